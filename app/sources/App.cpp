@@ -9,10 +9,15 @@
 
 #include "App.hpp"
 
-#include <fstream>
+#include <iostream>
 #include <sstream>
 #include <string>
 #include <set>
+#include <map>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <filesystem>
 
 #include "Options.hpp"
@@ -21,6 +26,16 @@
 #include "ConsoleColorizer.hpp"
 #include "FileHelper.hpp"
 #include "OutputFileParser.hpp"
+#include "BatchFileParser.hpp"
+#include "JobRunner.hpp"
+#include "StampCache.hpp"
+#include "DependencyFile.hpp"
+#include "CompilationDatabase.hpp"
+#include "WorkerProtocol.hpp"
+#include "FileWatcher.hpp"
+#include "Prelude.hpp"
+#include "CodeEmitter.hpp"
+#include "TimeReport.hpp"
 
 #include "VersionInfo.h"
 
@@ -28,18 +43,26 @@
 #define EXPECTATION_FILE_SUFFIX "_expect"
 #define IMPL_FILE_EXTENSION ".cpp"
 #define HEADER_FILE_EXTENSION ".hpp"
+#define DEPENDENCY_FILE_EXTENSION ".d"
 
 App::App( std::ostream &cout, std::ostream &cerr ) noexcept
-: m_cout(cout), m_cerr(cerr)
+: App( std::cin, cout, cerr )
 {
 }
 
-void App::PrintError( const char *msg ) noexcept
+App::App( std::istream &cin, std::ostream &cout, std::ostream &cerr ) noexcept
+: m_cin(cin), m_cout(cout), m_cerr(cerr)
+{
+}
+
+App::~App() = default;
+
+void App::PrintError( std::ostream &err, const char *msg ) noexcept
 {
     cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_RED );
-    m_cerr << "ERROR: ";
+    err << "ERROR: ";
     cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
-    m_cerr << msg << std::endl;
+    err << msg << std::endl;
 }
 
 static std::filesystem::path CombinePath( const std::filesystem::path &path, const char* fileSuffix )
@@ -66,250 +89,1153 @@ static std::filesystem::path CombinePath( const std::filesystem::path &path, con
     return ret;
 }
 
+/**
+ * Result of processing an input file.
+ */
+struct InputResult
+{
+    std::ostringstream output;
+    std::ostringstream error;
+    int returnCode = 0;
+};
+
+struct OutputBuffers
+{
+    CodeEmitter mock;
+    CodeEmitter expectationHeader;
+    CodeEmitter expectationImpl;
+};
+
+/**
+ * State of an execution, shared by all the input files processed.
+ */
+struct App::Execution
+{
+    Execution( Options &opts, std::ostream &outStream, std::ostream &errStream ) noexcept
+    : options( opts ), cout( outStream ), cerr( errStream )
+    {
+    }
+
+    Options &options;
+    std::ostream &cout;
+    std::ostream &cerr;
+
+    std::vector<BatchFileParser::Entry> inputs;
+    bool generateMock = false;
+    bool generateExpectation = false;
+    std::filesystem::path baseDirPath;
+    bool regenerate = false;
+    std::filesystem::path commonMockOutputPath;
+    std::filesystem::path commonExpectationOutputPath;
+    std::filesystem::path cacheDirPath;
+    std::filesystem::path compilationDatabasePath;
+    bool checkOnly = false;
+    bool generateDepFiles = false;
+    bool watch = false;
+    bool umbrella = false;
+    bool streaming = false;
+    std::string timeReportPath;
+    std::string tracePath;
+
+    std::unique_ptr<Prelude> prelude;
+    std::unique_ptr<StampCache> stampCache;
+    std::unique_ptr<CompilationDatabase> compilationDatabase;
+    std::vector<std::filesystem::path> umbrellaFilePaths;
+
+    // Configuration is shared by all the input files, so that options and configuration files are only processed once
+    std::once_flag configCreated;
+    std::unique_ptr<Config> config;
+    std::string genOpts;
+    std::vector<std::string> includePaths;
+    std::string signature;
+    std::string parsingSignature;
+    bool skipFunctionBodies = false;
+    bool singleFileParse = false;
+    bool simpleCParse = false;
+
+    std::unique_ptr<JobRunner> jobRunner;
+    unsigned int numThreads = 1;
+    unsigned int numGenerationThreads = 1;
+    bool bufferOutput = false;
+    std::shared_ptr<StringPool> stringPool;
+    std::vector<OutputBuffers> threadOutputBuffers;
+    std::vector<std::vector<std::filesystem::path>> inputDependencies;
+};
+
+/**
+ * State of the processing of an input file.
+ */
+struct App::InputFile
+{
+    std::filesystem::path path;
+    bool isCppHeader = false;
+    std::vector<std::string> compileArgs;
+    std::string argsSignature;
+
+    std::filesystem::path mockOutputFilePath;
+    std::filesystem::path expectationHeaderOutputFilePath;
+    std::filesystem::path expectationImplOutputFilePath;
+    std::string mockUserCode;
+    std::string regenerateOptions;
+    std::map<std::filesystem::path, std::vector<std::filesystem::path>> depFileTargets;
+    std::vector<std::filesystem::path> stampedFilePaths;
+    bool consoleOutput = false;
+
+    std::filesystem::path mockBaseDirPath;
+    std::filesystem::path expectBaseDirPath;
+    Parser::Outputs outputs = { nullptr, nullptr, nullptr };
+    std::unique_ptr<FileStreamWriter> mockWriter;
+    std::unique_ptr<FileStreamWriter> expectationHeaderWriter;
+    std::unique_ptr<FileStreamWriter> expectationImplWriter;
+
+    std::vector<std::filesystem::path> dependencies;
+};
+
+static std::string GetGenerationSignature( const std::string &genOpts, const std::vector<std::string> &includePaths,
+                                          const std::filesystem::path &baseDirPath, bool generateDepFiles,
+                                          const std::string &preludeContents )
+{
+    std::string signature = PRODUCT_NAME " v" PRODUCT_VERSION_STR "\n" + genOpts + "\n";
+
+    for( const std::string &includePath : includePaths )
+    {
+        signature += "-I " + includePath + "\n";
+    }
+
+    signature += "-B " + baseDirPath.generic_string() + "\n";
+
+    if( generateDepFiles )
+    {
+        signature += "--depfile\n";
+    }
+
+    if( !preludeContents.empty() )
+    {
+        signature += "--prelude\n" + preludeContents;
+    }
+
+    return signature;
+}
+
+static std::string GetParsingSignature( bool interpretAsCpp, const std::string &languageStandard, bool useUnderlyingTypedef,
+                                        bool skipFunctionBodies, bool singleFileParse, bool simpleCParse,
+                                        const std::vector<std::string> &typeMap, const std::vector<std::string> &includePaths,
+                                        const std::string &preludeContents )
+{
+    // Options that only affect how mocks and expectations are generated from the parsed model (e.g. type overrides,
+    // output paths or the base directory) are not part of the signature
+    std::string signature = PRODUCT_NAME " v" PRODUCT_VERSION_STR "\n";
+
+    signature += ( interpretAsCpp ? "-x\n" : "" );
+    signature += "-s " + languageStandard + "\n";
+    signature += ( useUnderlyingTypedef ? "-u\n" : "" );
+    // Options that only make parsing faster are not part of the generation options written into the outputs, but the
+    // models parsed with them may still differ (e.g. in the dependencies recorded)
+    signature += ( skipFunctionBodies ? "--fast-parse\n" : "" );
+    signature += ( simpleCParse ? "--simple-c\n" : "" );
+
+    // The type map is only used when parsing single files
+    if( singleFileParse )
+    {
+        signature += "--single-file\n";
+        for( const std::string &typeMapEntry : typeMap )
+        {
+            signature += "--type-map " + typeMapEntry + "\n";
+        }
+    }
+
+    for( const std::string &includePath : includePaths )
+    {
+        signature += "-I " + includePath + "\n";
+    }
+
+    if( !preludeContents.empty() )
+    {
+        signature += "--prelude\n" + preludeContents;
+    }
+
+    return signature;
+}
+
+static bool WriteOutputFile( const std::filesystem::path &path, const std::string &contents, const char *description )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::FILE_WRITE );
+
+    WriteResult writeResult = WriteFileIfChanged( path, contents );
+    if( writeResult == WriteResult::FAILED )
+    {
+        std::string errorMsg = std::string( description ) + " '" + path.generic_string() + "' could not be written.";
+        throw std::runtime_error( errorMsg );
+    }
+
+    return ( writeResult == WriteResult::WRITTEN );
+}
+
+static bool CommitOutputFile( FileStreamWriter &writer, const std::filesystem::path &path, const char *description )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::FILE_WRITE );
+
+    WriteResult writeResult = writer.Commit();
+    if( writeResult == WriteResult::FAILED )
+    {
+        std::string errorMsg = std::string( description ) + " '" + path.generic_string() + "' could not be written.";
+        throw std::runtime_error( errorMsg );
+    }
+
+    return ( writeResult == WriteResult::WRITTEN );
+}
+
+static std::filesystem::path NormalizePath( const std::filesystem::path &path )
+{
+    return std::filesystem::absolute( path ).lexically_normal();
+}
+
+static bool IsCommonOutputPathUsable( const std::filesystem::path &path )
+{
+    return ( path.empty() || IsDirPath( path ) || ( path == "@" ) );
+}
+
 int App::Execute( int argc, const char* argv[] ) noexcept
+{
+    return Execute( argc, argv, m_cout, m_cerr, false );
+}
+
+int App::RunWorker() noexcept
+{
+    std::string line;
+    while( std::getline( m_cin, line ) )
+    {
+        if( line.find_first_not_of( " \t\r" ) == std::string::npos )
+        {
+            continue;
+        }
+
+        WorkerProtocol::Response response = { 0, "", 0 };
+        std::ostringstream output;
+
+        try
+        {
+            WorkerProtocol::Request request = WorkerProtocol::ParseRequest( line );
+            response.requestId = request.requestId;
+
+            std::vector<const char*> argv = { PRODUCT_NAME };
+            for( const std::string &argument : request.arguments )
+            {
+                argv.push_back( argument.c_str() );
+            }
+            argv.push_back( nullptr );
+
+            // Console outputs and diagnostics are both reported in the response output
+            response.exitCode = Execute( (int) argv.size() - 1, argv.data(), output, output, true );
+        }
+        catch( std::exception &e )
+        {
+            PrintError( output, e.what() );
+            response.exitCode = 1;
+        }
+
+        response.output = output.str();
+        m_cout << WorkerProtocol::FormatResponse( response ) << std::endl;
+    }
+
+    return 0;
+}
+
+int App::Execute( int argc, const char* argv[], std::ostream &cout, std::ostream &cerr, bool isWorkerRequest ) noexcept
 {
     int returnCode = 0;
 
     Options options;
 
+    // Parsing of options is measured before knowing if the time report is requested
+    TimeReport timeReport;
+
     try
     {
-        options.Parse( argc, argv );
+        {
+            TimeReport::Scope timeScope( TimeReport::Phase::OPTIONS, &timeReport );
+            options.Parse( argc, argv );
+        }
 
         if( options.IsHelpRequested() )
         {
-            m_cout << options.GetHelpText();
+            cout << options.GetHelpText();
             return 0;
         }
 
         if( options.IsVersionRequested() )
         {
-            m_cout << PRODUCT_NAME " v" PRODUCT_VERSION_STR << std::endl;
+            cout << PRODUCT_NAME " v" PRODUCT_VERSION_STR << std::endl;
             return 0;
         }
 
-        std::filesystem::path inputFilePath = options.GetInputPath();
-        if( inputFilePath.empty() )
+        if( options.IsWorkerRequested() )
         {
-            throw std::runtime_error( "No input file specified." );
+            if( isWorkerRequest )
+            {
+                throw std::runtime_error( "The worker option (--worker) cannot be used in worker requests." );
+            }
+
+            return RunWorker();
         }
 
-        bool generateMock = options.IsMockRequested();
-        bool generateExpectation = options.IsExpectationsRequested();
-        if( !( generateMock || generateExpectation ) )
+        Execution execution( options, cout, cerr );
+
+        ReadInputs( execution );
+        ReadOptions( execution, isWorkerRequest );
+        Prepare( execution, timeReport );
+
+        std::vector<size_t> inputIndexes( execution.inputs.size() );
+        std::iota( inputIndexes.begin(), inputIndexes.end(), 0 );
+        ProcessInputs( execution, inputIndexes, returnCode );
+
+        // In watch mode the time report and the trace only cover the initial processing of the input files
+        timeReport.Deactivate();
+
+        WriteTimeReport( execution, timeReport );
+
+        if( execution.watch )
         {
-            throw std::runtime_error( "At least the mock generation option (-m) or the expectation generation option (-e) must be specified." );
+            Watch( execution, returnCode );
         }
-
-        std::filesystem::path baseDirPath = options.GetBaseDirectory();
-        if( !baseDirPath.empty() && !IsDirPath( baseDirPath ) )
+    }
+    catch(std::exception &e)
+    {
+        PrintError( cerr, e.what() );
+        if( !returnCode )
         {
-            std::string errorMsg = "Base directory path '" + baseDirPath.generic_string() + "' is not an existing directory.";
-            throw std::runtime_error( errorMsg );
+            returnCode = 1;
         }
+    }
+
+    return returnCode;
+}
+
+void App::ReadInputs( Execution &execution )
+{
+    for( const std::string &inputPath : execution.options.GetInputPaths() )
+    {
+        execution.inputs.push_back( { inputPath, "", "" } );
+    }
+
+    std::string batchFilePath = execution.options.GetBatchFilePath();
+    if( !batchFilePath.empty() )
+    {
+        BatchFileParser batchFileParser;
+        batchFileParser.Parse( batchFilePath );
+        const std::vector<BatchFileParser::Entry> &batchEntries = batchFileParser.GetEntries();
+        execution.inputs.insert( execution.inputs.end(), batchEntries.begin(), batchEntries.end() );
+    }
+
+    if( execution.inputs.empty() )
+    {
+        throw std::runtime_error( "No input file specified." );
+    }
+}
+
+void App::ReadOptions( Execution &execution, bool isWorkerRequest )
+{
+    Options &options = execution.options;
 
-        bool regenerate = options.IsRegenerationRequested();
-        std::string regenerateOptions;
+    execution.generateMock = options.IsMockRequested();
+    execution.generateExpectation = options.IsExpectationsRequested();
+    if( !( execution.generateMock || execution.generateExpectation ) )
+    {
+        throw std::runtime_error( "At least the mock generation option (-m) or the expectation generation option (-e) must be specified." );
+    }
 
-        std::filesystem::path mockOutputFilePath = options.GetMockOutputPath();
-        std::filesystem::path expectationHeaderOutputFilePath = options.GetExpectationsOutputPath();
-        if( generateMock && generateExpectation )
+    execution.baseDirPath = options.GetBaseDirectory();
+    if( !execution.baseDirPath.empty() && !IsDirPath( execution.baseDirPath ) )
+    {
+        std::string errorMsg = "Base directory path '" + execution.baseDirPath.generic_string() + "' is not an existing directory.";
+        throw std::runtime_error( errorMsg );
+    }
+
+    execution.regenerate = options.IsRegenerationRequested();
+    if( execution.regenerate && ( execution.inputs.size() > 1 ) )
+    {
+        throw std::runtime_error( "The regeneration option (-r) can only be used with a single input file." );
+    }
+
+    std::filesystem::path &commonMockOutputPath = execution.commonMockOutputPath;
+    std::filesystem::path &commonExpectationOutputPath = execution.commonExpectationOutputPath;
+    commonMockOutputPath = options.GetMockOutputPath();
+    commonExpectationOutputPath = options.GetExpectationsOutputPath();
+    if( execution.generateMock && execution.generateExpectation )
+    {
+        // Use common mock/expection generation path if one is passed explicitly but not the other.
+        if( commonMockOutputPath.empty() && !commonExpectationOutputPath.empty() )
+        {
+            commonMockOutputPath = CombinePath( commonExpectationOutputPath, MOCK_FILE_SUFFIX );
+        }
+        else if( commonExpectationOutputPath.empty() && !commonMockOutputPath.empty() )
         {
-            // Use common mock/expection generation path if one is passed explicitly but not the other.
-            if( mockOutputFilePath.empty() && !expectationHeaderOutputFilePath.empty() )
+            commonExpectationOutputPath = CombinePath( commonMockOutputPath, EXPECTATION_FILE_SUFFIX );
+        }
+    }
+
+    if( execution.inputs.size() > 1 )
+    {
+        // When several inputs share the common output paths, they must be directories to avoid overwriting outputs
+        for( const BatchFileParser::Entry &input : execution.inputs )
+        {
+            if( execution.generateMock && input.mockOutputPath.empty() && !IsCommonOutputPathUsable( commonMockOutputPath ) )
             {
-                mockOutputFilePath = CombinePath( expectationHeaderOutputFilePath, MOCK_FILE_SUFFIX );
+                std::string errorMsg = "Mock output path '" + commonMockOutputPath.generic_string() + "' must be a directory when processing several input files.";
+                throw std::runtime_error( errorMsg );
             }
-            else if( expectationHeaderOutputFilePath.empty() && !mockOutputFilePath.empty() )
+
+            if( execution.generateExpectation && input.expectationsOutputPath.empty() && !IsCommonOutputPathUsable( commonExpectationOutputPath ) )
             {
-                expectationHeaderOutputFilePath = CombinePath( mockOutputFilePath, EXPECTATION_FILE_SUFFIX );
+                std::string errorMsg = "Expectation output path '" + commonExpectationOutputPath.generic_string() + "' must be a directory when processing several input files.";
+                throw std::runtime_error( errorMsg );
             }
         }
+    }
 
-        std::ofstream mockOutputStream;
-        std::string mockUserCode;
-        if( generateMock )
+    execution.cacheDirPath = options.GetCacheDirectory();
+    execution.compilationDatabasePath = options.GetCompilationDatabasePath();
+    execution.checkOnly = options.IsCheckRequested();
+    if( execution.checkOnly && execution.cacheDirPath.empty() )
+    {
+        throw std::runtime_error( "The check option (--check) requires a cache directory (--cache-dir)." );
+    }
+
+    execution.generateDepFiles = options.IsDepFileRequested();
+
+    execution.watch = options.IsWatchRequested();
+    if( execution.watch && isWorkerRequest )
+    {
+        throw std::runtime_error( "The watch option (--watch) cannot be used in worker requests." );
+    }
+    if( execution.watch && execution.checkOnly )
+    {
+        throw std::runtime_error( "The watch option (--watch) cannot be used with the check option (--check)." );
+    }
+
+    CreatePrelude( execution );
+
+    execution.umbrella = options.IsUmbrellaParseRequested();
+    if( execution.umbrella && execution.watch )
+    {
+        throw std::runtime_error( "The umbrella option (--umbrella) cannot be used with the watch option (--watch)." );
+    }
+
+    // In streaming mode the outputs are generated while parsing each input file, which is not possible when input
+    // files are parsed together, and would not bound memory when translation units are kept
+    execution.streaming = options.IsStreamingRequested();
+    if( execution.streaming && execution.umbrella )
+    {
+        throw std::runtime_error( "The streaming option (--stream) cannot be used with the umbrella option (--umbrella)." );
+    }
+    if( execution.streaming && execution.watch )
+    {
+        throw std::runtime_error( "The streaming option (--stream) cannot be used with the watch option (--watch)." );
+    }
+
+    execution.timeReportPath = options.GetTimeReportPath();
+    execution.tracePath = options.GetTracePath();
+}
+
+void App::CreatePrelude( Execution &execution )
+{
+    // The prelude is precompiled only once for each set of parsing flags, and then shared by all the input files
+    std::vector<std::string> preludeHeaders = execution.options.GetPreludeHeaders();
+    bool autoPrelude = execution.options.IsAutoPreludeRequested();
+    if( !preludeHeaders.empty() || autoPrelude )
+    {
+        execution.prelude = std::make_unique<Prelude>( preludeHeaders );
+        if( autoPrelude )
         {
-            if( mockOutputFilePath != "@" )
+            std::vector<std::filesystem::path> inputFilePaths;
+            for( const BatchFileParser::Entry &input : execution.inputs )
             {
-                if( mockOutputFilePath.empty() || IsDirPath(mockOutputFilePath) )
-                {
-                    ConvertToDirPath( mockOutputFilePath );
-                    mockOutputFilePath /= inputFilePath.filename().stem();
-                    mockOutputFilePath += MOCK_FILE_SUFFIX IMPL_FILE_EXTENSION;
-                }
-                else if( !HasCppImplExtension( mockOutputFilePath ) )
-                {
-                    mockOutputFilePath += IMPL_FILE_EXTENSION;
-                }
+                inputFilePaths.push_back( input.inputPath );
+            }
+            execution.prelude->AddCommonIncludes( inputFilePaths );
+        }
+        if( execution.prelude->IsEmpty() )
+        {
+            execution.prelude.reset();
+        }
+    }
+}
 
-                OutputFileParser outputFileParser;
-                outputFileParser.Parse( mockOutputFilePath );
-                mockUserCode = outputFileParser.GetUserCode();
-                if( regenerate )
-                {
-                    regenerateOptions = outputFileParser.GetGenerationOptions();
-                }
+void App::Prepare( Execution &execution, TimeReport &timeReport )
+{
+    // Traces are recorded on the same phases measured for the time report
+    if( !execution.tracePath.empty() )
+    {
+        timeReport.EnableTrace();
+    }
+    if( !execution.timeReportPath.empty() || !execution.tracePath.empty() )
+    {
+        timeReport.Activate();
+    }
 
-                mockOutputStream.open( mockOutputFilePath );
-                if( !mockOutputStream.is_open() )
-                {
-                    std::string errorMsg = "Mock output file '" + mockOutputFilePath.generic_string() + "' could not be opened.";
-                    throw std::runtime_error( errorMsg );
-                }
+    if( !execution.cacheDirPath.empty() )
+    {
+        execution.stampCache = std::make_unique<StampCache>( execution.cacheDirPath );
+    }
+
+    // The compilation database is loaded and indexed only once, and then shared by all the input files
+    if( !execution.compilationDatabasePath.empty() )
+    {
+        execution.compilationDatabase = std::make_unique<CompilationDatabase>( execution.compilationDatabasePath );
+    }
+
+    // In umbrella mode the input files are parsed together in a single translation unit, except the ones with flags
+    // taken from the compilation database, since they may be different for each input file
+    if( execution.umbrella )
+    {
+        for( const BatchFileParser::Entry &input : execution.inputs )
+        {
+            if( !execution.compilationDatabase || !execution.compilationDatabase->GetFlags( input.inputPath ) )
+            {
+                execution.umbrellaFilePaths.push_back( input.inputPath );
             }
         }
+    }
 
-        std::filesystem::path expectationImplOutputFilePath;
-        std::ofstream expectationHeaderOutputStream;
-        std::ofstream expectationImplOutputStream;
-        if( generateExpectation )
+    // Each worker thread owns its parser (and therefore its libclang index), because libclang is only thread-safe per
+    // index. In watch mode each input file owns its parser instead, which keeps the translation unit of the input file
+    // to reparse it incrementally when it changes. In umbrella mode a single parser is used, which parses the umbrella
+    // translation unit only once.
+    execution.numThreads = JobRunner( execution.options.GetNumJobs() ).GetNumThreads();
+    execution.jobRunner = std::make_unique<JobRunner>( execution.umbrella ? 1 : execution.numThreads );
+    unsigned int numJobThreads = execution.jobRunner->GetNumThreads();
+    execution.bufferOutput = ( ( numJobThreads > 1 ) && ( execution.inputs.size() > 1 ) );
+
+    size_t numParsers = ( execution.watch ? execution.inputs.size() : numJobThreads );
+    if( m_parsers.size() < numParsers )
+    {
+        m_parsers.resize( numParsers );
+    }
+    // The strings of the models of the parsed functions are shared by all the input files
+    execution.stringPool = std::make_shared<StringPool>();
+    for( std::unique_ptr<Parser> &parser : m_parsers )
+    {
+        if( parser )
         {
-            if( expectationHeaderOutputFilePath != "@" )
-            {
-                if( expectationHeaderOutputFilePath.empty() || IsDirPath(expectationHeaderOutputFilePath) )
-                {
-                    ConvertToDirPath( expectationHeaderOutputFilePath );
-                    expectationHeaderOutputFilePath /= inputFilePath.stem();
-                    expectationImplOutputFilePath = expectationHeaderOutputFilePath;
-                    expectationHeaderOutputFilePath += EXPECTATION_FILE_SUFFIX HEADER_FILE_EXTENSION;
-                    expectationImplOutputFilePath += EXPECTATION_FILE_SUFFIX IMPL_FILE_EXTENSION;
-                }
-                else
-                {
-                    if( HasCppExtension( expectationHeaderOutputFilePath ) )
-                    {
-                        expectationHeaderOutputFilePath = expectationHeaderOutputFilePath.parent_path() / expectationHeaderOutputFilePath.stem();
-                    }
-
-                    expectationImplOutputFilePath = expectationHeaderOutputFilePath;
-                    expectationHeaderOutputFilePath += HEADER_FILE_EXTENSION;
-                    expectationImplOutputFilePath += IMPL_FILE_EXTENSION;
-                }
+            parser->SetUmbrellaFiles( execution.umbrellaFilePaths );
+            parser->SetStringPool( execution.stringPool );
+        }
+    }
 
-                expectationHeaderOutputStream.open( expectationHeaderOutputFilePath );
-                if( !expectationHeaderOutputStream.is_open() )
-                {
-                    std::string errorMsg = "Expectation header output file '" + expectationHeaderOutputFilePath.generic_string() + "' could not be opened.";
-                    throw std::runtime_error( errorMsg );
-                }
+    execution.inputDependencies = std::vector<std::vector<std::filesystem::path>>( execution.inputs.size() );
+    execution.threadOutputBuffers = std::vector<OutputBuffers>( numJobThreads );
+}
 
-                if( regenerate && regenerateOptions.empty() )
-                {
-                    OutputFileParser headerFileParser;
-                    headerFileParser.Parse( expectationHeaderOutputFilePath );
-                    regenerateOptions = headerFileParser.GetGenerationOptions();
-
-                    if( regenerateOptions.empty() )
-                    {
-                        OutputFileParser implFileParser;
-                        implFileParser.Parse( expectationImplOutputFilePath );
-                        regenerateOptions = implFileParser.GetGenerationOptions();
-                    }
-                }
+void App::ProcessInputs( Execution &execution, const std::vector<size_t> &inputIndexes, int &returnCode )
+{
+    const JobRunner &jobRunner = *execution.jobRunner;
 
-                expectationImplOutputStream.open( expectationImplOutputFilePath );
-                // LCOV_EXCL_START: Defensive
-                if( !expectationImplOutputStream.is_open() )
-                {
-                    std::string errorMsg = "Expectation implementation output file '" + expectationImplOutputFilePath.generic_string() + "' could not be opened.";
-                    throw std::runtime_error( errorMsg );
-                }
-                // LCOV_EXCL_STOP
+    // The code for input files with many functions is also generated in parallel, but only while input files are not
+    // processed in parallel (i.e. when a single input file is processed, or in umbrella mode), so that the threads used
+    // for each input file do not multiply the threads used for input files.
+    execution.numGenerationThreads = ( ( jobRunner.GetNumThreads() > 1 ) && ( inputIndexes.size() > 1 ) ) ? 1 : execution.numThreads;
+
+    std::vector<InputResult> results( inputIndexes.size() );
+
+    jobRunner.Run( inputIndexes.size(),
+                   [&]( size_t jobIndex, unsigned int threadIndex )
+                   {
+                       InputResult &result = results[ jobIndex ];
+
+                       // When processing input files in parallel, output is buffered to be printed in input order afterwards
+                       std::ostream &out = ( execution.bufferOutput ? result.output : execution.cout );
+                       std::ostream &err = ( execution.bufferOutput ? result.error : execution.cerr );
+
+                       result.returnCode = ProcessInput( execution, inputIndexes[ jobIndex ], threadIndex, out, err );
+                   },
+                   [&]( size_t jobIndex )
+                   {
+                       InputResult &result = results[ jobIndex ];
+
+                       execution.cout << result.output.str();
+                       execution.cerr << result.error.str();
+
+                       // Errors processing an input file do not prevent processing the rest of input files
+                       if( !returnCode )
+                       {
+                           returnCode = result.returnCode;
+                       }
+                   } );
+}
+
+int App::ProcessInput( Execution &execution, size_t inputIndex, unsigned int threadIndex, std::ostream &out, std::ostream &err )
+{
+    int returnCode = 0;
+
+    InputFile inputFile;
+    inputFile.path = execution.inputs[ inputIndex ].inputPath;
+
+    TimeReport::Scope timeScope( TimeReport::Phase::INPUT_FILE, execution.inputs[ inputIndex ].inputPath );
+    TimeReport::Count( TimeReport::Counter::INPUT_FILES );
+
+    try
+    {
+        GetOutputFiles( execution, inputIndex, inputFile );
+
+        // The configuration is created when processing the first input file, since regeneration options are taken from
+        // its output files
+        std::call_once( execution.configCreated, [&]()
+        {
+            CreateConfig( execution, inputFile.regenerateOptions );
+        } );
+
+        GetCompileArgs( execution, inputFile );
+
+        std::string inputSignature = execution.signature + inputFile.argsSignature;
+
+        // Parsing the input file is skipped when neither the input file, its dependencies, the outputs nor the
+        // generation options changed since the outputs were generated (except in watch mode, where input files must be
+        // parsed to find out their dependencies)
+        if( !inputFile.stampedFilePaths.empty() && !execution.watch &&
+            execution.stampCache->IsUpToDate( inputFile.stampedFilePaths, inputSignature ) )
+        {
+            cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_GREEN );
+            err << "UP-TO-DATE: ";
+            cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+            err << "Outputs for input file '" << inputFile.path.generic_string() << "' are up to date" << std::endl;
+            return returnCode;
+        }
+
+        if( execution.checkOnly )
+        {
+            if( inputFile.consoleOutput )
+            {
+                throw std::runtime_error( "Outputs printed to the console cannot be checked." );
             }
+
+            cerrColorizer.SetColor( ConsoleColorizer::Color::YELLOW );
+            err << "OUT-OF-DATE: ";
+            cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+            err << "Outputs for input file '" << inputFile.path.generic_string() << "' are out of date" << std::endl;
+            return 3;
+        }
+
+        Parser &parser = GetParser( execution, ( execution.watch ? inputIndex : threadIndex ) );
+        parser.SetNumGenerationThreads( execution.numGenerationThreads );
+        parser.SetModelSaved( execution.stampCache && !execution.watch && !execution.streaming ); // See ParseInput()
+
+        inputFile.mockBaseDirPath = execution.baseDirPath;
+        if( inputFile.mockBaseDirPath.empty() )
+        {
+            inputFile.mockBaseDirPath = inputFile.mockOutputFilePath.parent_path();
         }
 
-        if( regenerate )
+        inputFile.expectBaseDirPath = execution.baseDirPath;
+        if( inputFile.expectBaseDirPath.empty() )
         {
-            options.Parse( regenerateOptions );
+            inputFile.expectBaseDirPath = inputFile.expectationHeaderOutputFilePath.parent_path();
         }
 
-        bool isCppHeader = HasCppHeaderExtension( inputFilePath );
+        // Each output is generated into a buffer that is reused for all the input files processed by the same thread,
+        // and then written at once
+        OutputBuffers &outputBuffers = execution.threadOutputBuffers[ threadIndex ];
+        outputBuffers.mock.Clear();
+        outputBuffers.expectationHeader.Clear();
+        outputBuffers.expectationImpl.Clear();
+
+        inputFile.outputs = { ( execution.generateMock ? &outputBuffers.mock : nullptr ),
+                              ( execution.generateExpectation ? &outputBuffers.expectationHeader : nullptr ),
+                              ( execution.generateExpectation ? &outputBuffers.expectationImpl : nullptr ) };
 
-        Config config( options.InterpretAsCpp(),
-                       options.GetLanguageStandard(),
-                       options.UseUnderlyingTypedef(),
-                       options.GetTypeOverrides() );
+        if( execution.streaming )
+        {
+            StartStreaming( execution, parser, inputFile );
+        }
 
-        std::string genOpts = options.GetGenerationOptions();
+        bool parsed = ParseInput( execution, parser, inputFile, err );
 
-        Parser parser;
+        if( execution.watch )
+        {
+            execution.inputDependencies[ inputIndex ] = inputFile.dependencies;
+        }
+
+        if( !parsed )
+        {
+            returnCode = 2;
+            std::string errorMsg = "Output could not be generated due to errors parsing the input file '" + inputFile.path.generic_string() + "'.";
+            throw std::runtime_error( errorMsg );
+        }
 
-        if( parser.Parse( inputFilePath, config, isCppHeader, options.GetIncludePaths(), m_cerr ) )
+        if( !execution.streaming )
         {
-            if( generateMock )
+            parser.Generate( execution.genOpts, inputFile.mockUserCode, inputFile.mockBaseDirPath, inputFile.expectBaseDirPath,
+                             inputFile.expectationHeaderOutputFilePath, inputFile.outputs );
+        }
+
+        WriteOutputs( execution, inputFile, out, err );
+
+        for( const auto &depFile : inputFile.depFileTargets )
+        {
+            DependencyFile dependencyFile( depFile.second );
+            WriteOutputFile( depFile.first, dependencyFile.Generate( inputFile.dependencies ), "Dependency file" );
+        }
+
+        if( !inputFile.stampedFilePaths.empty() )
+        {
+            execution.stampCache->Update( inputFile.stampedFilePaths, inputSignature, inputFile.dependencies );
+        }
+    }
+    catch(std::exception &e)
+    {
+        PrintError( err, e.what() );
+        if( !returnCode )
+        {
+            returnCode = 1;
+        }
+    }
+
+    return returnCode;
+}
+
+void App::GetOutputFiles( const Execution &execution, size_t inputIndex, InputFile &inputFile )
+{
+    const BatchFileParser::Entry &input = execution.inputs[ inputIndex ];
+
+    std::filesystem::path &mockOutputFilePath = inputFile.mockOutputFilePath;
+    std::filesystem::path &expectationHeaderOutputFilePath = inputFile.expectationHeaderOutputFilePath;
+    std::filesystem::path &expectationImplOutputFilePath = inputFile.expectationImplOutputFilePath;
+
+    mockOutputFilePath = execution.commonMockOutputPath;
+    expectationHeaderOutputFilePath = execution.commonExpectationOutputPath;
+    if( !input.mockOutputPath.empty() )
+    {
+        mockOutputFilePath = input.mockOutputPath;
+    }
+    if( !input.expectationsOutputPath.empty() )
+    {
+        expectationHeaderOutputFilePath = input.expectationsOutputPath;
+    }
+
+    if( execution.generateMock )
+    {
+        if( mockOutputFilePath != "@" )
+        {
+            if( mockOutputFilePath.empty() || IsDirPath(mockOutputFilePath) )
+            {
+                ConvertToDirPath( mockOutputFilePath );
+                mockOutputFilePath /= inputFile.path.filename().stem();
+                mockOutputFilePath += MOCK_FILE_SUFFIX IMPL_FILE_EXTENSION;
+            }
+            else if( !HasCppImplExtension( mockOutputFilePath ) )
+            {
+                mockOutputFilePath += IMPL_FILE_EXTENSION;
+            }
+
+            OutputFileParser outputFileParser;
+            outputFileParser.Parse( mockOutputFilePath );
+            inputFile.mockUserCode = outputFileParser.GetUserCode();
+            if( execution.regenerate )
+            {
+                inputFile.regenerateOptions = outputFileParser.GetGenerationOptions();
+            }
+        }
+    }
+
+    if( execution.generateExpectation )
+    {
+        if( expectationHeaderOutputFilePath != "@" )
+        {
+            if( expectationHeaderOutputFilePath.empty() || IsDirPath(expectationHeaderOutputFilePath) )
+            {
+                ConvertToDirPath( expectationHeaderOutputFilePath );
+                expectationHeaderOutputFilePath /= inputFile.path.stem();
+                expectationImplOutputFilePath = expectationHeaderOutputFilePath;
+                expectationHeaderOutputFilePath += EXPECTATION_FILE_SUFFIX HEADER_FILE_EXTENSION;
+                expectationImplOutputFilePath += EXPECTATION_FILE_SUFFIX IMPL_FILE_EXTENSION;
+            }
+            else
             {
-                std::filesystem::path mockBaseDirPath = baseDirPath;
-                if( mockBaseDirPath.empty() )
+                if( HasCppExtension( expectationHeaderOutputFilePath ) )
                 {
-                    mockBaseDirPath = mockOutputFilePath.parent_path();
+                    expectationHeaderOutputFilePath = expectationHeaderOutputFilePath.parent_path() / expectationHeaderOutputFilePath.stem();
                 }
 
-                std::ostringstream output;
-                parser.GenerateMock( genOpts, mockUserCode, mockBaseDirPath, output );
+                expectationImplOutputFilePath = expectationHeaderOutputFilePath;
+                expectationHeaderOutputFilePath += HEADER_FILE_EXTENSION;
+                expectationImplOutputFilePath += IMPL_FILE_EXTENSION;
+            }
 
-                if( mockOutputStream.is_open() )
-                {
-                    mockOutputStream << output.str();
+            if( execution.regenerate && inputFile.regenerateOptions.empty() )
+            {
+                OutputFileParser headerFileParser;
+                headerFileParser.Parse( expectationHeaderOutputFilePath );
+                inputFile.regenerateOptions = headerFileParser.GetGenerationOptions();
 
-                    cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_GREEN );
-                    m_cerr << "SUCCESS: ";
-                    cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
-                    m_cerr << "Mock generated into '" << mockOutputFilePath.generic_string() << "'" << std::endl;
-                }
-                else
+                if( inputFile.regenerateOptions.empty() )
                 {
-                    m_cout << output.str();
+                    OutputFileParser implFileParser;
+                    implFileParser.Parse( expectationImplOutputFilePath );
+                    inputFile.regenerateOptions = implFileParser.GetGenerationOptions();
                 }
             }
+        }
+    }
+
+    // Outputs printed to the console have no dependency file, since there is no target to depend on
+    if( execution.generateDepFiles )
+    {
+        if( execution.generateMock && ( mockOutputFilePath != "@" ) )
+        {
+            std::filesystem::path depFilePath = mockOutputFilePath;
+            depFilePath.replace_extension( DEPENDENCY_FILE_EXTENSION );
+            inputFile.depFileTargets[ depFilePath ].push_back( mockOutputFilePath );
+        }
+        if( execution.generateExpectation && ( expectationHeaderOutputFilePath != "@" ) )
+        {
+            std::filesystem::path depFilePath = expectationHeaderOutputFilePath;
+            depFilePath.replace_extension( DEPENDENCY_FILE_EXTENSION );
+            inputFile.depFileTargets[ depFilePath ].push_back( expectationHeaderOutputFilePath );
+            inputFile.depFileTargets[ depFilePath ].push_back( expectationImplOutputFilePath );
+        }
+    }
+
+    // Outputs printed to the console are not stamped, since they are not kept
+    inputFile.consoleOutput = ( ( execution.generateMock && ( mockOutputFilePath == "@" ) ) ||
+                                ( execution.generateExpectation && ( expectationHeaderOutputFilePath == "@" ) ) );
+    if( execution.stampCache && !inputFile.consoleOutput )
+    {
+        if( execution.generateMock )
+        {
+            inputFile.stampedFilePaths.push_back( mockOutputFilePath );
+        }
+        if( execution.generateExpectation )
+        {
+            inputFile.stampedFilePaths.push_back( expectationHeaderOutputFilePath );
+            inputFile.stampedFilePaths.push_back( expectationImplOutputFilePath );
+        }
+        for( const auto &depFile : inputFile.depFileTargets )
+        {
+            inputFile.stampedFilePaths.push_back( depFile.first );
+        }
+    }
+}
+
+void App::CreateConfig( Execution &execution, const std::string &regenerateOptions )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::OPTIONS );
+
+    Options &options = execution.options;
+
+    if( execution.regenerate )
+    {
+        options.Parse( regenerateOptions );
+    }
+
+    bool interpretAsCpp = options.InterpretAsCpp();
+    std::string languageStandard = options.GetLanguageStandard();
+    bool useUnderlyingTypedef = options.UseUnderlyingTypedef();
+    execution.skipFunctionBodies = options.IsFastParseRequested();
+    execution.singleFileParse = options.IsSingleFileParseRequested();
+    execution.simpleCParse = options.IsSimpleCParseRequested();
+    std::vector<std::string> typeMap = options.GetTypeMap();
+
+    // Included files are not processed when parsing single files, hence they cannot be precompiled
+    if( execution.singleFileParse && execution.prelude )
+    {
+        throw std::runtime_error( "The prelude options (--prelude, --auto-prelude) cannot be used with the single file option (--single-file)." );
+    }
+
+    // The umbrella translation unit is made of include directives, which are not processed in single file mode
+    if( execution.singleFileParse && execution.umbrella )
+    {
+        throw std::runtime_error( "The umbrella option (--umbrella) cannot be used with the single file option (--single-file)." );
+    }
+
+    execution.config = std::make_unique<Config>( interpretAsCpp,
+                                                 languageStandard,
+                                                 useUnderlyingTypedef,
+                                                 options.GetTypeOverrides(),
+                                                 typeMap );
+
+    execution.genOpts = options.GetGenerationOptions();
+    execution.includePaths = options.GetIncludePaths();
+
+    std::string preludeContents = ( execution.prelude ? execution.prelude->GetContents() : "" );
+    execution.signature = GetGenerationSignature( execution.genOpts, execution.includePaths, execution.baseDirPath,
+                                                  execution.generateDepFiles, preludeContents );
+    execution.parsingSignature = GetParsingSignature( interpretAsCpp, languageStandard, useUnderlyingTypedef,
+                                                      execution.skipFunctionBodies, execution.singleFileParse,
+                                                      execution.simpleCParse, typeMap, execution.includePaths, preludeContents );
+}
+
+void App::GetCompileArgs( const Execution &execution, InputFile &inputFile )
+{
+    inputFile.isCppHeader = HasCppHeaderExtension( inputFile.path );
+
+    if( execution.compilationDatabase )
+    {
+        const CompilationDatabase::Flags *flags = execution.compilationDatabase->GetFlags( inputFile.path );
+        if( flags )
+        {
+            inputFile.compileArgs = flags->args;
+            inputFile.isCppHeader = inputFile.isCppHeader || flags->isCpp;
+        }
+    }
+
+    // Flags taken from the compilation database may be different for each input file
+    for( const std::string &compileArg : inputFile.compileArgs )
+    {
+        inputFile.argsSignature += compileArg + "\n";
+    }
+    if( inputFile.isCppHeader )
+    {
+        inputFile.argsSignature += "-xc++\n";
+    }
+}
+
+Parser& App::GetParser( Execution &execution, size_t parserIndex )
+{
+    std::unique_ptr<Parser> &parser = m_parsers[ parserIndex ];
+
+    // Parsers are kept between requests in worker mode, which may use a different parsing mode
+    if( !parser || ( parser->SkipsFunctionBodies() != execution.skipFunctionBodies ) ||
+        ( parser->ParsesSingleFile() != execution.singleFileParse ) ||
+        ( parser->ParsesSimpleC() != execution.simpleCParse ) )
+    {
+        parser = std::make_unique<Parser>( execution.watch, execution.skipFunctionBodies, execution.singleFileParse,
+                                           execution.simpleCParse );
+        parser->SetUmbrellaFiles( execution.umbrellaFilePaths );
+        parser->SetStringPool( execution.stringPool );
+    }
 
-            if( generateExpectation )
+    return *parser;
+}
+
+void App::StartStreaming( const Execution &execution, Parser &parser, InputFile &inputFile )
+{
+    // In streaming mode the outputs are generated while parsing the input file instead, and written in chunks into
+    // temporary files, which replace the output files once the input file has been parsed
+    if( execution.generateMock && ( inputFile.mockOutputFilePath != "@" ) )
+    {
+        inputFile.mockWriter = std::make_unique<FileStreamWriter>( inputFile.mockOutputFilePath );
+    }
+    if( execution.generateExpectation && ( inputFile.expectationHeaderOutputFilePath != "@" ) )
+    {
+        inputFile.expectationHeaderWriter = std::make_unique<FileStreamWriter>( inputFile.expectationHeaderOutputFilePath );
+        inputFile.expectationImplWriter = std::make_unique<FileStreamWriter>( inputFile.expectationImplOutputFilePath );
+    }
+
+    // Outputs printed to the console are not flushed, since they are printed one after the other
+    auto flushOutput = []( CodeEmitter *output, FileStreamWriter *writer )
+    {
+        if( output && writer )
+        {
+            TimeReport::Scope timeScope( TimeReport::Phase::FILE_WRITE );
+            writer->Write( output->GetBuffer() );
+            output->Clear();
+        }
+    };
+
+    parser.StartStreaming( execution.genOpts, inputFile.mockUserCode, inputFile.mockBaseDirPath, inputFile.expectBaseDirPath,
+                           inputFile.expectationHeaderOutputFilePath, inputFile.outputs,
+                           [&inputFile, flushOutput]( const Parser::Outputs &flushedOutputs )
+                           {
+                               flushOutput( flushedOutputs.mock, inputFile.mockWriter.get() );
+                               flushOutput( flushedOutputs.expectationHeader, inputFile.expectationHeaderWriter.get() );
+                               flushOutput( flushedOutputs.expectationImpl, inputFile.expectationImplWriter.get() );
+                           } );
+}
+
+bool App::ParseInput( Execution &execution, Parser &parser, InputFile &inputFile, std::ostream &err )
+{
+    // When outputs are out of date but neither the input file, its dependencies nor the parsing options changed (e.g.
+    // when only type overrides or output paths changed), the model of the input file stored in the cache is used
+    // instead of parsing it again. The model cache is not used in watch mode, where the translation units of input
+    // files are kept to reparse them incrementally, nor in streaming mode, where the model of the input file is not kept.
+    bool useModelCache = ( !inputFile.stampedFilePaths.empty() && !execution.watch && !execution.streaming );
+    std::string modelSignature = execution.parsingSignature + inputFile.argsSignature;
+
+    if( useModelCache )
+    {
+        std::string model;
+        if( execution.stampCache->GetModel( inputFile.path, modelSignature, model, inputFile.dependencies ) )
+        {
+            std::istringstream modelInput( model );
+            if( parser.LoadModel( inputFile.path, *execution.config, modelInput ) )
             {
-                std::filesystem::path expectBaseDirPath = baseDirPath;
-                if( expectBaseDirPath.empty() )
-                {
-                    expectBaseDirPath = expectationHeaderOutputFilePath.parent_path();
-                }
+                return true;
+            }
+        }
+    }
 
-                std::ostringstream headerOutput;
-                std::ostringstream implOutput;
-                parser.GenerateExpectationHeader( genOpts, expectBaseDirPath, headerOutput );
-                parser.GenerateExpectationImpl( genOpts, expectationHeaderOutputFilePath, implOutput );
+    // The precompiled prelude is not part of the signature, since its path changes on each execution
+    std::vector<std::string> parseArgs = inputFile.compileArgs;
+    const Prelude::PrecompiledHeader *precompiledPrelude = nullptr;
+    if( execution.prelude )
+    {
+        precompiledPrelude = &execution.prelude->GetPrecompiledHeader( parser, *execution.config, inputFile.isCppHeader,
+                                                                       execution.includePaths, inputFile.compileArgs, err );
+        parseArgs.push_back( "-include-pch" );
+        parseArgs.push_back( precompiledPrelude->filePath.generic_string() );
+    }
 
-                if( expectationHeaderOutputStream.is_open() )
-                {
-                    expectationHeaderOutputStream << headerOutput.str();
-                    expectationImplOutputStream << implOutput.str();
-
-                    cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_GREEN );
-                    m_cerr << "SUCCESS: ";
-                    cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
-                    m_cerr << "Expectations generated into '" << expectationHeaderOutputFilePath.generic_string() << 
-                              "' and '" << expectationImplOutputFilePath.generic_string() << "'" << std::endl;
-                }
-                else
-                {
-                    m_cout << headerOutput.str();
-                    m_cout << implOutput.str();
-                }
+    bool parsed = parser.Parse( inputFile.path, *execution.config, inputFile.isCppHeader, execution.includePaths, parseArgs, err );
+
+    // Files included from the precompiled prelude are not reported by the parser
+    inputFile.dependencies.clear();
+    if( execution.watch || !inputFile.depFileTargets.empty() || !inputFile.stampedFilePaths.empty() )
+    {
+        inputFile.dependencies = parser.GetDependencies();
+        if( precompiledPrelude )
+        {
+            inputFile.dependencies.insert( inputFile.dependencies.end(), precompiledPrelude->dependencies.begin(),
+                                           precompiledPrelude->dependencies.end() );
+        }
+    }
+
+    if( parsed && useModelCache )
+    {
+        std::ostringstream model;
+        parser.SaveModel( model );
+        execution.stampCache->StoreModel( inputFile.path, modelSignature, inputFile.dependencies, model.str() );
+    }
+
+    return parsed;
+}
+
+void App::WriteOutputs( const Execution &execution, InputFile &inputFile, std::ostream &out, std::ostream &err )
+{
+    if( execution.generateMock )
+    {
+        const std::string &output = inputFile.outputs.mock->GetBuffer();
+
+        if( inputFile.mockOutputFilePath != "@" )
+        {
+            bool changed = ( execution.streaming ? CommitOutputFile( *inputFile.mockWriter, inputFile.mockOutputFilePath, "Mock output file" ) :
+                                                   WriteOutputFile( inputFile.mockOutputFilePath, output, "Mock output file" ) );
+
+            cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_GREEN );
+            err << "SUCCESS: ";
+            cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+            err << "Mock generated into '" << inputFile.mockOutputFilePath.generic_string() << "'" <<
+                   ( changed ? "" : " (unchanged)" ) << std::endl;
+        }
+        else
+        {
+            out << output;
+        }
+    }
+
+    if( execution.generateExpectation )
+    {
+        const std::string &headerOutput = inputFile.outputs.expectationHeader->GetBuffer();
+        const std::string &implOutput = inputFile.outputs.expectationImpl->GetBuffer();
+
+        if( inputFile.expectationHeaderOutputFilePath != "@" )
+        {
+            bool changed;
+            if( execution.streaming )
+            {
+                changed = CommitOutputFile( *inputFile.expectationHeaderWriter, inputFile.expectationHeaderOutputFilePath, "Expectation header output file" );
+                changed |= CommitOutputFile( *inputFile.expectationImplWriter, inputFile.expectationImplOutputFilePath, "Expectation implementation output file" );
             }
+            else
+            {
+                changed = WriteOutputFile( inputFile.expectationHeaderOutputFilePath, headerOutput, "Expectation header output file" );
+                changed |= WriteOutputFile( inputFile.expectationImplOutputFilePath, implOutput, "Expectation implementation output file" );
+            }
+
+            cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_GREEN );
+            err << "SUCCESS: ";
+            cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+            err << "Expectations generated into '" << inputFile.expectationHeaderOutputFilePath.generic_string() <<
+                   "' and '" << inputFile.expectationImplOutputFilePath.generic_string() << "'" <<
+                   ( changed ? "" : " (unchanged)" ) << std::endl;
         }
         else
         {
-            returnCode = 2;
-            std::string errorMsg = "Output could not be generated due to errors parsing the input file '" + inputFilePath.generic_string() + "'.";
-            throw std::runtime_error( errorMsg );
+            out << headerOutput;
+            out << implOutput;
         }
     }
-    catch(std::exception &e)
+}
+
+void App::WriteTimeReport( const Execution &execution, const TimeReport &timeReport )
+{
+    if( !execution.timeReportPath.empty() )
     {
-        PrintError( e.what() );
-        if( !returnCode )
+        bool json = ( std::filesystem::path( execution.timeReportPath ).extension() == ".json" );
+        std::string report = timeReport.Format( json ? TimeReport::OutputFormat::JSON : TimeReport::OutputFormat::TEXT );
+        if( execution.timeReportPath == "@" )
         {
-            returnCode = 1;
+            execution.cerr << report;
+        }
+        else
+        {
+            WriteOutputFile( execution.timeReportPath, report, "Time report file" );
         }
     }
 
-    return returnCode;
+    if( !execution.tracePath.empty() )
+    {
+        std::string trace = timeReport.FormatTrace();
+        if( execution.tracePath == "@" )
+        {
+            execution.cerr << trace;
+        }
+        else
+        {
+            WriteOutputFile( execution.tracePath, trace, "Trace file" );
+        }
+    }
 }
 
+void App::Watch( Execution &execution, int &returnCode )
+{
+    // Input files are processed again when they or any of the files they include change, until the process is
+    // terminated or nothing can be watched any more
+    FileWatcher fileWatcher;
+
+    while( true )
+    {
+        std::vector<std::set<std::filesystem::path>> inputWatchedFiles( execution.inputs.size() );
+        std::set<std::filesystem::path> watchedFiles;
+        for( size_t inputIndex = 0; inputIndex < execution.inputs.size(); inputIndex++ )
+        {
+            inputWatchedFiles[ inputIndex ].insert( NormalizePath( execution.inputs[ inputIndex ].inputPath ) );
+            for( const std::filesystem::path &dependency : execution.inputDependencies[ inputIndex ] )
+            {
+                inputWatchedFiles[ inputIndex ].insert( NormalizePath( dependency ) );
+            }
+            watchedFiles.insert( inputWatchedFiles[ inputIndex ].begin(), inputWatchedFiles[ inputIndex ].end() );
+        }
+
+        fileWatcher.Watch( std::vector<std::filesystem::path>( watchedFiles.begin(), watchedFiles.end() ) );
+
+        cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_CYAN );
+        execution.cerr << "WATCHING: ";
+        cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+        execution.cerr << "Waiting for changes in the input files" << std::endl;
+
+        std::vector<std::filesystem::path> changedFiles = fileWatcher.WaitForChanges();
+        if( changedFiles.empty() )
+        {
+            break;
+        }
+
+        if( execution.prelude )
+        {
+            execution.prelude->Invalidate( changedFiles );
+        }
+
+        std::vector<size_t> changedInputIndexes;
+        for( size_t inputIndex = 0; inputIndex < execution.inputs.size(); inputIndex++ )
+        {
+            for( const std::filesystem::path &changedFile : changedFiles )
+            {
+                if( inputWatchedFiles[ inputIndex ].count( changedFile ) > 0 )
+                {
+                    changedInputIndexes.push_back( inputIndex );
+                    break;
+                }
+            }
+        }
+
+        ProcessInputs( execution, changedInputIndexes, returnCode );
+    }
+}
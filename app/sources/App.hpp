@@ -10,7 +10,14 @@
 #ifndef CPPUMOCKGEN_APP_HPP_
 #define CPPUMOCKGEN_APP_HPP_
 
+#include <istream>
 #include <ostream>
+#include <string>
+#include <memory>
+#include <vector>
+
+class Parser;
+class TimeReport;
 
 /**
  * Class that implements the application.
@@ -26,6 +33,20 @@ public:
      */
     App( std::ostream &cout, std::ostream &cerr ) noexcept;
 
+    /**
+     * Constructor.
+     *
+     * @param[in] cin Stream from where requests will be read in persistent worker mode
+     * @param[out] cout Stream where standard output will be printed
+     * @param[out] cerr Stream where error output will be printed
+     */
+    App( std::istream &cin, std::ostream &cout, std::ostream &cerr ) noexcept;
+
+    /**
+     * Destructor.
+     */
+    ~App();
+
     /**
      * Executes the application.
      *
@@ -36,10 +57,35 @@ public:
     int Execute( int argc, const char* argv[] ) noexcept;
 
 private:
-    void PrintError( const char *msg ) noexcept;
+    struct Execution;
+    struct InputFile;
 
+    int Execute( int argc, const char* argv[], std::ostream &cout, std::ostream &cerr, bool isWorkerRequest ) noexcept;
+    int RunWorker() noexcept;
+    void Prepare( Execution &execution, TimeReport &timeReport );
+    void ProcessInputs( Execution &execution, const std::vector<size_t> &inputIndexes, int &returnCode );
+    int ProcessInput( Execution &execution, size_t inputIndex, unsigned int threadIndex, std::ostream &out, std::ostream &err );
+    Parser& GetParser( Execution &execution, size_t parserIndex );
+    void Watch( Execution &execution, int &returnCode );
+
+    static void ReadInputs( Execution &execution );
+    static void ReadOptions( Execution &execution, bool isWorkerRequest );
+    static void CreatePrelude( Execution &execution );
+    static void CreateConfig( Execution &execution, const std::string &regenerateOptions );
+    static void GetOutputFiles( const Execution &execution, size_t inputIndex, InputFile &inputFile );
+    static void GetCompileArgs( const Execution &execution, InputFile &inputFile );
+    static void StartStreaming( const Execution &execution, Parser &parser, InputFile &inputFile );
+    static bool ParseInput( Execution &execution, Parser &parser, InputFile &inputFile, std::ostream &err );
+    static void WriteOutputs( const Execution &execution, InputFile &inputFile, std::ostream &out, std::ostream &err );
+    static void WriteTimeReport( const Execution &execution, const TimeReport &timeReport );
+    static void PrintError( std::ostream &err, const char *msg ) noexcept;
+
+    std::istream &m_cin;
     std::ostream &m_cout;
     std::ostream &m_cerr;
+
+    // Parsers (one per worker thread) are kept between executions, so that libclang stays initialized
+    std::vector<std::unique_ptr<Parser>> m_parsers;
 };
 
 #endif // header guard
@@ -0,0 +1,134 @@
+/**
+ * @file
+ * @brief      Implementation of BatchFileParser class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "BatchFileParser.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <regex>
+#include <stdexcept>
+
+static const std::regex g_tokenRegex( "\"((?:[^\"\\\\]|\\\\.)*)\"|(\\S+)" );
+static const std::regex g_escapedQuoteRegex( "\\\\\"" );
+
+static std::string ResolvePath( const std::string &path, const std::filesystem::path &basePath )
+{
+    if( path.empty() || ( path == "@" ) || std::filesystem::path( path ).is_absolute() )
+    {
+        return path;
+    }
+    else
+    {
+        std::string ret = ( basePath / path ).lexically_normal().generic_string();
+
+        // Keep the trailing separator that identifies directory paths
+        if( ( ( path.back() == '/' ) || ( path.back() == '\\' ) ) && ( ret.back() != '/' ) )
+        {
+            ret += '/';
+        }
+
+        return ret;
+    }
+}
+
+BatchFileParser::BatchFileParser()
+{
+}
+
+const std::vector<BatchFileParser::Entry>& BatchFileParser::GetEntries() const
+{
+    return m_entries;
+}
+
+void BatchFileParser::Parse( const std::filesystem::path &filepath )
+{
+    unsigned int lineNum = 1;
+    std::string line;
+
+    std::ifstream batchFile( filepath );
+    if( batchFile.is_open() )
+    {
+        try
+        {
+            while( getline( batchFile, line ) )
+            {
+                ParseLine( line, filepath.parent_path() );
+                lineNum++;
+            }
+        }
+        catch( const std::exception& e )
+        {
+            std::ostringstream errorMsg;
+            errorMsg << "In batch file '" << filepath.generic_string() << "':" << lineNum << ": " << e.what();
+            throw std::runtime_error( errorMsg.str() );
+        }
+
+        batchFile.close();
+    }
+    else
+    {
+        std::string errorMsg = "Batch file '" + filepath.generic_string() + "' could not be opened.";
+        throw std::runtime_error( errorMsg );
+    }
+}
+
+void BatchFileParser::ParseLine( const std::string &line, const std::filesystem::path &basePath )
+{
+    std::vector<std::string> tokens;
+
+    for( auto it = std::sregex_iterator( line.begin(), line.end(), g_tokenRegex ); it != std::sregex_iterator(); it++ )
+    {
+        if( (*it)[1].matched )
+        {
+            tokens.push_back( std::regex_replace( (*it)[1].str(), g_escapedQuoteRegex, "\"" ) );
+        }
+        else
+        {
+            tokens.push_back( (*it)[2].str() );
+        }
+    }
+
+    if( tokens.empty() || ( tokens[0][0] == '#' ) )
+    {
+        return;
+    }
+
+    Entry entry;
+
+    for( size_t i = 0; i < tokens.size(); i++ )
+    {
+        const std::string &token = tokens[i];
+
+        if( ( token == "-m" ) || ( token == "-e" ) )
+        {
+            if( ( i + 1 ) >= tokens.size() )
+            {
+                throw std::runtime_error( "Option '" + token + "' requires a path." );
+            }
+
+            std::string &outputPath = ( token == "-m" ) ? entry.mockOutputPath : entry.expectationsOutputPath;
+            outputPath = ResolvePath( tokens[++i], basePath );
+        }
+        else if( entry.inputPath.empty() && ( token[0] != '-' ) )
+        {
+            entry.inputPath = ResolvePath( token, basePath );
+        }
+        else
+        {
+            throw std::runtime_error( "Unexpected parameter '" + token + "'." );
+        }
+    }
+
+    if( entry.inputPath.empty() )
+    {
+        throw std::runtime_error( "No input file specified." );
+    }
+
+    m_entries.push_back( entry );
+}
@@ -0,0 +1,53 @@
+/**
+ * @file
+ * @brief      Declaration of BatchFileParser class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CppUMockGen_BatchFileParser_hpp_
+#define CppUMockGen_BatchFileParser_hpp_
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * Parser for batch files.
+ *
+ * Each non-empty line in a batch file (excluding lines starting with '#') describes an input file to be processed,
+ * with the format:
+ *
+ *     <input> [-m <mock-output>] [-e <expect-output>]
+ *
+ * Paths containing spaces can be enclosed in double quotes. Relative paths are interpreted as relative to the
+ * directory where the batch file is located.
+ */
+class BatchFileParser
+{
+public:
+    /**
+     * Input file entry in a batch file.
+     */
+    struct Entry
+    {
+        std::string inputPath;
+        std::string mockOutputPath;
+        std::string expectationsOutputPath;
+    };
+
+    BatchFileParser();
+
+    void Parse( const std::filesystem::path &filepath );
+
+    const std::vector<Entry>& GetEntries() const;
+
+private:
+    void ParseLine( const std::string &line, const std::filesystem::path &basePath );
+
+    std::vector<Entry> m_entries;
+};
+
+#endif // header guard
@@ -9,6 +9,52 @@
 
 #include "ClangHelper.hpp"
 
+static thread_local CursorCache *currentCursorCache = nullptr;
+
+CursorCache::CursorCache() noexcept
+: m_previous( currentCursorCache )
+{
+    currentCursorCache = this;
+}
+
+CursorCache::~CursorCache() noexcept
+{
+    currentCursorCache = m_previous;
+}
+
+CursorCache* CursorCache::GetCurrent() noexcept
+{
+    return currentCursorCache;
+}
+
+const std::string* CursorCache::FindQualifiedName( const CXCursor &scope ) const noexcept
+{
+    auto it = m_qualifiedNames.find( scope );
+    return ( it != m_qualifiedNames.end() ) ? &it->second : nullptr;
+}
+
+void CursorCache::StoreQualifiedName( const CXCursor &scope, const std::string &qualifiedName ) noexcept
+{
+    m_qualifiedNames.emplace( scope, qualifiedName );
+}
+
+bool CursorCache::FindPublicScope( const CXCursor &scope, bool &isPublic ) const noexcept
+{
+    auto it = m_publicScopes.find( scope );
+    if( it == m_publicScopes.end() )
+    {
+        return false;
+    }
+
+    isPublic = it->second;
+    return true;
+}
+
+void CursorCache::StorePublicScope( const CXCursor &scope, bool isPublic ) noexcept
+{
+    m_publicScopes.emplace( scope, isPublic );
+}
+
 std::ostream& operator<<( std::ostream& stream, const CXString& cxstr ) noexcept
 {
     const char *cstr = clang_getCString(cxstr);
@@ -47,6 +93,8 @@ std::string operator+( const char *string, const CXString &cxstr ) noexcept
     return ret;
 }
 
+static std::string getScopeQualifiedName( const CXCursor &scope ) noexcept;
+
 std::string getQualifiedName( const CXCursor &cursor ) noexcept
 {
     std::string ret;
@@ -58,7 +106,7 @@ std::string getQualifiedName( const CXCursor &cursor ) noexcept
 
         if( !clang_Cursor_isNull( parent ) ) //LCOV_EXCL_BR_LINE: Defensive
         {
-            ret = getQualifiedName( parent );
+            ret = getScopeQualifiedName( parent );
         }
 
         if( !ret.empty() )
@@ -72,9 +120,37 @@ std::string getQualifiedName( const CXCursor &cursor ) noexcept
     return ret;
 }
 
+static std::string getScopeQualifiedName( const CXCursor &scope ) noexcept
+{
+    // Scopes are shared by all their members, therefore their qualified names are cached when possible
+    CursorCache *cache = CursorCache::GetCurrent();
+    if( cache != nullptr )
+    {
+        const std::string *cachedName = cache->FindQualifiedName( scope );
+        if( cachedName != nullptr )
+        {
+            return *cachedName;
+        }
+    }
+
+    std::string ret = getQualifiedName( scope );
+
+    if( cache != nullptr )
+    {
+        cache->StoreQualifiedName( scope, ret );
+    }
+
+    return ret;
+}
+
 std::string getBareTypeSpelling( const CXType &type ) noexcept
 {
-    std::string fullName = toString( clang_getTypeSpelling( (CXType &)type ) );
+    return getBareTypeSpelling( toString( clang_getTypeSpelling( (CXType &)type ) ) );
+}
+
+std::string getBareTypeSpelling( const std::string &typeSpelling ) noexcept
+{
+    std::string fullName = typeSpelling;
 
     size_t sepIdx = fullName.find_last_of( ' ' );
 
@@ -110,7 +186,7 @@ std::string getMemberClassName( const CXCursor &cursor ) noexcept
 
     if( !clang_Cursor_isNull( parent ) ) //LCOV_EXCL_BR_LINE: Defensive
     {
-        ret = getQualifiedName( parent );
+        ret = getScopeQualifiedName( parent );
     }
 
     return ret;
@@ -180,5 +256,22 @@ bool isCursorNonPrivate( const CXCursor &cursor ) noexcept
 
 bool isCursorInPublicClass( const CXCursor &cursor ) noexcept
 {
-    return isCursorPublic( clang_getCursorSemanticParent( cursor ) );
+    CXCursor parent = clang_getCursorSemanticParent( cursor );
+
+    // Classes are shared by all their members, therefore their accessibility is cached when possible
+    CursorCache *cache = CursorCache::GetCurrent();
+    bool ret;
+    if( ( cache != nullptr ) && cache->FindPublicScope( parent, ret ) )
+    {
+        return ret;
+    }
+
+    ret = isCursorPublic( parent );
+
+    if( cache != nullptr )
+    {
+        cache->StorePublicScope( parent, ret );
+    }
+
+    return ret;
 }
@@ -12,8 +12,93 @@
 
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <clang-c/Index.h>
 
+/**
+ * Class that caches information about the scopes (i.e., namespaces and classes) that contain cursors.
+ *
+ * While a cache exists, the qualified names and the public accessibility of the scopes looked up by the helper functions
+ * below from the thread that created it are stored in the cache, so that they are computed only once for all the
+ * members of each scope, instead of walking up the semantic parents of each member again. Since cursors are only
+ * unique within a translation unit, a cache must only be used while parsing a single translation unit.
+ */
+class CursorCache
+{
+public:
+    /**
+     * Constructor, which makes the cache the current one for the calling thread.
+     */
+    CursorCache() noexcept;
+
+    /**
+     * Destructor, which restores the previous cache for the calling thread.
+     */
+    ~CursorCache() noexcept;
+
+    CursorCache( const CursorCache& ) = delete;
+    CursorCache& operator=( const CursorCache& ) = delete;
+
+    /**
+     * Returns the current cache for the calling thread, or @c nullptr if there is none.
+     */
+    static CursorCache* GetCurrent() noexcept;
+
+    /**
+     * Looks up the qualified name of a scope.
+     *
+     * @param[in] scope A cursor to a scope
+     * @return Pointer to the cached qualified name, or @c nullptr if it was not cached
+     */
+    const std::string* FindQualifiedName( const CXCursor &scope ) const noexcept;
+
+    /**
+     * Stores the qualified name of a scope.
+     *
+     * @param[in] scope A cursor to a scope
+     * @param[in] qualifiedName Qualified name of the scope
+     */
+    void StoreQualifiedName( const CXCursor &scope, const std::string &qualifiedName ) noexcept;
+
+    /**
+     * Looks up if a scope is public.
+     *
+     * @param[in] scope A cursor to a scope
+     * @param[out] isPublic Indicates if the scope is public
+     * @return @c true if the accessibility of the scope was cached, @c false otherwise
+     */
+    bool FindPublicScope( const CXCursor &scope, bool &isPublic ) const noexcept;
+
+    /**
+     * Stores if a scope is public.
+     *
+     * @param[in] scope A cursor to a scope
+     * @param[in] isPublic Indicates if the scope is public
+     */
+    void StorePublicScope( const CXCursor &scope, bool isPublic ) noexcept;
+
+private:
+    struct CursorHash
+    {
+        size_t operator()( const CXCursor &cursor ) const noexcept
+        {
+            return clang_hashCursor( cursor );
+        }
+    };
+
+    struct CursorEqual
+    {
+        bool operator()( const CXCursor &cursor1, const CXCursor &cursor2 ) const noexcept
+        {
+            return ( clang_equalCursors( cursor1, cursor2 ) != 0 );
+        }
+    };
+
+    std::unordered_map<CXCursor, std::string, CursorHash, CursorEqual> m_qualifiedNames;
+    std::unordered_map<CXCursor, bool, CursorHash, CursorEqual> m_publicScopes;
+    CursorCache *m_previous;
+};
+
 /**
  * Writes the CXString @p cxstr to @p stream.
  *
@@ -74,6 +159,14 @@ std::string getQualifiedName( const CXCursor &cursor ) noexcept;
  */
 std::string getBareTypeSpelling( const CXType &type ) noexcept;
 
+/**
+ * Returns the spelling of a type removing modifiers (const, volatile, pointer, etc.).
+ *
+ * @param[in] typeSpelling Spelling of a type, as returned by libclang
+ * @return A string with the spelling of the bare type
+ */
+std::string getBareTypeSpelling( const std::string &typeSpelling ) noexcept;
+
 /**
  * Returns the name of the class to which a member belongs.
  *
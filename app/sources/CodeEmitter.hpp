@@ -0,0 +1,125 @@
+/**
+ * @file
+ * @brief      Header of CodeEmitter class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_CODEEMITTER_HPP_
+#define CPPUMOCKGEN_CODEEMITTER_HPP_
+
+#include <string>
+#include <utility>
+
+/**
+ * Class used to emit generated code.
+ *
+ * The code is appended to a growable buffer, which can be reused to emit the code for all the functions of an output
+ * file, so that memory is only allocated when the buffer has to grow.
+ */
+class CodeEmitter
+{
+public:
+    /**
+     * Appends a string to the emitted code.
+     */
+    CodeEmitter& operator<<( const std::string &text )
+    {
+        m_buffer.append( text );
+        return *this;
+    }
+
+    /**
+     * Appends a null-terminated string to the emitted code.
+     */
+    CodeEmitter& operator<<( const char *text )
+    {
+        m_buffer.append( text );
+        return *this;
+    }
+
+    /**
+     * Appends a character to the emitted code.
+     */
+    CodeEmitter& operator<<( char c )
+    {
+        m_buffer.push_back( c );
+        return *this;
+    }
+
+    /**
+     * Appends the first @p length characters of a string to the emitted code.
+     */
+    void Write( const char *text, size_t length )
+    {
+        m_buffer.append( text, length );
+    }
+
+    /**
+     * Returns the size of the code emitted until now.
+     */
+    size_t GetSize() const noexcept
+    {
+        return m_buffer.size();
+    }
+
+    /**
+     * Discards the code emitted after the first @p size characters.
+     */
+    void Truncate( size_t size ) noexcept
+    {
+        m_buffer.erase( size );
+    }
+
+    /**
+     * Removes the leading and trailing spaces of the code emitted after the first @p start characters.
+     */
+    void Trim( size_t start ) noexcept
+    {
+        size_t last = m_buffer.find_last_not_of( ' ' );
+        if( ( last != std::string::npos ) && ( last >= start ) )
+        {
+            m_buffer.erase( last + 1 );
+            m_buffer.erase( start, ( m_buffer.find_first_not_of( ' ', start ) - start ) );
+        }
+    }
+
+    /**
+     * Discards all the emitted code, keeping the allocated buffer for reuse.
+     */
+    void Clear() noexcept
+    {
+        m_buffer.clear();
+    }
+
+    /**
+     * Reserves room in the buffer for at least @p size characters.
+     */
+    void Reserve( size_t size )
+    {
+        m_buffer.reserve( size );
+    }
+
+    /**
+     * Returns the emitted code.
+     */
+    const std::string& GetBuffer() const noexcept
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Returns the emitted code, transferring the buffer to the caller.
+     */
+    std::string Release() noexcept
+    {
+        return std::move( m_buffer );
+    }
+
+private:
+    std::string m_buffer;
+};
+
+#endif // header guard
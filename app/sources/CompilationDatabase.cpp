@@ -0,0 +1,253 @@
+/**
+ * @file
+ * @brief      Implementation of CompilationDatabase class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "CompilationDatabase.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <clang-c/CXCompilationDatabase.h>
+
+#include "ClangHelper.hpp"
+#include "FileHelper.hpp"
+
+static const char COMPILATION_DATABASE_FILENAME[] = "compile_commands.json";
+
+// Options that are passed to the parser, and whose value is a path relative to the compilation directory
+static const char* const PATH_OPTIONS[] = { "-I", "-isystem", "-iquote", "-idirafter", "-include", "-imacros", "-F", "-iframework" };
+
+// Options that are passed to the parser, and whose value is a macro definition
+static const char* const MACRO_OPTIONS[] = { "-D", "-U" };
+
+// Options that are not passed to the parser, but whose separate value must be skipped
+static const char* const IGNORED_OPTIONS_WITH_VALUE[] = { "-include-pch", "-o", "-MF", "-MT", "-MQ" };
+
+static std::filesystem::path NormalizePath( const std::filesystem::path &path )
+{
+    return std::filesystem::absolute( path ).lexically_normal();
+}
+
+static bool IsCppStandard( const std::string &standard ) noexcept
+{
+    return ( ( standard.find( "c++" ) == 0 ) || ( standard.find( "gnu++" ) == 0 ) );
+}
+
+static bool GetOptionValue( const std::vector<std::string> &args, size_t &argIndex, const char *option, std::string &value )
+{
+    const std::string &arg = args[ argIndex ];
+    size_t optionLength = std::strlen( option );
+
+    if( arg == option )
+    {
+        // Separate value
+        if( ( argIndex + 1 ) < args.size() )
+        {
+            value = args[ ++argIndex ];
+            return true;
+        }
+    }
+    else if( arg.compare( 0, optionLength, option ) == 0 )
+    {
+        // Joined value
+        value = arg.substr( optionLength );
+        return true;
+    }
+
+    return false;
+}
+
+static CompilationDatabase::Flags GetFlagsFromArgs( const std::vector<std::string> &args, const std::filesystem::path &directory,
+                                                    const std::filesystem::path &unitPath )
+{
+    CompilationDatabase::Flags flags = { {}, HasCppImplExtension( unitPath ) };
+
+    // The first argument is the compiler executable
+    for( size_t argIndex = 1; argIndex < args.size(); argIndex++ )
+    {
+        const std::string &arg = args[ argIndex ];
+        std::string value;
+        bool processed = false;
+
+        for( const char *option : IGNORED_OPTIONS_WITH_VALUE )
+        {
+            if( arg == option )
+            {
+                argIndex++;
+                processed = true;
+                break;
+            }
+        }
+
+        for( const char *option : PATH_OPTIONS )
+        {
+            if( !processed && GetOptionValue( args, argIndex, option, value ) )
+            {
+                std::filesystem::path path = value;
+                if( path.is_relative() )
+                {
+                    path = directory / path;
+                }
+                flags.args.push_back( option );
+                flags.args.push_back( path.lexically_normal().generic_string() );
+                processed = true;
+            }
+        }
+
+        for( const char *option : MACRO_OPTIONS )
+        {
+            if( !processed && GetOptionValue( args, argIndex, option, value ) )
+            {
+                flags.args.push_back( option + value );
+                processed = true;
+            }
+        }
+
+        if( !processed )
+        {
+            if( ( arg.compare( 0, 5, "-std=" ) == 0 ) || ( arg.compare( 0, 6, "--std=" ) == 0 ) )
+            {
+                std::string standard = arg.substr( arg.find( '=' ) + 1 );
+                flags.args.push_back( "-std=" + standard );
+                flags.isCpp = flags.isCpp || IsCppStandard( standard );
+            }
+            else if( GetOptionValue( args, argIndex, "-x", value ) )
+            {
+                flags.isCpp = ( value.find( "c++" ) == 0 );
+            }
+        }
+    }
+
+    return flags;
+}
+
+static size_t GetNumCommonComponents( const std::filesystem::path &path1, const std::filesystem::path &path2 ) noexcept
+{
+    size_t numCommonComponents = 0;
+
+    auto it1 = path1.begin();
+    auto it2 = path2.begin();
+    while( ( it1 != path1.end() ) && ( it2 != path2.end() ) && ( *it1 == *it2 ) )
+    {
+        numCommonComponents++;
+        it1++;
+        it2++;
+    }
+
+    return numCommonComponents;
+}
+
+CompilationDatabase::CompilationDatabase( const std::filesystem::path &path )
+{
+    std::filesystem::path dirPath = path;
+    if( path.filename() == COMPILATION_DATABASE_FILENAME )
+    {
+        dirPath = path.parent_path();
+    }
+    if( dirPath.empty() )
+    {
+        dirPath = ".";
+    }
+
+    if( !std::filesystem::is_regular_file( dirPath / COMPILATION_DATABASE_FILENAME ) )
+    {
+        std::string errorMsg = "Compilation database '" + path.generic_string() + "' does not exist.";
+        throw std::runtime_error( errorMsg );
+    }
+
+    CXCompilationDatabase_Error dbError;
+    CXCompilationDatabase db = clang_CompilationDatabase_fromDirectory( dirPath.generic_string().c_str(), &dbError );
+    if( dbError != CXCompilationDatabase_NoError )
+    {
+        std::string errorMsg = "Compilation database '" + path.generic_string() + "' could not be loaded.";
+        throw std::runtime_error( errorMsg );
+    }
+
+    CXCompileCommands commands = clang_CompilationDatabase_getAllCompileCommands( db );
+    unsigned int numCommands = clang_CompileCommands_getSize( commands );
+
+    for( unsigned int commandIndex = 0; commandIndex < numCommands; commandIndex++ )
+    {
+        CXCompileCommand command = clang_CompileCommands_getCommand( commands, commandIndex );
+
+        std::filesystem::path directory = NormalizePath( toString( clang_CompileCommand_getDirectory( command ) ) );
+        std::filesystem::path unitPath = toString( clang_CompileCommand_getFilename( command ) );
+        if( unitPath.is_relative() )
+        {
+            unitPath = directory / unitPath;
+        }
+        unitPath = NormalizePath( unitPath );
+
+        std::vector<std::string> args;
+        unsigned int numArgs = clang_CompileCommand_getNumArgs( command );
+        for( unsigned int argIndex = 0; argIndex < numArgs; argIndex++ )
+        {
+            args.push_back( toString( clang_CompileCommand_getArg( command, argIndex ) ) );
+        }
+
+        size_t flagsIndex = m_flags.size();
+        m_flags.push_back( GetFlagsFromArgs( args, directory, unitPath ) );
+        m_unitDirectories.push_back( unitPath.parent_path() );
+
+        // When a translation unit appears several times, the first entry is used
+        m_flagsByStemPath.emplace( ( unitPath.parent_path() / unitPath.stem() ).generic_string(), flagsIndex );
+        m_flagsByStem[ unitPath.stem().generic_string() ].push_back( flagsIndex );
+        m_flagsByDirectory.emplace( unitPath.parent_path().generic_string(), flagsIndex );
+    }
+
+    clang_CompileCommands_dispose( commands );
+    clang_CompilationDatabase_dispose( db );
+}
+
+const CompilationDatabase::Flags* CompilationDatabase::GetFlags( const std::filesystem::path &headerFilePath ) const noexcept
+{
+    std::filesystem::path headerPath = NormalizePath( headerFilePath );
+    std::filesystem::path headerDirPath = headerPath.parent_path();
+
+    // Translation unit with the same name in the same directory
+    auto stemPathIt = m_flagsByStemPath.find( ( headerDirPath / headerPath.stem() ).generic_string() );
+    if( stemPathIt != m_flagsByStemPath.end() )
+    {
+        return &m_flags[ stemPathIt->second ];
+    }
+
+    // Translation unit with the same name in the nearest directory
+    auto stemIt = m_flagsByStem.find( headerPath.stem().generic_string() );
+    if( stemIt != m_flagsByStem.end() )
+    {
+        size_t bestFlagsIndex = stemIt->second.front();
+        size_t bestNumCommonComponents = 0;
+        for( size_t flagsIndex : stemIt->second )
+        {
+            size_t numCommonComponents = GetNumCommonComponents( headerDirPath, m_unitDirectories[ flagsIndex ] );
+            if( numCommonComponents > bestNumCommonComponents )
+            {
+                bestFlagsIndex = flagsIndex;
+                bestNumCommonComponents = numCommonComponents;
+            }
+        }
+
+        return &m_flags[ bestFlagsIndex ];
+    }
+
+    // Translation unit in the same directory or in the nearest parent directory
+    for( std::filesystem::path dirPath = headerDirPath; !dirPath.empty(); dirPath = dirPath.parent_path() )
+    {
+        auto dirIt = m_flagsByDirectory.find( dirPath.generic_string() );
+        if( dirIt != m_flagsByDirectory.end() )
+        {
+            return &m_flags[ dirIt->second ];
+        }
+
+        if( dirPath == dirPath.parent_path() )
+        {
+            break;
+        }
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file
+ * @brief      Header of CompilationDatabase class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_COMPILATIONDATABASE_HPP_
+#define CPPUMOCKGEN_COMPILATIONDATABASE_HPP_
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <filesystem>
+
+/**
+ * Class that provides the compilation flags to be used to parse header files, taken from a JSON compilation database
+ * (i.e., a "compile_commands.json" file as generated by CMake, Ninja, Bear, etc.).
+ *
+ * Compilation databases only contain the commands used to compile translation units, therefore the flags for a header
+ * file are taken from the translation unit that most probably includes it, which is searched in this order:
+ *  - A translation unit with the same name (without extension) in the same directory as the header file.
+ *  - A translation unit with the same name (without extension) in the nearest directory to the header file.
+ *  - A translation unit in the directory of the header file or in the nearest parent directory.
+ *
+ * All the translation units are indexed when the database is loaded, so that looking up flags does not depend on
+ * the size of the database.
+ */
+class CompilationDatabase
+{
+public:
+    /**
+     * Compilation flags for a header file.
+     */
+    struct Flags
+    {
+        std::vector<std::string> args;  ///< Compiler arguments relevant for parsing (include paths, macros, standard)
+        bool isCpp;                     ///< Indicates if the translation unit is compiled as C++
+    };
+
+    /**
+     * Constructor.
+     *
+     * Loads the compilation database and indexes its translation units.
+     *
+     * @param[in] path Path to the compilation database file, or to the directory that contains it
+     * @throws std::runtime_error If the compilation database cannot be loaded
+     */
+    CompilationDatabase( const std::filesystem::path &path );
+
+    /**
+     * Returns the compilation flags to be used to parse a header file.
+     *
+     * @param[in] headerFilePath Path to the header file
+     * @return Pointer to the flags of the translation unit that most probably includes the header file, or
+     *         @c nullptr if no translation unit in the database is related to the header file
+     */
+    const Flags* GetFlags( const std::filesystem::path &headerFilePath ) const noexcept;
+
+private:
+    std::vector<Flags> m_flags;
+    std::unordered_map<std::string, size_t> m_flagsByStemPath;
+    std::unordered_map<std::string, std::vector<size_t>> m_flagsByStem;
+    std::unordered_map<std::string, size_t> m_flagsByDirectory;
+    std::vector<std::filesystem::path> m_unitDirectories;
+};
+
+#endif // header guard
@@ -11,19 +11,76 @@
 
 #include <set>
 #include <vector>
+#include <cctype>
 #include <stdexcept>
+#include <algorithm>
 
 #include "StringHelper.hpp"
 
 static const char EXPR_MOD_SEPARATOR = '~';
 static const char EXPR_CURRENT_ARG_PLACEHOLDER = '$';
 static const char EXPECTATION_ARG_TYPE_SEPARATOR = '<';
+static const char KEY_PATTERN_PREFIX = '%';
+static const char KEY_PATTERN_ESCAPE = '\\';
+
+static bool IsIdentifier( const std::string &name ) noexcept
+{
+    if( name.empty() || std::isdigit( static_cast<unsigned char>( name[0] ) ) )
+    {
+        return false;
+    }
+
+    for( char c : name )
+    {
+        if( !std::isalnum( static_cast<unsigned char>( c ) ) && ( c != '_' ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
 
 Config::Config( bool interpretAsCpp, const std::string &languageStandard, bool useUnderlyingTypedefType,
-                const std::vector<std::string> &typeOverrideOptions )
+                const std::vector<std::string> &typeOverrideOptions, const std::vector<std::string> &typeMapOptions )
 : m_interpretAsCpp( interpretAsCpp ), m_languageStandard( languageStandard ), m_useUnderlyingTypedefType( useUnderlyingTypedefType ),
   m_typeOverrideMap( typeOverrideOptions )
 {
+    std::set<std::string> typeNames;
+
+    for( const std::string &option : typeMapOptions )
+    {
+        size_t sepPos = option.find( '=' );
+        if( sepPos == std::string::npos )
+        {
+            std::string errorMsg = "Invalid type map option ['" + option + "'].";
+            throw std::runtime_error( errorMsg );
+        }
+
+        std::string typeName = TrimString( option.substr( 0, sepPos ) );
+        std::string type = TrimString( option.substr( sepPos + 1 ) );
+
+        if( !IsIdentifier( typeName ) )
+        {
+            std::string errorMsg = "Type map option type name must be an identifier ['" + option + "'].";
+            throw std::runtime_error( errorMsg );
+        }
+
+        if( type.empty() )
+        {
+            std::string errorMsg = "Type map option type cannot be empty ['" + option + "'].";
+            throw std::runtime_error( errorMsg );
+        }
+
+        if( !typeNames.insert( typeName ).second )
+        {
+            std::string errorMsg = "Type map option type name '" + typeName + "' can only be passed once.";
+            throw std::runtime_error( errorMsg );
+        }
+
+        // Using __typeof__ allows declaring any type (e.g. pointers to functions or arrays) without parsing it
+        m_typeMapDeclarations += "typedef __typeof__(" + type + ") " + typeName + ";\n";
+    }
 }
 
 bool Config::InterpretAsCpp() const noexcept
@@ -41,11 +98,16 @@ bool Config::UseUnderlyingTypedefType() const noexcept
     return m_useUnderlyingTypedefType;
 }
 
-const Config::OverrideSpec* Config::GetTypeOverride( const std::string& key ) const noexcept
+const Config::OverrideSpec* Config::GetTypeOverride( std::string_view key ) const noexcept
 {
     return m_typeOverrideMap.GetOverride(key);
 }
 
+const std::string& Config::GetTypeMapDeclarations() const noexcept
+{
+    return m_typeMapDeclarations;
+}
+
 static const std::vector<std::pair<std::string, MockedType>> validOverrideTypes =
 {
     { "Bool", MockedType::Bool },
@@ -208,15 +270,56 @@ Config::OverrideSpec::OverrideSpec( const std::string &value, bool isReturn )
     }
 }
 
+static std::vector<std::pair<char, bool>> ParseKeyPattern( const std::string &key, bool &hasWildcards )
+{
+    // Returns each character of the pattern paired with a flag that indicates if it is a wildcard. Only patterns are
+    // parsed, since '?' and '*' are ordinary characters in exact keys (e.g. "#int *" or "Class1::operator*#p").
+    std::vector<std::pair<char, bool>> pattern;
+    hasWildcards = false;
+
+    for( size_t i = 0; i < key.size(); i++ )
+    {
+        char c = key[i];
+        bool isWildcard = false;
+
+        if( c == KEY_PATTERN_ESCAPE )
+        {
+            if( ++i == key.size() )
+            {
+                throw OptionError( "Override option key pattern cannot end with an escape character" );
+            }
+            c = key[i];
+        }
+        else if( ( c == '?' ) || ( c == '*' ) )
+        {
+            isWildcard = true;
+        }
+
+        hasWildcards = hasWildcards || isWildcard;
+        pattern.emplace_back( c, isWildcard );
+    }
+
+    return pattern;
+}
+
 Config::OverrideMap::OverrideMap( const std::vector<std::string> &options )
 {
     for( const std::string &option : options )
     {
-        size_t sepPos = option.find('=');
+        // Function names may contain '=' (e.g. "Class1::operator*=#p"), but the names of parameters and types may not,
+        // therefore the key ends at the first '=' after the '#' or '@' separator
+        size_t keySepPos = option.find_first_of( "#@" );
+        size_t sepPos = option.find( '=', ( keySepPos != std::string::npos ) ? keySepPos : 0 );
         if( sepPos != std::string::npos )
         {
             bool isReturn = false;
             std::string key = TrimString( option.substr(0, sepPos) );
+            bool isPattern = ( !key.empty() && ( key.front() == KEY_PATTERN_PREFIX ) );
+            if( isPattern )
+            {
+                key = key.substr( 1 );
+            }
+
             if( key.empty() )
             {
                 std::string errorMsg = "Override option key cannot be empty ['" + option + "'].";
@@ -242,9 +345,48 @@ Config::OverrideMap::OverrideMap( const std::vector<std::string> &options )
             {
                 Config::OverrideSpec spec = Config::OverrideSpec( option.substr(sepPos+1), isReturn );
 
-                if( !m_map.emplace( key, spec ).second )
+                bool isNew;
+                bool hasWildcards = false;
+                std::vector<std::pair<char, bool>> pattern;
+                if( isPattern )
                 {
-                    std::string errorMsg = "Override option key '" + key + "' can only be passed once.";
+                    pattern = ParseKeyPattern( key, hasWildcards );
+                }
+
+                if( !hasWildcards )
+                {
+                    // Patterns without wildcards are just exact keys written with escape characters
+                    if( isPattern )
+                    {
+                        key.clear();
+                        for( const std::pair<char, bool> &patternChar : pattern )
+                        {
+                            key += patternChar.first;
+                        }
+                    }
+                    isNew = ( m_map.find( key ) == m_map.end() );
+                    if( isNew )
+                    {
+                        m_keys.push_back( key );
+                        m_map.emplace( m_keys.back(), spec );
+                    }
+                }
+                else
+                {
+                    // Generic and function-specific keys are looked up separately, so that a pattern for any
+                    // function (e.g. "*#p") never matches a generic key
+                    bool isGeneric = ( ( key.front() == '#' ) || ( key.front() == '@' ) );
+                    PatternSet &patterns = isGeneric ? m_genericPatterns : m_specificPatterns;
+                    isNew = patterns.Add( pattern, m_patternSpecs.size() );
+                    if( isNew )
+                    {
+                        m_patternSpecs.push_back( spec );
+                    }
+                }
+
+                if( !isNew )
+                {
+                    std::string errorMsg = "Override option key '" + TrimString( option.substr(0, sepPos) ) + "' can only be passed once.";
                     throw std::runtime_error( errorMsg );
                 }
             }
@@ -263,10 +405,175 @@ Config::OverrideMap::OverrideMap( const std::vector<std::string> &options )
     }
 }
 
-const Config::OverrideSpec* Config::OverrideMap::GetOverride( const std::string& key ) const noexcept
+const Config::OverrideSpec* Config::OverrideMap::GetOverride( std::string_view key ) const noexcept
 {
     OverrideMapType::const_iterator it = m_map.find( key );
-    return ( it != m_map.end() ) ? &(it->second) : NULL;
+    if( it != m_map.end() )
+    {
+        return &(it->second);
+    }
+
+    if( m_patternSpecs.empty() || key.empty() )
+    {
+        return NULL;
+    }
+
+    bool isGeneric = ( ( key.front() == '#' ) || ( key.front() == '@' ) );
+    size_t patternIndex = ( isGeneric ? m_genericPatterns : m_specificPatterns ).Match( key );
+    return ( patternIndex != std::string::npos ) ? &m_patternSpecs[patternIndex] : NULL;
+}
+
+bool Config::OverrideMap::PatternSet::Add( const std::vector<std::pair<char, bool>> &pattern, size_t index )
+{
+    if( m_nodes.empty() )
+    {
+        m_nodes.emplace_back();
+    }
+
+    size_t nodeIndex = 0;
+
+    for( const std::pair<char, bool> &patternChar : pattern )
+    {
+        size_t nextNodeIndex;
+
+        if( !patternChar.second )
+        {
+            auto it = m_nodes[nodeIndex].children.find( patternChar.first );
+            nextNodeIndex = ( it != m_nodes[nodeIndex].children.end() ) ? it->second : std::string::npos;
+        }
+        else if( patternChar.first == '?' )
+        {
+            nextNodeIndex = m_nodes[nodeIndex].anyCharChild;
+        }
+        else if( m_nodes[nodeIndex].isAnySequence )
+        {
+            // Consecutive '*' wildcards are equivalent to a single one
+            continue;
+        }
+        else
+        {
+            nextNodeIndex = m_nodes[nodeIndex].anySequenceChild;
+        }
+
+        if( nextNodeIndex == std::string::npos )
+        {
+            nextNodeIndex = m_nodes.size();
+            m_nodes.emplace_back();
+
+            if( !patternChar.second )
+            {
+                m_nodes[nodeIndex].children.emplace( patternChar.first, nextNodeIndex );
+            }
+            else if( patternChar.first == '?' )
+            {
+                m_nodes[nodeIndex].anyCharChild = nextNodeIndex;
+            }
+            else
+            {
+                m_nodes[nodeIndex].anySequenceChild = nextNodeIndex;
+                m_nodes[nextNodeIndex].isAnySequence = true;
+            }
+        }
+
+        nodeIndex = nextNodeIndex;
+    }
+
+    if( m_nodes[nodeIndex].patternIndex != std::string::npos )
+    {
+        return false;
+    }
+
+    m_nodes[nodeIndex].patternIndex = index;
+    return true;
+}
+
+// States of the automaton being simulated. Each node is marked with the step when it was last added, so that the states
+// at each step are not repeated without searching them. The states are kept per thread and reused for every match, so
+// that matching does not allocate memory.
+struct Config::OverrideMap::PatternSet::MatchStates
+{
+    std::vector<size_t> states;
+    std::vector<size_t> nextStates;
+    std::vector<size_t> nodeSteps;
+    size_t step = 0;
+};
+
+void Config::OverrideMap::PatternSet::AddState( size_t nodeIndex, MatchStates &matchStates, std::vector<size_t> &states ) const noexcept
+{
+    if( matchStates.nodeSteps[nodeIndex] != matchStates.step )
+    {
+        matchStates.nodeSteps[nodeIndex] = matchStates.step;
+        states.push_back( nodeIndex );
+
+        // A '*' wildcard may match an empty sequence, therefore it is also reached without consuming characters
+        if( m_nodes[nodeIndex].anySequenceChild != std::string::npos )
+        {
+            AddState( m_nodes[nodeIndex].anySequenceChild, matchStates, states );
+        }
+    }
+}
+
+size_t Config::OverrideMap::PatternSet::Match( std::string_view key ) const noexcept
+{
+    if( m_nodes.empty() )
+    {
+        return std::string::npos;
+    }
+
+    thread_local MatchStates matchStates;
+    if( matchStates.nodeSteps.size() < m_nodes.size() )
+    {
+        matchStates.nodeSteps.resize( m_nodes.size(), 0 );
+    }
+
+    std::vector<size_t> &states = matchStates.states;
+    std::vector<size_t> &nextStates = matchStates.nextStates;
+
+    states.clear();
+    matchStates.step++;
+    AddState( 0, matchStates, states );
+
+    for( char c : key )
+    {
+        nextStates.clear();
+        matchStates.step++;
+
+        for( size_t nodeIndex : states )
+        {
+            const Node &node = m_nodes[nodeIndex];
+
+            if( node.isAnySequence )
+            {
+                AddState( nodeIndex, matchStates, nextStates );
+            }
+
+            auto it = node.children.find( c );
+            if( it != node.children.end() )
+            {
+                AddState( it->second, matchStates, nextStates );
+            }
+
+            if( node.anyCharChild != std::string::npos )
+            {
+                AddState( node.anyCharChild, matchStates, nextStates );
+            }
+        }
+
+        if( nextStates.empty() )
+        {
+            return std::string::npos;
+        }
+
+        states.swap( nextStates );
+    }
+
+    size_t patternIndex = std::string::npos;
+    for( size_t nodeIndex : states )
+    {
+        patternIndex = std::min( patternIndex, m_nodes[nodeIndex].patternIndex );
+    }
+
+    return patternIndex;
 }
 
 MockedType Config::OverrideSpec::GetType() const noexcept
@@ -11,7 +11,10 @@
 #define CPPUMOCKGEN_CONFIG_HPP_
 
 #include <string>
+#include <string_view>
 #include <map>
+#include <unordered_map>
+#include <deque>
 #include <vector>
 #include <utility>
 
@@ -124,9 +127,11 @@ public:
      * @param[in] useUnderlyingTypedefType Indicates whether to use the underlying type of typedefs or the typedef name
      *                                     to identify function parameters types
      * @param[in] typeOverrideOptions Override options for specific or generic parameter or return types (see OverrideMap)
+     * @param[in] typeMapOptions Types to be used for type names that are not declared when parsing single files, each
+     *                           consisting in a pair of type name / type separated by a '=' character
      */
     Config( bool interpretAsCpp, const std::string &languageStandard, bool useUnderlyingTypedefType, 
-            const std::vector<std::string> &typeOverrideOptions );
+            const std::vector<std::string> &typeOverrideOptions, const std::vector<std::string> &typeMapOptions );
 
     /**
      * Returns if the header file must be interpreted as C++.
@@ -151,11 +156,23 @@ public:
      * @param[in] key Identifier for a parameter or return type
      * @return A pointer to an override spec, or NULL if it does not exist
      */
-    const OverrideSpec* GetTypeOverride( const std::string& key ) const noexcept;
+    const OverrideSpec* GetTypeOverride( std::string_view key ) const noexcept;
+
+    /**
+     * Returns the declarations of the type names in the type map, which must be prepended to header files that are
+     * parsed without reading the files that they include.
+     *
+     * @return String with a typedef declaration for each type name in the type map
+     */
+    const std::string& GetTypeMapDeclarations() const noexcept;
 
 private:
     /**
      * Correspondences between an element and its related override specification.
+     *
+     * Element identifiers prefixed by '%' are patterns, where '?' matches any single character, '*' matches any
+     * sequence of characters and '\\' makes the next character match itself (e.g. "%#int \\*"). Elements are first
+     * looked up by exact identifier, and then matched against the patterns in the order they were passed.
      */
     class OverrideMap
     {
@@ -168,6 +185,12 @@ private:
          */
         OverrideMap( const std::vector<std::string> &options );
 
+        /**
+         * Copying is not allowed, since the exact keys are indexed by views of the strings stored by the object.
+         */
+        OverrideMap( const OverrideMap & ) = delete;
+        OverrideMap& operator=( const OverrideMap & ) = delete;
+
         /**
          * Returns the override specification related to an element represented by @p key
          * (if it exists).
@@ -175,17 +198,69 @@ private:
          * @param[in] key Identifier for an element
          * @return A pointer to an override specification, or NULL if it does not exist
          */
-        const OverrideSpec* GetOverride( const std::string& key ) const noexcept;
+        const OverrideSpec* GetOverride( std::string_view key ) const noexcept;
 
     private:
-        typedef std::map<std::string, OverrideSpec> OverrideMapType;
+        /**
+         * Automaton that matches element identifiers against a set of patterns.
+         *
+         * Patterns are compiled into a trie whose nodes are the states of a non-deterministic automaton, so that
+         * patterns sharing a prefix share states. Matching an identifier steps once per character over the states
+         * that are active at once, each counted only once, therefore its cost depends on the number of patterns
+         * only through the '*' wildcards of the patterns that match a prefix of the identifier.
+         */
+        class PatternSet
+        {
+        public:
+            /**
+             * Adds a pattern to the set.
+             *
+             * @param[in] pattern Pattern, where each character is paired with a flag that indicates if it is a wildcard
+             * @param[in] index Index of the pattern, which must be increasing for each pattern added
+             * @return @c false if the same pattern was already added, @c true otherwise
+             */
+            bool Add( const std::vector<std::pair<char, bool>> &pattern, size_t index );
+
+            /**
+             * Matches an element identifier against the patterns in the set.
+             *
+             * @param[in] key Identifier for an element
+             * @return The lowest index of the patterns that match @p key, or @c std::string::npos if none matches
+             */
+            size_t Match( std::string_view key ) const noexcept;
+
+        private:
+            struct Node
+            {
+                std::map<char, size_t> children;
+                size_t anyCharChild = std::string::npos;
+                size_t anySequenceChild = std::string::npos;
+                bool isAnySequence = false;
+                size_t patternIndex = std::string::npos;
+            };
+
+            struct MatchStates;
+
+            void AddState( size_t nodeIndex, MatchStates &matchStates, std::vector<size_t> &states ) const noexcept;
+
+            std::vector<Node> m_nodes;
+        };
+
+        // Exact keys are stored in a container that never relocates them, so that the hash index can be looked up
+        // with views of the keys without allocating
+        typedef std::unordered_map<std::string_view, OverrideSpec> OverrideMapType;
+        std::deque<std::string> m_keys;
         OverrideMapType m_map;
+        std::vector<OverrideSpec> m_patternSpecs;
+        PatternSet m_specificPatterns;
+        PatternSet m_genericPatterns;
     };
 
     bool m_interpretAsCpp;
     std::string m_languageStandard;
     bool m_useUnderlyingTypedefType;
     OverrideMap m_typeOverrideMap;
+    std::string m_typeMapDeclarations;
 };
 
 #endif // header guard
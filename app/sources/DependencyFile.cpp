@@ -0,0 +1,63 @@
+/**
+ * @file
+ * @brief      Implementation of DependencyFile class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "DependencyFile.hpp"
+
+#include <sstream>
+
+static std::string EscapePath( const std::filesystem::path &path )
+{
+    std::string ret;
+
+    for( char c : path.generic_string() )
+    {
+        switch( c )
+        {
+            case ' ':
+            case '#':
+                ret += '\\';
+                ret += c;
+                break;
+
+            case '$':
+                ret += "$$";
+                break;
+
+            default:
+                ret += c;
+                break;
+        }
+    }
+
+    return ret;
+}
+
+DependencyFile::DependencyFile( const std::vector<std::filesystem::path> &targets ) noexcept
+: m_targets( targets )
+{
+}
+
+std::string DependencyFile::Generate( const std::vector<std::filesystem::path> &dependencies ) const
+{
+    std::ostringstream output;
+
+    for( size_t i = 0; i < m_targets.size(); i++ )
+    {
+        output << ( ( i > 0 ) ? " " : "" ) << EscapePath( m_targets[i] );
+    }
+    output << ":";
+
+    for( const std::filesystem::path &dependency : dependencies )
+    {
+        output << " \\" << std::endl << "  " << EscapePath( dependency );
+    }
+    output << std::endl;
+
+    return output.str();
+}
@@ -0,0 +1,43 @@
+/**
+ * @file
+ * @brief      Header of DependencyFile class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_DEPENDENCYFILE_HPP_
+#define CPPUMOCKGEN_DEPENDENCYFILE_HPP_
+
+#include <string>
+#include <vector>
+#include <filesystem>
+
+/**
+ * Class that generates dependency files (a.k.a. depfiles) in the format understood by Make and Ninja, which list the
+ * files that output files were generated from, so that build systems can detect when they must be regenerated.
+ */
+class DependencyFile
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param[in] targets Paths to the output files that depend on the dependencies
+     */
+    DependencyFile( const std::vector<std::filesystem::path> &targets ) noexcept;
+
+    /**
+     * Generates the contents of the dependency file.
+     *
+     * @param[in] dependencies Paths to the files used to generate the targets
+     * @return Contents of the dependency file
+     */
+    std::string Generate( const std::vector<std::filesystem::path> &dependencies ) const;
+
+private:
+    std::vector<std::filesystem::path> m_targets;
+};
+
+#endif // header guard
@@ -1,61 +1,383 @@
-/**
- * @file
- * @brief      Implementation of file handling helper functions
- * @project    CppUMockGen
- * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
- * @copyright  Copyright (c) 2017-2020 Jesus Gonzalez. All rights reserved.
- * @license    See LICENSE.txt
- */
-
-#include "FileHelper.hpp"
-
-#include <filesystem>
-#include <set>
-
-#include "StringHelper.hpp"
-
-bool IsDirPath( const std::filesystem::path &path ) noexcept
-{
-    return ( !path.empty() && 
-             ( !path.has_filename() ||
-               std::filesystem::is_directory( path ) ) );
-}
-
-void ConvertToDirPath( std::filesystem::path &path ) noexcept
-{
-    if( !path.empty() && path.has_filename() )
-    {
-        path /= "";
-    }
-}
-
-const std::set<std::string> cppHeaderExtensions = { ".hpp", ".hxx", ".hh" };
-const std::set<std::string> cppImplExtensions = { ".cpp", ".cxx", ".cc" };
-
-static bool IsCppHeaderExtension( const std::string &extension ) noexcept
-{
-    return ( cppHeaderExtensions.count( extension ) > 0 );
-}
-
-static bool IsCppImplExtension( const std::string &extension ) noexcept
-{
-    return ( cppImplExtensions.count( extension ) > 0 );
-}
-
-bool HasCppExtension( const std::filesystem::path &path ) noexcept
-{
-    auto extension = ToLower( path.extension().generic_string() );
-    return IsCppImplExtension( extension ) || IsCppHeaderExtension( extension );
-}
-
-bool HasCppImplExtension( const std::filesystem::path &path ) noexcept
-{
-    auto extension = ToLower( path.extension().generic_string() );
-    return IsCppImplExtension( extension );
-}
-
-bool HasCppHeaderExtension( const std::filesystem::path &path ) noexcept
-{
-    auto extension = ToLower( path.extension().generic_string() );
-    return IsCppHeaderExtension( extension );
-}
+/**
+ * @file
+ * @brief      Implementation of file handling helper functions
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2017-2020 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "FileHelper.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <set>
+#include <random>
+#include <algorithm>
+#include <system_error>
+#include <memory>
+#include <cstring>
+#include <cerrno>
+#include <climits>
+
+#ifdef WIN32
+#include <io.h>
+#include <share.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+
+#include "StringHelper.hpp"
+
+bool IsDirPath( const std::filesystem::path &path ) noexcept
+{
+    return ( !path.empty() && 
+             ( !path.has_filename() ||
+               std::filesystem::is_directory( path ) ) );
+}
+
+void ConvertToDirPath( std::filesystem::path &path ) noexcept
+{
+    if( !path.empty() && path.has_filename() )
+    {
+        path /= "";
+    }
+}
+
+const std::set<std::string> cppHeaderExtensions = { ".hpp", ".hxx", ".hh" };
+const std::set<std::string> cppImplExtensions = { ".cpp", ".cxx", ".cc" };
+
+static bool IsCppHeaderExtension( const std::string &extension ) noexcept
+{
+    return ( cppHeaderExtensions.count( extension ) > 0 );
+}
+
+static bool IsCppImplExtension( const std::string &extension ) noexcept
+{
+    return ( cppImplExtensions.count( extension ) > 0 );
+}
+
+bool HasCppExtension( const std::filesystem::path &path ) noexcept
+{
+    auto extension = ToLower( path.extension().generic_string() );
+    return IsCppImplExtension( extension ) || IsCppHeaderExtension( extension );
+}
+
+bool HasCppImplExtension( const std::filesystem::path &path ) noexcept
+{
+    auto extension = ToLower( path.extension().generic_string() );
+    return IsCppImplExtension( extension );
+}
+
+bool HasCppHeaderExtension( const std::filesystem::path &path ) noexcept
+{
+    auto extension = ToLower( path.extension().generic_string() );
+    return IsCppHeaderExtension( extension );
+}
+
+#ifdef WIN32
+
+static bool FileHasContents( const std::filesystem::path &path, const std::string &contents ) noexcept
+{
+    std::ifstream file( path );
+    if( !file.is_open() )
+    {
+        return false;
+    }
+
+    std::ostringstream currentContents;
+    currentContents << file.rdbuf();
+    return ( currentContents.str() == contents );
+}
+
+static int OpenNewFile( const std::filesystem::path &path ) noexcept
+{
+    // Files are written in text mode, like the rest of files written by standard streams
+    int fd = -1;
+    errno = _wsopen_s( &fd, path.c_str(), ( _O_WRONLY | _O_CREAT | _O_EXCL | _O_TEXT | _O_NOINHERIT ), _SH_DENYNO,
+                       ( _S_IREAD | _S_IWRITE ) );
+    return fd;
+}
+
+static bool WriteAll( int fd, const char *data, size_t size ) noexcept
+{
+    while( size > 0 )
+    {
+        unsigned int chunkSize = static_cast<unsigned int>( std::min<size_t>( size, INT_MAX ) );
+        int numWritten = _write( fd, data, chunkSize );
+        if( numWritten < 0 )
+        {
+            return false;
+        }
+        data += numWritten;
+        size -= static_cast<size_t>( numWritten );
+    }
+
+    return true;
+}
+
+static bool CloseFile( int fd ) noexcept
+{
+    return ( _close( fd ) == 0 );
+}
+
+#else
+
+static bool ReadAll( int fd, char *data, size_t size ) noexcept
+{
+    while( size > 0 )
+    {
+        ssize_t numRead = read( fd, data, size );
+        if( numRead <= 0 )
+        {
+            if( ( numRead < 0 ) && ( errno == EINTR ) )
+            {
+                continue; // LCOV_EXCL_LINE: Defensive
+            }
+            return false;
+        }
+        data += numRead;
+        size -= static_cast<size_t>( numRead );
+    }
+
+    return true;
+}
+
+static bool FileHasContents( const std::filesystem::path &path, const std::string &contents ) noexcept
+{
+    int fd = open( path.c_str(), ( O_RDONLY | O_CLOEXEC ) );
+    if( fd < 0 )
+    {
+        return false;
+    }
+
+    // Only files with the expected size are read, in a single call into a buffer of the right size
+    bool hasContents = false;
+    struct stat fileStatus;
+    if( ( fstat( fd, &fileStatus ) == 0 ) && S_ISREG( fileStatus.st_mode ) &&
+        ( static_cast<size_t>( fileStatus.st_size ) == contents.size() ) )
+    {
+        std::unique_ptr<char[]> currentContents( new char[ contents.size() ] );
+        hasContents = ReadAll( fd, currentContents.get(), contents.size() ) &&
+                      ( contents.compare( 0, contents.size(), currentContents.get(), contents.size() ) == 0 );
+    }
+
+    close( fd );
+
+    return hasContents;
+}
+
+static int OpenNewFile( const std::filesystem::path &path ) noexcept
+{
+    return open( path.c_str(), ( O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC ), 0666 );
+}
+
+static bool WriteAll( int fd, const char *data, size_t size ) noexcept
+{
+    // Usually the whole contents are written by a single call
+    while( size > 0 )
+    {
+        ssize_t numWritten = write( fd, data, size );
+        if( numWritten < 0 )
+        {
+            if( errno == EINTR )
+            {
+                continue; // LCOV_EXCL_LINE: Defensive
+            }
+            return false; // LCOV_EXCL_LINE: Defensive
+        }
+        data += numWritten;
+        size -= static_cast<size_t>( numWritten );
+    }
+
+    return true;
+}
+
+static bool CloseFile( int fd ) noexcept
+{
+    return ( close( fd ) == 0 );
+}
+
+#endif
+
+static int CreateTempFile( const std::filesystem::path &path, std::filesystem::path &tempPath ) noexcept
+{
+    // Temporary files are created exclusively with unpredictable names in the directory of the target file, and names
+    // that already exist (e.g. temporary files of other writers) are never reused nor removed, but skipped
+    static const int MAX_ATTEMPTS = 100;
+    static thread_local std::mt19937_64 randomGenerator( std::random_device{}() );
+    for( int attempt = 0; attempt < MAX_ATTEMPTS; attempt++ )
+    {
+        tempPath = path;
+        tempPath += ".tmp" + std::to_string( randomGenerator() );
+        int fd = OpenNewFile( tempPath );
+        if( ( fd >= 0 ) || ( errno != EEXIST ) )
+        {
+            return fd;
+        }
+    }
+
+    return -1; // LCOV_EXCL_LINE: Defensive
+}
+
+static void CopyPermissions( const std::filesystem::path &fromPath, const std::filesystem::path &toPath ) noexcept
+{
+    // The replaced file keeps its permissions, instead of getting the default ones of newly created files
+    std::error_code ec;
+    std::filesystem::file_status fromStatus = std::filesystem::status( fromPath, ec );
+    if( !ec && std::filesystem::exists( fromStatus ) )
+    {
+        std::filesystem::permissions( toPath, fromStatus.permissions(), std::filesystem::perm_options::replace, ec );
+    }
+}
+
+static bool FilesHaveSameContents( const std::filesystem::path &path1, const std::filesystem::path &path2 ) noexcept
+{
+    std::error_code ec1;
+    std::error_code ec2;
+    if( std::filesystem::file_size( path1, ec1 ) != std::filesystem::file_size( path2, ec2 ) || ec1 || ec2 )
+    {
+        return false;
+    }
+
+    std::ifstream file1( path1, std::ios::binary );
+    std::ifstream file2( path2, std::ios::binary );
+    if( !file1.is_open() || !file2.is_open() )
+    {
+        return false; // LCOV_EXCL_LINE: Defensive
+    }
+
+    // Files are compared in blocks, to avoid reading them whole into memory
+    static const size_t BLOCK_SIZE = ( 64 * 1024 );
+    std::unique_ptr<char[]> block1( new char[ BLOCK_SIZE ] );
+    std::unique_ptr<char[]> block2( new char[ BLOCK_SIZE ] );
+    while( file1 && file2 )
+    {
+        file1.read( block1.get(), BLOCK_SIZE );
+        file2.read( block2.get(), BLOCK_SIZE );
+        if( ( file1.gcount() != file2.gcount() ) ||
+            ( std::memcmp( block1.get(), block2.get(), static_cast<size_t>( file1.gcount() ) ) != 0 ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+WriteResult WriteFileIfChanged( const std::filesystem::path &path, const std::string &contents ) noexcept
+{
+    // Files are only replaced when their contents change, to avoid triggering unnecessary rebuilds
+    if( FileHasContents( path, contents ) )
+    {
+        return WriteResult::UNCHANGED;
+    }
+
+    // Contents are written into a temporary file in the same directory, which then atomically replaces the target
+    // file, so that the target file is never left partially written
+    std::filesystem::path tempPath;
+    int fd = CreateTempFile( path, tempPath );
+    if( fd < 0 )
+    {
+        return WriteResult::FAILED;
+    }
+
+    std::error_code ec;
+    bool written = WriteAll( fd, contents.data(), contents.size() );
+    written = CloseFile( fd ) && written;
+    if( written )
+    {
+        CopyPermissions( path, tempPath );
+        std::filesystem::rename( tempPath, path, ec );
+    }
+
+    if( !written || ec )
+    {
+        std::filesystem::remove( tempPath, ec );
+        return WriteResult::FAILED;
+    }
+
+    return WriteResult::WRITTEN;
+}
+
+FileStreamWriter::FileStreamWriter( const std::filesystem::path &path )
+: m_path( path ), m_fd( CreateTempFile( path, m_tempPath ) ), m_failed( m_fd < 0 ), m_committed( false )
+{
+}
+
+FileStreamWriter::~FileStreamWriter()
+{
+    if( !m_committed && ( m_fd >= 0 ) )
+    {
+        CloseFile( m_fd );
+        std::error_code ec;
+        std::filesystem::remove( m_tempPath, ec );
+    }
+}
+
+void FileStreamWriter::Write( const std::string &contents ) noexcept
+{
+    // Chunks are accumulated in a buffer, so that small chunks do not result in a system call each
+    static const size_t BUFFER_SIZE = ( 64 * 1024 );
+    m_buffer += contents;
+    if( m_buffer.size() >= BUFFER_SIZE )
+    {
+        Flush();
+    }
+}
+
+void FileStreamWriter::Flush() noexcept
+{
+    if( !m_failed && !WriteAll( m_fd, m_buffer.data(), m_buffer.size() ) )
+    {
+        m_failed = true;
+    }
+    m_buffer.clear();
+}
+
+WriteResult FileStreamWriter::Commit() noexcept
+{
+    m_committed = true;
+
+    // Nothing is left to be removed when the temporary file could not be created
+    if( m_fd < 0 )
+    {
+        return WriteResult::FAILED;
+    }
+
+    Flush();
+    bool written = CloseFile( m_fd ) && !m_failed;
+
+    std::error_code ec;
+    WriteResult result = WriteResult::WRITTEN;
+    if( !written )
+    {
+        result = WriteResult::FAILED;
+    }
+    else if( FilesHaveSameContents( m_tempPath, m_path ) )
+    {
+        // Files are only replaced when their contents change, to avoid triggering unnecessary rebuilds
+        result = WriteResult::UNCHANGED;
+    }
+    else
+    {
+        CopyPermissions( m_path, m_tempPath );
+        std::filesystem::rename( m_tempPath, m_path, ec );
+        if( ec )
+        {
+            result = WriteResult::FAILED;
+        }
+    }
+
+    if( result != WriteResult::WRITTEN )
+    {
+        std::filesystem::remove( m_tempPath, ec );
+    }
+
+    return result;
+}
@@ -1,24 +1,60 @@
-/**
- * @file
- * @brief      Header of file handling helper functions
- * @project    CppUMockGen
- * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
- * @copyright  Copyright (c) 2017-2020 Jesus Gonzalez. All rights reserved.
- * @license    See LICENSE.txt
- */
-
-#ifndef CPPUMOCKGEN_FILEHELPER_HPP_
-#define CPPUMOCKGEN_FILEHELPER_HPP_
-
-#include <string>
-#include <filesystem>
-
-bool IsDirPath( const std::filesystem::path &path ) noexcept;
-
-void ConvertToDirPath( std::filesystem::path &path ) noexcept;
-
-bool HasCppExtension( const std::filesystem::path &path ) noexcept;
-bool HasCppImplExtension( const std::filesystem::path &path ) noexcept;
-bool HasCppHeaderExtension( const std::filesystem::path &path ) noexcept;
-
-#endif // header guard
+/**
+ * @file
+ * @brief      Header of file handling helper functions
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2017-2020 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_FILEHELPER_HPP_
+#define CPPUMOCKGEN_FILEHELPER_HPP_
+
+#include <string>
+#include <filesystem>
+#include <fstream>
+
+bool IsDirPath( const std::filesystem::path &path ) noexcept;
+
+void ConvertToDirPath( std::filesystem::path &path ) noexcept;
+
+bool HasCppExtension( const std::filesystem::path &path ) noexcept;
+bool HasCppImplExtension( const std::filesystem::path &path ) noexcept;
+bool HasCppHeaderExtension( const std::filesystem::path &path ) noexcept;
+
+enum class WriteResult { UNCHANGED, WRITTEN, FAILED };
+
+WriteResult WriteFileIfChanged( const std::filesystem::path &path, const std::string &contents ) noexcept;
+
+/**
+ * Class used to write a file in chunks, so that its whole contents do not need to be kept in memory.
+ *
+ * The contents are written into a temporary file created exclusively by the writer, which replaces the file when
+ * committed only if its contents changed. The temporary file is removed if the writer is destroyed without being
+ * committed.
+ */
+class FileStreamWriter
+{
+public:
+    FileStreamWriter( const std::filesystem::path &path );
+    ~FileStreamWriter();
+
+    FileStreamWriter( const FileStreamWriter& ) = delete;
+    FileStreamWriter& operator=( const FileStreamWriter& ) = delete;
+
+    void Write( const std::string &contents ) noexcept;
+
+    WriteResult Commit() noexcept;
+
+private:
+    void Flush() noexcept;
+
+    std::filesystem::path m_path;
+    std::filesystem::path m_tempPath;
+    int m_fd;
+    std::string m_buffer;
+    bool m_failed;
+    bool m_committed;
+};
+
+#endif // header guard
@@ -0,0 +1,237 @@
+/**
+ * @file
+ * @brief      Implementation of FileWatcher class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "FileWatcher.hpp"
+
+#include <set>
+#include <string>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef __linux__
+#include <cerrno>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+// Time to wait for further changes once a change has been detected
+static const int SETTLE_TIME_MS = 100;
+
+#ifndef __linux__
+static const int POLL_PERIOD_MS = 250;
+#endif
+
+static std::filesystem::path NormalizePath( const std::filesystem::path &path )
+{
+    return std::filesystem::absolute( path ).lexically_normal();
+}
+
+FileWatcher::FileWatcher() noexcept
+#ifdef __linux__
+: m_fd( -1 )
+#endif
+{
+}
+
+FileWatcher::~FileWatcher()
+{
+#ifdef __linux__
+    if( m_fd >= 0 )
+    {
+        close( m_fd );
+    }
+#endif
+}
+
+void FileWatcher::Watch( const std::vector<std::filesystem::path> &filePaths )
+{
+    m_watchedFiles.clear();
+
+    for( const std::filesystem::path &filePath : filePaths )
+    {
+        m_watchedFiles[ NormalizePath( filePath ) ] = filePath;
+    }
+
+#ifdef __linux__
+    if( m_fd < 0 )
+    {
+        m_fd = inotify_init1( IN_CLOEXEC );
+        if( m_fd < 0 )
+        {
+            throw std::runtime_error( "File changes cannot be watched." ); // LCOV_EXCL_LINE: Defensive
+        }
+    }
+
+    // Directories are watched instead of files, because editors usually replace files instead of modifying them
+    std::set<std::filesystem::path> dirPaths;
+    for( const auto &watchedFile : m_watchedFiles )
+    {
+        dirPaths.insert( watchedFile.first.parent_path() );
+    }
+
+    for( auto it = m_watchedDirs.begin(); it != m_watchedDirs.end(); )
+    {
+        if( dirPaths.erase( it->second ) == 0 )
+        {
+            inotify_rm_watch( m_fd, it->first );
+            it = m_watchedDirs.erase( it );
+        }
+        else
+        {
+            it++;
+        }
+    }
+
+    for( const std::filesystem::path &dirPath : dirPaths )
+    {
+        int wd = inotify_add_watch( m_fd, dirPath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE );
+        if( wd < 0 )
+        {
+            std::string errorMsg = "Directory '" + dirPath.generic_string() + "' cannot be watched.";
+            throw std::runtime_error( errorMsg );
+        }
+        m_watchedDirs[ wd ] = dirPath;
+    }
+#else
+    m_fileTimes.clear();
+
+    for( const auto &watchedFile : m_watchedFiles )
+    {
+        std::error_code ec;
+        std::filesystem::file_time_type fileTime = std::filesystem::last_write_time( watchedFile.first, ec );
+        m_fileTimes[ watchedFile.first ] = ( ec ? std::filesystem::file_time_type::min() : fileTime );
+    }
+#endif
+}
+
+std::vector<std::filesystem::path> FileWatcher::WaitForChanges()
+{
+    if( m_watchedFiles.empty() )
+    {
+        throw std::runtime_error( "There are no files to be watched." );
+    }
+
+    std::set<std::filesystem::path> changedFiles;
+
+#ifdef __linux__
+    int timeout = -1;
+
+    while( true )
+    {
+        struct pollfd pfd = { m_fd, POLLIN, 0 };
+        int ret = poll( &pfd, 1, timeout );
+        if( ret == 0 )
+        {
+            // No more changes after the settle time
+            break;
+        }
+        else if( ret < 0 )
+        {
+// LCOV_EXCL_START: Defensive
+            if( errno == EINTR )
+            {
+                continue;
+            }
+            throw std::runtime_error( "File changes cannot be watched." );
+// LCOV_EXCL_STOP
+        }
+
+        alignas( struct inotify_event ) char buffer[ 4096 ];
+        ssize_t length = read( m_fd, buffer, sizeof( buffer ) );
+        if( length <= 0 )
+        {
+            throw std::runtime_error( "File changes cannot be watched." ); // LCOV_EXCL_LINE: Defensive
+        }
+
+        const char *ptr = buffer;
+        while( ptr < ( buffer + length ) )
+        {
+            const struct inotify_event *event = (const struct inotify_event *) ptr;
+            ptr += sizeof( struct inotify_event ) + event->len;
+
+            if( event->mask & IN_Q_OVERFLOW )
+            {
+// LCOV_EXCL_START: Defensive
+                // Events have been lost, therefore any of the watched files may have changed
+                for( const auto &watchedFile : m_watchedFiles )
+                {
+                    changedFiles.insert( watchedFile.second );
+                }
+                continue;
+// LCOV_EXCL_STOP
+            }
+
+            auto watchedDir = m_watchedDirs.find( event->wd );
+            if( watchedDir == m_watchedDirs.end() )
+            {
+                continue;
+            }
+
+            if( event->mask & IN_IGNORED )
+            {
+                // The watched directory has been removed
+                m_watchedDirs.erase( watchedDir );
+            }
+            else if( event->len > 0 )
+            {
+                auto watchedFile = m_watchedFiles.find( watchedDir->second / event->name );
+                if( watchedFile != m_watchedFiles.end() )
+                {
+                    changedFiles.insert( watchedFile->second );
+                }
+            }
+        }
+
+        if( !changedFiles.empty() )
+        {
+            timeout = SETTLE_TIME_MS;
+        }
+        else if( m_watchedDirs.empty() )
+        {
+            // Nothing left to be watched
+            break;
+        }
+    }
+#else
+    while( true )
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( changedFiles.empty() ? POLL_PERIOD_MS : SETTLE_TIME_MS ) );
+
+        bool changed = false;
+        for( auto &fileTime : m_fileTimes )
+        {
+            std::error_code ec;
+            std::filesystem::file_time_type currentFileTime = std::filesystem::last_write_time( fileTime.first, ec );
+            if( ec )
+            {
+                currentFileTime = std::filesystem::file_time_type::min();
+            }
+
+            if( currentFileTime != fileTime.second )
+            {
+                fileTime.second = currentFileTime;
+                changedFiles.insert( m_watchedFiles[ fileTime.first ] );
+                changed = true;
+            }
+        }
+
+        if( !changed && !changedFiles.empty() )
+        {
+            // No more changes after the settle time
+            break;
+        }
+    }
+#endif
+
+    return std::vector<std::filesystem::path>( changedFiles.begin(), changedFiles.end() );
+}
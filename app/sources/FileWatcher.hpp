@@ -0,0 +1,68 @@
+/**
+ * @file
+ * @brief      Header of FileWatcher class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_FILEWATCHER_HPP_
+#define CPPUMOCKGEN_FILEWATCHER_HPP_
+
+#include <vector>
+#include <map>
+#include <filesystem>
+
+/**
+ * Class that monitors a set of files for changes.
+ *
+ * On Linux the directories containing the watched files are monitored using inotify, so that files replaced by editors
+ * (i.e. written to a temporary file which is then renamed) are also detected. On other platforms the modification time
+ * of the watched files is polled periodically.
+ */
+class FileWatcher
+{
+public:
+    /**
+     * Constructor.
+     */
+    FileWatcher() noexcept;
+
+    /**
+     * Destructor.
+     */
+    ~FileWatcher();
+
+    /**
+     * Sets the files to be watched, replacing the previously watched ones.
+     *
+     * @param[in] filePaths Paths to the files to be watched
+     * @throws std::runtime_error If the files cannot be watched
+     */
+    void Watch( const std::vector<std::filesystem::path> &filePaths );
+
+    /**
+     * Waits until any of the watched files changes.
+     *
+     * Changes happening in a short lapse after the first one (e.g. when several files are saved at once) are reported
+     * together. If changes may have been missed (e.g. because too many happened at once), all the watched files are
+     * reported as changed.
+     *
+     * @return Paths to the changed files, as passed to Watch(), or an empty list if none of the watched files can be
+     *         watched any more (e.g. because their directories have been removed)
+     * @throws std::runtime_error If the files cannot be watched
+     */
+    std::vector<std::filesystem::path> WaitForChanges();
+
+private:
+    std::map<std::filesystem::path, std::filesystem::path> m_watchedFiles;
+#ifdef __linux__
+    int m_fd;
+    std::map<int, std::filesystem::path> m_watchedDirs;
+#else
+    std::map<std::filesystem::path, std::filesystem::file_time_type> m_fileTimes;
+#endif
+};
+
+#endif // header guard
@@ -12,9 +12,15 @@
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <algorithm>
+#include <unordered_map>
 
 #include "ClangHelper.hpp"
 #include "StringHelper.hpp"
+#include "StringPool.hpp"
+#include "CodeEmitter.hpp"
+#include "TimeReport.hpp"
 
 //*************************************************************************************************
 //                                             CONSTANTS
@@ -28,6 +34,549 @@
 #define SIZEOF_VAR_PREFIX       "__sizeof_"
 #define INDENT                  "    "
 
+//*************************************************************************************************
+//
+//                                        MODEL SERIALIZATION
+//
+//*************************************************************************************************
+
+static void WriteNumber( std::ostream &output, size_t value )
+{
+    output << value << '\n';
+}
+
+static bool ReadNumber( std::istream &input, size_t &value )
+{
+    return ( input >> value ) && ( input.get() == '\n' );
+}
+
+static void WriteFlag( std::ostream &output, bool value )
+{
+    WriteNumber( output, value ? 1 : 0 );
+}
+
+static bool ReadFlag( std::istream &input, bool &value )
+{
+    size_t number;
+    if( !ReadNumber( input, number ) || ( number > 1 ) )
+    {
+        return false;
+    }
+
+    value = ( number == 1 );
+    return true;
+}
+
+static void WriteString( std::ostream &output, const std::string &value )
+{
+    // Strings are prefixed by their size, so that they may contain any character
+    output << value.size() << ':' << value << '\n';
+}
+
+static bool ReadString( std::istream &input, std::string &value )
+{
+    size_t size;
+    if( !( input >> size ) || ( input.get() != ':' ) )
+    {
+        return false;
+    }
+
+    value.resize( size );
+    return input.read( &value[0], size ) && ( input.get() == '\n' );
+}
+
+// String of the model of a function. When a type cache with a string pool exists, strings are interned in the pool, so
+// that the models of all the functions share the storage of equal strings (e.g. types, expression modifiers and
+// parameter names), which is then also copied without allocating memory when returns and arguments are cloned.
+class ModelString
+{
+public:
+    ModelString() noexcept {}
+
+    ModelString( const std::string &str ) : m_string( Intern( str ) ) {}
+
+    explicit ModelString( const std::shared_ptr<const std::string> &internedStr ) noexcept : m_string( internedStr ) {}
+
+    ModelString& operator=( const std::string &str )
+    {
+        m_string = Intern( str );
+        return *this;
+    }
+
+    const std::string& str() const noexcept
+    {
+        static const std::string emptyString;
+        return m_string ? *m_string : emptyString;
+    }
+
+    operator const std::string&() const noexcept
+    {
+        return str();
+    }
+
+    bool empty() const noexcept
+    {
+        return !m_string;
+    }
+
+    void clear() noexcept
+    {
+        m_string.reset();
+    }
+
+    static std::shared_ptr<const std::string> Intern( const std::string &str );
+
+private:
+    std::shared_ptr<const std::string> m_string;
+};
+
+static std::string operator+( const ModelString &str1, const std::string &str2 )
+{
+    return str1.str() + str2;
+}
+
+static std::string operator+( const std::string &str1, const ModelString &str2 )
+{
+    return str1 + str2.str();
+}
+
+static std::string operator+( const ModelString &str1, const char *str2 )
+{
+    return str1.str() + str2;
+}
+
+static bool ReadString( std::istream &input, ModelString &value )
+{
+    std::string str;
+    if( !ReadString( input, str ) )
+    {
+        return false;
+    }
+
+    value = str;
+    return true;
+}
+
+static const Config::OverrideSpec* GetTypeOverride( const Config &config, const std::string &scope, char separator,
+                                                    const std::string &name )
+{
+    // Override keys are built into a buffer reused by all the lookups done from the same thread, so that looking up
+    // overrides does not allocate memory
+    thread_local std::string key;
+    key.assign( scope ).append( 1, separator ).append( name );
+
+    const Config::OverrideSpec *override = config.GetTypeOverride( key );
+
+    TimeReport::Count( TimeReport::Counter::OVERRIDE_LOOKUPS );
+    if( override != nullptr )
+    {
+        TimeReport::Count( TimeReport::Counter::OVERRIDES_HIT );
+    }
+
+    return override;
+}
+
+//*************************************************************************************************
+//
+//                                           TYPE ACCESSORS
+//
+//*************************************************************************************************
+
+// Type of a return or parameter as parsed, before applying any type override. It holds the information about the type
+// that is needed to process it, modeled like libclang does, so that functions can be processed again without the
+// source they were parsed from (libclang types are only valid while their translation unit exists), and in the same
+// way whether they were parsed by libclang or by the simple C parser.
+class Function::RawType
+{
+public:
+    RawType( CXTypeKind kind, bool isConst, const std::string &spelling,
+             const std::shared_ptr<const RawType> &subtype, const std::shared_ptr<const RawType> &canonical )
+    : m_kind( kind ), m_isConst( isConst ), m_spelling( spelling ), m_subtype( subtype ), m_canonical( canonical )
+    {}
+
+    CXTypeKind GetKind() const noexcept
+    {
+        return m_kind;
+    }
+
+    bool IsConst() const noexcept
+    {
+        return m_isConst;
+    }
+
+    const std::string& GetSpelling() const noexcept
+    {
+        return m_spelling;
+    }
+
+    const RawType& GetPointeeType() const noexcept
+    {
+        bool hasPointee = ( m_kind == CXType_Pointer ) || ( m_kind == CXType_LValueReference ) ||
+                          ( m_kind == CXType_RValueReference );
+        return hasPointee ? GetSubtype() : Invalid();
+    }
+
+    const RawType& GetElementType() const noexcept
+    {
+        bool hasElement = ( m_kind == CXType_ConstantArray ) || ( m_kind == CXType_IncompleteArray );
+        return hasElement ? GetSubtype() : Invalid();
+    }
+
+    const RawType& GetNamedType() const noexcept
+    {
+        return ( m_kind == CXType_Elaborated ) ? GetSubtype() : Invalid();
+    }
+
+    const RawType& GetCanonicalType() const noexcept
+    {
+        return m_canonical ? *m_canonical : *this;
+    }
+
+    static const RawType& Invalid() noexcept
+    {
+        static const RawType invalid( CXType_Invalid, false, "", nullptr, nullptr );
+        return invalid;
+    }
+
+    void Serialize( std::ostream &output ) const
+    {
+        WriteNumber( output, static_cast<size_t>( m_kind ) );
+        WriteFlag( output, m_isConst );
+        WriteString( output, m_spelling );
+
+        WriteFlag( output, bool( m_subtype ) );
+        if( m_subtype )
+        {
+            m_subtype->Serialize( output );
+        }
+
+        WriteFlag( output, bool( m_canonical ) );
+        if( m_canonical )
+        {
+            m_canonical->Serialize( output );
+        }
+    }
+
+    static std::shared_ptr<const RawType> Deserialize( std::istream &input )
+    {
+        size_t kind;
+        bool isConst;
+        std::string spelling;
+        bool hasSubtype;
+        std::shared_ptr<const RawType> subtype;
+        bool hasCanonical;
+        std::shared_ptr<const RawType> canonical;
+
+        if( !ReadNumber( input, kind ) || !ReadFlag( input, isConst ) || !ReadString( input, spelling ) ||
+            !ReadFlag( input, hasSubtype ) || ( hasSubtype && !( subtype = Deserialize( input ) ) ) ||
+            !ReadFlag( input, hasCanonical ) || ( hasCanonical && !( canonical = Deserialize( input ) ) ) )
+        {
+            return nullptr;
+        }
+
+        return std::make_shared<const RawType>( static_cast<CXTypeKind>( kind ), isConst, spelling, subtype, canonical );
+    }
+
+private:
+    const RawType& GetSubtype() const noexcept
+    {
+        return m_subtype ? *m_subtype : Invalid();
+    }
+
+    CXTypeKind m_kind;
+    bool m_isConst;
+    ModelString m_spelling;
+    std::shared_ptr<const RawType> m_subtype;
+    std::shared_ptr<const RawType> m_canonical;
+};
+
+// Raw types are built in the same way whether they were parsed by libclang or by the simple C parser, and they are
+// processed in the same way whether they were built from a parsed type or loaded from a serialized model, therefore
+// types are accessed through these overloads
+
+static CXTypeKind GetTypeKind( const CXType &type ) noexcept
+{
+    return type.kind;
+}
+
+static CXTypeKind GetTypeKind( const SimpleCParser::Type &type ) noexcept
+{
+    return type.GetKind();
+}
+
+static CXTypeKind GetTypeKind( const Function::RawType &type ) noexcept
+{
+    return type.GetKind();
+}
+
+static std::string GetTypeSpelling( const CXType &type ) noexcept
+{
+    return toString( clang_getTypeSpelling( type ) );
+}
+
+static std::string GetTypeSpelling( const SimpleCParser::Type &type ) noexcept
+{
+    return type.GetSpelling();
+}
+
+static std::string GetTypeSpelling( const Function::RawType &type ) noexcept
+{
+    return type.GetSpelling();
+}
+
+static std::string GetBareTypeSpelling( const Function::RawType &type ) noexcept
+{
+    return getBareTypeSpelling( type.GetSpelling() );
+}
+
+static bool IsConstQualifiedType( const CXType &type ) noexcept
+{
+    return clang_isConstQualifiedType( type );
+}
+
+static bool IsConstQualifiedType( const SimpleCParser::Type &type ) noexcept
+{
+    return type.IsConst();
+}
+
+static bool IsConstQualifiedType( const Function::RawType &type ) noexcept
+{
+    return type.IsConst();
+}
+
+static CXType GetPointeeType( const CXType &type ) noexcept
+{
+    return clang_getPointeeType( type );
+}
+
+static const SimpleCParser::Type& GetPointeeType( const SimpleCParser::Type &type ) noexcept
+{
+    return type.GetPointeeType();
+}
+
+static const Function::RawType& GetPointeeType( const Function::RawType &type ) noexcept
+{
+    return type.GetPointeeType();
+}
+
+static CXType GetElementType( const CXType &type ) noexcept
+{
+    return clang_getElementType( type );
+}
+
+static const SimpleCParser::Type& GetElementType( const SimpleCParser::Type &type ) noexcept
+{
+    return type.GetElementType();
+}
+
+static const Function::RawType& GetElementType( const Function::RawType &type ) noexcept
+{
+    return type.GetElementType();
+}
+
+static CXType GetNamedType( const CXType &type ) noexcept
+{
+    return clang_Type_getNamedType( type );
+}
+
+static const SimpleCParser::Type& GetNamedType( const SimpleCParser::Type &type ) noexcept
+{
+    return type.GetNamedType();
+}
+
+static const Function::RawType& GetNamedType( const Function::RawType &type ) noexcept
+{
+    return type.GetNamedType();
+}
+
+static CXType GetCanonicalType( const CXType &type ) noexcept
+{
+    return clang_getCanonicalType( type );
+}
+
+static const SimpleCParser::Type& GetCanonicalType( const SimpleCParser::Type &type ) noexcept
+{
+    return type.GetCanonicalType();
+}
+
+static const Function::RawType& GetCanonicalType( const Function::RawType &type ) noexcept
+{
+    return type.GetCanonicalType();
+}
+
+static bool IsSameType( const CXType &type1, const CXType &type2 ) noexcept
+{
+    return clang_equalTypes( type1, type2 );
+}
+
+static bool IsSameType( const SimpleCParser::Type &type1, const SimpleCParser::Type &type2 ) noexcept
+{
+    return ( &type1 == &type2 );
+}
+
+//*************************************************************************************************
+//
+//                                             TYPE CACHE
+//
+//*************************************************************************************************
+
+// Identifies a type, optionally processed with a given configuration. Types parsed by libclang are identified by their
+// internal data (which is unique for each distinct type in a translation unit), and types parsed by the simple C parser
+// and raw types by their address (since each distinct type is only instantiated once while a cache exists).
+struct TypeKey
+{
+    const void *type;
+    const void *context;
+    bool useUnderlyingTypedefType;
+
+    bool operator==( const TypeKey &other ) const noexcept
+    {
+        return ( type == other.type ) && ( context == other.context ) &&
+               ( useUnderlyingTypedefType == other.useUnderlyingTypedefType );
+    }
+};
+
+struct TypeKeyHash
+{
+    size_t operator()( const TypeKey &key ) const noexcept
+    {
+        size_t hash = std::hash<const void*>()( key.type );
+        hash = ( hash * 31 ) + std::hash<const void*>()( key.context );
+        return ( hash * 31 ) + ( key.useUnderlyingTypedefType ? 1 : 0 );
+    }
+};
+
+static TypeKey GetTypeKey( const CXType &type ) noexcept
+{
+    return { type.data[0], type.data[1], false };
+}
+
+static TypeKey GetTypeKey( const SimpleCParser::Type &type ) noexcept
+{
+    return { &type, nullptr, false };
+}
+
+static TypeKey GetTypeKey( const Function::RawType &type, const Config &config ) noexcept
+{
+    return { &type, nullptr, config.UseUnderlyingTypedefType() };
+}
+
+class ReturnStandard;
+class ArgumentStandard;
+
+struct Function::TypeCache::Entries
+{
+    std::unordered_map<TypeKey, std::shared_ptr<const Function::RawType>, TypeKeyHash> rawTypes;
+    std::unordered_map<std::string, std::shared_ptr<const Function::RawType>> loadedRawTypes;
+    std::unordered_map<TypeKey, std::unique_ptr<const ReturnStandard>, TypeKeyHash> returns;
+    std::unordered_map<TypeKey, std::unique_ptr<const ArgumentStandard>, TypeKeyHash> arguments;
+    std::unordered_map<std::string_view, std::shared_ptr<const std::string>> internedStrings;
+};
+
+template<typename TType>
+static std::shared_ptr<const Function::RawType> GetRawType( const TType &type );
+
+template<typename TType>
+static std::shared_ptr<const Function::RawType> BuildRawType( const TType &type )
+{
+    std::shared_ptr<const Function::RawType> subtype;
+    switch( GetTypeKind( type ) )
+    {
+        case CXType_Pointer:
+        case CXType_LValueReference:
+        case CXType_RValueReference:
+            subtype = GetRawType( GetPointeeType( type ) );
+            break;
+
+        case CXType_ConstantArray:
+        case CXType_IncompleteArray:
+            subtype = GetRawType( GetElementType( type ) );
+            break;
+
+        case CXType_Elaborated:
+            subtype = GetRawType( GetNamedType( type ) );
+            break;
+
+        default:
+            break;
+    }
+
+    // The canonical type is only stored when it is not the type itself
+    std::shared_ptr<const Function::RawType> canonical;
+    const auto &canonicalType = GetCanonicalType( type );
+    if( !IsSameType( canonicalType, type ) )
+    {
+        canonical = GetRawType( canonicalType );
+    }
+
+    return std::make_shared<const Function::RawType>( GetTypeKind( type ), IsConstQualifiedType( type ),
+                                                      GetTypeSpelling( type ), subtype, canonical );
+}
+
+template<typename TType>
+static std::shared_ptr<const Function::RawType> GetRawType( const TType &type )
+{
+    Function::TypeCache *cache = Function::TypeCache::GetCurrent();
+    if( cache == nullptr )
+    {
+        return BuildRawType( type );
+    }
+
+    auto &rawTypes = cache->GetEntries().rawTypes;
+    TypeKey key = GetTypeKey( type );
+    auto it = rawTypes.find( key );
+    if( it != rawTypes.end() )
+    {
+        return it->second;
+    }
+
+    std::shared_ptr<const Function::RawType> rawType = BuildRawType( type );
+    rawTypes.emplace( key, rawType );
+    return rawType;
+}
+
+static void WriteRawType( std::ostream &output, const Function::RawType &type )
+{
+    // Raw types are stored as strings, which identify them when they are loaded
+    std::ostringstream serializedType;
+    type.Serialize( serializedType );
+    WriteString( output, serializedType.str() );
+}
+
+static std::shared_ptr<const Function::RawType> ReadRawType( std::istream &input )
+{
+    std::string serializedType;
+    if( !ReadString( input, serializedType ) )
+    {
+        return nullptr;
+    }
+
+    // The types loaded while a cache exists are shared by all the functions that use them
+    Function::TypeCache *cache = Function::TypeCache::GetCurrent();
+    if( cache != nullptr )
+    {
+        auto it = cache->GetEntries().loadedRawTypes.find( serializedType );
+        if( it != cache->GetEntries().loadedRawTypes.end() )
+        {
+            return it->second;
+        }
+    }
+
+    std::istringstream typeInput( serializedType );
+    std::shared_ptr<const Function::RawType> rawType = Function::RawType::Deserialize( typeInput );
+    if( !rawType || ( typeInput.peek() != std::istringstream::traits_type::eof() ) )
+    {
+        return nullptr;
+    }
+
+    if( cache != nullptr )
+    {
+        cache->GetEntries().loadedRawTypes.emplace( serializedType, rawType );
+    }
+
+    return rawType;
+}
+
 //*************************************************************************************************
 //
 //                                             RETURN PROCESSING
@@ -44,23 +593,23 @@ public:
         m_originalType = type;
     }
 
-    std::string GetMockSignature() const noexcept
+    void EmitMockSignature( CodeEmitter &output ) const noexcept
     {
-        return m_originalType;
+        output << m_originalType;
     }
 
-    virtual std::string GetMockBodyFront() const noexcept = 0;
+    virtual void EmitMockBodyFront( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetMockBodyBack() const noexcept = 0;
+    virtual void EmitMockBodyBack( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetExpectationSignature() const noexcept = 0;
+    virtual void EmitExpectationSignature( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetExpectationCallArgument() const noexcept = 0;
+    virtual void EmitExpectationCallArgument( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetExpectationBody() const noexcept = 0;
+    virtual void EmitExpectationBody( CodeEmitter &output ) const noexcept = 0;
 
 protected:
-    std::string m_originalType;
+    ModelString m_originalType;
 };
 
 class ReturnVoid : public Function::Return
@@ -68,29 +617,24 @@ class ReturnVoid : public Function::Return
 public:
     virtual ~ReturnVoid() noexcept {};
 
-    virtual std::string GetMockBodyFront() const noexcept override
+    virtual void EmitMockBodyFront( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetMockBodyBack() const noexcept override
+    virtual void EmitMockBodyBack( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetExpectationSignature() const noexcept override
+    virtual void EmitExpectationSignature( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetExpectationCallArgument() const noexcept override
+    virtual void EmitExpectationCallArgument( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetExpectationBody() const noexcept override
+    virtual void EmitExpectationBody( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 };
 
@@ -100,57 +644,63 @@ public:
     ReturnStandard() noexcept : m_expectationArgByRef(false), m_expectationNeedsCast(false), m_isRVReference(false), m_expectationUseBaseType(false) {}
     virtual ~ReturnStandard() noexcept {};
 
+    virtual ReturnStandard* Clone() const = 0;
+
     void MockRetExprPrepend( const std::string &expr ) noexcept
     {
-        m_mockRetExprFront.insert( 0, expr );
+        m_mockRetExprFront = expr + m_mockRetExprFront;
     }
 
     void MockRetExprAppend( const std::string &expr ) noexcept
     {
-        m_mockRetExprBack.append( expr );
+        m_mockRetExprBack = m_mockRetExprBack + expr;
     }
 
     void ExpectationRetExprPrepend( const std::string &expr ) noexcept
     {
-        m_expectationRetExprFront.insert( 0, expr );
+        m_expectationRetExprFront = expr + m_expectationRetExprFront;
     }
 
     void ExpectationRetExprAppend( const std::string &expr ) noexcept
     {
-        m_expectationRetExprBack.append( expr );
+        m_expectationRetExprBack = m_expectationRetExprBack + expr;
     }
 
-    virtual std::string GetMockBodyFront() const noexcept override
+    virtual void EmitMockBodyFront( CodeEmitter &output ) const noexcept override
     {
-        return "return " + m_mockRetExprFront;
+        output << "return " << m_mockRetExprFront;
     }
 
-    virtual std::string GetMockBodyBack() const noexcept override
+    virtual void EmitMockBodyBack( CodeEmitter &output ) const noexcept override
     {
-        return "." + GetMockCall() + "()" + m_mockRetExprBack;
+        output << '.' << GetMockCall() << "()" << m_mockRetExprBack;
     }
 
-    virtual std::string GetExpectationCallArgument() const noexcept override
+    virtual void EmitExpectationCallArgument( CodeEmitter &output ) const noexcept override
     {
-        return RETURN_ARG_NAME;
+        output << RETURN_ARG_NAME;
     }
 
-    virtual std::string GetExpectationSignature() const noexcept override
+    virtual void EmitExpectationSignature( CodeEmitter &output ) const noexcept override
     {
         if( m_expectationUseBaseType )
         {
-            return GetExpectationBaseType() + " " RETURN_ARG_NAME;
+            output << GetExpectationBaseType() << " " RETURN_ARG_NAME;
         }
         else
         {
-            return GetSignatureType() + (m_expectationArgByRef ? " &" : " ") + RETURN_ARG_NAME;
+            EmitSignatureType( output );
+            output << (m_expectationArgByRef ? " &" : " ") << RETURN_ARG_NAME;
         }
     }
 
-    virtual std::string GetExpectationBody() const noexcept override
+    virtual void EmitExpectationBody( CodeEmitter &output ) const noexcept override
     {
-        return INDENT EXPECTED_CALL_VAR_NAME ".andReturnValue(" + GetExpectationRetExprFront() +
-               RETURN_ARG_NAME +  GetExpectationRetExprBack() + ");\n";
+        output << INDENT EXPECTED_CALL_VAR_NAME ".andReturnValue(";
+        EmitExpectationRetExprFront( output );
+        output << RETURN_ARG_NAME;
+        EmitExpectationRetExprBack( output );
+        output << ");\n";
     }
 
     void SetExpectationArgByRef() noexcept
@@ -174,37 +724,45 @@ public:
     }
 
 protected:
-    virtual std::string GetMockCall() const noexcept = 0;
+    virtual const char* GetMockCall() const noexcept = 0;
 
-    virtual std::string GetExpectationBaseType() const noexcept = 0;
+    virtual const char* GetExpectationBaseType() const noexcept = 0;
 
 private:
-    std::string GetExpectationRetExprFront() const noexcept
+    void EmitExpectationRetExprFront( CodeEmitter &output ) const noexcept
     {
-        return ( m_expectationNeedsCast ? "static_cast<" + GetExpectationBaseType() + ">(" : "" ) + m_expectationRetExprFront;
+        if( m_expectationNeedsCast )
+        {
+            output << "static_cast<" << GetExpectationBaseType() << ">(";
+        }
+        output << m_expectationRetExprFront;
     }
 
-    std::string GetExpectationRetExprBack() const noexcept
+    void EmitExpectationRetExprBack( CodeEmitter &output ) const noexcept
     {
-        return m_expectationRetExprBack +  ( m_expectationNeedsCast ? ")" : "" );
+        output << m_expectationRetExprBack;
+        if( m_expectationNeedsCast )
+        {
+            output << ')';
+        }
     }
 
-    std::string GetSignatureType() const noexcept
+    void EmitSignatureType( CodeEmitter &output ) const noexcept
     {
         if( m_isRVReference )
         {
-            return m_originalType.substr( 0, ( m_originalType.size() - 1 ) );
+            output.Write( m_originalType.str().data(), ( m_originalType.str().size() - 1 ) );
         }
         else
         {
-            return m_originalType;
+            output << m_originalType;
         }
     }
 
-    std::string m_mockRetExprFront;
-    std::string m_mockRetExprBack;
-    std::string m_expectationRetExprFront;
-    std::string m_expectationRetExprBack;
+    ModelString m_mockRetExprFront;
+    ModelString m_mockRetExprBack;
+    ModelString m_expectationRetExprFront;
+    ModelString m_expectationRetExprBack;
     bool m_expectationArgByRef;
     bool m_expectationNeedsCast;
     bool m_isRVReference;
@@ -216,13 +774,18 @@ class ReturnBool : public ReturnStandard
 public:
     virtual ~ReturnBool() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnBool( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "bool";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnBoolValue";
     }
@@ -233,13 +796,18 @@ class ReturnInt : public ReturnStandard
 public:
     virtual ~ReturnInt() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnInt( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "int";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnIntValue";
     }
@@ -250,13 +818,18 @@ class ReturnUnsignedInt : public ReturnStandard
 public:
     virtual ~ReturnUnsignedInt() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnUnsignedInt( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "unsigned int";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnUnsignedIntValue";
     }
@@ -267,13 +840,18 @@ class ReturnLong : public ReturnStandard
 public:
     virtual ~ReturnLong() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnLong( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "long";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnLongIntValue";
     }
@@ -284,13 +862,18 @@ class ReturnUnsignedLong : public ReturnStandard
 public:
     virtual ~ReturnUnsignedLong() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnUnsignedLong( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "unsigned long";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnUnsignedLongIntValue";
     }
@@ -301,13 +884,18 @@ class ReturnDouble : public ReturnStandard
 public:
     virtual ~ReturnDouble() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnDouble( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "double";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnDoubleValue";
     }
@@ -318,13 +906,18 @@ class ReturnString : public ReturnStandard
 public:
     virtual ~ReturnString() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnString( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "const char*";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnStringValue";
     }
@@ -335,13 +928,18 @@ class ReturnConstPointer : public ReturnStandard
 public:
     virtual ~ReturnConstPointer() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnConstPointer( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "const void*";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnConstPointerValue";
     }
@@ -352,13 +950,18 @@ class ReturnPointer : public ReturnStandard
 public:
     virtual ~ReturnPointer() noexcept {};
 
+    virtual ReturnStandard* Clone() const override
+    {
+        return new ReturnPointer( *this );
+    }
+
 protected:
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual const char* GetExpectationBaseType() const noexcept override
     {
         return "void*";
     }
 
-    virtual std::string GetMockCall() const noexcept override
+    virtual const char* GetMockCall() const noexcept override
     {
         return "returnPointerValue";
     }
@@ -371,43 +974,42 @@ public:
     : m_config( config )
     {}
 
-    Function::Return* Process( const std::string funcName, const CXType &returnType );
+    Function::Return* Process( const std::string funcName, const Function::RawType &returnType );
 
 private:
     Function::Return* ProcessOverride( const Config::OverrideSpec *override );
-    ReturnStandard* ProcessType( const CXType &returnType, bool inheritConst, bool enableCast );
-    ReturnStandard* ProcessTypePointer( const CXType & returnType, bool enableCast ) noexcept;
-    ReturnStandard* ProcessTypeTypedef( const CXType & returnType, bool inheritConst );
+    ReturnStandard* ProcessCachedType( const Function::RawType &returnType );
+    ReturnStandard* ProcessType( const Function::RawType &returnType, bool inheritConst, bool enableCast );
+    ReturnStandard* ProcessTypePointer( const Function::RawType &returnType, bool enableCast ) noexcept;
+    ReturnStandard* ProcessTypeTypedef( const Function::RawType &returnType, bool inheritConst );
 
     const Config &m_config;
 };
 
-Function::Return* ReturnParser::Process( const std::string funcName, const CXType &returnType )
+Function::Return* ReturnParser::Process( const std::string funcName, const Function::RawType &returnType )
 {
     Function::Return *ret;
 
-    std::string typeExpr = toString( clang_getTypeSpelling( returnType ) );
+    std::string typeExpr = GetTypeSpelling( returnType );
 
-    if( returnType.kind == CXType_Void )
+    if( GetTypeKind( returnType ) == CXType_Void )
     {
         ret = new ReturnVoid;
     }
     else
     {
         // Check if a function specific override exists
-        std::string overrideKey = funcName + "@";
-        const Config::OverrideSpec *override = m_config.GetTypeOverride( overrideKey );
+        const Config::OverrideSpec *override = GetTypeOverride( m_config, funcName, '@', std::string() );
 
         if( override == NULL )
         {
             // Check if a generic override exists
-            overrideKey = "@" + typeExpr;
-            override = m_config.GetTypeOverride( overrideKey );
+            override = GetTypeOverride( m_config, std::string(), '@', typeExpr );
         }
 
         if( override == NULL )
         {
-            ret = ProcessType( returnType, false, true );
+            ret = ProcessCachedType( returnType );
         }
         else
         {
@@ -476,13 +1078,30 @@ Function::Return* ReturnParser::ProcessOverride( const Config::OverrideSpec *ove
     return ret;
 }
 
-ReturnStandard* ReturnParser::ProcessType( const CXType &returnType, bool inheritConst, bool enableCast )
+ReturnStandard* ReturnParser::ProcessCachedType( const Function::RawType &returnType )
+{
+    Function::TypeCache *cache = Function::TypeCache::GetCurrent();
+    if( cache == nullptr )
+    {
+        return ProcessType( returnType, false, true );
+    }
+
+    std::unique_ptr<const ReturnStandard> &cachedRet = cache->GetEntries().returns[ GetTypeKey( returnType, m_config ) ];
+    if( !cachedRet )
+    {
+        cachedRet.reset( ProcessType( returnType, false, true ) );
+    }
+
+    return cachedRet->Clone();
+}
+
+ReturnStandard* ReturnParser::ProcessType( const Function::RawType &returnType, bool inheritConst, bool enableCast )
 {
     ReturnStandard *ret;
 
     bool mockNeedsCast = false;
 
-    switch( returnType.kind ) // LCOV_EXCL_BR_LINE: Defensive
+    switch( GetTypeKind( returnType ) ) // LCOV_EXCL_BR_LINE: Defensive
     {
         case CXType_Bool:
             ret = new ReturnBool;
@@ -557,7 +1176,7 @@ ReturnStandard* ReturnParser::ProcessType( const CXType &returnType, bool inheri
             ret->SetExpectationArgByRef();
             if( enableCast )
             {
-                ret->MockRetExprPrepend( "*static_cast<const " + clang_getTypeSpelling( returnType ) + "*>(" );
+                ret->MockRetExprPrepend( "*static_cast<const " + GetTypeSpelling( returnType ) + "*>(" );
                 ret->MockRetExprAppend( ")" );
                 ret->ExpectationRetExprPrepend( "&" );
             }
@@ -569,34 +1188,34 @@ ReturnStandard* ReturnParser::ProcessType( const CXType &returnType, bool inheri
             break;
 
         case CXType_Elaborated:
-            ret = ProcessType( clang_Type_getNamedType( returnType ), inheritConst, enableCast );
+            ret = ProcessType( GetNamedType( returnType ), inheritConst, enableCast );
             break;
 
 // LCOV_EXCL_START: Defensive
         default:
-            throw std::runtime_error( "Unsupported return type " + clang_getTypeSpelling( returnType ) +
-                                      " (kind: " +  clang_getTypeKindSpelling( returnType.kind) + ")" );
+            throw std::runtime_error( "Unsupported return type " + GetTypeSpelling( returnType ) +
+                                      " (kind: " +  clang_getTypeKindSpelling( GetTypeKind( returnType )) + ")" );
 // LCOV_EXCL_STOP
     }
 
     if( mockNeedsCast && enableCast )
     {
-        ret->MockRetExprPrepend( "static_cast<" + clang_getTypeSpelling( returnType ) + ">(" );
+        ret->MockRetExprPrepend( "static_cast<" + GetTypeSpelling( returnType ) + ">(" );
         ret->MockRetExprAppend( ")" );
     }
 
     return ret;
 }
 
-ReturnStandard* ReturnParser::ProcessTypePointer( const CXType &returnType, bool enableCast ) noexcept
+ReturnStandard* ReturnParser::ProcessTypePointer( const Function::RawType &returnType, bool enableCast ) noexcept
 {
     ReturnStandard *ret;
 
-    const CXType pointeeType = clang_getPointeeType( returnType );
-    bool isPointeeConst = clang_isConstQualifiedType( pointeeType );
+    const Function::RawType &pointeeType = GetPointeeType( returnType );
+    bool isPointeeConst = IsConstQualifiedType( pointeeType );
 
-    if( ( returnType.kind == CXType_Pointer ) &&
-        ( pointeeType.kind == CXType_Char_S ) &&
+    if( ( GetTypeKind( returnType ) == CXType_Pointer ) &&
+        ( GetTypeKind( pointeeType ) == CXType_Char_S ) &&
         isPointeeConst )
     {
         ret = new ReturnString;
@@ -604,8 +1223,8 @@ ReturnStandard* ReturnParser::ProcessTypePointer( const CXType &returnType, bool
     else
     {
         // Resolve possible typedefs
-        const CXType underlyingPointeeType = clang_getCanonicalType( pointeeType );
-        bool isUnderlyingPointeeConst = clang_isConstQualifiedType( underlyingPointeeType );
+        const Function::RawType &underlyingPointeeType = GetCanonicalType( pointeeType );
+        bool isUnderlyingPointeeConst = IsConstQualifiedType( underlyingPointeeType );
 
         if( isPointeeConst || isUnderlyingPointeeConst )
         {
@@ -616,26 +1235,26 @@ ReturnStandard* ReturnParser::ProcessTypePointer( const CXType &returnType, bool
             ret = new ReturnPointer;
         }
 
-        if( pointeeType.kind != CXType_Void )
+        if( GetTypeKind( pointeeType ) != CXType_Void )
         {
             ret->SetExpectationNeedsCast();
 
             if( enableCast )
             {
                 // Cast mock return pointer to proper pointer type
-                ret->MockRetExprPrepend( "static_cast<" + clang_getTypeSpelling( pointeeType ) + "*>(" );
+                ret->MockRetExprPrepend( "static_cast<" + GetTypeSpelling( pointeeType ) + "*>(" );
                 ret->MockRetExprAppend( ")" );
             }
         }
     }
 
-    if( returnType.kind == CXType_LValueReference )
+    if( GetTypeKind( returnType ) == CXType_LValueReference )
     {
         // Dereference mock return pointer
         ret->MockRetExprPrepend( "*" );
         ret->ExpectationRetExprPrepend( "&" );
     }
-    else if( returnType.kind == CXType_RValueReference )
+    else if( GetTypeKind( returnType ) == CXType_RValueReference )
     {
         // Dereference mock return pointer
         ret->MockRetExprPrepend( "std::move(*" );
@@ -646,30 +1265,30 @@ ReturnStandard* ReturnParser::ProcessTypePointer( const CXType &returnType, bool
     return ret;
 }
 
-ReturnStandard* ReturnParser::ProcessTypeTypedef( const CXType &returnType, bool inheritConst )
+ReturnStandard* ReturnParser::ProcessTypeTypedef( const Function::RawType &returnType, bool inheritConst )
 {
     ReturnStandard *ret;
 
-    const CXType underlyingType = clang_getCanonicalType( returnType );
+    const Function::RawType &underlyingType = GetCanonicalType( returnType );
 
-    if( ( underlyingType.kind == CXType_Pointer ) ||
-        ( underlyingType.kind == CXType_LValueReference ) ||
-        ( underlyingType.kind == CXType_RValueReference ) )
+    if( ( GetTypeKind( underlyingType ) == CXType_Pointer ) ||
+        ( GetTypeKind( underlyingType ) == CXType_LValueReference ) ||
+        ( GetTypeKind( underlyingType ) == CXType_RValueReference ) )
     {
-        ret = ProcessTypePointer( underlyingType, ( underlyingType.kind != CXType_Pointer ) );
+        ret = ProcessTypePointer( underlyingType, ( GetTypeKind( underlyingType ) != CXType_Pointer ) );
     }
     else
     {
-        bool isTypedefConst = clang_isConstQualifiedType( returnType ) || inheritConst;
+        bool isTypedefConst = IsConstQualifiedType( returnType ) || inheritConst;
 
         ret = ProcessType( underlyingType, isTypedefConst, false );
     }
 
-    if( ( underlyingType.kind == CXType_Record ) ||
-        ( underlyingType.kind == CXType_Unexposed ) )
+    if( ( GetTypeKind( underlyingType ) == CXType_Record ) ||
+        ( GetTypeKind( underlyingType ) == CXType_Unexposed ) )
     {
         // Dereference mock return pointer
-        ret->MockRetExprPrepend( "*static_cast<const " + clang_getTypeSpelling( returnType ) + "*>(" );
+        ret->MockRetExprPrepend( "*static_cast<const " + GetTypeSpelling( returnType ) + "*>(" );
         ret->MockRetExprAppend( ")" );
         ret->SetExpectationArgByRef();
         ret->ExpectationRetExprPrepend( "&" );
@@ -677,7 +1296,7 @@ ReturnStandard* ReturnParser::ProcessTypeTypedef( const CXType &returnType, bool
     else
     {
         // Just cast
-        ret->MockRetExprPrepend( "static_cast<" + clang_getTypeSpelling( returnType ) + ">(" );
+        ret->MockRetExprPrepend( "static_cast<" + GetTypeSpelling( returnType ) + ">(" );
         ret->MockRetExprAppend( ")" );
     }
 
@@ -691,9 +1310,11 @@ ReturnStandard* ReturnParser::ProcessTypeTypedef( const CXType &returnType, bool
 //
 //*************************************************************************************************
 
-static std::string GetSignature( const std::string &typePre, const std::string &name, const std::string &typePost ) noexcept
+static void EmitSignature( CodeEmitter &output, const std::string &typePre, const std::string &name, const std::string &typePost ) noexcept
 {
-    return TrimString( typePre + " " + name + typePost );
+    size_t start = output.GetSize();
+    output << typePre << ' ' << name << typePost;
+    output.Trim( start );
 }
 
 class Function::Argument
@@ -728,15 +1349,15 @@ public:
         }
     }
 
-    virtual std::string GetMockSignature() const noexcept = 0;
+    virtual void EmitMockSignature( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetMockBody() const noexcept = 0;
+    virtual void EmitMockBody( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetExpectationSignature() const noexcept = 0;
+    virtual void EmitExpectationSignature( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetExpectationCallArgument() const noexcept = 0;
+    virtual void EmitExpectationCallArgument( CodeEmitter &output ) const noexcept = 0;
 
-    virtual std::string GetExpectationBody( bool argumentsSkipped ) const noexcept = 0;
+    virtual void EmitExpectationBody( CodeEmitter &output, bool argumentsSkipped ) const noexcept = 0;
 
     virtual bool CanBeIgnored() const noexcept = 0;
 
@@ -759,10 +1380,10 @@ protected:
     }
 
 private:
-    std::string m_name;
-    std::string m_mockTypePre;
-    std::string m_mockTypePost;
-    std::string m_expectationType;
+    ModelString m_name;
+    ModelString m_mockTypePre;
+    ModelString m_mockTypePost;
+    ModelString m_expectationType;
 };
 
 class ArgumentSkip : public Function::Argument
@@ -770,29 +1391,25 @@ class ArgumentSkip : public Function::Argument
 public:
     virtual ~ArgumentSkip() noexcept {}
 
-    virtual std::string GetMockSignature() const noexcept override
+    virtual void EmitMockSignature( CodeEmitter &output ) const noexcept override
     {
-        return GetSignature( GetMockTypePre(), "", GetMockTypePost() );
+        EmitSignature( output, GetMockTypePre(), "", GetMockTypePost() );
     }
 
-    virtual std::string GetExpectationSignature() const noexcept override
+    virtual void EmitExpectationSignature( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetMockBody() const noexcept override
+    virtual void EmitMockBody( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetExpectationCallArgument() const noexcept override
+    virtual void EmitExpectationCallArgument( CodeEmitter & ) const noexcept override
     {
-        return "";
     }
 
-    virtual std::string GetExpectationBody( bool ) const noexcept override
+    virtual void EmitExpectationBody( CodeEmitter &, bool ) const noexcept override
     {
-        return "";
     }
 
     virtual bool IsSkipped() const noexcept override
@@ -815,51 +1432,64 @@ public:
     : m_expectationArgByRef(false), m_forceNotIgnored(false), m_isRVReference(false), m_expectationUseBaseType(expectationUseBaseType) {}
     virtual ~ArgumentStandard() noexcept {}
 
-    virtual std::string GetMockSignature() const noexcept override
+    virtual ArgumentStandard* Clone() const = 0;
+
+    virtual void EmitMockSignature( CodeEmitter &output ) const noexcept override
     {
-        return GetSignature( GetMockTypePre(), GetName(), GetMockTypePost() );
+        EmitSignature( output, GetMockTypePre(), GetName(), GetMockTypePost() );
     }
 
-    virtual std::string GetExpectationSignature() const noexcept override
+    virtual void EmitExpectationSignature( CodeEmitter &output ) const noexcept override
     {
-        std::string usedType = ( m_expectationUseBaseType ? GetExpectationBaseType() : GetExpectationSignatureType() );
-        if( CanBeIgnored() )
+        bool canBeIgnored = CanBeIgnored();
+        if( canBeIgnored )
         {
-            return "CppUMockGen::Parameter<" + usedType + "> " + GetName();
+            output << "CppUMockGen::Parameter<";
+        }
+
+        if( m_expectationUseBaseType )
+        {
+            EmitExpectationBaseType( output );
         }
         else
         {
-            return usedType + " " + GetName();
+            EmitExpectationSignatureType( output );
         }
+
+        output << ( canBeIgnored ? "> " : " " ) << GetName();
     }
 
-    virtual std::string GetMockBody() const noexcept override
+    virtual void EmitMockBody( CodeEmitter &output ) const noexcept override
     {
-        return "." + GetMockBodyCall();
+        output << '.';
+        EmitMockBodyCall( output );
     }
 
-    virtual std::string GetExpectationCallArgument() const noexcept override
+    virtual void EmitExpectationCallArgument( CodeEmitter &output ) const noexcept override
     {
-        return GetName();
+        output << GetName();
     }
 
-    virtual std::string GetExpectationBody( bool argumentsSkipped ) const noexcept override
+    virtual void EmitExpectationBody( CodeEmitter &output, bool argumentsSkipped ) const noexcept override
     {
         if( CanBeIgnored() )
         {
             if( argumentsSkipped )
             {
-                return INDENT "if(!" + GetName() + ".isIgnored()) { " EXPECTED_CALL_VAR_NAME "." + GetExpectationBodyCall( ".getValue()" ) + "; }\n";
+                output << INDENT "if(!" << GetName() << ".isIgnored()) { " EXPECTED_CALL_VAR_NAME ".";
             }
             else
             {
-                return INDENT "if(" + GetName() + ".isIgnored()) { " IGNORE_OTHERS_VAR_NAME " = true; } else { " EXPECTED_CALL_VAR_NAME "." +
-                        GetExpectationBodyCall( ".getValue()" ) + "; }\n";
+                output << INDENT "if(" << GetName() << ".isIgnored()) { " IGNORE_OTHERS_VAR_NAME " = true; } else { " EXPECTED_CALL_VAR_NAME ".";
             }
+            EmitExpectationBodyCall( output, ".getValue()" );
+            output << "; }\n";
         }
         else
         {
-            return INDENT EXPECTED_CALL_VAR_NAME "." + GetExpectationBodyCall( "" ) + ";\n";
+            output << INDENT EXPECTED_CALL_VAR_NAME ".";
+            EmitExpectationBodyCall( output, "" );
+            output << ";\n";
         }
     }
 
@@ -870,12 +1500,12 @@ public:
 
     void MockArgExprPrepend( const std::string &expr ) noexcept
     {
-        m_mockArgExprFront.insert( 0, expr );
+        m_mockArgExprFront = expr + m_mockArgExprFront;
     }
 
     void MockArgExprAppend( const std::string &expr ) noexcept
     {
-        m_mockArgExprBack.append( expr );
+        m_mockArgExprBack = m_mockArgExprBack + expr;
     }
 
     void SetExpectationArgByRef() noexcept
@@ -904,52 +1534,65 @@ protected:
         return true;
     }
 
-    virtual std::string GetCallFront( bool mock ) const noexcept = 0;
+    virtual void EmitCallFront( CodeEmitter &output, bool mock ) const noexcept = 0;
 
-    virtual std::string GetCallMiddle( bool mock ) const noexcept
+    virtual void EmitCallMiddle( CodeEmitter &output, bool mock ) const noexcept
     {
-        return "";
     }
 
-    virtual std::string GetCallBack( bool mock, const std::string& getter ) const noexcept
+    virtual void EmitCallBack( CodeEmitter &output, bool mock, const char *getter ) const noexcept
     {
-        return ")";
+        output << ')';
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept = 0;
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept = 0;
 
-    std::string m_mockArgExprFront;
-    std::string m_mockArgExprBack;
+    ModelString m_mockArgExprFront;
+    ModelString m_mockArgExprBack;
 
 private:
-    std::string GetMockBodyCall() const noexcept
+    void EmitMockBodyCall( CodeEmitter &output ) const noexcept
     {
-        return GetCallFront( true ) + "\"" + GetName() + "\", " + GetCallMiddle( true ) + m_mockArgExprFront + GetName() +
-            m_mockArgExprBack + GetCallBack( true, "" );
+        EmitCallFront( output, true );
+        output << '"' << GetName() << "\", ";
+        EmitCallMiddle( output, true );
+        output << m_mockArgExprFront << GetName() << m_mockArgExprBack;
+        EmitCallBack( output, true, "" );
     }
 
-    std::string GetExpectationBodyCall( const std::string& getter ) const noexcept
+    void EmitExpectationBodyCall( CodeEmitter &output, const char *getter ) const noexcept
     {
-        return GetCallFront( false ) + "\"" + GetName() + "\", " + GetCallMiddle( false ) +
-            ( m_expectationUseBaseType ? "" : m_mockArgExprFront ) + GetName() + getter +
-            ( m_expectationUseBaseType ? "" : m_mockArgExprBack ) + GetCallBack( false, getter );
+        EmitCallFront( output, false );
+        output << '"' << GetName() << "\", ";
+        EmitCallMiddle( output, false );
+        if( m_expectationUseBaseType )
+        {
+            output << GetName() << getter;
+        }
+        else
+        {
+            output << m_mockArgExprFront << GetName() << getter << m_mockArgExprBack;
+        }
+        EmitCallBack( output, false, getter );
     }
 
-    std::string GetExpectationSignatureType() const noexcept
+    void EmitExpectationSignatureType( CodeEmitter &output ) const noexcept
     {
-        std::string ret = GetExpectationType();
-        
+        const std::string &type = GetExpectationType();
+
         if( m_isRVReference )
         {
-            ret = ret.substr( 0, ( ret.size() - 1 ) );
+            output.Write( type.data(), ( type.size() - 1 ) );
+        }
+        else
+        {
+            output << type;
         }
 
         if( m_expectationArgByRef )
         {
-            ret += "&";
+            output << '&';
         }
-
-        return ret;
     }
 
     bool m_expectationArgByRef;
@@ -964,15 +1607,20 @@ public:
     ArgumentBool( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentBool() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentBool( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withBoolParameter(";
+        output << "withBoolParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "bool";
+        output << "bool";
     }
 };
 
@@ -982,15 +1630,20 @@ public:
     ArgumentInt( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentInt() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentInt( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withIntParameter(";
+        output << "withIntParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "int";
+        output << "int";
     }
 };
 
@@ -1000,15 +1653,20 @@ public:
     ArgumentUnsignedInt( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentUnsignedInt() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentUnsignedInt( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withUnsignedIntParameter(";
+        output << "withUnsignedIntParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "unsigned int";
+        output << "unsigned int";
     }
 };
 
@@ -1018,15 +1676,20 @@ public:
     ArgumentLong( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentLong() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentLong( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withLongIntParameter(";
+        output << "withLongIntParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "long";
+        output << "long";
     }
 };
 
@@ -1036,15 +1699,20 @@ public:
     ArgumentUnsignedLong( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentUnsignedLong() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentUnsignedLong( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withUnsignedLongIntParameter(";
+        output << "withUnsignedLongIntParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "unsigned long";
+        output << "unsigned long";
     }
 };
 
@@ -1054,15 +1722,20 @@ public:
     ArgumentDouble( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentDouble() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentDouble( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withDoubleParameter(";
+        output << "withDoubleParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "double";
+        output << "double";
     }
 };
 
@@ -1072,15 +1745,20 @@ public:
     ArgumentString( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentString() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentString( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withStringParameter(";
+        output << "withStringParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "const char*";
+        output << "const char*";
     }
 };
 
@@ -1090,15 +1768,20 @@ public:
     ArgumentPointer( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentPointer() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentPointer( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withPointerParameter(";
+        output << "withPointerParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "void*";
+        output << "void*";
     }
 };
 
@@ -1108,15 +1791,20 @@ public:
     ArgumentConstPointer( bool expectationUseBaseType ) noexcept : ArgumentStandard( expectationUseBaseType ) {}
     virtual ~ArgumentConstPointer() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentConstPointer( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withConstPointerParameter(";
+        output << "withConstPointerParameter(";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "const void*";
+        output << "const void*";
     }
 };
 
@@ -1128,24 +1816,27 @@ public:
 
     virtual ~ArgumentOutput() noexcept {}
 
-    virtual std::string GetExpectationSignature() const noexcept override
+    virtual ArgumentStandard* Clone() const override
     {
-        std::string ret = ArgumentStandard::GetExpectationSignature();
+        return new ArgumentOutput( *this );
+    }
+
+    virtual void EmitExpectationSignature( CodeEmitter &output ) const noexcept override
+    {
+        ArgumentStandard::EmitExpectationSignature( output );
         if( !m_calculateSizeFromType )
         {
-            ret += ", size_t " SIZEOF_VAR_PREFIX + GetName();
+            output << ", size_t " SIZEOF_VAR_PREFIX << GetName();
         }
-        return ret;
     }
 
-    virtual std::string GetExpectationCallArgument() const noexcept override
+    virtual void EmitExpectationCallArgument( CodeEmitter &output ) const noexcept override
     {
-        std::string ret = ArgumentStandard::GetExpectationCallArgument();
+        ArgumentStandard::EmitExpectationCallArgument( output );
         if( !m_calculateSizeFromType )
         {
-            ret += ", " SIZEOF_VAR_PREFIX + GetName();
+            output << ", " SIZEOF_VAR_PREFIX << GetName();
         }
-        return ret;
     }
 
 protected:
@@ -1154,38 +1845,38 @@ protected:
         return false;
     }
 
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool mock ) const noexcept override
     {
         if( mock )
         {
-            return "withOutputParameter(";
+            output << "withOutputParameter(";
         }
         else
         {
-            return "withOutputParameterReturning(";
+            output << "withOutputParameterReturning(";
         }
     }
 
-    virtual std::string GetCallBack( bool mock, const std::string& getter ) const noexcept
+    virtual void EmitCallBack( CodeEmitter &output, bool mock, const char *getter ) const noexcept override
     {
         if( mock )
         {
-            return ")";
+            output << ')';
         }
         else if( m_calculateSizeFromType )
         {
-            return ", sizeof(*" + m_mockArgExprFront + GetName() + m_mockArgExprBack + "))";
+            output << ", sizeof(*" << m_mockArgExprFront << GetName() << m_mockArgExprBack << "))";
         }
         else
         {
-            return ", " SIZEOF_VAR_PREFIX + GetName() + ")";
+            output << ", " SIZEOF_VAR_PREFIX << GetName() << ')';
         }
     }
 
 // LCOV_EXCL_START: Never called for this subclass
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "const void*";
+        output << "const void*";
     }
 // LCOV_EXCL_STOP
 
@@ -1196,7 +1887,7 @@ class ArgumentMemoryBuffer : public ArgumentStandard
 {
 public:
     ArgumentMemoryBuffer() noexcept 
-    : ArgumentStandard( false ), m_calculateSizeFromType( true ) {}
+    : ArgumentStandard( false ), m_calculateSizeFromType( true ), m_hasSizeExprPlaceholder( false ) {}
 
     ArgumentMemoryBuffer( bool hasSizeExprPlaceholder, const std::string &sizeExprFront, const std::string &sizeExprBack ) noexcept
     : ArgumentStandard( false ), m_calculateSizeFromType( false ), m_hasSizeExprPlaceholder( hasSizeExprPlaceholder ),
@@ -1204,54 +1895,57 @@ public:
 
     virtual ~ArgumentMemoryBuffer() noexcept {}
 
-    virtual std::string GetExpectationSignature() const noexcept override
+    virtual ArgumentStandard* Clone() const override
     {
-        std::string ret = ArgumentStandard::GetExpectationSignature();
+        return new ArgumentMemoryBuffer( *this );
+    }
+
+    virtual void EmitExpectationSignature( CodeEmitter &output ) const noexcept override
+    {
+        ArgumentStandard::EmitExpectationSignature( output );
         if( !m_calculateSizeFromType )
         {
-            ret += ", size_t " SIZEOF_VAR_PREFIX + GetName();
+            output << ", size_t " SIZEOF_VAR_PREFIX << GetName();
         }
-        return ret;
     }
 
-    virtual std::string GetExpectationCallArgument() const noexcept override
+    virtual void EmitExpectationCallArgument( CodeEmitter &output ) const noexcept override
     {
-        std::string ret = ArgumentStandard::GetExpectationCallArgument();
+        ArgumentStandard::EmitExpectationCallArgument( output );
         if( !m_calculateSizeFromType )
         {
-            ret += ", " SIZEOF_VAR_PREFIX + GetName();
+            output << ", " SIZEOF_VAR_PREFIX << GetName();
         }
-        return ret;
     }
 
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withMemoryBufferParameter(";
+        output << "withMemoryBufferParameter(";
     }
 
-    virtual std::string GetCallMiddle( bool ) const noexcept override
+    virtual void EmitCallMiddle( CodeEmitter &output, bool ) const noexcept override
     {
-        return "static_cast<const unsigned char *>(static_cast<const void *>(";
+        output << "static_cast<const unsigned char *>(static_cast<const void *>(";
     }
 
-    virtual std::string GetCallBack( bool mock, const std::string& getter  ) const noexcept
+    virtual void EmitCallBack( CodeEmitter &output, bool mock, const char *getter ) const noexcept override
     {
         if( mock )
         {
             if( m_calculateSizeFromType )
             {
-                return ")), sizeof(*" + m_mockArgExprFront + GetName() + m_mockArgExprBack + "))";
+                output << ")), sizeof(*" << m_mockArgExprFront << GetName() << m_mockArgExprBack << "))";
             }
             else
             {
                 if( m_hasSizeExprPlaceholder )
                 {
-                    return ")), " + m_sizeExprFront + GetName() + m_sizeExprBack + ")";
+                    output << ")), " << m_sizeExprFront << GetName() << m_sizeExprBack << ')';
                 }
                 else
                 {
-                    return ")), " + m_sizeExprFront + ")";
+                    output << ")), " << m_sizeExprFront << ')';
                 }
             }
         }
@@ -1259,27 +1953,27 @@ protected:
         {
             if( m_calculateSizeFromType )
             {
-                return ")), sizeof(*" + m_mockArgExprFront + GetName() + getter + m_mockArgExprBack + "))";
+                output << ")), sizeof(*" << m_mockArgExprFront << GetName() << getter << m_mockArgExprBack << "))";
             }
             else
             {
-                return ")), " SIZEOF_VAR_PREFIX + GetName() + ")";
+                output << ")), " SIZEOF_VAR_PREFIX << GetName() << ')';
             }
         }
     }
 
 // LCOV_EXCL_START: Never called for this subclass
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "const void*";
+        output << "const void*";
     }
 // LCOV_EXCL_STOP
 
 private:
     bool m_calculateSizeFromType;
     bool m_hasSizeExprPlaceholder;
-    std::string m_sizeExprFront;
-    std::string m_sizeExprBack;
+    ModelString m_sizeExprFront;
+    ModelString m_sizeExprBack;
 };
 
 class ArgumentInputOfType : public ArgumentStandard
@@ -1293,19 +1987,24 @@ public:
 
     virtual ~ArgumentInputOfType() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentInputOfType( *this );
+    }
+
 protected:
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool ) const noexcept override
     {
-        return "withParameterOfType(\"" + m_exposedType + "\", ";
+        output << "withParameterOfType(\"" << m_exposedType << "\", ";
     }
 
-    virtual std::string GetExpectationBaseType() const noexcept override
+    virtual void EmitExpectationBaseType( CodeEmitter &output ) const noexcept override
     {
-        return "const " + m_expectationArgType + "*";
+        output << "const " << m_expectationArgType << '*';
     }
 
-    std::string m_exposedType;
-    std::string m_expectationArgType;
+    ModelString m_exposedType;
+    ModelString m_expectationArgType;
 };
 
 class ArgumentOutputOfType : public ArgumentInputOfType
@@ -1319,21 +2018,26 @@ public:
 
     virtual ~ArgumentOutputOfType() noexcept {}
 
+    virtual ArgumentStandard* Clone() const override
+    {
+        return new ArgumentOutputOfType( *this );
+    }
+
 protected:
     virtual bool isInput() const noexcept override
     {
         return false;
     }
 
-    virtual std::string GetCallFront( bool mock ) const noexcept override
+    virtual void EmitCallFront( CodeEmitter &output, bool mock ) const noexcept override
     {
         if( mock )
         {
-            return "withOutputParameterOfType(\"" + m_exposedType + "\", ";
+            output << "withOutputParameterOfType(\"" << m_exposedType << "\", ";
         }
         else
         {
-            return "withOutputParameterOfTypeReturning(\"" + m_exposedType + "\", ";
+            output << "withOutputParameterOfTypeReturning(\"" << m_exposedType << "\", ";
         }
     }
 };
@@ -1345,30 +2049,28 @@ public:
     : m_config( config )
     {}
 
-    Function::Argument* Process( const std::string funcName, const CXCursor &arg, int argNum );
+    Function::Argument* Process( const std::string funcName, const Function::RawType &argType, const std::string &name, int argNum );
 
 private:
     Function::Argument* ProcessOverride( const Config::OverrideSpec *override );
-    ArgumentStandard* ProcessType( const CXType &argType, const CXType &origArgType, bool inheritConst );
-    ArgumentStandard* ProcessTypePointer( const CXType &argType, const CXType &origArgType );
-    ArgumentStandard* ProcessTypeArray( const CXType &argType, const CXType &origArgType );
-    ArgumentStandard* ProcessTypeRVReference( const CXType &argType, const CXType &origArgType );
-    ArgumentStandard* ProcessTypeTypedef( const CXType &argType, const CXType &origArgType, bool inheritConst );
-    ArgumentStandard* ProcessTypeRecord( const CXType &argType, const CXType &origArgType, bool inheritConst, bool isPointee );
+    ArgumentStandard* ProcessCachedType( const Function::RawType &argType );
+    ArgumentStandard* ProcessType( const Function::RawType &argType, const Function::RawType &origArgType, bool inheritConst );
+    ArgumentStandard* ProcessTypePointer( const Function::RawType &argType, const Function::RawType &origArgType );
+    ArgumentStandard* ProcessTypeArray( const Function::RawType &argType, const Function::RawType &origArgType );
+    ArgumentStandard* ProcessTypeRVReference( const Function::RawType &argType, const Function::RawType &origArgType );
+    ArgumentStandard* ProcessTypeTypedef( const Function::RawType &argType, const Function::RawType &origArgType, bool inheritConst );
+    ArgumentStandard* ProcessTypeRecord( const Function::RawType &argType, const Function::RawType &origArgType, bool inheritConst, bool isPointee );
 
     const Config &m_config;
 };
 
-Function::Argument* ArgumentParser::Process( const std::string funcName, const CXCursor &arg, int argNum )
+Function::Argument* ArgumentParser::Process( const std::string funcName, const Function::RawType &argType, const std::string &name, int argNum )
 {
     Function::Argument *ret;
 
-    // Get argument type
-    const CXType argType = clang_getCursorType( arg );
-    std::string typeExpr = toString( clang_getTypeSpelling( argType ) );
+    std::string typeExpr = GetTypeSpelling( argType );
 
-    // Get argument name
-    std::string argName = toString( clang_getCursorSpelling( arg ) );
+    std::string argName = name;
     if( argName.empty() )
     {
         std::ostringstream argNameStream;
@@ -1377,19 +2079,17 @@ Function::Argument* ArgumentParser::Process( const std::string funcName, const C
     }
 
     // Check if a function specific override exists
-    std::string overrideKey = funcName + "#" + argName;
-    const Config::OverrideSpec *override = m_config.GetTypeOverride( overrideKey );
+    const Config::OverrideSpec *override = GetTypeOverride( m_config, funcName, '#', argName );
 
     if( override == NULL )
     {
         // Check if a generic type override exists
-        overrideKey = "#" + typeExpr;
-        override = m_config.GetTypeOverride( overrideKey );
+        override = GetTypeOverride( m_config, std::string(), '#', typeExpr );
     }
 
     if( override == NULL )
     {
-        ret = ProcessType( argType, argType, false );
+        ret = ProcessCachedType( argType );
     }
     else
     {
@@ -1484,11 +2184,28 @@ Function::Argument* ArgumentParser::ProcessOverride( const Config::OverrideSpec
     return ret;
 }
 
-ArgumentStandard* ArgumentParser::ProcessType( const CXType &argType, const CXType &origArgType, bool inheritConst )
+ArgumentStandard* ArgumentParser::ProcessCachedType( const Function::RawType &argType )
+{
+    Function::TypeCache *cache = Function::TypeCache::GetCurrent();
+    if( cache == nullptr )
+    {
+        return ProcessType( argType, argType, false );
+    }
+
+    std::unique_ptr<const ArgumentStandard> &cachedArg = cache->GetEntries().arguments[ GetTypeKey( argType, m_config ) ];
+    if( !cachedArg )
+    {
+        cachedArg.reset( ProcessType( argType, argType, false ) );
+    }
+
+    return cachedArg->Clone();
+}
+
+ArgumentStandard* ArgumentParser::ProcessType( const Function::RawType &argType, const Function::RawType &origArgType, bool inheritConst )
 {
     ArgumentStandard *ret;
 
-    switch( argType.kind ) // LCOV_EXCL_BR_LINE: Defensive
+    switch( GetTypeKind( argType ) ) // LCOV_EXCL_BR_LINE: Defensive
     {
         case CXType_Bool:
             ret = new ArgumentBool( false );
@@ -1555,13 +2272,13 @@ ArgumentStandard* ArgumentParser::ProcessType( const CXType &argType, const CXTy
             break;
 
         case CXType_Elaborated:
-            ret = ProcessType( clang_Type_getNamedType( argType ), origArgType, inheritConst );
+            ret = ProcessType( GetNamedType( argType ), origArgType, inheritConst );
             break;
 
 // LCOV_EXCL_START: Defensive
         default:
-            throw std::runtime_error( "Unsupported parameter type " + clang_getTypeSpelling( argType ) +
-                                      " (kind: " +  clang_getTypeKindSpelling( argType.kind) + ")" );
+            throw std::runtime_error( "Unsupported parameter type " + GetTypeSpelling( argType ) +
+                                      " (kind: " +  clang_getTypeKindSpelling( GetTypeKind( argType )) + ")" );
             break;
 // LCOV_EXCL_STOP
     }
@@ -1569,15 +2286,15 @@ ArgumentStandard* ArgumentParser::ProcessType( const CXType &argType, const CXTy
     return ret;
 }
 
-ArgumentStandard* ArgumentParser::ProcessTypePointer( const CXType &argType, const CXType &origArgType )
+ArgumentStandard* ArgumentParser::ProcessTypePointer( const Function::RawType &argType, const Function::RawType &origArgType )
 {
     ArgumentStandard *ret;
 
-    const CXType pointeeType = clang_getPointeeType( argType );
-    bool isPointeeConst = clang_isConstQualifiedType( pointeeType );
+    const Function::RawType &pointeeType = GetPointeeType( argType );
+    bool isPointeeConst = IsConstQualifiedType( pointeeType );
 
-    if( ( argType.kind == CXType_Pointer ) &&
-        ( pointeeType.kind == CXType_Char_S ) &&
+    if( ( GetTypeKind( argType ) == CXType_Pointer ) &&
+        ( GetTypeKind( pointeeType ) == CXType_Char_S ) &&
         isPointeeConst )
     {
         ret = new ArgumentString( false );
@@ -1585,12 +2302,12 @@ ArgumentStandard* ArgumentParser::ProcessTypePointer( const CXType &argType, con
     else
     {
         // Resolve possible typedefs
-        const CXType underlyingPointeeType = clang_getCanonicalType( pointeeType );
-        bool isUnderlyingPointeeConst = clang_isConstQualifiedType( underlyingPointeeType );
+        const Function::RawType &underlyingPointeeType = GetCanonicalType( pointeeType );
+        bool isUnderlyingPointeeConst = IsConstQualifiedType( underlyingPointeeType );
 
         if( isPointeeConst || isUnderlyingPointeeConst )
         {
-            switch( underlyingPointeeType.kind )
+            switch( GetTypeKind( underlyingPointeeType ) )
             {
                 case CXType_Record:
                 case CXType_Unexposed: // Template classes are processed as "Unexposed" kind
@@ -1604,7 +2321,7 @@ ArgumentStandard* ArgumentParser::ProcessTypePointer( const CXType &argType, con
         }
         else
         {
-            switch( underlyingPointeeType.kind )
+            switch( GetTypeKind( underlyingPointeeType ) )
             {
                 case CXType_Void:
                 case CXType_Pointer: // TODO: Remove, should be output
@@ -1617,13 +2334,13 @@ ArgumentStandard* ArgumentParser::ProcessTypePointer( const CXType &argType, con
                     break;
 
                 default:
-                    ret = new ArgumentOutput( argType.kind != CXType_Pointer );
+                    ret = new ArgumentOutput( GetTypeKind( argType ) != CXType_Pointer );
                     break;
             }
         }
     }
 
-    if( argType.kind != CXType_Pointer )
+    if( GetTypeKind( argType ) != CXType_Pointer )
     {
         ret->MockArgExprPrepend("&");
     }
@@ -1631,14 +2348,14 @@ ArgumentStandard* ArgumentParser::ProcessTypePointer( const CXType &argType, con
     return ret;
 }
 
-ArgumentStandard* ArgumentParser::ProcessTypeArray( const CXType &argType, const CXType &origArgType )
+ArgumentStandard* ArgumentParser::ProcessTypeArray( const Function::RawType &argType, const Function::RawType &origArgType )
 {
-    const CXType elementType = clang_getElementType( argType );
-    bool isElementConst = clang_isConstQualifiedType( elementType );
+    const Function::RawType &elementType = GetElementType( argType );
+    bool isElementConst = IsConstQualifiedType( elementType );
 
     // Resolve possible typedefs
-    const CXType underlyingElementType = clang_getCanonicalType( elementType );
-    bool isUnderlyingElementConst = clang_isConstQualifiedType( underlyingElementType );
+    const Function::RawType &underlyingElementType = GetCanonicalType( elementType );
+    bool isUnderlyingElementConst = IsConstQualifiedType( underlyingElementType );
 
     if( isElementConst || isUnderlyingElementConst )
     {
@@ -1650,26 +2367,23 @@ ArgumentStandard* ArgumentParser::ProcessTypeArray( const CXType &argType, const
     }
 }
 
-ArgumentStandard* ArgumentParser::ProcessTypeRVReference( const CXType &argType, const CXType &origArgType )
+ArgumentStandard* ArgumentParser::ProcessTypeRVReference( const Function::RawType &argType, const Function::RawType &origArgType )
 {
     ArgumentStandard *ret;
 
-    CXType pointeeType = clang_getPointeeType( argType );
+    const Function::RawType &referencedType = GetPointeeType( argType );
 
     // Remove sugar like "struct", etc.
-    if( pointeeType.kind == CXType_Elaborated )
-    {
-        pointeeType = clang_Type_getNamedType( pointeeType );
-    }
+    const Function::RawType &pointeeType = ( GetTypeKind( referencedType ) == CXType_Elaborated ) ? GetNamedType( referencedType ) : referencedType;
 
-    if( ( pointeeType.kind == CXType_Record ) ||
-        ( pointeeType.kind == CXType_Unexposed ) )
+    if( ( GetTypeKind( pointeeType ) == CXType_Record ) ||
+        ( GetTypeKind( pointeeType ) == CXType_Unexposed ) )
     {
         ret = ProcessTypePointer( argType, origArgType );
     }
     else
     {
-        bool isPointeeConst = clang_isConstQualifiedType( pointeeType );
+        bool isPointeeConst = IsConstQualifiedType( pointeeType );
         ret = ProcessType( pointeeType, origArgType, isPointeeConst );
     }
 
@@ -1678,21 +2392,21 @@ ArgumentStandard* ArgumentParser::ProcessTypeRVReference( const CXType &argType,
     return ret;
 }
 
-ArgumentStandard* ArgumentParser::ProcessTypeTypedef( const CXType &argType, const CXType &origArgType, bool inheritConst )
+ArgumentStandard* ArgumentParser::ProcessTypeTypedef( const Function::RawType &argType, const Function::RawType &origArgType, bool inheritConst )
 {
     ArgumentStandard *ret;
 
-    const CXType underlyingType = clang_getCanonicalType( argType );
+    const Function::RawType &underlyingType = GetCanonicalType( argType );
 
-    if( ( underlyingType.kind == CXType_Pointer ) ||
-        ( underlyingType.kind == CXType_LValueReference ) ||
-        ( underlyingType.kind == CXType_RValueReference ) )
+    if( ( GetTypeKind( underlyingType ) == CXType_Pointer ) ||
+        ( GetTypeKind( underlyingType ) == CXType_LValueReference ) ||
+        ( GetTypeKind( underlyingType ) == CXType_RValueReference ) )
     {
-        const CXType pointeeType = clang_getPointeeType( underlyingType );
-        bool isPointeeConst = clang_isConstQualifiedType( pointeeType );
+        const Function::RawType &pointeeType = GetPointeeType( underlyingType );
+        bool isPointeeConst = IsConstQualifiedType( pointeeType );
 
-        if( ( underlyingType.kind == CXType_Pointer ) &&
-            ( pointeeType.kind == CXType_Char_S ) &&
+        if( ( GetTypeKind( underlyingType ) == CXType_Pointer ) &&
+            ( GetTypeKind( pointeeType ) == CXType_Char_S ) &&
             isPointeeConst )
         {
             ret = new ArgumentString( false );
@@ -1706,19 +2420,19 @@ ArgumentStandard* ArgumentParser::ProcessTypeTypedef( const CXType &argType, con
             ret = new ArgumentPointer( false );
         }
 
-        if( underlyingType.kind == CXType_RValueReference )
+        if( GetTypeKind( underlyingType ) == CXType_RValueReference )
         {
             ret->ForceNotIgnored();
         }
 
-        if( underlyingType.kind != CXType_Pointer )
+        if( GetTypeKind( underlyingType ) != CXType_Pointer )
         {
             ret->MockArgExprPrepend("&");
         }
     }
-    else if( underlyingType.kind == CXType_IncompleteArray )
+    else if( GetTypeKind( underlyingType ) == CXType_IncompleteArray )
     {
-        bool isArrayConst = clang_isConstQualifiedType( underlyingType );
+        bool isArrayConst = IsConstQualifiedType( underlyingType );
 
         if( isArrayConst )
         {
@@ -1731,19 +2445,19 @@ ArgumentStandard* ArgumentParser::ProcessTypeTypedef( const CXType &argType, con
     }
     else
     {
-        bool isTypedefConst = clang_isConstQualifiedType( argType ) || inheritConst;
+        bool isTypedefConst = IsConstQualifiedType( argType ) || inheritConst;
         ret = ProcessType( underlyingType, origArgType, isTypedefConst );
     }
 
     return ret;
 }
 
-ArgumentStandard* ArgumentParser::ProcessTypeRecord( const CXType &argType, const CXType &origArgType, bool inheritConst, bool isPointee )
+ArgumentStandard* ArgumentParser::ProcessTypeRecord( const Function::RawType &argType, const Function::RawType &origArgType, bool inheritConst, bool isPointee )
 {
     ArgumentInputOfType *ret;
 
-    bool isConst = clang_isConstQualifiedType( argType ) || inheritConst;
-    auto exposedType = getBareTypeSpelling( m_config.UseUnderlyingTypedefType() ? argType : origArgType );
+    bool isConst = IsConstQualifiedType( argType ) || inheritConst;
+    auto exposedType = GetBareTypeSpelling( m_config.UseUnderlyingTypedefType() ? argType : origArgType );
     if( !isPointee || isConst )
     {
         ret = new ArgumentInputOfType( false, exposedType );
@@ -1763,6 +2477,53 @@ ArgumentStandard* ArgumentParser::ProcessTypeRecord( const CXType &argType, cons
 //
 //*************************************************************************************************
 
+// Type caches are implemented here because destroying their entries requires the complete return and argument types
+static thread_local Function::TypeCache *currentTypeCache = nullptr;
+
+Function::TypeCache::TypeCache( StringPool *stringPool, bool keepRawTypes )
+: m_entries( new Entries ), m_stringPool( stringPool ), m_keepRawTypes( keepRawTypes ), m_previous( currentTypeCache )
+{
+    currentTypeCache = this;
+}
+
+Function::TypeCache::~TypeCache() noexcept
+{
+    currentTypeCache = m_previous;
+}
+
+Function::TypeCache* Function::TypeCache::GetCurrent() noexcept
+{
+    return currentTypeCache;
+}
+
+std::shared_ptr<const std::string> ModelString::Intern( const std::string &str )
+{
+    if( str.empty() )
+    {
+        return nullptr;
+    }
+
+    StringPool *stringPool = ( currentTypeCache != nullptr ) ? currentTypeCache->GetStringPool() : nullptr;
+    if( stringPool == nullptr )
+    {
+        return std::make_shared<const std::string>( str );
+    }
+
+    // The strings interned while parsing a translation unit are also kept in its type cache, which is only used by
+    // the current thread, so that the pool shared with other threads is only consulted the first time that each
+    // string is found in the translation unit
+    auto &internedStrings = currentTypeCache->GetEntries().internedStrings;
+    auto it = internedStrings.find( str );
+    if( it != internedStrings.end() )
+    {
+        return it->second;
+    }
+
+    std::shared_ptr<const std::string> internedStr = stringPool->Intern( str );
+    internedStrings.emplace( *internedStr, internedStr );
+    return internedStr;
+}
+
 Function::Function() noexcept
 : m_isConstMethod( false ), m_isNonStaticMethod( false ), m_exceptionSpec( EExceptionSpec::Any )
 {
@@ -1828,11 +2589,10 @@ static Function::EExceptionSpec ParseClangExceptionSpec( const CXCursor &cursor
 
 bool Function::Parse( const CXCursor &cursor, const Config &config )
 {
+    TimeReport::Scope timeScope( TimeReport::Phase::FUNCTION_PARSE );
+
     if( IsMockable(cursor) )
     {
-        ReturnParser returnParser( config );
-        ArgumentParser argumentParser( config );
-
         // Get function name
         m_functionName = getQualifiedName( cursor );
 
@@ -1875,18 +2635,24 @@ bool Function::Parse( const CXCursor &cursor, const Config &config )
         if( !isConstructor && !isDestructor )
         {
             // Get & process function return type
-            const CXType returnType = clang_getCursorResultType( cursor );
-            m_return = std::unique_ptr<Return>( returnParser.Process( m_functionName, returnType ) );
+            m_rawReturnType = GetRawType( clang_getCursorResultType( cursor ) );
         }
 
         // Process arguments
         int numArgs = clang_Cursor_getNumArguments( cursor );
+        m_rawArguments.reserve( std::max( numArgs, 0 ) );
         for( int i = 0; i < numArgs; i++ )
         {
             const CXCursor arg = clang_Cursor_getArgument( cursor, i );
-            m_arguments.push_back( std::unique_ptr<Argument>( argumentParser.Process( m_functionName, arg, i ) ) );
+            m_rawArguments.emplace_back( ModelString::Intern( toString( clang_getCursorSpelling( arg ) ) ),
+                                         GetRawType( clang_getCursorType( arg ) ) );
         }
 
+        Process( config );
+
+        TimeReport::Count( TimeReport::Counter::FUNCTIONS );
+        TimeReport::Count( TimeReport::Counter::ARGUMENTS, m_arguments.size() );
+
         return true;
     }
     else
@@ -1895,7 +2661,142 @@ bool Function::Parse( const CXCursor &cursor, const Config &config )
     }
 }
 
-static std::string ExceptionSpecToString( Function::EExceptionSpec exceptionSpec ) noexcept
+bool Function::Parse( const SimpleCParser::FunctionDecl &function, const Config &config )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::FUNCTION_PARSE );
+
+    // Functions declared in C headers are never methods, and exception specifications do not apply to them
+    m_functionName = function.name;
+    m_exceptionSpec = EExceptionSpec::Any;
+
+    m_rawReturnType = GetRawType( *function.returnType );
+
+    m_rawArguments.reserve( function.parameters.size() );
+    for( const SimpleCParser::Parameter &parameter : function.parameters )
+    {
+        m_rawArguments.emplace_back( ModelString::Intern( parameter.name ), GetRawType( *parameter.type ) );
+    }
+
+    Process( config );
+
+    TimeReport::Count( TimeReport::Counter::FUNCTIONS );
+    TimeReport::Count( TimeReport::Counter::ARGUMENTS, m_arguments.size() );
+
+    return true;
+}
+
+void Function::Process( const Config &config )
+{
+    ReturnParser returnParser( config );
+    ArgumentParser argumentParser( config );
+
+    m_return.reset();
+    if( m_rawReturnType )
+    {
+        m_return = std::unique_ptr<Return>( returnParser.Process( m_functionName, *m_rawReturnType ) );
+    }
+
+    m_arguments.clear();
+    m_arguments.reserve( m_rawArguments.size() );
+    for( size_t i = 0; i < m_rawArguments.size(); i++ )
+    {
+        const ModelString argName( m_rawArguments[i].first );
+        m_arguments.push_back( std::unique_ptr<Argument>( argumentParser.Process( m_functionName, *m_rawArguments[i].second,
+                                                                                  argName, (int) i ) ) );
+    }
+
+    // The raw types are only needed afterwards to serialize the function, which is not done when the current type
+    // cache does not keep them
+    if( ( currentTypeCache != nullptr ) && !currentTypeCache->KeepsRawTypes() )
+    {
+        m_rawReturnType.reset();
+        m_rawArguments.clear();
+        m_rawArguments.shrink_to_fit();
+    }
+}
+
+void Function::Serialize( std::ostream &output ) const
+{
+    WriteString( output, m_functionName );
+    WriteString( output, m_className );
+    WriteFlag( output, m_isConstMethod );
+    WriteFlag( output, m_isNonStaticMethod );
+    WriteNumber( output, static_cast<size_t>( m_exceptionSpec ) );
+
+    WriteFlag( output, bool( m_rawReturnType ) );
+    if( m_rawReturnType )
+    {
+        WriteRawType( output, *m_rawReturnType );
+    }
+
+    WriteNumber( output, m_rawArguments.size() );
+    for( const std::pair<std::shared_ptr<const std::string>, std::shared_ptr<const RawType>> &rawArgument : m_rawArguments )
+    {
+        WriteString( output, ModelString( rawArgument.first ) );
+        WriteRawType( output, *rawArgument.second );
+    }
+}
+
+bool Function::Deserialize( std::istream &input, const Config &config )
+{
+    size_t exceptionSpec;
+    bool hasReturn;
+
+    if( !ReadString( input, m_functionName ) ||
+        !ReadString( input, m_className ) ||
+        !ReadFlag( input, m_isConstMethod ) ||
+        !ReadFlag( input, m_isNonStaticMethod ) ||
+        !ReadNumber( input, exceptionSpec ) || ( exceptionSpec > static_cast<size_t>( EExceptionSpec::MSAny ) ) ||
+        !ReadFlag( input, hasReturn ) )
+    {
+        return false;
+    }
+
+    m_exceptionSpec = static_cast<EExceptionSpec>( exceptionSpec );
+
+    m_rawReturnType.reset();
+    if( hasReturn )
+    {
+        m_rawReturnType = ReadRawType( input );
+        if( !m_rawReturnType )
+        {
+            return false;
+        }
+    }
+
+    size_t numArgs;
+    if( !ReadNumber( input, numArgs ) )
+    {
+        return false;
+    }
+
+    m_rawArguments.clear();
+    for( size_t i = 0; i < numArgs; i++ )
+    {
+        std::string argName;
+        std::shared_ptr<const RawType> argType;
+        if( !ReadString( input, argName ) || !( argType = ReadRawType( input ) ) )
+        {
+            return false;
+        }
+        m_rawArguments.emplace_back( ModelString::Intern( argName ), argType );
+    }
+
+    // The types are processed again, so that the current type overrides are applied
+    try
+    {
+        Process( config );
+    }
+    catch( const std::runtime_error& )
+    {
+        // Types that cannot be processed can only come from invalid serialized data
+        return false;
+    }
+
+    return true;
+}
+
+static const char* ExceptionSpecToString( Function::EExceptionSpec exceptionSpec ) noexcept
 {
     switch(exceptionSpec)
     {
@@ -1917,122 +2818,155 @@ static std::string ExceptionSpecToString( Function::EExceptionSpec exceptionSpec
 }
 
 std::string Function::GenerateMock() const noexcept
+{
+    CodeEmitter output;
+    GenerateMock( output );
+    return output.Release();
+}
+
+void Function::GenerateMock( CodeEmitter &output ) const noexcept
 {
 // LCOV_EXCL_START
     if( m_functionName.empty() )
     {
-        return "";
+        return;
     }
 // LCOV_EXCL_STOP
 
-    std::string signature;
-    std::string body;
+    // Signature
 
     if( m_return )
     {
-        signature = m_return->GetMockSignature() + " ";
-        body = m_return->GetMockBodyFront();
+        m_return->EmitMockSignature( output );
+        output << ' ';
     }
 
-    signature += m_functionName + "(";
-    body += "mock().actualCall(\"" + m_functionName + "\")";
-
-    if( m_isNonStaticMethod )
-    {
-        body += ".onObject(this)";
-    }
+    output << m_functionName << '(';
 
     for( size_t i = 0; i < m_arguments.size(); i++ )
     {
         if( i > 0 )
         {
-            signature += ", ";
+            output << ", ";
         }
 
-        signature += m_arguments[i]->GetMockSignature();
-
-        body += m_arguments[i]->GetMockBody();
+        m_arguments[i]->EmitMockSignature( output );
     }
 
-    signature += ")";
+    output << ')';
 
     if( m_isConstMethod )
     {
-        signature += " const";
+        output << " const";
     }
 
-    signature += ExceptionSpecToString( m_exceptionSpec );
+    output << ExceptionSpecToString( m_exceptionSpec );
+
+    // Body
+
+    output << "\n{\n    ";
 
     if( m_return )
     {
-        body += m_return->GetMockBodyBack();
+        m_return->EmitMockBodyFront( output );
     }
 
-    return signature + "\n{\n    " + body + ";\n}\n";
-}
-
-static std::string namespaceSeparator = "::";
+    output << "mock().actualCall(\"" << m_functionName << "\")";
 
-static std::vector<std::string> GetNamespaceDecomposition( const std::string &qualifiedName ) noexcept
-{
-    std::vector<std::string> ret;
+    if( m_isNonStaticMethod )
+    {
+        output << ".onObject(this)";
+    }
 
-    size_t initPos = 0;
-    size_t endPos = 0;
+    for( const std::unique_ptr<Argument> &argument : m_arguments )
+    {
+        argument->EmitMockBody( output );
+    }
 
-    while( endPos != std::string::npos )
+    if( m_return )
     {
-        endPos = qualifiedName.find(namespaceSeparator, initPos);
-        if( endPos != std::string::npos )
-        {
-            ret.push_back( qualifiedName.substr( initPos, (endPos - initPos) ) );
-        }
-        else
-        {
-            ret.push_back( qualifiedName.substr( initPos ) );
-        }
-        initPos = endPos + namespaceSeparator.size();
+        m_return->EmitMockBodyBack( output );
     }
 
-    return ret;
+    output << ";\n}\n";
 }
 
+static const char namespaceSeparator[] = "::";
+
 std::string Function::GenerateExpectation( bool proto ) const noexcept
+{
+    CodeEmitter output;
+    GenerateExpectation( proto, output );
+    return output.Release();
+}
+
+void Function::GenerateExpectation( bool proto, CodeEmitter &output ) const noexcept
 {
 // LCOV_EXCL_START
     if( m_functionName.empty() )
     {
-        return "";
+        return;
     }
 // LCOV_EXCL_STOP
 
     // Namespace opening
-    std::string ret = "namespace expect {";
+    output << "namespace expect {";
 
-    std::vector<std::string> namespaces = GetNamespaceDecomposition( m_functionName );
-    for( size_t i = 0; i < (namespaces.size() - 1); i++ )
+    size_t numNamespaces = 0;
+    size_t initPos = 0;
+    size_t endPos = m_functionName.find( namespaceSeparator );
+    while( endPos != std::string::npos )
     {
-        ret += " namespace " + namespaces[i] + "$ {";
+        output << " namespace ";
+        output.Write( ( m_functionName.data() + initPos ), ( endPos - initPos ) );
+        output << "$ {";
+        numNamespaces++;
+
+        initPos = endPos + ( sizeof( namespaceSeparator ) - 1 );
+        endPos = m_functionName.find( namespaceSeparator, initPos );
     }
-    ret += "\n";
+    output << '\n';
 
-    std::string functionName = GetExpectationFunctionName( namespaces[namespaces.size()-1] );
+    std::string functionName = ( initPos == 0 ) ? GetExpectationFunctionName( m_functionName ) :
+                                                  GetExpectationFunctionName( m_functionName.substr( initPos ) );
 
     // Function processing
-    ret += GenerateExpectation( proto, functionName, true );
-    ret += GenerateExpectation( proto, functionName, false );
+    GenerateExpectation( proto, functionName, true, output );
+    GenerateExpectation( proto, functionName, false, output );
 
     // Namespace closing
-    for( size_t i = 0; i < (namespaces.size() - 1); i++ )
+    for( size_t i = 0; i < numNamespaces; i++ )
     {
-        ret += "} ";
+        output << "} ";
     }
-    ret += "}\n";
+    output << "}\n";
+}
 
-    return ret;
+// The separator is only kept if the emitter generates any code
+template<typename TEmit>
+static bool EmitSeparated( CodeEmitter &output, bool addSeparator, TEmit emit ) noexcept
+{
+    size_t mark = output.GetSize();
+
+    if( addSeparator )
+    {
+        output << ", ";
+    }
+
+    size_t start = output.GetSize();
+
+    emit();
+
+    if( output.GetSize() == start )
+    {
+        output.Truncate( mark );
+        return false;
+    }
+
+    return true;
 }
 
-std::string Function::GenerateExpectation( bool proto, const std::string &functionName, bool oneCall ) const noexcept
+void Function::GenerateExpectation( bool proto, const std::string &functionName, bool oneCall, CodeEmitter &output ) const noexcept
 {
     bool addSignatureSeparator = false;
     bool argumentsSkipped = HasSkippedArguments();
@@ -2040,11 +2974,11 @@ std::string Function::GenerateExpectation( bool proto, const std::string &functi
 
     // Generate function signature initial part (name, number of calls paramater, and object paramater)
 
-    std::string ret = "MockExpectedCall& " + functionName + "(";
+    output << "MockExpectedCall& " << functionName << '(';
 
     if( !oneCall )
     {
-        ret += "unsigned int " NUM_CALLS_ARG_NAME;
+        output << "unsigned int " NUM_CALLS_ARG_NAME;
         addSignatureSeparator = true;
     }
 
@@ -2052,155 +2986,122 @@ std::string Function::GenerateExpectation( bool proto, const std::string &functi
     {
         if( addSignatureSeparator )
         {
-            ret += ", ";
+            output << ", ";
         }
 
-        ret += "CppUMockGen::Parameter<const " + m_className + "*> " OBJECT_ARG_NAME;
+        output << "CppUMockGen::Parameter<const " << m_className << "*> " OBJECT_ARG_NAME;
 
         if( !m_return && proto )
         {
             // Destructor => Add default value
-            ret += " = ::CppUMockGen::IgnoreParameter::YES";
+            output << " = ::CppUMockGen::IgnoreParameter::YES";
         }
 
         addSignatureSeparator = true;
     }
 
-    // Generate function body initial part (name, number of calls paramater, and object paramater)
+    // Generate function signature arguments part
 
-    std::string body;
-    if( !proto )
+    for( const std::unique_ptr<Argument> &argument : m_arguments )
     {
-        if( oneCall )
+        if( EmitSeparated( output, addSignatureSeparator, [&]() { argument->EmitExpectationSignature( output ); } ) )
         {
-            body += INDENT "return " + functionName + "(1";
-
-            if( m_isNonStaticMethod )
-            {
-                body += ", " OBJECT_ARG_NAME;
-            }
+            addSignatureSeparator = true;
         }
-        else
-        {
-            if( checkIgnoredArguments )
-            {
-                body += INDENT "bool " IGNORE_OTHERS_VAR_NAME " = false;\n";
-            }
+    }
 
-            body += INDENT "MockExpectedCall& " EXPECTED_CALL_VAR_NAME " = mock().expectNCalls(" NUM_CALLS_ARG_NAME ", \"" + m_functionName + "\");\n";
+    // Generate function signature return part
 
-            if( m_isNonStaticMethod )
-            {
-                body += INDENT "if(!" OBJECT_ARG_NAME ".isIgnored()) { " EXPECTED_CALL_VAR_NAME ".onObject(const_cast<" +
-                        m_className + "*>(" OBJECT_ARG_NAME ".getValue())); }\n";
-            }
-        }
+    if( m_return )
+    {
+        EmitSeparated( output, addSignatureSeparator, [&]() { m_return->EmitExpectationSignature( output ); } );
     }
 
-    // Generate function signature and body arguments part
+    // Generate function signature final part
 
-    for( size_t i = 0; i < m_arguments.size(); i++ )
+    if( proto )
     {
-        // Generate function signature argument part
+        output << ");\n";
+        return;
+    }
 
-        std::string argumentSignature = m_arguments[i]->GetExpectationSignature();
+    output << ")\n{\n";
 
-        if( !argumentSignature.empty() )
-        {
-            if( addSignatureSeparator )
-            {
-                ret += ", ";
-            }
+    // Generate function body initial part (name, number of calls paramater, and object paramater)
 
-            ret += argumentSignature;
-            addSignatureSeparator = true;
+    if( oneCall )
+    {
+        output << INDENT "return " << functionName << "(1";
+
+        if( m_isNonStaticMethod )
+        {
+            output << ", " OBJECT_ARG_NAME;
+        }
+    }
+    else
+    {
+        if( checkIgnoredArguments )
+        {
+            output << INDENT "bool " IGNORE_OTHERS_VAR_NAME " = false;\n";
         }
 
-        // Generate function body argument part
+        output << INDENT "MockExpectedCall& " EXPECTED_CALL_VAR_NAME " = mock().expectNCalls(" NUM_CALLS_ARG_NAME ", \"" << m_functionName << "\");\n";
 
-        if( !proto )
+        if( m_isNonStaticMethod )
         {
-            if( oneCall )
-            {
-                std::string callArgument = m_arguments[i]->GetExpectationCallArgument();
-                if( !callArgument.empty() )
-                {
-                    body += ", " + callArgument;
-                }
-            }
-            else
-            {
-                body += m_arguments[i]->GetExpectationBody( argumentsSkipped );
-            }
+            output << INDENT "if(!" OBJECT_ARG_NAME ".isIgnored()) { " EXPECTED_CALL_VAR_NAME ".onObject(const_cast<" <<
+                      m_className << "*>(" OBJECT_ARG_NAME ".getValue())); }\n";
         }
     }
 
-    // Generate function signature and body return part
+    // Generate function body arguments part
 
-    if( m_return )
+    for( const std::unique_ptr<Argument> &argument : m_arguments )
     {
-        // Generate function signature return part
-
-        std::string returnSignature = m_return->GetExpectationSignature();
-
-        if( !returnSignature.empty() )
+        if( oneCall )
         {
-            if( addSignatureSeparator )
-            {
-                ret += ", ";
-            }
-
-            ret += returnSignature;
+            EmitSeparated( output, true, [&]() { argument->EmitExpectationCallArgument( output ); } );
+        }
+        else
+        {
+            argument->EmitExpectationBody( output, argumentsSkipped );
         }
+    }
 
-        // Generate function body return part
+    // Generate function body return part
 
-        if( !proto )
+    if( m_return )
+    {
+        if( oneCall )
         {
-            if( oneCall )
-            {
-                std::string returnArgument = m_return->GetExpectationCallArgument();
-                if( !returnArgument.empty() )
-                {
-                    body += ", " + returnArgument;
-                }
-            }
-            else
-            {
-                body += m_return->GetExpectationBody();
-            }
+            EmitSeparated( output, true, [&]() { m_return->EmitExpectationCallArgument( output ); } );
+        }
+        else
+        {
+            m_return->EmitExpectationBody( output );
         }
     }
 
-    // Generate function signature and body final part
+    // Generate function body final part
 
-    if( proto )
+    if( oneCall )
     {
-        ret += ");\n";
+        output << ");";
     }
     else
     {
-        if( oneCall )
+        if( argumentsSkipped )
         {
-            body += ");";
+            output << INDENT EXPECTED_CALL_VAR_NAME ".ignoreOtherParameters();\n";
         }
-        else
+        else if( checkIgnoredArguments )
         {
-            if( argumentsSkipped )
-            {
-                body += INDENT EXPECTED_CALL_VAR_NAME ".ignoreOtherParameters();\n";
-            }
-            else if( checkIgnoredArguments )
-            {
-                body += INDENT "if(" IGNORE_OTHERS_VAR_NAME ") { " EXPECTED_CALL_VAR_NAME ".ignoreOtherParameters(); }\n";
-            }
-            body += INDENT "return " EXPECTED_CALL_VAR_NAME ";";
+            output << INDENT "if(" IGNORE_OTHERS_VAR_NAME ") { " EXPECTED_CALL_VAR_NAME ".ignoreOtherParameters(); }\n";
         }
-
-        ret += ")\n{\n" + body + "\n}\n";
+        output << INDENT "return " EXPECTED_CALL_VAR_NAME ";";
     }
 
-    return ret;
+    output << "\n}\n";
 }
 
 bool Function::HasIgnorableArguments() const noexcept
@@ -14,7 +14,14 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <utility>
+#include <istream>
+#include <ostream>
 #include "Config.hpp"
+#include "SimpleCParser.hpp"
+#include "CodeEmitter.hpp"
+
+class StringPool;
 
 /**
  * Class used to parse functions and generate mocks and expectations.
@@ -40,6 +47,14 @@ public:
      */
     bool Parse( const CXCursor &cursor, const Config &config );
 
+    /**
+     * Parses a function declared in a C header parsed by the simple C parser.
+     *
+     * @param[in] function Declaration of the function
+     * @param[in] config Configuration to be used for parsing
+     */
+    bool Parse( const SimpleCParser::FunctionDecl &function, const Config &config );
+
     /**
      * Generates a mock for the function.
      *
@@ -47,6 +62,13 @@ public:
      */
     std::string GenerateMock() const noexcept;
 
+    /**
+     * Generates a mock for the function, appending it to the code emitted previously.
+     *
+     * @param[out] output Emitter where the generated mock is appended
+     */
+    void GenerateMock( CodeEmitter &output ) const noexcept;
+
     /**
      * Generates an expectation function prototype or implementation for the function.
      *
@@ -55,8 +77,41 @@ public:
      */
     std::string GenerateExpectation( bool proto ) const noexcept;
 
+    /**
+     * Generates an expectation function prototype or implementation for the function, appending it to the code
+     * emitted previously.
+     *
+     * @param[in] proto Generate function prototype if @c true, or function implementation otherwise.
+     * @param[out] output Emitter where the generated expectation function is appended
+     */
+    void GenerateExpectation( bool proto, CodeEmitter &output ) const noexcept;
+
+    /**
+     * Serializes the parsed function, so that it can be loaded later without parsing it again.
+     *
+     * The return and parameter types are stored as parsed, before applying any type override, so that the serialized
+     * function does not depend on the configuration used for parsing it. Therefore, the function must not have been
+     * parsed while a type cache that does not keep the raw types existed.
+     *
+     * @param[out] output Stream where the serialized function is written
+     */
+    void Serialize( std::ostream &output ) const;
+
+    /**
+     * Loads a function serialized previously.
+     *
+     * The return and parameter types are processed again, applying the type overrides in @p config.
+     *
+     * @param[in] input Stream where the serialized function is read from
+     * @param[in] config Configuration to be used for processing the function
+     * @return @c true if the function was loaded, @c false if the serialized data is invalid
+     */
+    bool Deserialize( std::istream &input, const Config &config );
+
     class Argument;
     class Return;
+    class RawType;
+    class TypeCache;
 
     enum class EExceptionSpec
     {
@@ -75,11 +130,13 @@ protected:
 
     virtual std::string GetExpectationFunctionName( const std::string &functionName ) const noexcept;
 
-    std::string GenerateExpectation( bool proto, const std::string &functionName, bool oneCall ) const noexcept;
+    void GenerateExpectation( bool proto, const std::string &functionName, bool oneCall, CodeEmitter &output ) const noexcept;
 
     bool HasIgnorableArguments() const noexcept;
     bool HasSkippedArguments() const noexcept;
 
+    void Process( const Config &config );
+
     std::string m_functionName;
     std::unique_ptr<Return> m_return;
     std::vector<std::unique_ptr<Argument>> m_arguments;
@@ -87,6 +144,81 @@ protected:
     bool m_isNonStaticMethod;
     EExceptionSpec m_exceptionSpec;
     std::string m_className;
+    std::shared_ptr<const RawType> m_rawReturnType;
+    std::vector<std::pair<std::shared_ptr<const std::string>, std::shared_ptr<const RawType>>> m_rawArguments;
+};
+
+/**
+ * Class that caches the processing of the return and parameter types of functions.
+ *
+ * While a cache exists, the way of mocking each distinct type (i.e., the kind of mocked value, the expression
+ * modifiers and the expectation type) determined when parsing functions from the thread that created it is stored in
+ * the cache, so that further returns or parameters of the same type are just copied from it instead of being
+ * processed again. The raw type of each distinct type (i.e., the type as parsed, which is stored in the models of the
+ * functions) is also stored, so that it is only built once and shared by all the functions that use it. Since types
+ * are only unique within a translation unit, a cache must only be used while parsing a single translation unit.
+ *
+ * The cache may also have a string pool, shared by several translation units, where the strings of the models of the
+ * parsed functions are interned.
+ *
+ * The raw types of the functions parsed while the cache exists are only kept in them when the cache is configured to
+ * keep them, since they are only needed to serialize the functions; functions parsed without a cache always keep them.
+ */
+class Function::TypeCache
+{
+public:
+    /**
+     * Constructor, which makes the cache the current one for the calling thread.
+     *
+     * @param[in] stringPool Pool where the strings of the parsed functions are interned (optional)
+     * @param[in] keepRawTypes Indicates if the parsed functions keep their raw types, so that they can be serialized
+     */
+    TypeCache( StringPool *stringPool = nullptr, bool keepRawTypes = true );
+
+    /**
+     * Destructor, which restores the previous cache for the calling thread.
+     */
+    ~TypeCache() noexcept;
+
+    TypeCache( const TypeCache& ) = delete;
+    TypeCache& operator=( const TypeCache& ) = delete;
+
+    /**
+     * Returns the current cache for the calling thread, or @c nullptr if there is none.
+     */
+    static TypeCache* GetCurrent() noexcept;
+
+    struct Entries;
+
+    /**
+     * Returns the entries stored in the cache.
+     */
+    Entries& GetEntries() noexcept
+    {
+        return *m_entries;
+    }
+
+    /**
+     * Returns the pool where the strings of the parsed functions are interned, or @c nullptr if there is none.
+     */
+    StringPool* GetStringPool() const noexcept
+    {
+        return m_stringPool;
+    }
+
+    /**
+     * Indicates if the functions parsed while the cache exists keep their raw types.
+     */
+    bool KeepsRawTypes() const noexcept
+    {
+        return m_keepRawTypes;
+    }
+
+private:
+    std::unique_ptr<Entries> m_entries;
+    StringPool *m_stringPool;
+    bool m_keepRawTypes;
+    TypeCache *m_previous;
 };
 
 #endif // header guard
@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @brief      Implementation of JobRunner class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "JobRunner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+#include <exception>
+
+JobRunner::JobRunner( unsigned int numThreads ) noexcept
+: m_numThreads( numThreads )
+{
+    if( m_numThreads == 0 )
+    {
+        m_numThreads = std::thread::hardware_concurrency();
+        if( m_numThreads == 0 )
+        {
+            m_numThreads = 1; // LCOV_EXCL_LINE: Defensive
+        }
+    }
+}
+
+unsigned int JobRunner::GetNumThreads() const noexcept
+{
+    return m_numThreads;
+}
+
+void JobRunner::Run( size_t numJobs, const JobFunction &job, const CompletionFunction &completion ) const
+{
+    size_t numThreads = std::min<size_t>( m_numThreads, numJobs );
+
+    std::vector<std::exception_ptr> exceptions( numJobs );
+
+    if( numThreads <= 1 )
+    {
+        for( size_t jobIndex = 0; jobIndex < numJobs; jobIndex++ )
+        {
+            try
+            {
+                job( jobIndex, 0 );
+            }
+            catch( ... )
+            {
+                exceptions[ jobIndex ] = std::current_exception();
+            }
+
+            completion( jobIndex );
+        }
+    }
+    else
+    {
+        std::atomic<size_t> nextJobIndex( 0 );
+        std::vector<bool> finishedJobs( numJobs, false );
+        std::mutex mutex;
+        std::condition_variable jobFinished;
+
+        auto runJobs = [&]( unsigned int threadIndex )
+        {
+            size_t jobIndex;
+            while( ( jobIndex = nextJobIndex++ ) < numJobs )
+            {
+                try
+                {
+                    job( jobIndex, threadIndex );
+                }
+                catch( ... )
+                {
+                    exceptions[ jobIndex ] = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock( mutex );
+                    finishedJobs[ jobIndex ] = true;
+                }
+                jobFinished.notify_all();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        try
+        {
+            for( unsigned int threadIndex = 0; threadIndex < numThreads; threadIndex++ )
+            {
+                threads.emplace_back( runJobs, threadIndex );
+            }
+        }
+        catch( ... )
+        {
+            // When no more threads can be created the jobs are run by the threads already created, which must be joined
+            // anyway, or by the calling thread if none could be created
+            if( threads.empty() )
+            {
+                runJobs( 0 );
+            }
+        }
+
+        // Report completed jobs in order while the rest of jobs are being processed
+        for( size_t jobIndex = 0; jobIndex < numJobs; jobIndex++ )
+        {
+            {
+                std::unique_lock<std::mutex> lock( mutex );
+                jobFinished.wait( lock, [&]() { return finishedJobs[ jobIndex ]; } );
+            }
+
+            completion( jobIndex );
+        }
+
+        for( std::thread &thread : threads )
+        {
+            thread.join();
+        }
+    }
+
+    for( const std::exception_ptr &exception : exceptions )
+    {
+        if( exception )
+        {
+            std::rethrow_exception( exception );
+        }
+    }
+}
@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @brief      Header of JobRunner class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_JOBRUNNER_HPP_
+#define CPPUMOCKGEN_JOBRUNNER_HPP_
+
+#include <cstddef>
+#include <functional>
+
+/**
+ * Class that runs a set of independent jobs using a pool of worker threads.
+ */
+class JobRunner
+{
+public:
+    /**
+     * Function that executes a job.
+     *
+     * @param[in] jobIndex Index of the job to be executed
+     * @param[in] threadIndex Index of the worker thread executing the job (in the range [0, number of threads) )
+     */
+    typedef std::function<void( size_t jobIndex, unsigned int threadIndex )> JobFunction;
+
+    /**
+     * Function that is called when a job has been completed.
+     *
+     * @param[in] jobIndex Index of the completed job
+     */
+    typedef std::function<void( size_t jobIndex )> CompletionFunction;
+
+    /**
+     * Constructor.
+     *
+     * @param[in] numThreads Maximum number of worker threads, or 0 to use the number of hardware threads
+     */
+    JobRunner( unsigned int numThreads ) noexcept;
+
+    /**
+     * Returns the maximum number of worker threads.
+     */
+    unsigned int GetNumThreads() const noexcept;
+
+    /**
+     * Runs the jobs.
+     *
+     * Jobs are distributed between the worker threads in index order. The completion function is always called from
+     * the calling thread, in the same order as the job indexes, regardless of the order in which jobs actually finish,
+     * so that results can be reported deterministically.
+     *
+     * When only a single worker thread is needed, the jobs are run sequentially in the calling thread. When worker
+     * threads cannot be created, the jobs are run by the worker threads that could be created, or sequentially in the
+     * calling thread if none could be created.
+     *
+     * If any job throws an exception, the rest of jobs are still run, and the exception thrown by the job with the
+     * lowest index is rethrown once all jobs have finished. The completion function shall not throw exceptions.
+     *
+     * @param[in] numJobs Number of jobs
+     * @param[in] job Function that executes a job
+     * @param[in] completion Function called when a job has been completed
+     */
+    void Run( size_t numJobs, const JobFunction &job, const CompletionFunction &completion ) const;
+
+private:
+    unsigned int m_numThreads;
+};
+
+#endif // header guard
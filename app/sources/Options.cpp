@@ -20,21 +20,40 @@ Options::Options()
 : m_options( PRODUCT_NAME, PRODUCT_FILE_DESCRIPTION )
 {
     m_options.add_options()
-        ( "i,input", "Input file path", cxxopts::value<std::string>(), "<input>" )
+        ( "i,input", "Input file path", cxxopts::value<std::vector<std::string>>(), "<input>" )
         ( "m,mock-output", "Mock output directory or file path", cxxopts::value<std::string>()->implicit_value( "" ), "<mock-output>" )
         ( "e,expect-output", "Expectation output directory or file path", cxxopts::value<std::string>()->implicit_value( "" ), "<expect-output>" )
         ( "x,cpp", "Force interpretation of the input file as C++", cxxopts::value<bool>(), "<force-cpp>" )
         ( "s,std", "Set language standard", cxxopts::value<std::string>(), "<standard>" )
         ( "u,underlying-typedef", "Use underlying typedef type", cxxopts::value<bool>(), "<underlying-typedef>" )
+        ( "fast-parse", "Skip function bodies when parsing input files", cxxopts::value<bool>(), "<fast-parse>" )
+        ( "single-file", "Parse only the input files, without processing the files that they include", cxxopts::value<bool>(), "<single-file>" )
+        ( "simple-c", "Parse simple C input files without libclang when possible", cxxopts::value<bool>(), "<simple-c>" )
         ( "I,include-path", "Include path", cxxopts::value<std::vector<std::string>>(), "<path>" )
+        ( "compile-commands", "Compilation database used to get the flags to parse each input file", cxxopts::value<std::string>(), "<path>" )
         ( "B,base-directory", "Base directory path", cxxopts::value<std::string>(), "<path>" )
         ( "t,type-override", "Type override", cxxopts::value<std::vector<std::string>>(), "<expr>" )
+        ( "type-map", "Declaration of a type used when parsing single files", cxxopts::value<std::vector<std::string>>(), "<name>=<type>" )
         ( "f,config-file", "Config file", cxxopts::value<std::vector<std::string>>(), "<file-path>" )
         ( "r,regen", "Use previous generate options from output file", cxxopts::value<bool>(), "<regenerate>" )
+        ( "b,batch-file", "Batch file with a list of input files", cxxopts::value<std::string>(), "<file-path>" )
+        ( "j,jobs", "Number of input files processed in parallel (0 = number of hardware threads)", cxxopts::value<unsigned int>()->default_value( "0" ), "<num>" )
+        ( "cache-dir", "Cache directory used to skip generation of up-to-date outputs", cxxopts::value<std::string>(), "<path>" )
+        ( "check", "Only check if outputs are up to date", cxxopts::value<bool>(), "<check>" )
+        ( "depfile", "Generate dependency files for build systems next to the outputs", cxxopts::value<bool>(), "<depfile>" )
+        ( "watch", "Keep running and regenerate the outputs when the input files or the files they include change", cxxopts::value<bool>(), "<watch>" )
+        ( "prelude", "Header precompiled once and shared by all input files", cxxopts::value<std::vector<std::string>>(), "<header>" )
+        ( "auto-prelude", "Precompile the system headers included at the beginning of all input files", cxxopts::value<bool>(), "<auto-prelude>" )
+        ( "umbrella", "Parse all input files together in a single translation unit", cxxopts::value<bool>(), "<umbrella>" )
+        ( "stream", "Generate the outputs while parsing the input files, keeping memory bounded for very large input files", cxxopts::value<bool>(), "<stream>" )
+        ( "time-report", "Report of the time spent in each processing phase (written to the console if @, as JSON if the file extension is .json)", cxxopts::value<std::string>(), "<file-path>" )
+        ( "trace", "Trace of the processing phases of each input file, viewable with chrome://tracing or Perfetto (written to the console if @)", cxxopts::value<std::string>(), "<file-path>" )
+        ( "worker", "Run as a persistent worker, processing requests read from the standard input", cxxopts::value<bool>(), "<worker>" )
+        ( "persistent_worker", "Same as --worker (as passed by Bazel)", cxxopts::value<bool>(), "<worker>" )
         ( "v,version", "Print version" )
         ( "h,help", "Print help" );
 
-    m_options.positional_help( "<input>" );
+    m_options.positional_help( "<input>..." );
     m_options.parse_positional( std::vector<std::string> { "input" } );
 }
 
@@ -231,9 +250,19 @@ bool Options::IsVersionRequested() const
     return ( m_options.count("version") > 0 );
 }
 
-std::string Options::GetInputPath() const
+bool Options::IsWorkerRequested() const
 {
-    return m_options["input"].as<std::string>();
+    return ( m_options["worker"].as<bool>() || m_options["persistent_worker"].as<bool>() );
+}
+
+std::vector<std::string> Options::GetInputPaths() const
+{
+    return m_options["input"].as<std::vector<std::string>>();
+}
+
+std::string Options::GetBatchFilePath() const
+{
+    return m_options["batch-file"].as<std::string>();
 }
 
 std::string Options::GetBaseDirectory() const
@@ -266,6 +295,66 @@ bool Options::IsRegenerationRequested() const
     return m_options["regen"].as<bool>();
 }
 
+unsigned int Options::GetNumJobs() const
+{
+    return m_options["jobs"].as<unsigned int>();
+}
+
+std::string Options::GetCacheDirectory() const
+{
+    return m_options["cache-dir"].as<std::string>();
+}
+
+std::string Options::GetCompilationDatabasePath() const
+{
+    return m_options["compile-commands"].as<std::string>();
+}
+
+bool Options::IsCheckRequested() const
+{
+    return m_options["check"].as<bool>();
+}
+
+bool Options::IsDepFileRequested() const
+{
+    return m_options["depfile"].as<bool>();
+}
+
+bool Options::IsWatchRequested() const
+{
+    return m_options["watch"].as<bool>();
+}
+
+std::vector<std::string> Options::GetPreludeHeaders() const
+{
+    return m_options["prelude"].as<std::vector<std::string>>();
+}
+
+bool Options::IsAutoPreludeRequested() const
+{
+    return m_options["auto-prelude"].as<bool>();
+}
+
+bool Options::IsUmbrellaParseRequested() const
+{
+    return m_options["umbrella"].as<bool>();
+}
+
+bool Options::IsStreamingRequested() const
+{
+    return m_options["stream"].as<bool>();
+}
+
+std::string Options::GetTimeReportPath() const
+{
+    return m_options["time-report"].as<std::string>();
+}
+
+std::string Options::GetTracePath() const
+{
+    return m_options["trace"].as<std::string>();
+}
+
 bool Options::InterpretAsCpp() const
 {
     return m_options["cpp"].as<bool>();
@@ -281,11 +370,31 @@ bool Options::UseUnderlyingTypedef() const
     return m_options["underlying-typedef"].as<bool>();
 }
 
+bool Options::IsFastParseRequested() const
+{
+    return m_options["fast-parse"].as<bool>();
+}
+
+bool Options::IsSingleFileParseRequested() const
+{
+    return m_options["single-file"].as<bool>();
+}
+
+bool Options::IsSimpleCParseRequested() const
+{
+    return m_options["simple-c"].as<bool>();
+}
+
 std::vector<std::string> Options::GetTypeOverrides() const
 {
     return m_options["type-override"].as<std::vector<std::string>>();
 }
 
+std::vector<std::string> Options::GetTypeMap() const
+{
+    return m_options["type-map"].as<std::vector<std::string>>();
+}
+
 std::vector<std::string> Options::GetIncludePaths() const
 {
     return m_options["include-path"].as<std::vector<std::string>>();
@@ -323,11 +432,23 @@ std::string Options::GetGenerationOptions() const
         ret += "-u ";
     }
 
+    // Options that only make parsing faster (i.e. fast parsing and simple C parsing) are not included, since they do
+    // not change the generated outputs, which otherwise would be rewritten when they are toggled
+    if( IsSingleFileParseRequested() )
+    {
+        ret += "--single-file ";
+    }
+
     for( auto typeOverride : GetTypeOverrides() )
     {
         ret += "-t " + QuotifyOption( typeOverride ) + " ";
     }
 
+    for( auto typeMap : GetTypeMap() )
+    {
+        ret += "--type-map " + QuotifyOption( typeMap ) + " ";
+    }
+
     // Delete the trailing whitespace
     if( !ret.empty() )
     {
@@ -44,7 +44,11 @@ public:
 
     bool IsVersionRequested() const;
 
-    std::string GetInputPath() const;
+    bool IsWorkerRequested() const;
+
+    std::vector<std::string> GetInputPaths() const;
+
+    std::string GetBatchFilePath() const;
 
     std::string GetBaseDirectory() const;
 
@@ -58,14 +62,46 @@ public:
 
     bool IsRegenerationRequested() const;
 
+    unsigned int GetNumJobs() const;
+
+    std::string GetCacheDirectory() const;
+
+    std::string GetCompilationDatabasePath() const;
+
+    bool IsCheckRequested() const;
+
+    bool IsDepFileRequested() const;
+
+    bool IsWatchRequested() const;
+
+    std::vector<std::string> GetPreludeHeaders() const;
+
+    bool IsAutoPreludeRequested() const;
+
+    bool IsUmbrellaParseRequested() const;
+
+    bool IsStreamingRequested() const;
+
+    std::string GetTimeReportPath() const;
+
+    std::string GetTracePath() const;
+
     bool InterpretAsCpp() const;
 
     std::string GetLanguageStandard() const;
 
     bool UseUnderlyingTypedef() const;
 
+    bool IsFastParseRequested() const;
+
+    bool IsSingleFileParseRequested() const;
+
+    bool IsSimpleCParseRequested() const;
+
     std::vector<std::string> GetTypeOverrides() const;
 
+    std::vector<std::string> GetTypeMap() const;
+
     std::vector<std::string> GetIncludePaths() const;
 
     std::string GetGenerationOptions() const;
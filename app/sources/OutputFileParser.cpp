@@ -12,6 +12,8 @@
 #include <fstream>
 #include <regex>
 
+#include "TimeReport.hpp"
+
 static const std::regex g_userCodeBeginRegex( "(?:\\/\\/|\\/\\*)\\s*" USER_CODE_BEGIN );
 static const std::regex g_userCodeEndRegex( "(?:\\/\\/|\\/\\*)\\s*" USER_CODE_END );
 static const std::regex g_generationOptionsRegex( GENERATION_OPTIONS_LABEL "(.*)" );
@@ -32,6 +34,8 @@ const std::string& OutputFileParser::GetGenerationOptions() const
 
 void OutputFileParser::Parse( const std::filesystem::path &filepath )
 {
+    TimeReport::Scope timeScope( TimeReport::Phase::OUTPUT_FILE_PARSE );
+
     bool captureUserCode = false;
     std::string line;
 
@@ -15,6 +15,11 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <unordered_set>
+#include <algorithm>
+#include <iterator>
+#include <functional>
 #include <clang-c/Index.h>
 
 #include "Config.hpp"
@@ -27,16 +32,216 @@
 #include "FileHelper.hpp"
 #include "VersionInfo.h"
 #include "OutputFileParser.hpp"
+#include "SimpleCParser.hpp"
+#include "CodeEmitter.hpp"
+#include "JobRunner.hpp"
+#include "TimeReport.hpp"
+
+using FunctionList = std::vector<std::unique_ptr<const Function>>;
+
+static const char UMBRELLA_FILENAME[] = "CppUMockGen_umbrella.h";
 
 struct ParseData
 {
     const Config& config;
-    std::vector<std::unique_ptr<const Function>> &functions;
+    const std::vector<FunctionList*> &functions;
+    const std::vector<CXFile> *files;
+    const std::unordered_set<std::string> *definedFunctions;
+    const std::function<void()> *functionParsed;
 };
 
-void Parse( CXTranslationUnit tu, const Config &config, std::vector<std::unique_ptr<const Function>> &functions )
+static FunctionList* GetFunctionList( CXCursor cursor, const ParseData &parseData ) noexcept
+{
+    CXSourceLocation location = clang_getCursorLocation( cursor );
+
+    // Only functions declared in the main file are mocked, except for umbrella translation units, where functions are
+    // partitioned by the (included) file where they are declared
+    if( parseData.files == nullptr )
+    {
+        return ( clang_Location_isFromMainFile( location ) != 0 ) ? parseData.functions[0] : nullptr;
+    }
+
+    CXFile file;
+    clang_getExpansionLocation( location, &file, nullptr, nullptr, nullptr );
+    if( file != nullptr )
+    {
+        for( size_t i = 0; i < parseData.files->size(); i++ )
+        {
+            if( clang_File_isEqual( file, (*parseData.files)[i] ) )
+            {
+                return parseData.functions[i];
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+static bool IsFunctionKind( CXCursorKind cursorKind ) noexcept
 {
-    ParseData parseData = { config, functions };
+    return ( cursorKind == CXCursor_FunctionDecl ) || ( cursorKind == CXCursor_CXXMethod ) ||
+           ( cursorKind == CXCursor_Constructor ) || ( cursorKind == CXCursor_Destructor );
+}
+
+static size_t SkipBlanksAndComments( const char *contents, size_t size, size_t pos ) noexcept
+{
+    while( pos < size )
+    {
+        if( ( contents[pos] == ' ' ) || ( contents[pos] == '\t' ) || ( contents[pos] == '\r' ) || ( contents[pos] == '\n' ) )
+        {
+            pos++;
+        }
+        else if( ( contents[pos] == '/' ) && ( ( pos + 1 ) < size ) && ( contents[pos + 1] == '/' ) )
+        {
+            while( ( pos < size ) && ( contents[pos] != '\n' ) )
+            {
+                pos++;
+            }
+        }
+        else if( ( contents[pos] == '/' ) && ( ( pos + 1 ) < size ) && ( contents[pos + 1] == '*' ) )
+        {
+            pos += 2;
+            while( ( ( pos + 1 ) < size ) && !( ( contents[pos] == '*' ) && ( contents[pos + 1] == '/' ) ) )
+            {
+                pos++;
+            }
+            pos += 2;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return pos;
+}
+
+static bool HasBody( CXTranslationUnit tu, CXCursor cursor ) noexcept
+{
+    // Bodies that are never skipped (e.g. of constexpr functions) are reported as definitions
+    if( clang_isCursorDefinition( cursor ) )
+    {
+        return true;
+    }
+
+    // The extent of a function declaration whose body was skipped ends before the body, while the extent of a
+    // declaration without body (including "= 0", "= default" and "= delete") is always followed by the semicolon
+    // or comma that terminates it
+    CXFile file;
+    unsigned int offset;
+    clang_getExpansionLocation( clang_getRangeEnd( clang_getCursorExtent( cursor ) ), &file, nullptr, nullptr, &offset );
+
+    size_t size = 0;
+    const char *contents = ( file != nullptr ) ? clang_getFileContents( tu, file, &size ) : nullptr;
+    if( contents == nullptr )
+    {
+        return false; // LCOV_EXCL_LINE: Defensive
+    }
+
+    size_t pos = SkipBlanksAndComments( contents, size, offset );
+    return ( pos < size ) && ( contents[pos] != ';' ) && ( contents[pos] != ',' );
+}
+
+struct DefinitionsData
+{
+    CXTranslationUnit tu;
+    std::unordered_set<std::string> &definedFunctions;
+};
+
+static void GetDefinedFunctions( CXTranslationUnit tu, std::unordered_set<std::string> &definedFunctions )
+{
+    DefinitionsData definitionsData = { tu, definedFunctions };
+
+    // Functions are identified by their USR, which is the same for all their declarations, because functions declared
+    // in the input file may be defined in any of its declarations (in the input file or in the files it includes)
+    CXCursor tuCursor = clang_getTranslationUnitCursor( tu );
+    clang_visitChildren(
+        tuCursor,
+        []( CXCursor cursor, CXCursor parent, CXClientData clientData )
+        {
+            DefinitionsData *definitionsData = (DefinitionsData*) clientData;
+            if( clang_Location_isInSystemHeader( clang_getCursorLocation( cursor ) ) != 0 )
+            {
+                return CXChildVisit_Continue;
+            }
+            else if( IsFunctionKind( clang_getCursorKind( cursor ) ) )
+            {
+                if( HasBody( definitionsData->tu, cursor ) )
+                {
+                    definitionsData->definedFunctions.insert( toString( clang_getCursorUSR( cursor ) ) );
+                }
+                return CXChildVisit_Continue;
+            }
+            else
+            {
+                return CXChildVisit_Recurse;
+            }
+        },
+        (CXClientData) &definitionsData );
+}
+
+static bool IsDefinedFunction( CXCursor cursor, const std::unordered_set<std::string> &definedFunctions ) noexcept
+{
+    if( definedFunctions.count( toString( clang_getCursorUSR( cursor ) ) ) > 0 )
+    {
+        return true;
+    }
+
+    // Declarations loaded from a precompiled prelude are not visited when looking for definitions, therefore the first
+    // declaration and the definition of the function are also checked, since they may come from it
+    CXTranslationUnit tu = clang_Cursor_getTranslationUnit( cursor );
+    for( CXCursor declaration : { clang_getCanonicalCursor( cursor ), clang_getCursorDefinition( cursor ) } )
+    {
+        if( !clang_Cursor_isNull( declaration ) && !clang_equalCursors( declaration, cursor ) &&
+            ( clang_Location_isInSystemHeader( clang_getCursorLocation( declaration ) ) == 0 ) &&
+            HasBody( tu, declaration ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<typename T>
+static void ParseFunction( CXCursor cursor, FunctionList &functions, const ParseData &parseData )
+{
+    T *function = new T;
+    if( function->Parse( cursor, parseData.config ) )
+    {
+        functions.push_back( std::unique_ptr<const Function>(function) );
+
+        if( parseData.functionParsed != nullptr )
+        {
+            (*parseData.functionParsed)();
+        }
+    }
+    else
+    {
+        delete function; // LCOV_EXCL_BR_LINE: False positive
+    }
+}
+
+void Parse( CXTranslationUnit tu, const Config &config, const std::vector<FunctionList*> &functions,
+            const std::vector<CXFile> *files, bool skipFunctionBodies, StringPool *stringPool, bool keepRawTypes,
+            const std::function<void()> *functionParsed = nullptr )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::AST_TRAVERSAL );
+
+    // When function bodies are skipped libclang does not report functions defined inline as having a definition,
+    // therefore they are detected beforehand from the source code and not mocked
+    std::unordered_set<std::string> definedFunctions;
+    if( skipFunctionBodies )
+    {
+        GetDefinedFunctions( tu, definedFunctions );
+    }
+
+    ParseData parseData = { config, functions, files, ( skipFunctionBodies ? &definedFunctions : nullptr ), functionParsed };
+
+    // The scopes that contain the functions and the types of their returns and parameters are resolved only once for
+    // the whole translation unit
+    CursorCache cursorCache;
+    Function::TypeCache typeCache( stringPool, keepRawTypes );
 
     CXCursor tuCursor = clang_getTranslationUnitCursor(tu);
     clang_visitChildren(
@@ -44,59 +249,33 @@ void Parse( CXTranslationUnit tu, const Config &config, std::vector<std::unique_
         []( CXCursor cursor, CXCursor parent, CXClientData clientData )
         {
             ParseData *parseData = (ParseData*) clientData;
-            if( clang_Location_isFromMainFile( clang_getCursorLocation( cursor ) ) != 0 )
+            FunctionList *functions = GetFunctionList( cursor, *parseData );
+            if( functions != nullptr )
             {
                 CXCursorKind cursorKind = clang_getCursorKind( cursor );
-                if( cursorKind == CXCursor_FunctionDecl )
+                if( IsFunctionKind( cursorKind ) && ( parseData->definedFunctions != nullptr ) &&
+                    IsDefinedFunction( cursor, *parseData->definedFunctions ) )
+                {
+                    return CXChildVisit_Continue;
+                }
+                else if( cursorKind == CXCursor_FunctionDecl )
                 {
-                    Function *function = new Function;
-                    if( function->Parse( cursor, parseData->config ) )
-                    {
-                        parseData->functions.push_back( std::unique_ptr<const Function>(function) );
-                    }
-                    else
-                    {
-                        delete function; // LCOV_EXCL_BR_LINE: False positive
-                    }
+                    ParseFunction<Function>( cursor, *functions, *parseData );
                     return CXChildVisit_Continue;
                 }
                 else if( cursorKind == CXCursor_CXXMethod )
                 {
-                    Method *method = new Method;
-                    if( method->Parse( cursor, parseData->config ) )
-                    {
-                        parseData->functions.push_back( std::unique_ptr<const Function>(method) );
-                    }
-                    else
-                    {
-                        delete method; // LCOV_EXCL_BR_LINE: False positive
-                    }
+                    ParseFunction<Method>( cursor, *functions, *parseData );
                     return CXChildVisit_Continue;
                 }
                 else if( cursorKind == CXCursor_Constructor )
                 {
-                    Constructor *constructor = new Constructor;
-                    if( constructor->Parse( cursor, parseData->config ) )
-                    {
-                        parseData->functions.push_back( std::unique_ptr<const Function>(constructor) );
-                    }
-                    else
-                    {
-                        delete constructor; // LCOV_EXCL_BR_LINE: False positive
-                    }
+                    ParseFunction<Constructor>( cursor, *functions, *parseData );
                     return CXChildVisit_Continue;
                 }
                 else if( cursorKind == CXCursor_Destructor )
                 {
-                    Destructor *destructor = new Destructor;
-                    if( destructor->Parse( cursor, parseData->config ) )
-                    {
-                        parseData->functions.push_back( std::unique_ptr<const Function>(destructor) );
-                    }
-                    else
-                    {
-                        delete destructor; // LCOV_EXCL_BR_LINE: False positive
-                    }
+                    ParseFunction<Destructor>( cursor, *functions, *parseData );
                     return CXChildVisit_Continue;
                 }
                 else
@@ -112,15 +291,11 @@ void Parse( CXTranslationUnit tu, const Config &config, std::vector<std::unique_
         (CXClientData) &parseData );
 }
 
-bool Parser::Parse( const std::filesystem::path &inputFilepath, const Config &config, bool isCppHeader,
-                    const std::vector<std::string> &includePaths, std::ostream &error )
+static std::vector<std::string> GetClangArgs( const Config &config, const std::vector<std::string> &includePaths,
+                                              const std::vector<std::string> &compileArgs, bool &interpretAsCpp,
+                                              bool isHeader )
 {
-    m_inputFilePath = inputFilepath;
-    m_interpretAsCpp = isCppHeader || config.InterpretAsCpp();
-
-    CXIndex index = clang_createIndex( 0, 0 );
-
-    std::vector<const char*> clangOpts;
+    std::vector<std::string> clangArgs;
 
     std::string stdOpt;
 
@@ -132,62 +307,53 @@ bool Parser::Parse( const std::filesystem::path &inputFilepath, const Config &co
 
         if( ( languageStandard.find( "c++" ) == 0 ) || ( languageStandard.find( "gnu++" ) == 0 ) )
         {
-            m_interpretAsCpp = true;
+            interpretAsCpp = true;
         }
     }
 
-    if( m_interpretAsCpp )
+    if( interpretAsCpp )
     {
-        clangOpts.push_back( "-xc++" );
+        clangArgs.push_back( isHeader ? "-xc++-header" : "-xc++" );
     }
-
-    if( !stdOpt.empty() )
+    else if( isHeader )
     {
-        clangOpts.push_back( stdOpt.c_str() );
+        clangArgs.push_back( "-xc-header" );
     }
 
-    std::vector<std::string> includePathOptions;
-
     for( const std::string &includePath : includePaths )
     {
-        // Option strings must be stored in a vector, otherwise C strings would not be valid
-        includePathOptions.push_back( "-I" + includePath );
-        clangOpts.push_back( includePathOptions.back().c_str() );
+        clangArgs.push_back( "-I" + includePath );
     }
 
-    std::string inputFilepathStr = inputFilepath.generic_string();
+    // Additional arguments are passed after the explicit include paths, so that these are searched first, and
+    // before the explicit language standard, so that it overrides the additional one
+    clangArgs.insert( clangArgs.end(), compileArgs.begin(), compileArgs.end() );
 
-    CXTranslationUnit tu;
-    // Note: Use of CXTranslationUnit_SkipFunctionBodies is not allowed, otherwise libclang
-    // will not detect properly methods defined inline (which must not be mocked).
-    CXErrorCode tuError = clang_parseTranslationUnit2( index, inputFilepathStr.c_str(),
-                                                       clangOpts.data(), (int) clangOpts.size(),
-                                                       nullptr, 0,
-                                                       CXTranslationUnit_None,
-                                                       &tu );
-    if( tuError != CXError_Success )
+    if( !stdOpt.empty() )
     {
-        cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_RED );
-        error << "INPUT ERROR: ";
-        cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+        clangArgs.push_back( stdOpt );
+    }
 
-        // Check if file exists
-        
-        if( !std::filesystem::exists( inputFilepath ) )
-        {
-            error << "Input file '" << inputFilepathStr.c_str() << "' does not exist." << std::endl;
-        }
-// LCOV_EXCL_START: Defensive
-        else
-        {
-            error << "Unable to parse input file (Error code = " << tuError << ")." << std::endl;
-        }
-// LCOV_EXCL_STOP
+    return clangArgs;
+}
 
-        clang_disposeIndex( index );
-        return false;
+static std::vector<const char*> GetArgPointers( const std::vector<std::string> &args )
+{
+    std::vector<const char*> argPointers;
+    argPointers.reserve( args.size() );
+
+    for( const std::string &arg : args )
+    {
+        argPointers.push_back( arg.c_str() );
     }
 
+    return argPointers;
+}
+
+static unsigned int PrintDiagnostics( CXTranslationUnit tu, std::ostream &error )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::DIAGNOSTICS );
+
     unsigned int numDiags = clang_getNumDiagnostics(tu);
     unsigned int numErrors = 0;
     if( numDiags > 0 )
@@ -219,17 +385,504 @@ bool Parser::Parse( const std::filesystem::path &inputFilepath, const Config &co
             }
 
             cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
-            error << clang_formatDiagnostic( diag, clang_defaultDiagnosticDisplayOptions() ) << std::endl;
+
+            // Diagnostics are reported at their presumed location, which takes into account line directives (e.g. the
+            // one that restores the line numbering of the input file after the type map when parsing single files)
+            unsigned int displayOptions = clang_defaultDiagnosticDisplayOptions();
+            CXString diagFilename;
+            unsigned int diagLine;
+            unsigned int diagColumn;
+            clang_getPresumedLocation( clang_getDiagnosticLocation( diag ), &diagFilename, &diagLine, &diagColumn );
+            const char *diagFilenameStr = clang_getCString( diagFilename );
+            if( ( diagFilenameStr != nullptr ) && ( diagFilenameStr[0] != '\0' ) &&
+                ( displayOptions & CXDiagnostic_DisplaySourceLocation ) )
+            {
+                error << diagFilenameStr << ":" << diagLine << ":" << diagColumn << ": ";
+                displayOptions &= ~( CXDiagnostic_DisplaySourceLocation | CXDiagnostic_DisplayColumn |
+                                     CXDiagnostic_DisplaySourceRanges );
+            }
+            clang_disposeString( diagFilename );
+
+            error << clang_formatDiagnostic( diag, displayOptions ) << std::endl;
 
             clang_disposeDiagnostic( diag );
         }
     }
 
+    return numErrors;
+}
+
+static bool HasErrors( CXTranslationUnit tu ) noexcept
+{
+    unsigned int numDiags = clang_getNumDiagnostics( tu );
+    for( unsigned int i = 0; i < numDiags; i++ )
+    {
+        CXDiagnostic diag = clang_getDiagnostic( tu, i );
+        CXDiagnosticSeverity diagSeverity = clang_getDiagnosticSeverity( diag );
+        clang_disposeDiagnostic( diag );
+
+        if( ( diagSeverity == CXDiagnostic_Error ) || ( diagSeverity == CXDiagnostic_Fatal ) )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void PrintParseError( const std::filesystem::path &filepath, CXErrorCode tuError, std::ostream &error )
+{
+    cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_RED );
+    error << "INPUT ERROR: ";
+    cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+
+    // Check if file exists
+
+    if( !std::filesystem::exists( filepath ) )
+    {
+        error << "Input file '" << filepath.generic_string() << "' does not exist." << std::endl;
+    }
+// LCOV_EXCL_START: Defensive
+    else
+    {
+        error << "Unable to parse input file (Error code = " << tuError << ")." << std::endl;
+    }
+// LCOV_EXCL_STOP
+}
+
+static std::string RemoveIncludeDirectives( const std::string &contents )
+{
+    // Include directives are replaced by empty lines to keep the line numbering of the contents
+    std::string ret;
+    ret.reserve( contents.size() );
+
+    bool inDirective = false;
+    size_t lineStart = 0;
+    while( lineStart < contents.size() )
+    {
+        size_t lineEnd = contents.find( '\n', lineStart );
+        if( lineEnd == std::string::npos )
+        {
+            lineEnd = contents.size();
+        }
+
+        std::string line = contents.substr( lineStart, lineEnd - lineStart );
+
+        if( !inDirective )
+        {
+            size_t pos = line.find_first_not_of( " \t" );
+            if( ( pos != std::string::npos ) && ( line[pos] == '#' ) )
+            {
+                pos = line.find_first_not_of( " \t", pos + 1 );
+                std::string directive = ( pos != std::string::npos ) ? line.substr( pos, line.find_first_of( " \t<\"", pos ) - pos ) : "";
+                inDirective = ( directive == "include" ) || ( directive == "include_next" ) || ( directive == "import" );
+            }
+        }
+
+        if( inDirective )
+        {
+            // Directives may be continued in the next line
+            inDirective = ( !line.empty() && ( line.back() == '\\' ) ) ||
+                          ( ( line.size() > 1 ) && ( line.back() == '\r' ) && ( line[ line.size() - 2 ] == '\\' ) );
+        }
+        else
+        {
+            ret += line;
+        }
+
+        if( lineEnd < contents.size() )
+        {
+            ret += '\n';
+        }
+        lineStart = lineEnd + 1;
+    }
+
+    return ret;
+}
+
+static void GetInclusions( CXTranslationUnit tu, std::vector<std::filesystem::path> &dependencies )
+{
+    clang_getInclusions( tu,
+        []( CXFile includedFile, CXSourceLocation*, unsigned, CXClientData clientData )
+        {
+            std::vector<std::filesystem::path> *dependencies = (std::vector<std::filesystem::path>*) clientData;
+            dependencies->push_back( toString( clang_getFileName( includedFile ) ) );
+        },
+        (CXClientData) &dependencies );
+}
+
+static bool IsSimpleCStandard( const std::string &languageStandard ) noexcept
+{
+    // Older standards (e.g. without line comments) are not supported by the simple C parser
+    static const char* const SIMPLE_C_STANDARDS[] = { "c99", "c11", "c17", "c18", "gnu99", "gnu11", "gnu17", "gnu18" };
+
+    return languageStandard.empty() ||
+           std::any_of( std::begin( SIMPLE_C_STANDARDS ), std::end( SIMPLE_C_STANDARDS ),
+                        [&languageStandard]( const char *standard ) { return languageStandard == standard; } );
+}
+
+bool Parser::ParseSimpleC( const std::string &contents, const std::vector<std::string> &includePaths, const Config &config )
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::SIMPLE_C_PARSE );
+
+    SimpleCParser simpleParser;
+    if( !simpleParser.Parse( contents ) )
+    {
+        return false;
+    }
+
+    // Standard headers included by the input file could be replaced by headers found in the include paths
+    std::vector<std::filesystem::path> searchPaths( includePaths.begin(), includePaths.end() );
+    searchPaths.push_back( m_inputFilePath.parent_path() );
+    for( const std::string &includedHeader : simpleParser.GetIncludedHeaders() )
+    {
+        for( const std::filesystem::path &searchPath : searchPaths )
+        {
+            std::error_code ec;
+            if( std::filesystem::exists( searchPath / includedHeader, ec ) )
+            {
+                return false;
+            }
+        }
+    }
+
+    // Functions that cannot be processed (and input files without mockable functions) are reported when parsed by
+    // libclang instead
+    std::vector<std::unique_ptr<const Function>> functions;
+    Function::TypeCache typeCache( m_stringPool.get(), m_modelSaved );
+    try
+    {
+        for( const SimpleCParser::FunctionDecl &functionDecl : simpleParser.GetFunctions() )
+        {
+            Function *function = new Function;
+            functions.push_back( std::unique_ptr<const Function>( function ) );
+            function->Parse( functionDecl, config );
+        }
+    }
+    catch( std::exception & )
+    {
+        return false;
+    }
+
+    if( functions.empty() )
+    {
+        return false;
+    }
+
+    m_functions = std::move( functions );
+    m_dependencies.push_back( m_inputFilePath );
+    return true;
+}
+
+CXIndex Parser::GetIndex( const std::vector<std::string> &compileArgs ) noexcept
+{
+    // The indexes are created only once and reused by subsequent parses, which avoids the cost of setting up
+    // libclang again for each input file when processing several files. Declarations loaded from precompiled
+    // headers are only excluded when visiting translation units that use a precompiled prelude, since only
+    // declarations in input files are mocked, but the precompiled preamble of kept translation units must be visited.
+    bool usesPrecompiledHeader = ( std::find( compileArgs.begin(), compileArgs.end(), "-include-pch" ) != compileArgs.end() );
+    CXIndex &index = ( usesPrecompiledHeader ? m_pchIndex : m_index );
+    if( index == nullptr )
+    {
+        index = clang_createIndex( ( usesPrecompiledHeader ? 1 : 0 ), 0 );
+    }
+
+    return index;
+}
+
+void Parser::ParseUmbrella( Umbrella &umbrella, const std::vector<std::string> &tuArgs, const Config &config,
+                            const std::vector<std::string> &includePaths, const std::vector<std::string> &compileArgs,
+                            std::ostream &error )
+{
+    // Only the files that would be parsed individually with the same arguments are parsed together
+    std::vector<std::filesystem::path> filepaths;
+    std::string contents;
+    for( const std::filesystem::path &umbrellaFile : m_umbrellaFiles )
+    {
+        bool interpretAsCpp = HasCppHeaderExtension( umbrellaFile ) || config.InterpretAsCpp();
+        if( GetClangArgs( config, includePaths, compileArgs, interpretAsCpp, false ) == tuArgs )
+        {
+            filepaths.push_back( std::filesystem::absolute( umbrellaFile ).lexically_normal() );
+            contents += "#include \"" + filepaths.back().generic_string() + "\"\n";
+        }
+    }
+
+    if( filepaths.size() < 2 )
+    {
+        return;
+    }
+
+    std::string umbrellaFilepathStr = ( std::filesystem::current_path() / UMBRELLA_FILENAME ).generic_string();
+    CXUnsavedFile unsavedFile = { umbrellaFilepathStr.c_str(), contents.c_str(), (unsigned long) contents.size() };
+    std::vector<const char*> clangOpts = GetArgPointers( tuArgs );
+
+    unsigned int tuOptions = CXTranslationUnit_None;
+    if( m_skipFunctionBodies )
+    {
+        tuOptions |= CXTranslationUnit_SkipFunctionBodies;
+    }
+
+    CXTranslationUnit tu;
+    CXErrorCode tuError;
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::TU_PARSE );
+        tuError = clang_parseTranslationUnit2( GetIndex( compileArgs ), umbrellaFilepathStr.c_str(), clangOpts.data(), (int) clangOpts.size(),
+                                               &unsavedFile, 1, tuOptions, &tu );
+    }
+
+    if( tuError != CXError_Success )
+    {
+        return; // LCOV_EXCL_LINE: Defensive
+    }
+
+    // When there are errors the files are parsed individually instead, so that errors are reported for each of them
+    if( !HasErrors( tu ) )
+    {
+        PrintDiagnostics( tu, error );
+
+        std::vector<CXFile> files;
+        std::vector<FunctionList*> functions;
+        for( const std::filesystem::path &filepath : filepaths )
+        {
+            files.push_back( clang_getFile( tu, filepath.generic_string().c_str() ) );
+            functions.push_back( &umbrella.functions[ filepath ] );
+        }
+
+        ::Parse( tu, config, functions, &files, m_skipFunctionBodies, m_stringPool.get(), m_modelSaved );
+
+        // The files included by each input file cannot be told apart (e.g. files included by several input files are
+        // only processed for the first one), therefore all the files read are dependencies of every input file
+        GetInclusions( tu, umbrella.dependencies );
+        umbrella.dependencies.erase( std::remove( umbrella.dependencies.begin(), umbrella.dependencies.end(),
+                                                  std::filesystem::path( umbrellaFilepathStr ) ),
+                                     umbrella.dependencies.end() );
+
+        umbrella.parsed = true;
+    }
+
+    clang_disposeTranslationUnit( tu );
+}
+
+bool Parser::TakeUmbrellaFunctions( const std::filesystem::path &inputFilepath, const std::vector<std::string> &tuArgs,
+                                    const Config &config, const std::vector<std::string> &includePaths,
+                                    const std::vector<std::string> &compileArgs, std::ostream &error )
+{
+    std::filesystem::path filepath = std::filesystem::absolute( inputFilepath ).lexically_normal();
+    if( std::none_of( m_umbrellaFiles.begin(), m_umbrellaFiles.end(),
+                      [&filepath]( const std::filesystem::path &umbrellaFile )
+                      { return std::filesystem::absolute( umbrellaFile ).lexically_normal() == filepath; } ) )
+    {
+        return false;
+    }
+
+    // The umbrella translation unit is parsed when the first of its files is parsed
+    auto umbrellaIt = m_umbrellas.find( tuArgs );
+    if( umbrellaIt == m_umbrellas.end() )
+    {
+        umbrellaIt = m_umbrellas.emplace( tuArgs, Umbrella() ).first;
+        ParseUmbrella( umbrellaIt->second, tuArgs, config, includePaths, compileArgs, error );
+    }
+
+    // Files without mockable functions are parsed individually, which reports the error (it could also happen if the
+    // file was skipped in the umbrella translation unit, e.g. because its include guard is also used by another file)
+    Umbrella &umbrella = umbrellaIt->second;
+    auto functionsIt = umbrella.functions.find( filepath );
+    if( !umbrella.parsed || ( functionsIt == umbrella.functions.end() ) || functionsIt->second.empty() )
+    {
+        return false;
+    }
+
+    m_functions = std::move( functionsIt->second );
+    umbrella.functions.erase( functionsIt );
+    m_dependencies = umbrella.dependencies;
+    return true;
+}
+
+bool Parser::Parse( const std::filesystem::path &inputFilepath, const Config &config, bool isCppHeader,
+                    const std::vector<std::string> &includePaths, const std::vector<std::string> &compileArgs,
+                    std::ostream &error )
+{
+    bool parsed = ParseInput( inputFilepath, config, isCppHeader, includePaths, compileArgs, error );
+
+    // In streaming mode the functions not generated yet (e.g. when not parsed by libclang) are generated now, and then
+    // all the code is flushed
+    if( m_streaming )
+    {
+        if( parsed )
+        {
+            StreamFunctions( true );
+        }
+
+        m_streaming.reset();
+    }
+
+    return parsed;
+}
+
+bool Parser::ParseInput( const std::filesystem::path &inputFilepath, const Config &config, bool isCppHeader,
+                         const std::vector<std::string> &includePaths, const std::vector<std::string> &compileArgs,
+                         std::ostream &error )
+{
+    m_functions.clear();
+    m_dependencies.clear();
+    m_inputFilePath = inputFilepath;
+    m_interpretAsCpp = isCppHeader || config.InterpretAsCpp();
+
+    std::string inputFilepathStr = inputFilepath.generic_string();
+
+    std::vector<std::string> tuArgs = GetClangArgs( config, includePaths, compileArgs, m_interpretAsCpp, false );
+    std::vector<const char*> clangOpts = GetArgPointers( tuArgs );
+
+    // In streaming mode the headings are generated as soon as the language of the input file is known
+    if( m_streaming )
+    {
+        GenerateHeadings( m_streaming->genOpts, m_streaming->userCode, m_streaming->mockBaseDirPath,
+                          m_streaming->expectationBaseDirPath, m_streaming->expectationHeaderFilepath, m_streaming->outputs );
+    }
+
+    // The input file path is only used to identify the translation unit to be reparsed
+    std::vector<std::string> tuKey = tuArgs;
+    tuKey.push_back( inputFilepathStr );
+
+    // When parsing a single file, included files are not processed, therefore the types that they declare are
+    // declared instead by the type map, which is prepended to the contents of the input file. The line numbering of
+    // the input file is restored after the type map, so that diagnostics point to the right lines.
+    // Include directives are removed beforehand, since libclang still looks for the included files (and fails if they
+    // cannot be found) even if it does not parse them.
+    std::string inputContents;
+    bool inputRead = false;
+    if( m_singleFileParse || m_simpleCParse )
+    {
+        std::ifstream inputFile( inputFilepath, std::ios::binary );
+        if( inputFile.is_open() )
+        {
+            std::ostringstream inputStream;
+            inputStream << inputFile.rdbuf();
+            inputContents = m_singleFileParse ? RemoveIncludeDirectives( inputStream.str() ) : inputStream.str();
+            inputRead = true;
+        }
+    }
+
+    // Simple C input files are parsed without libclang when possible, which is much faster. The file is parsed with
+    // libclang anyway if the simple parser does not support any of its contents, or if the compiler arguments could
+    // make libclang parse it differently (in which case the simple parser is not even tried).
+    if( m_simpleCParse && inputRead && !m_interpretAsCpp && compileArgs.empty() &&
+        IsSimpleCStandard( config.GetLanguageStandard() ) )
+    {
+        std::string contents = m_singleFileParse ? ( config.GetTypeMapDeclarations() + inputContents ) : inputContents;
+        if( ParseSimpleC( contents, includePaths, config ) )
+        {
+            return true;
+        }
+    }
+
+    // Input files parsed together in an umbrella translation unit just take their functions from it
+    if( !m_singleFileParse && !m_keepTranslationUnit &&
+        TakeUmbrellaFunctions( inputFilepath, tuArgs, config, includePaths, compileArgs, error ) )
+    {
+        return true;
+    }
+
+    std::string singleFileContents;
+    std::vector<CXUnsavedFile> unsavedFiles;
+    if( m_singleFileParse )
+    {
+        if( inputRead )
+        {
+            singleFileContents = config.GetTypeMapDeclarations() + "#line 1\n" + inputContents;
+            unsavedFiles.push_back( { inputFilepathStr.c_str(), singleFileContents.c_str(),
+                                      (unsigned long) singleFileContents.size() } );
+        }
+
+        tuKey.push_back( config.GetTypeMapDeclarations() );
+    }
+
+    CXTranslationUnit tu = nullptr;
+    CXErrorCode tuError = CXError_Failure;
+
+    // A kept translation unit is reparsed only if it was parsed from the same file with the same options, which
+    // reuses its precompiled preamble as long as the included files did not change
+    if( m_tu != nullptr )
+    {
+        if( tuKey == m_tuArgs )
+        {
+            TimeReport::Scope timeScope( TimeReport::Phase::TU_PARSE );
+
+            if( clang_reparseTranslationUnit( m_tu, (unsigned) unsavedFiles.size(), unsavedFiles.data(),
+                                              clang_defaultReparseOptions( m_tu ) ) == 0 )
+            {
+                tu = m_tu;
+                tuError = CXError_Success;
+            }
+            else
+            {
+                // After a failed reparse the translation unit can only be disposed, so fall back to a full parse
+                clang_disposeTranslationUnit( m_tu );
+            }
+        }
+        else
+        {
+            clang_disposeTranslationUnit( m_tu );
+        }
+
+        m_tu = nullptr;
+    }
+
+    if( tu == nullptr )
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::TU_PARSE );
+
+        unsigned int tuOptions = CXTranslationUnit_None;
+        if( m_keepTranslationUnit )
+        {
+            tuOptions = CXTranslationUnit_PrecompiledPreamble | CXTranslationUnit_CreatePreambleOnFirstParse;
+        }
+
+        // Note: When CXTranslationUnit_SkipFunctionBodies is used, libclang does not detect methods defined inline
+        // (which must not be mocked), therefore they are detected by other means (see GetDefinedFunctions).
+        if( m_skipFunctionBodies )
+        {
+            tuOptions |= CXTranslationUnit_SkipFunctionBodies;
+        }
+
+        if( m_singleFileParse )
+        {
+            tuOptions |= CXTranslationUnit_SingleFileParse;
+        }
+
+        tuError = clang_parseTranslationUnit2( GetIndex( compileArgs ), inputFilepathStr.c_str(),
+                                               clangOpts.data(), (int) clangOpts.size(),
+                                               unsavedFiles.data(), (unsigned) unsavedFiles.size(),
+                                               tuOptions,
+                                               &tu );
+    }
+
+    if( tuError != CXError_Success )
+    {
+        PrintParseError( inputFilepath, tuError, error );
+        return false;
+    }
+
+    unsigned int numErrors = PrintDiagnostics( tu, error );
+
+    // Dependencies are also obtained when there are errors, because they can be caused by included files
+    GetInclusions( tu, m_dependencies );
+
     if( numErrors == 0 )
     {
-        ::Parse( tu, config, m_functions );
+        if( m_streaming )
+        {
+            // Functions are generated as soon as they are parsed, hence their strings are not interned, since they
+            // would be kept in the pool after the functions are released, and their models are never saved
+            std::function<void()> functionParsed = [this]() { StreamFunctions( false ); };
+            ::Parse( tu, config, { &m_functions }, nullptr, m_skipFunctionBodies, nullptr, false, &functionParsed );
+        }
+        else
+        {
+            ::Parse( tu, config, { &m_functions }, nullptr, m_skipFunctionBodies, m_stringPool.get(), m_modelSaved );
+        }
 
-        if( m_functions.size() == 0 )
+        if( !HasFunctions() )
         {
             cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_RED );
             error << "INPUT ERROR: ";
@@ -238,10 +891,72 @@ bool Parser::Parse( const std::filesystem::path &inputFilepath, const Config &co
         }
     }
 
+    if( m_keepTranslationUnit )
+    {
+        m_tu = tu;
+        m_tuArgs = std::move( tuKey );
+    }
+    else
+    {
+        clang_disposeTranslationUnit( tu );
+    }
+
+    return (numErrors == 0) && HasFunctions();
+}
+
+bool Parser::BuildPrecompiledHeader( const std::filesystem::path &headerFilepath, const std::filesystem::path &pchFilepath,
+                                     const Config &config, bool isCppHeader, const std::vector<std::string> &includePaths,
+                                     const std::vector<std::string> &compileArgs,
+                                     std::vector<std::filesystem::path> &dependencies, std::ostream &error )
+{
+    bool interpretAsCpp = isCppHeader || config.InterpretAsCpp();
+
+    std::vector<std::string> tuArgs = GetClangArgs( config, includePaths, compileArgs, interpretAsCpp, true );
+    std::vector<const char*> clangOpts = GetArgPointers( tuArgs );
+
+    // Functions in precompiled headers are never mocked, therefore their bodies can be skipped as well
+    unsigned int tuOptions = CXTranslationUnit_Incomplete | CXTranslationUnit_ForSerialization;
+    if( m_skipFunctionBodies )
+    {
+        tuOptions |= CXTranslationUnit_SkipFunctionBodies;
+    }
+
+    CXTranslationUnit tu;
+    CXErrorCode tuError;
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::TU_PARSE );
+        tuError = clang_parseTranslationUnit2( GetIndex( compileArgs ), headerFilepath.generic_string().c_str(),
+                                               clangOpts.data(), (int) clangOpts.size(),
+                                               nullptr, 0,
+                                               tuOptions,
+                                               &tu );
+    }
+
+    if( tuError != CXError_Success )
+    {
+        PrintParseError( headerFilepath, tuError, error );
+        return false;
+    }
+
+    bool success = ( PrintDiagnostics( tu, error ) == 0 );
+
+    if( success )
+    {
+        GetInclusions( tu, dependencies );
+
+        if( clang_saveTranslationUnit( tu, pchFilepath.generic_string().c_str(), clang_defaultSaveOptions( tu ) ) != CXSaveError_None )
+        {
+            cerrColorizer.SetColor( ConsoleColorizer::Color::LIGHT_RED );
+            error << "INPUT ERROR: ";
+            cerrColorizer.SetColor( ConsoleColorizer::Color::RESET );
+            error << "Precompiled header '" << pchFilepath.generic_string() << "' could not be saved." << std::endl;
+            success = false;
+        }
+    }
+
     clang_disposeTranslationUnit( tu );
-    clang_disposeIndex( index );
 
-    return (numErrors == 0) && (m_functions.size() > 0);
+    return success;
 }
 
 static std::string GetIncludeFilename( const std::filesystem::path &inputFilePath, const std::filesystem::path &baseDirPath )
@@ -261,98 +976,337 @@ static std::string GetIncludeFilename( const std::filesystem::path &inputFilePat
     return includeFilename;
 }
 
-void Parser::GenerateMock( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &baseDirPath,
-                           std::ostream &output ) const noexcept
-{
-    std::string includeFilename = GetIncludeFilename( m_inputFilePath, baseDirPath );
+// Number of functions generated by each parallel job, large enough to make the overhead of a job negligible
+static const size_t GENERATION_CHUNK_SIZE = 256;
 
-    GenerateFileHeading( genOpts, output, true );
+// Size of the code generated in streaming mode above which it is flushed
+static const size_t STREAMING_CHUNK_SIZE = ( 256 * 1024 );
+
+struct OutputBuffers
+{
+    CodeEmitter mock;
+    CodeEmitter expectationHeader;
+    CodeEmitter expectationImpl;
+};
 
-    if( !m_interpretAsCpp )
+static void AppendChunk( CodeEmitter *output, CodeEmitter &chunk )
+{
+    if( output )
     {
-        output << "extern \"C\" {" << std::endl;
+        // The code of the chunk is released once appended, to avoid keeping the generated code twice in memory
+        *output << chunk.Release();
     }
-    output << "#include \"" << includeFilename << "\"" << std::endl;
-    if( !m_interpretAsCpp )
+}
+
+void Parser::GenerateHeadings( const std::string &genOpts, const std::string &userCode,
+                               const std::filesystem::path &mockBaseDirPath, const std::filesystem::path &expectationBaseDirPath,
+                               const std::filesystem::path &expectationHeaderFilepath, const Outputs &outputs ) const noexcept
+{
+    if( outputs.mock )
     {
-        output << "}" << std::endl;
+        CodeEmitter &output = *outputs.mock;
+
+        GenerateFileHeading( genOpts, output, true );
+
+        if( !m_interpretAsCpp )
+        {
+            output << "extern \"C\" {\n";
+        }
+        output << "#include \"" << GetIncludeFilename( m_inputFilePath, mockBaseDirPath ) << "\"\n";
+        if( !m_interpretAsCpp )
+        {
+            output << "}\n";
+        }
+        output << '\n';
+
+        output << "#include <CppUTestExt/MockSupport.h>\n";
+        output << '\n';
+
+        output << "// " USER_CODE_BEGIN "\n";
+        output << userCode;
+        output << "// " USER_CODE_END "\n";
+        output << '\n';
     }
-    output << std::endl;
 
-    output << "#include <CppUTestExt/MockSupport.h>" << std::endl;
-    output << std::endl;
+    if( outputs.expectationHeader )
+    {
+        CodeEmitter &output = *outputs.expectationHeader;
+
+        GenerateFileHeading( genOpts, output, false );
 
-    output << "// " USER_CODE_BEGIN << std::endl;
-    output << userCode;
-    output << "// " USER_CODE_END << std::endl;
-    output << std::endl;
+        output << "#include <CppUMockGen.hpp>\n";
+        output << '\n';
 
-    for( const std::unique_ptr<const Function> &function : m_functions )
+        if( !m_interpretAsCpp )
+        {
+            output << "extern \"C\" {\n";
+        }
+        output << "#include \"" << GetIncludeFilename( m_inputFilePath, expectationBaseDirPath ) << "\"\n";
+        if( !m_interpretAsCpp )
+        {
+            output << "}\n";
+        }
+        output << '\n';
+
+        output << "#include <CppUTestExt/MockSupport.h>\n";
+        output << '\n';
+    }
+
+    if( outputs.expectationImpl )
     {
-        output << function->GenerateMock() << std::endl;
+        CodeEmitter &output = *outputs.expectationImpl;
+
+        GenerateFileHeading( genOpts, output, false );
+
+        output << "#include \"" << expectationHeaderFilepath.filename().generic_string() << "\"\n";
+        output << '\n';
     }
 }
 
-void Parser::GenerateExpectationHeader( const std::string &genOpts, const std::filesystem::path &baseDirPath, std::ostream &output ) const noexcept
+void Parser::Generate( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                       const std::filesystem::path &expectationBaseDirPath, const std::filesystem::path &expectationHeaderFilepath,
+                       const Outputs &outputs ) const
 {
-    std::string includeFilename = GetIncludeFilename( m_inputFilePath, baseDirPath );
+    GenerateHeadings( genOpts, userCode, mockBaseDirPath, expectationBaseDirPath, expectationHeaderFilepath, outputs );
 
-    GenerateFileHeading( genOpts, output, false );
+    // All the outputs are generated in a single pass over the functions. Headers with many functions are generated in
+    // chunks in parallel, each one into its own outputs, which are appended in order as soon as they are completed.
+    size_t numChunks = ( ( m_functions.size() + GENERATION_CHUNK_SIZE - 1 ) / GENERATION_CHUNK_SIZE );
+    if( ( m_numGenerationThreads <= 1 ) || ( numChunks <= 1 ) )
+    {
+        GenerateFunctions( 0, m_functions.size(), outputs );
+    }
+    else
+    {
+        std::vector<OutputBuffers> chunkBuffers( numChunks );
 
-    output << "#include <CppUMockGen.hpp>" << std::endl;
-    output << std::endl;
+        JobRunner jobRunner( m_numGenerationThreads );
+        jobRunner.Run( numChunks,
+                       [&]( size_t chunkIndex, unsigned int )
+                       {
+                           OutputBuffers &buffers = chunkBuffers[ chunkIndex ];
+                           size_t begin = ( chunkIndex * GENERATION_CHUNK_SIZE );
+                           size_t end = std::min( ( begin + GENERATION_CHUNK_SIZE ), m_functions.size() );
+                           GenerateFunctions( begin, end, { ( outputs.mock ? &buffers.mock : nullptr ),
+                                                            ( outputs.expectationHeader ? &buffers.expectationHeader : nullptr ),
+                                                            ( outputs.expectationImpl ? &buffers.expectationImpl : nullptr ) } );
+                       },
+                       [&]( size_t chunkIndex )
+                       {
+                           OutputBuffers &buffers = chunkBuffers[ chunkIndex ];
+                           AppendChunk( outputs.mock, buffers.mock );
+                           AppendChunk( outputs.expectationHeader, buffers.expectationHeader );
+                           AppendChunk( outputs.expectationImpl, buffers.expectationImpl );
+                       } );
+    }
+}
 
-    if( !m_interpretAsCpp )
+void Parser::GenerateFunctions( size_t begin, size_t end, const Outputs &outputs ) const
+{
+    TimeReport::Scope timeScope( TimeReport::Phase::GENERATION );
+
+    for( size_t i = begin; i < end; i++ )
     {
-        output << "extern \"C\" {" << std::endl;
+        const Function &function = *m_functions[i];
+
+        if( outputs.mock )
+        {
+            function.GenerateMock( *outputs.mock );
+            *outputs.mock << '\n';
+        }
+
+        if( outputs.expectationHeader )
+        {
+            function.GenerateExpectation( true, *outputs.expectationHeader );
+            *outputs.expectationHeader << '\n';
+        }
+
+        if( outputs.expectationImpl )
+        {
+            function.GenerateExpectation( false, *outputs.expectationImpl );
+            *outputs.expectationImpl << '\n';
+        }
     }
-    output << "#include \"" <<  includeFilename << "\"" << std::endl;
-    if( !m_interpretAsCpp )
+}
+
+void Parser::StartStreaming( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                             const std::filesystem::path &expectationBaseDirPath, const std::filesystem::path &expectationHeaderFilepath,
+                             const Outputs &outputs, const FlushFunction &flush )
+{
+    m_streaming = std::make_unique<Streaming>();
+    m_streaming->genOpts = genOpts;
+    m_streaming->userCode = userCode;
+    m_streaming->mockBaseDirPath = mockBaseDirPath;
+    m_streaming->expectationBaseDirPath = expectationBaseDirPath;
+    m_streaming->expectationHeaderFilepath = expectationHeaderFilepath;
+    m_streaming->outputs = outputs;
+    m_streaming->flush = flush;
+}
+
+void Parser::StreamFunctions( bool flush )
+{
+    GenerateFunctions( 0, m_functions.size(), m_streaming->outputs );
+    m_streaming->numFunctions += m_functions.size();
+    m_functions.clear();
+
+    const Outputs &outputs = m_streaming->outputs;
+    size_t generatedSize = ( ( outputs.mock ? outputs.mock->GetSize() : 0 ) +
+                             ( outputs.expectationHeader ? outputs.expectationHeader->GetSize() : 0 ) +
+                             ( outputs.expectationImpl ? outputs.expectationImpl->GetSize() : 0 ) );
+    if( flush || ( generatedSize >= STREAMING_CHUNK_SIZE ) )
     {
-        output << "}" << std::endl;
+        m_streaming->flush( outputs );
     }
-    output << std::endl;
+}
+
+bool Parser::HasFunctions() const noexcept
+{
+    return !m_functions.empty() || ( m_streaming && ( m_streaming->numFunctions > 0 ) );
+}
+
+void Parser::GenerateMock( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &baseDirPath,
+                           std::ostream &output ) const noexcept
+{
+    CodeEmitter emitter;
+    Generate( genOpts, userCode, baseDirPath, "", "", { &emitter, nullptr, nullptr } );
+    output << emitter.GetBuffer();
+}
 
-    output << "#include <CppUTestExt/MockSupport.h>" << std::endl;
-    output << std::endl;
+void Parser::GenerateExpectationHeader( const std::string &genOpts, const std::filesystem::path &baseDirPath, std::ostream &output ) const noexcept
+{
+    CodeEmitter emitter;
+    Generate( genOpts, "", "", baseDirPath, "", { nullptr, &emitter, nullptr } );
+    output << emitter.GetBuffer();
+}
+
+void Parser::GenerateExpectationImpl( const std::string &genOpts, const std::filesystem::path &headerFilepath, std::ostream &output ) const noexcept
+{
+    CodeEmitter emitter;
+    Generate( genOpts, "", "", "", headerFilepath, { nullptr, nullptr, &emitter } );
+    output << emitter.GetBuffer();
+}
+
+const std::vector<std::filesystem::path>& Parser::GetDependencies() const noexcept
+{
+    return m_dependencies;
+}
+
+static const char MODEL_HEADER[] = "CppUMockGen model";
+
+static const char FUNCTION_KIND[] = "function";
+static const char METHOD_KIND[] = "method";
+static const char CONSTRUCTOR_KIND[] = "constructor";
+static const char DESTRUCTOR_KIND[] = "destructor";
+
+void Parser::SaveModel( std::ostream &output ) const
+{
+    output << MODEL_HEADER << std::endl;
+    output << ( m_interpretAsCpp ? 1 : 0 ) << std::endl;
+    output << m_functions.size() << std::endl;
 
     for( const std::unique_ptr<const Function> &function : m_functions )
     {
-        output << function->GenerateExpectation(true) << std::endl;
+        // The kind of function is stored to create an object of the same class when loading the model
+        const char *kind = FUNCTION_KIND;
+        if( dynamic_cast<const Constructor*>( function.get() ) )
+        {
+            kind = CONSTRUCTOR_KIND;
+        }
+        else if( dynamic_cast<const Destructor*>( function.get() ) )
+        {
+            kind = DESTRUCTOR_KIND;
+        }
+        else if( dynamic_cast<const Method*>( function.get() ) )
+        {
+            kind = METHOD_KIND;
+        }
+
+        output << kind << std::endl;
+        function->Serialize( output );
     }
 }
 
-void Parser::GenerateExpectationImpl( const std::string &genOpts, const std::filesystem::path &headerFilepath, std::ostream &output ) const noexcept
+bool Parser::LoadModel( const std::filesystem::path &inputFilepath, const Config &config, std::istream &input )
 {
-    GenerateFileHeading( genOpts, output, false );
+    std::string line;
+    if( !std::getline( input, line ) || ( line != MODEL_HEADER ) )
+    {
+        return false;
+    }
 
-    output << "#include \"" <<  headerFilepath.filename().generic_string() << "\"" << std::endl;
-    output << std::endl;
+    size_t interpretAsCpp;
+    size_t numFunctions;
+    if( !( input >> interpretAsCpp ) || ( interpretAsCpp > 1 ) || !( input >> numFunctions ) || !std::getline( input, line ) )
+    {
+        return false;
+    }
 
-    for( const std::unique_ptr<const Function> &function : m_functions )
+    std::vector<std::unique_ptr<const Function>> functions;
+    Function::TypeCache typeCache( m_stringPool.get() );
+    for( size_t i = 0; i < numFunctions; i++ )
     {
-        output << function->GenerateExpectation(false) << std::endl;
+        if( !std::getline( input, line ) )
+        {
+            return false;
+        }
+
+        std::unique_ptr<Function> function;
+        if( line == FUNCTION_KIND )
+        {
+            function = std::make_unique<Function>();
+        }
+        else if( line == METHOD_KIND )
+        {
+            function = std::make_unique<Method>();
+        }
+        else if( line == CONSTRUCTOR_KIND )
+        {
+            function = std::make_unique<Constructor>();
+        }
+        else if( line == DESTRUCTOR_KIND )
+        {
+            function = std::make_unique<Destructor>();
+        }
+        else
+        {
+            return false;
+        }
+
+        if( !function->Deserialize( input, config ) )
+        {
+            return false;
+        }
+
+        functions.push_back( std::move( function ) );
     }
+
+    // The parser state is only replaced when the whole model is valid
+    m_functions = std::move( functions );
+    m_dependencies.clear();
+    m_inputFilePath = inputFilepath;
+    m_interpretAsCpp = ( interpretAsCpp == 1 );
+
+    return true;
 }
 
-void Parser::GenerateFileHeading( const std::string &genOpts, std::ostream &output, bool hasUserCode ) const noexcept
+void Parser::GenerateFileHeading( const std::string &genOpts, CodeEmitter &output, bool hasUserCode ) const noexcept
 {
-    output << "/*" << std::endl;
-    output << " * This file has been auto-generated by CppUMockGen v" PRODUCT_VERSION_STR "." << std::endl;
-    output << " *" << std::endl;
+    output << "/*\n";
+    output << " * This file has been auto-generated by CppUMockGen v" PRODUCT_VERSION_STR ".\n";
+    output << " *\n";
     if( hasUserCode )
     {
-        output << " * Only contents in the user code section will be preserved if it is regenerated!!!" << std::endl;
+        output << " * Only contents in the user code section will be preserved if it is regenerated!!!\n";
     }
     else
     {
-        output << " * Contents will NOT be preserved if it is regenerated!!!" << std::endl;
+        output << " * Contents will NOT be preserved if it is regenerated!!!\n";
     }
     if( !genOpts.empty() )
     {
-        output << " *" << std::endl;
-        output << " * " GENERATION_OPTIONS_LABEL " " << genOpts << std::endl;
+        output << " *\n";
+        output << " * " GENERATION_OPTIONS_LABEL " " << genOpts << '\n';
     }
-    output << " */" << std::endl;
-    output << std::endl;
+    output << " */\n";
+    output << '\n';
 }
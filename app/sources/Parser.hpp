@@ -14,9 +14,13 @@
 #include <string>
 #include <sstream>
 #include <memory>
+#include <map>
 #include <filesystem>
+#include <functional>
 
 #include "Function.hpp"
+#include "StringPool.hpp"
+#include "CodeEmitter.hpp"
 
 class Config;
 
@@ -27,22 +31,226 @@ class Parser
 {
 public:
     /**
-     * Default constructor
+     * Constructor
+     *
+     * @param[in] keepTranslationUnit Indicates if the translation unit must be kept after parsing, so that subsequent
+     *                                parses of the same file with the same options just reparse it incrementally
+     * @param[in] skipFunctionBodies Indicates if the bodies of functions must be skipped when parsing, which is much
+     *                               faster for headers with many inline function definitions
+     * @param[in] singleFileParse Indicates if only the input file must be parsed, without processing the files that it
+     *                            includes, in which case the types not declared in the input file must be declared using
+     *                            the type map from the configuration
+     * @param[in] simpleCParse Indicates if simple C input files must be parsed without libclang when possible, which
+     *                         is much faster (libclang is used anyway if the input file is not simple enough)
+     */
+    Parser( bool keepTranslationUnit = false, bool skipFunctionBodies = false, bool singleFileParse = false,
+            bool simpleCParse = false )
+    : m_index(nullptr), m_pchIndex(nullptr), m_tu(nullptr), m_keepTranslationUnit(keepTranslationUnit),
+      m_skipFunctionBodies(skipFunctionBodies), m_singleFileParse(singleFileParse), m_simpleCParse(simpleCParse),
+      m_interpretAsCpp(false), m_numGenerationThreads(1), m_modelSaved(false) {}
+
+    /**
+     * Destructor
+     */
+    ~Parser()
+    {
+        if( m_tu != nullptr )
+        {
+            clang_disposeTranslationUnit( m_tu );
+        }
+
+        if( m_index != nullptr )
+        {
+            clang_disposeIndex( m_index );
+        }
+
+        if( m_pchIndex != nullptr )
+        {
+            clang_disposeIndex( m_pchIndex );
+        }
+    }
+
+    /**
+     * Returns if the bodies of functions are skipped when parsing.
+     */
+    bool SkipsFunctionBodies() const noexcept
+    {
+        return m_skipFunctionBodies;
+    }
+
+    /**
+     * Returns if only the input file is parsed, without processing the files that it includes.
+     */
+    bool ParsesSingleFile() const noexcept
+    {
+        return m_singleFileParse;
+    }
+
+    /**
+     * Returns if simple C input files are parsed without libclang when possible.
+     */
+    bool ParsesSimpleC() const noexcept
+    {
+        return m_simpleCParse;
+    }
+
+    /**
+     * Sets the input files that must be parsed together in a single umbrella translation unit.
+     *
+     * When the first of these files is parsed, all of them that would be parsed with the same compiler arguments are
+     * parsed at once in a translation unit that includes them all, so that the files that they share are only parsed
+     * once. The mockable functions are then partitioned by the file where they are declared, and subsequent parses of
+     * the rest of files just take their functions from the umbrella translation unit. Files are parsed individually
+     * if the umbrella translation unit has errors, and also when parsing single files or keeping translation units.
+     *
+     * @param[in] inputFilepaths Filenames for the C/C++ header files (the results of any previous umbrella
+     *                           translation unit are discarded)
+     */
+    void SetUmbrellaFiles( const std::vector<std::filesystem::path> &inputFilepaths )
+    {
+        m_umbrellaFiles = inputFilepaths;
+        m_umbrellas.clear();
+    }
+
+    /**
+     * Sets the pool where the strings of the models of the parsed functions are interned.
+     *
+     * Sharing the same pool between the parsers used to parse a set of input files makes the memory used by the
+     * models depend on the number of distinct names and types, instead of on the number of functions.
+     *
+     * @param[in] stringPool String pool
      */
-    Parser() : m_interpretAsCpp(false) {}
+    void SetStringPool( const std::shared_ptr<StringPool> &stringPool )
+    {
+        m_stringPool = stringPool;
+    }
+
+    /**
+     * Sets the maximum number of threads used to generate the code for the functions of the parsed header.
+     *
+     * Code for headers with many functions is generated in chunks of functions distributed between the threads, and
+     * then the chunks are concatenated in order, so that the generated code is the same regardless of the number of
+     * threads.
+     *
+     * @param[in] numThreads Maximum number of threads (1 to generate sequentially)
+     */
+    void SetNumGenerationThreads( unsigned int numThreads ) noexcept
+    {
+        m_numGenerationThreads = numThreads;
+    }
+
+    /**
+     * Sets if the models of the headers parsed afterwards will be saved.
+     *
+     * The functions parsed keep the types of their returns and parameters as parsed (which are only needed to save
+     * their models) only when the models will be saved.
+     *
+     * @param[in] modelSaved Indicates if the models will be saved using SaveModel()
+     */
+    void SetModelSaved( bool modelSaved ) noexcept
+    {
+        m_modelSaved = modelSaved;
+    }
 
     /**
      * Parses the C/C++ header located in @p inputFilename.
      *
+     * The same parser can be used to parse several files in sequence, in which case the results from the previous
+     * parse are discarded. If the translation unit is kept and the same file is parsed again with the same options,
+     * it is reparsed reusing the precompiled preamble of the previous parse.
+     *
      * @param[in] inputFilepath Filename for the C/C++ header file
      * @param[in] config Configuration to be used during mock generation
      * @param[in] isCppHeader Indicates if the input file is recognized as a C++ header
      * @param[in] includePaths List of paths to search for included header files
+     * @param[in] compileArgs Additional compiler arguments (e.g. taken from a compilation database), which are
+     *                        overridden by the options in @p config and @p includePaths
      * @param[out] error Stream where errors will be written
      * @return @c true if the input file could be parsed successfully, @c false otherwise
      */
     bool Parse( const std::filesystem::path &inputFilepath, const Config &config, bool isCppHeader,
-                const std::vector<std::string> &includePaths, std::ostream &error );
+                const std::vector<std::string> &includePaths, const std::vector<std::string> &compileArgs,
+                std::ostream &error );
+
+    /**
+     * Builds a precompiled header from the C/C++ header located in @p headerFilepath.
+     *
+     * The precompiled header can then be used when parsing input files with the same options, by passing
+     * "-include-pch <pchFilepath>" as additional compiler arguments.
+     *
+     * @param[in] headerFilepath Filename for the C/C++ header file to be precompiled
+     * @param[in] pchFilepath Filename for the precompiled header file to be saved
+     * @param[in] config Configuration to be used during mock generation
+     * @param[in] isCppHeader Indicates if the header must be precompiled as a C++ header
+     * @param[in] includePaths List of paths to search for included header files
+     * @param[in] compileArgs Additional compiler arguments
+     * @param[out] dependencies List where the files read to build the precompiled header are added
+     * @param[out] error Stream where errors will be written
+     * @return @c true if the precompiled header could be built successfully, @c false otherwise
+     */
+    bool BuildPrecompiledHeader( const std::filesystem::path &headerFilepath, const std::filesystem::path &pchFilepath,
+                                 const Config &config, bool isCppHeader, const std::vector<std::string> &includePaths,
+                                 const std::vector<std::string> &compileArgs,
+                                 std::vector<std::filesystem::path> &dependencies, std::ostream &error );
+
+    /**
+     * Outputs where the code generated for the C/C++ header parsed previously is appended.
+     */
+    struct Outputs
+    {
+        CodeEmitter *mock;               ///< Output for the mocked functions, or @c nullptr to not generate them
+        CodeEmitter *expectationHeader;  ///< Output for the expectation functions header, or @c nullptr to not generate it
+        CodeEmitter *expectationImpl;    ///< Output for the expectation functions implementation, or @c nullptr to not generate it
+    };
+
+    /**
+     * Generates mocked functions and expectation functions for the C/C++ header parsed previously, in a single pass
+     * over the parsed functions.
+     *
+     * @param[in] genOpts String containing the generation options
+     * @param[in] userCode String containing the user code existing in previously existing mock output file
+     * @param[in] mockBaseDirPath Base directory to reference input file in include directives of the mocked functions
+     * @param[in] expectationBaseDirPath Base directory to reference input file in include directives of the expectation
+     *                                   functions header
+     * @param[in] expectationHeaderFilepath Filename for the expectation functions header file
+     * @param[out] outputs Outputs where the generated code will be appended
+     * @throws std::system_error If the threads used to generate the code in parallel cannot be created
+     */
+    void Generate( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                   const std::filesystem::path &expectationBaseDirPath, const std::filesystem::path &expectationHeaderFilepath,
+                   const Outputs &outputs ) const;
+
+    /**
+     * Function called in streaming mode to flush the code generated into the outputs.
+     *
+     * The function may consume the code emitted into any of the outputs, which must then be cleared.
+     */
+    typedef std::function<void( const Outputs &outputs )> FlushFunction;
+
+    /**
+     * Starts generating mocked functions and expectation functions while parsing the next C/C++ header (streaming
+     * mode).
+     *
+     * The code for each function is generated as soon as it is found while parsing the next header, without keeping
+     * its model. The code is flushed in bounded chunks, so that
+     * the memory used to generate the outputs does not grow with the number of functions of the header.
+     *
+     * Streaming mode only applies to the next parse, which generates and flushes the rest of the code if the header is
+     * parsed successfully. Otherwise, the code flushed until then must be discarded. The model of a header parsed in
+     * streaming mode is not kept, hence it cannot be generated or saved afterwards.
+     *
+     * @param[in] genOpts String containing the generation options
+     * @param[in] userCode String containing the user code existing in previously existing mock output file
+     * @param[in] mockBaseDirPath Base directory to reference input file in include directives of the mocked functions
+     * @param[in] expectationBaseDirPath Base directory to reference input file in include directives of the expectation
+     *                                   functions header
+     * @param[in] expectationHeaderFilepath Filename for the expectation functions header file
+     * @param[out] outputs Outputs where the generated code will be appended
+     * @param[in] flush Function called to flush the generated code
+     */
+    void StartStreaming( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                         const std::filesystem::path &expectationBaseDirPath, const std::filesystem::path &expectationHeaderFilepath,
+                         const Outputs &outputs, const FlushFunction &flush );
 
     /**
      * Generates mocked functions for the C/C++ header parsed previously.
@@ -73,12 +281,99 @@ public:
      */
     void GenerateExpectationImpl( const std::string &genOpts, const std::filesystem::path &headerFilepath, std::ostream &output ) const noexcept;
 
+    /**
+     * Returns the files that were read to parse the C/C++ header parsed previously (i.e., the header itself and all
+     * the files included by it, directly or indirectly).
+     *
+     * @return List of file paths
+     */
+    const std::vector<std::filesystem::path>& GetDependencies() const noexcept;
+
+    /**
+     * Saves the model of the C/C++ header parsed previously (i.e., its mockable functions), so that mocks and
+     * expectations can be generated later from the model without parsing the header again.
+     *
+     * @pre The header must have been parsed after enabling the saving of models with SetModelSaved().
+     *
+     * @param[out] output Stream where the model will be written
+     */
+    void SaveModel( std::ostream &output ) const;
+
+    /**
+     * Loads the model of a C/C++ header saved previously, which replaces parsing the header.
+     *
+     * @param[in] inputFilepath Filename for the C/C++ header file
+     * @param[in] config Configuration to be used during mock generation (its type overrides are applied to the loaded
+     *            functions)
+     * @param[in] input Stream where the model is read from
+     * @return @c true if the model was loaded, @c false if the model is invalid (then the header must be parsed again)
+     */
+    bool LoadModel( const std::filesystem::path &inputFilepath, const Config &config, std::istream &input );
+
 private:
-    void GenerateFileHeading( const std::string &genOpts, std::ostream &output, bool hasUserCode ) const noexcept;
+    /**
+     * Results of parsing an umbrella translation unit.
+     */
+    struct Umbrella
+    {
+        bool parsed = false;
+        std::map<std::filesystem::path, std::vector<std::unique_ptr<const Function>>> functions;
+        std::vector<std::filesystem::path> dependencies;
+    };
+
+    /**
+     * State of the generation in streaming mode.
+     */
+    struct Streaming
+    {
+        std::string genOpts;
+        std::string userCode;
+        std::filesystem::path mockBaseDirPath;
+        std::filesystem::path expectationBaseDirPath;
+        std::filesystem::path expectationHeaderFilepath;
+        Outputs outputs;
+        FlushFunction flush;
+        size_t numFunctions = 0;
+    };
+
+    CXIndex GetIndex( const std::vector<std::string> &compileArgs ) noexcept;
+    void ParseUmbrella( Umbrella &umbrella, const std::vector<std::string> &tuArgs, const Config &config,
+                        const std::vector<std::string> &includePaths, const std::vector<std::string> &compileArgs,
+                        std::ostream &error );
+    bool TakeUmbrellaFunctions( const std::filesystem::path &inputFilepath, const std::vector<std::string> &tuArgs,
+                                const Config &config, const std::vector<std::string> &includePaths,
+                                const std::vector<std::string> &compileArgs, std::ostream &error );
+    bool ParseSimpleC( const std::string &contents, const std::vector<std::string> &includePaths, const Config &config );
+
+    void GenerateFileHeading( const std::string &genOpts, CodeEmitter &output, bool hasUserCode ) const noexcept;
+    void GenerateHeadings( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                           const std::filesystem::path &expectationBaseDirPath,
+                           const std::filesystem::path &expectationHeaderFilepath, const Outputs &outputs ) const noexcept;
+    void GenerateFunctions( size_t begin, size_t end, const Outputs &outputs ) const;
+    bool ParseInput( const std::filesystem::path &inputFilepath, const Config &config, bool isCppHeader,
+                     const std::vector<std::string> &includePaths, const std::vector<std::string> &compileArgs,
+                     std::ostream &error );
+    void StreamFunctions( bool flush );
+    bool HasFunctions() const noexcept;
 
+    CXIndex m_index;
+    CXIndex m_pchIndex;
+    CXTranslationUnit m_tu;
+    std::vector<std::string> m_tuArgs;
+    bool m_keepTranslationUnit;
+    bool m_skipFunctionBodies;
+    bool m_singleFileParse;
+    bool m_simpleCParse;
     std::vector<std::unique_ptr<const Function>> m_functions;
     std::filesystem::path m_inputFilePath;
+    std::vector<std::filesystem::path> m_dependencies;
     bool m_interpretAsCpp;
+    std::vector<std::filesystem::path> m_umbrellaFiles;
+    std::map<std::vector<std::string>, Umbrella> m_umbrellas;
+    std::shared_ptr<StringPool> m_stringPool;
+    unsigned int m_numGenerationThreads;
+    bool m_modelSaved;
+    std::unique_ptr<Streaming> m_streaming;
 };
 
 #endif // header guard
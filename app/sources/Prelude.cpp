@@ -0,0 +1,305 @@
+/**
+ * @file
+ * @brief      Implementation of Prelude class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "Prelude.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef WIN32
+#include <random>
+#else
+#include <cstdlib>
+#endif
+
+#include "Parser.hpp"
+
+static const char PRELUDE_FILENAME[] = "prelude.h";
+static const char PCH_FILE_EXTENSION[] = ".pch";
+
+static const char WHITESPACE[] = " \t\r";
+
+static std::string Trim( const std::string &str )
+{
+    size_t first = str.find_first_not_of( WHITESPACE );
+    if( first == std::string::npos )
+    {
+        return "";
+    }
+    size_t last = str.find_last_not_of( WHITESPACE );
+    return str.substr( first, ( last - first + 1 ) );
+}
+
+static std::filesystem::path CreateTempDir()
+{
+    // The directory must be created by this process, since it is removed with all its contents when the prelude is
+    // destroyed, hence existing directories are never reused
+    std::filesystem::path tempDirTemplate = std::filesystem::temp_directory_path() / "CppUMockGen_prelude_";
+#ifdef WIN32
+    static const int MAX_ATTEMPTS = 100;
+    std::random_device randomDevice;
+    for( int attempt = 0; attempt < MAX_ATTEMPTS; attempt++ )
+    {
+        std::filesystem::path tempDirPath = tempDirTemplate;
+        tempDirPath += std::to_string( randomDevice() );
+        std::error_code ec;
+        if( std::filesystem::create_directory( tempDirPath, ec ) )
+        {
+            return tempDirPath;
+        }
+    }
+#else
+    std::string tempDirPath = tempDirTemplate.string() + "XXXXXX";
+    if( mkdtemp( &tempDirPath[0] ) != nullptr )
+    {
+        return tempDirPath;
+    }
+#endif
+
+    std::string errorMsg = "Prelude directory could not be created into '" +
+                           tempDirTemplate.parent_path().generic_string() + "'.";
+    throw std::runtime_error( errorMsg );
+}
+
+static std::filesystem::path NormalizePath( const std::filesystem::path &path )
+{
+    std::error_code ec;
+    std::filesystem::path absolutePath = std::filesystem::absolute( path, ec );
+    return ( ec ? path : absolutePath ).lexically_normal();
+}
+
+/*
+ * Returns the system headers (i.e. included using angle brackets) included at the beginning of a file, skipping
+ * comments and include guards.
+ */
+static std::vector<std::string> GetLeadingSystemIncludes( const std::filesystem::path &filePath )
+{
+    std::vector<std::string> includes;
+
+    std::ifstream file( filePath );
+    std::string line;
+    std::string guardName;
+    bool inComment = false;
+
+    while( std::getline( file, line ) )
+    {
+        line = Trim( line );
+
+        if( inComment )
+        {
+            size_t commentEnd = line.find( "*/" );
+            if( commentEnd == std::string::npos )
+            {
+                continue;
+            }
+            line = Trim( line.substr( commentEnd + 2 ) );
+            inComment = false;
+        }
+
+        if( line.compare( 0, 2, "/*" ) == 0 )
+        {
+            size_t commentEnd = line.find( "*/", 2 );
+            if( commentEnd == std::string::npos )
+            {
+                inComment = true;
+                continue;
+            }
+            line = Trim( line.substr( commentEnd + 2 ) );
+        }
+
+        if( line.empty() || ( line.compare( 0, 2, "//" ) == 0 ) )
+        {
+            continue;
+        }
+
+        if( line[0] != '#' )
+        {
+            break;
+        }
+
+        std::istringstream directive( line.substr( 1 ) );
+        std::string keyword;
+        std::string argument;
+        std::string rest;
+        directive >> keyword >> argument;
+        std::getline( directive, rest );
+        rest = Trim( rest );
+
+        if( ( keyword == "include" ) && ( argument.size() > 2 ) && ( argument.front() == '<' ) && ( argument.back() == '>' ) &&
+            ( rest.empty() || ( rest.compare( 0, 2, "//" ) == 0 ) ) )
+        {
+            includes.push_back( "#include " + argument );
+        }
+        else if( ( keyword == "ifndef" ) && guardName.empty() && includes.empty() && rest.empty() )
+        {
+            guardName = argument;
+        }
+        else if( ( ( keyword == "define" ) && !guardName.empty() && ( argument == guardName ) && rest.empty() ) ||
+                 ( ( keyword == "pragma" ) && ( argument == "once" ) ) )
+        {
+            continue;
+        }
+        else
+        {
+            // Other directives (e.g. macro definitions) may change the meaning of the subsequent includes
+            break;
+        }
+    }
+
+    return includes;
+}
+
+Prelude::Prelude( const std::vector<std::string> &headerPaths ) noexcept
+: m_numBuilds( 0 )
+{
+    for( const std::string &headerPath : headerPaths )
+    {
+        m_includes.push_back( "#include \"" + NormalizePath( headerPath ).generic_string() + "\"" );
+    }
+}
+
+Prelude::~Prelude()
+{
+    if( !m_tempDirPath.empty() )
+    {
+        std::error_code ec;
+        std::filesystem::remove_all( m_tempDirPath, ec );
+    }
+}
+
+void Prelude::AddCommonIncludes( const std::vector<std::filesystem::path> &inputFilePaths )
+{
+    std::vector<std::string> commonIncludes;
+
+    for( size_t i = 0; i < inputFilePaths.size(); i++ )
+    {
+        std::vector<std::string> includes = GetLeadingSystemIncludes( inputFilePaths[i] );
+        if( i == 0 )
+        {
+            commonIncludes = includes;
+        }
+        else
+        {
+            auto mismatch = std::mismatch( commonIncludes.begin(), commonIncludes.end(), includes.begin(), includes.end() );
+            commonIncludes.erase( mismatch.first, commonIncludes.end() );
+        }
+    }
+
+    for( const std::string &include : commonIncludes )
+    {
+        if( std::find( m_includes.begin(), m_includes.end(), include ) == m_includes.end() )
+        {
+            m_includes.push_back( include );
+        }
+    }
+}
+
+bool Prelude::IsEmpty() const noexcept
+{
+    return m_includes.empty();
+}
+
+std::string Prelude::GetContents() const
+{
+    std::string contents;
+
+    for( const std::string &include : m_includes )
+    {
+        contents += include + "\n";
+    }
+
+    return contents;
+}
+
+const Prelude::PrecompiledHeader& Prelude::GetPrecompiledHeader( Parser &parser, const Config &config, bool isCppHeader,
+                                                                 const std::vector<std::string> &includePaths,
+                                                                 const std::vector<std::string> &compileArgs,
+                                                                 std::ostream &error )
+{
+    std::string key = ( isCppHeader ? "c++\n" : "c\n" );
+    for( const std::string &compileArg : compileArgs )
+    {
+        key += compileArg + "\n";
+    }
+
+    // Precompiled headers are built while holding the lock, since other threads parsing input files with the same
+    // options would have to wait for it anyway
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    auto entryIt = m_entries.find( key );
+    if( entryIt == m_entries.end() )
+    {
+        if( m_tempDirPath.empty() )
+        {
+            std::filesystem::path tempDirPath = CreateTempDir();
+
+            std::ofstream preludeFile( tempDirPath / PRELUDE_FILENAME );
+            preludeFile << GetContents();
+            preludeFile.close();
+            if( preludeFile.fail() )
+            {
+                std::error_code ec;
+                std::filesystem::remove_all( tempDirPath, ec );
+                std::string errorMsg = "Prelude file could not be written into '" + tempDirPath.generic_string() + "'.";
+                throw std::runtime_error( errorMsg );
+            }
+
+            m_tempDirPath = tempDirPath;
+        }
+
+        // Each precompiled header gets a new file name, so that files still in use by parsers are never overwritten
+        Entry entry = { false, { m_tempDirPath / ( "prelude" + std::to_string( m_numBuilds++ ) + PCH_FILE_EXTENSION ), {} } };
+        entry.built = parser.BuildPrecompiledHeader( m_tempDirPath / PRELUDE_FILENAME, entry.precompiledHeader.filePath,
+                                                     config, isCppHeader, includePaths, compileArgs,
+                                                     entry.precompiledHeader.dependencies, error );
+
+        // The temporary prelude file is not a real dependency
+        auto &dependencies = entry.precompiledHeader.dependencies;
+        dependencies.erase( std::remove_if( dependencies.begin(), dependencies.end(),
+                                            [this]( const std::filesystem::path &dependency )
+                                            { return NormalizePath( dependency ).parent_path() == m_tempDirPath.lexically_normal(); } ),
+                            dependencies.end() );
+
+        entryIt = m_entries.emplace( key, std::move( entry ) ).first;
+    }
+
+    if( !entryIt->second.built )
+    {
+        throw std::runtime_error( "The prelude could not be precompiled." );
+    }
+
+    return entryIt->second.precompiledHeader;
+}
+
+void Prelude::Invalidate( const std::vector<std::filesystem::path> &changedFilePaths )
+{
+    std::lock_guard<std::mutex> lock( m_mutex );
+
+    for( auto entryIt = m_entries.begin(); entryIt != m_entries.end(); )
+    {
+        const std::vector<std::filesystem::path> &dependencies = entryIt->second.precompiledHeader.dependencies;
+
+        bool changed = std::any_of( dependencies.begin(), dependencies.end(), [&]( const std::filesystem::path &dependency )
+        {
+            return ( std::find( changedFilePaths.begin(), changedFilePaths.end(), NormalizePath( dependency ) ) != changedFilePaths.end() );
+        } );
+
+        if( changed )
+        {
+            entryIt = m_entries.erase( entryIt );
+        }
+        else
+        {
+            entryIt++;
+        }
+    }
+}
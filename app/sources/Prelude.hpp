@@ -0,0 +1,112 @@
+/**
+ * @file
+ * @brief      Header of Prelude class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_PRELUDE_HPP_
+#define CPPUMOCKGEN_PRELUDE_HPP_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <filesystem>
+
+class Parser;
+class Config;
+
+/**
+ * Class that manages a prelude, i.e. a set of headers included by most input files, which is precompiled only once to
+ * avoid parsing it again for each input file.
+ *
+ * Since precompiled headers can only be used by translation units parsed with the same options, a precompiled header
+ * is built for each different set of options when first needed. Precompiled headers are stored in a temporary
+ * directory, which is removed when the prelude is destroyed.
+ */
+class Prelude
+{
+public:
+    /**
+     * Precompiled header built for a set of options.
+     */
+    struct PrecompiledHeader
+    {
+        std::filesystem::path filePath;                      ///< Path to the precompiled header file
+        std::vector<std::filesystem::path> dependencies;     ///< Files read to build the precompiled header
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param[in] headerPaths Paths to the prelude headers
+     */
+    Prelude( const std::vector<std::string> &headerPaths ) noexcept;
+
+    /**
+     * Destructor.
+     */
+    ~Prelude();
+
+    /**
+     * Adds to the prelude the system headers that are included at the beginning of all the input files.
+     *
+     * @param[in] inputFilePaths Paths to the input files
+     */
+    void AddCommonIncludes( const std::vector<std::filesystem::path> &inputFilePaths );
+
+    /**
+     * Indicates if the prelude does not include any header.
+     */
+    bool IsEmpty() const noexcept;
+
+    /**
+     * Returns the contents of the prelude (i.e. the include directives of the prelude headers).
+     */
+    std::string GetContents() const;
+
+    /**
+     * Returns the precompiled header for a set of options, building it if necessary.
+     *
+     * This method is thread-safe.
+     *
+     * @param[in] parser Parser used to build the precompiled header
+     * @param[in] config Configuration to be used during mock generation
+     * @param[in] isCppHeader Indicates if the prelude must be precompiled as a C++ header
+     * @param[in] includePaths List of paths to search for included header files
+     * @param[in] compileArgs Additional compiler arguments
+     * @param[out] error Stream where errors will be written
+     * @return Precompiled header
+     * @throws std::runtime_error If the prelude cannot be precompiled
+     */
+    const PrecompiledHeader& GetPrecompiledHeader( Parser &parser, const Config &config, bool isCppHeader,
+                                                   const std::vector<std::string> &includePaths,
+                                                   const std::vector<std::string> &compileArgs, std::ostream &error );
+
+    /**
+     * Discards the precompiled headers that depend on any of the changed files, so that they are built again when
+     * needed.
+     *
+     * @param[in] changedFilePaths Absolute paths to the changed files
+     */
+    void Invalidate( const std::vector<std::filesystem::path> &changedFilePaths );
+
+private:
+    struct Entry
+    {
+        bool built;
+        PrecompiledHeader precompiledHeader;
+    };
+
+    std::vector<std::string> m_includes;
+    std::filesystem::path m_tempDirPath;
+    std::map<std::string, Entry> m_entries;
+    unsigned int m_numBuilds;
+    std::mutex m_mutex;
+};
+
+#endif // header guard
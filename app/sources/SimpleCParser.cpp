@@ -0,0 +1,1525 @@
+/**
+ * @file
+ * @brief      Implementation of SimpleCParser class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "SimpleCParser.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+
+//*************************************************************************************************
+//                                             TYPES
+//*************************************************************************************************
+
+static bool IsArrayKind( CXTypeKind kind ) noexcept
+{
+    return ( kind == CXType_ConstantArray ) || ( kind == CXType_IncompleteArray );
+}
+
+static bool IsFunctionKind( CXTypeKind kind ) noexcept
+{
+    return ( kind == CXType_FunctionProto ) || ( kind == CXType_FunctionNoProto );
+}
+
+static std::shared_ptr<const SimpleCParser::Type> MakeType( CXTypeKind kind, bool isConst, const std::string &name,
+                                                            const std::vector<std::shared_ptr<const SimpleCParser::Type>> &subtypes = {},
+                                                            const std::string &suffix = "" )
+{
+    return std::make_shared<const SimpleCParser::Type>( kind, isConst, name, subtypes, suffix );
+}
+
+SimpleCParser::Type::Type( CXTypeKind kind, bool isConst, const std::string &name,
+                           const std::vector<std::shared_ptr<const Type>> &subtypes, const std::string &suffix )
+: m_kind( kind ), m_isConst( isConst ), m_name( name ), m_suffix( suffix ), m_subtypes( subtypes )
+{
+    // Elaborated types are named like the type that they refer to
+    if( ( m_kind == CXType_Elaborated ) && m_name.empty() )
+    {
+        m_name = m_subtypes[0]->m_name;
+    }
+
+    m_spelling = Spell( "" );
+
+    std::vector<std::shared_ptr<const Type>> canonicalSubtypes;
+    bool isCanonical = true;
+    for( const std::shared_ptr<const Type> &subtype : m_subtypes )
+    {
+        canonicalSubtypes.push_back( subtype->m_canonical ? subtype->m_canonical : subtype );
+        isCanonical = isCanonical && ( canonicalSubtypes.back() == subtype );
+    }
+
+    if( ( m_kind == CXType_Elaborated ) || ( m_kind == CXType_Typedef ) )
+    {
+        // Sugar is removed, merging its qualifiers with the ones of the type that it refers to
+        const std::shared_ptr<const Type> &canonical = canonicalSubtypes[0];
+        if( m_isConst && !canonical->m_isConst )
+        {
+            m_canonical = MakeType( canonical->m_kind, true, canonical->m_name, canonical->m_subtypes, canonical->m_suffix );
+        }
+        else
+        {
+            m_canonical = canonical;
+        }
+    }
+    else if( !isCanonical )
+    {
+        m_canonical = MakeType( m_kind, m_isConst, m_name, canonicalSubtypes, m_suffix );
+    }
+}
+
+const SimpleCParser::Type& SimpleCParser::Type::Invalid() noexcept
+{
+    static const Type invalid( CXType_Invalid, false, "", {} );
+    return invalid;
+}
+
+std::string SimpleCParser::Type::Spell( const std::string &declarator ) const
+{
+    // Types are spelled like clang prints them, i.e. the declarator (without name) is built from the outer type to the
+    // inner one, and then it is appended to the base type
+    if( m_kind == CXType_Pointer )
+    {
+        std::string pointerDeclarator = "*";
+        if( m_isConst )
+        {
+            pointerDeclarator += "const";
+            if( !declarator.empty() && ( declarator[0] != '[' ) )
+            {
+                pointerDeclarator += " ";
+            }
+        }
+        pointerDeclarator += declarator;
+
+        CXTypeKind pointeeKind = m_subtypes[0]->m_kind;
+        if( IsArrayKind( pointeeKind ) || IsFunctionKind( pointeeKind ) )
+        {
+            pointerDeclarator = "(" + pointerDeclarator + ")";
+        }
+
+        return m_subtypes[0]->Spell( pointerDeclarator );
+    }
+    else if( IsArrayKind( m_kind ) )
+    {
+        return m_subtypes[0]->Spell( declarator + m_suffix );
+    }
+    else if( IsFunctionKind( m_kind ) )
+    {
+        std::string parameters;
+        for( size_t i = 1; i < m_subtypes.size(); i++ )
+        {
+            parameters += ( ( i > 1 ) ? ", " : "" ) + m_subtypes[i]->Spell( "" );
+        }
+
+        if( ( m_kind == CXType_FunctionProto ) && parameters.empty() )
+        {
+            parameters = "void";
+        }
+
+        return m_subtypes[0]->Spell( declarator + "(" + parameters + ")" );
+    }
+    else
+    {
+        std::string spelling = m_isConst ? ( "const " + m_name ) : m_name;
+        if( !declarator.empty() )
+        {
+            spelling += ( ( declarator[0] == '[' ) ? "" : " " ) + declarator;
+        }
+        return spelling;
+    }
+}
+
+//*************************************************************************************************
+//                                           BASIC TYPES
+//*************************************************************************************************
+
+static const char* GetBuiltinSpelling( CXTypeKind kind ) noexcept
+{
+    switch( kind ) // LCOV_EXCL_BR_LINE: Defensive
+    {
+        case CXType_Void: return "void";
+        case CXType_Bool: return "_Bool";
+        case CXType_Char_S: return "char";
+        case CXType_Char_U: return "char";
+        case CXType_SChar: return "signed char";
+        case CXType_UChar: return "unsigned char";
+        case CXType_Short: return "short";
+        case CXType_UShort: return "unsigned short";
+        case CXType_Int: return "int";
+        case CXType_UInt: return "unsigned int";
+        case CXType_Long: return "long";
+        case CXType_ULong: return "unsigned long";
+        case CXType_LongLong: return "long long";
+        case CXType_ULongLong: return "unsigned long long";
+        case CXType_Float: return "float";
+        case CXType_Double: return "double";
+        case CXType_LongDouble: return "long double";
+        default: return ""; // LCOV_EXCL_LINE: Defensive
+    }
+}
+
+template<typename T>
+static CXTypeKind GetIntegerKind() noexcept
+{
+    // Standard types are declared like in the host, since libclang targets the host by default
+    if( std::is_same<T, signed char>::value ) return CXType_SChar;
+    if( std::is_same<T, unsigned char>::value ) return CXType_UChar;
+    if( std::is_same<T, short>::value ) return CXType_Short;
+    if( std::is_same<T, unsigned short>::value ) return CXType_UShort;
+    if( std::is_same<T, int>::value ) return CXType_Int;
+    if( std::is_same<T, unsigned int>::value ) return CXType_UInt;
+    if( std::is_same<T, long>::value ) return CXType_Long;
+    if( std::is_same<T, unsigned long>::value ) return CXType_ULong;
+    if( std::is_same<T, long long>::value ) return CXType_LongLong;
+    if( std::is_same<T, unsigned long long>::value ) return CXType_ULongLong;
+    return CXType_Invalid; // LCOV_EXCL_LINE: Defensive
+}
+
+struct StandardTypedef
+{
+    const char *header;
+    const char *name;
+    CXTypeKind kind;
+};
+
+static const StandardTypedef STANDARD_TYPEDEFS[] =
+{
+    { "stdint.h", "int8_t", GetIntegerKind<int8_t>() },
+    { "stdint.h", "uint8_t", GetIntegerKind<uint8_t>() },
+    { "stdint.h", "int16_t", GetIntegerKind<int16_t>() },
+    { "stdint.h", "uint16_t", GetIntegerKind<uint16_t>() },
+    { "stdint.h", "int32_t", GetIntegerKind<int32_t>() },
+    { "stdint.h", "uint32_t", GetIntegerKind<uint32_t>() },
+    { "stdint.h", "int64_t", GetIntegerKind<int64_t>() },
+    { "stdint.h", "uint64_t", GetIntegerKind<uint64_t>() },
+    { "stdint.h", "intptr_t", GetIntegerKind<intptr_t>() },
+    { "stdint.h", "uintptr_t", GetIntegerKind<uintptr_t>() },
+    { "stdint.h", "intmax_t", GetIntegerKind<intmax_t>() },
+    { "stdint.h", "uintmax_t", GetIntegerKind<uintmax_t>() },
+    { "stddef.h", "size_t", GetIntegerKind<size_t>() },
+    { "stddef.h", "ptrdiff_t", GetIntegerKind<ptrdiff_t>() },
+};
+
+static const char* const KEYWORDS[] =
+{
+    "asm", "auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else", "enum", "extern",
+    "float", "for", "goto", "if", "inline", "int", "long", "register", "restrict", "return", "short", "signed", "sizeof",
+    "static", "struct", "switch", "typedef", "typeof", "union", "unsigned", "void", "volatile", "while",
+};
+
+static const char* const BASIC_TYPE_KEYWORDS[] =
+{
+    "void", "_Bool", "char", "short", "int", "long", "float", "double", "signed", "unsigned",
+};
+
+static bool IsInList( const std::string &identifier, const char* const *list, size_t listSize ) noexcept
+{
+    return std::any_of( list, list + listSize, [&identifier]( const char *item ) { return identifier == item; } );
+}
+
+static bool IsReserved( const std::string &identifier ) noexcept
+{
+    // Identifiers reserved for the implementation may be compiler extensions (e.g. "__attribute__" or "_Noreturn")
+    return IsInList( identifier, KEYWORDS, sizeof( KEYWORDS ) / sizeof( KEYWORDS[0] ) ) ||
+           ( ( identifier.size() > 1 ) && ( identifier[0] == '_' ) &&
+             ( ( identifier[1] == '_' ) || std::isupper( (unsigned char) identifier[1] ) ) );
+}
+
+static bool IsBasicTypeKeyword( const std::string &identifier ) noexcept
+{
+    return IsInList( identifier, BASIC_TYPE_KEYWORDS, sizeof( BASIC_TYPE_KEYWORDS ) / sizeof( BASIC_TYPE_KEYWORDS[0] ) );
+}
+
+//*************************************************************************************************
+//                                           PREPROCESSING
+//*************************************************************************************************
+
+static std::string Trim( const std::string &str )
+{
+    size_t start = str.find_first_not_of( " \t\f\v" );
+    if( start == std::string::npos )
+    {
+        return "";
+    }
+
+    return str.substr( start, str.find_last_not_of( " \t\f\v" ) - start + 1 );
+}
+
+static bool IsIdentifierChar( char c ) noexcept
+{
+    return std::isalnum( (unsigned char) c ) || ( c == '_' );
+}
+
+static size_t ScanLiteral( const std::string &line, size_t pos ) noexcept
+{
+    char quote = line[pos];
+    for( pos++; pos < line.size(); pos++ )
+    {
+        if( line[pos] == '\\' )
+        {
+            pos++;
+        }
+        else if( line[pos] == quote )
+        {
+            return pos + 1;
+        }
+    }
+
+    return std::string::npos;
+}
+
+static bool SplitTokens( const std::string &line, std::vector<std::string> &texts, std::vector<int> &kinds )
+{
+    static const char PUNCTUATORS[] = "{}[]();,*=:<>+-/%&|^!~?.";
+
+    size_t pos = 0;
+    while( pos < line.size() )
+    {
+        char c = line[pos];
+        size_t end;
+        int kind;
+
+        if( std::isspace( (unsigned char) c ) )
+        {
+            pos++;
+            continue;
+        }
+        else if( std::isalpha( (unsigned char) c ) || ( c == '_' ) )
+        {
+            end = pos;
+            while( ( end < line.size() ) && IsIdentifierChar( line[end] ) )
+            {
+                end++;
+            }
+            kind = 0;
+
+            // Prefixed character and string literals
+            std::string identifier = line.substr( pos, end - pos );
+            if( ( ( identifier == "L" ) || ( identifier == "u" ) || ( identifier == "U" ) || ( identifier == "u8" ) ) &&
+                ( end < line.size() ) && ( ( line[end] == '"' ) || ( line[end] == '\'' ) ) )
+            {
+                end = ScanLiteral( line, end );
+                kind = 2;
+            }
+        }
+        else if( std::isdigit( (unsigned char) c ) ||
+                 ( ( c == '.' ) && ( ( pos + 1 ) < line.size() ) && std::isdigit( (unsigned char) line[pos + 1] ) ) )
+        {
+            // Preprocessing numbers
+            end = pos + 1;
+            while( ( end < line.size() ) &&
+                   ( IsIdentifierChar( line[end] ) || ( line[end] == '.' ) ||
+                     ( ( ( line[end] == '+' ) || ( line[end] == '-' ) ) && std::strchr( "eEpP", line[end - 1] ) ) ) )
+            {
+                end++;
+            }
+            kind = 1;
+        }
+        else if( ( c == '"' ) || ( c == '\'' ) )
+        {
+            end = ScanLiteral( line, pos );
+            kind = 2;
+        }
+        else if( line.compare( pos, 3, "..." ) == 0 )
+        {
+            end = pos + 3;
+            kind = 3;
+        }
+        else if( std::strchr( PUNCTUATORS, c ) != nullptr )
+        {
+            end = pos + 1;
+            kind = 3;
+        }
+        else
+        {
+            return false;
+        }
+
+        if( end == std::string::npos )
+        {
+            return false;
+        }
+
+        texts.push_back( line.substr( pos, end - pos ) );
+        kinds.push_back( kind );
+        pos = end;
+    }
+
+    return true;
+}
+
+static bool GetConditionalMacro( const std::string &expression, std::string &macro, bool &isNegated )
+{
+    std::vector<std::string> texts;
+    std::vector<int> kinds;
+    if( !SplitTokens( expression, texts, kinds ) )
+    {
+        return false;
+    }
+
+    // Only "defined(X)", "defined X" and their negations are supported
+    size_t pos = 0;
+    isNegated = ( ( pos < texts.size() ) && ( texts[pos] == "!" ) );
+    if( isNegated )
+    {
+        pos++;
+    }
+
+    if( ( pos >= texts.size() ) || ( texts[pos++] != "defined" ) )
+    {
+        return false;
+    }
+
+    bool hasParenthesis = ( ( pos < texts.size() ) && ( texts[pos] == "(" ) );
+    if( hasParenthesis )
+    {
+        pos++;
+    }
+
+    if( ( pos >= texts.size() ) || ( kinds[pos] != 0 ) )
+    {
+        return false;
+    }
+    macro = texts[pos++];
+
+    if( hasParenthesis && ( ( pos >= texts.size() ) || ( texts[pos++] != ")" ) ) )
+    {
+        return false;
+    }
+
+    return ( pos == texts.size() );
+}
+
+static bool IsDefineDirective( const std::string &line, const std::string &macro )
+{
+    if( line.empty() || ( line[0] != '#' ) )
+    {
+        return false;
+    }
+
+    std::string directive = Trim( line.substr( 1 ) );
+    if( ( directive.compare( 0, 6, "define" ) != 0 ) || ( directive.size() < 7 ) || !std::isspace( (unsigned char) directive[6] ) )
+    {
+        return false;
+    }
+
+    std::string definition = Trim( directive.substr( 7 ) );
+    return ( definition.compare( 0, macro.size(), macro ) == 0 ) &&
+           ( ( definition.size() == macro.size() ) || !IsIdentifierChar( definition[macro.size()] ) );
+}
+
+bool SimpleCParser::Preprocess( const std::string &contents )
+{
+    // Line splices are removed (translation phase 2)
+    std::string spliced;
+    spliced.reserve( contents.size() );
+    for( size_t i = 0; i < contents.size(); i++ )
+    {
+        if( contents[i] == '\r' )
+        {
+            continue;
+        }
+        else if( ( contents[i] == '\\' ) && ( contents.find_first_not_of( '\r', i + 1 ) != std::string::npos ) &&
+                 ( contents[ contents.find_first_not_of( '\r', i + 1 ) ] == '\n' ) )
+        {
+            i = contents.find_first_not_of( '\r', i + 1 );
+            continue;
+        }
+
+        spliced += contents[i];
+    }
+
+    // Comments are replaced by a space (translation phase 3)
+    std::string text;
+    text.reserve( spliced.size() );
+    for( size_t i = 0; i < spliced.size(); i++ )
+    {
+        if( ( spliced[i] == '"' ) || ( spliced[i] == '\'' ) )
+        {
+            size_t end = std::min( ScanLiteral( spliced, i ), spliced.find( '\n', i ) );
+            if( end == std::string::npos )
+            {
+                return false;
+            }
+            text += spliced.substr( i, end - i );
+            i = end - 1;
+        }
+        else if( spliced.compare( i, 2, "//" ) == 0 )
+        {
+            i = std::min( spliced.find( '\n', i ), spliced.size() ) - 1;
+            text += ' ';
+        }
+        else if( spliced.compare( i, 2, "/*" ) == 0 )
+        {
+            size_t end = spliced.find( "*/", i + 2 );
+            if( end == std::string::npos )
+            {
+                return false;
+            }
+            i = end + 1;
+            text += ' ';
+        }
+        else
+        {
+            text += spliced[i];
+        }
+    }
+
+    std::vector<std::string> lines;
+    size_t lineStart = 0;
+    while( lineStart <= text.size() )
+    {
+        size_t lineEnd = std::min( text.find( '\n', lineStart ), text.size() );
+        std::string line = Trim( text.substr( lineStart, lineEnd - lineStart ) );
+        if( !line.empty() )
+        {
+            lines.push_back( line );
+        }
+        lineStart = lineEnd + 1;
+    }
+
+    // Each element is the state of a conditional group, being active only if all the enclosing groups are active too
+    std::vector<bool> conditionals;
+    for( size_t i = 0; i < lines.size(); i++ )
+    {
+        bool isActive = std::find( conditionals.begin(), conditionals.end(), false ) == conditionals.end();
+
+        if( lines[i][0] == '#' )
+        {
+            if( !ProcessDirective( Trim( lines[i].substr( 1 ) ), ( ( i + 1 ) < lines.size() ) ? lines[i + 1] : "",
+                                   conditionals ) )
+            {
+                return false;
+            }
+        }
+        else if( isActive && !Tokenize( lines[i] ) )
+        {
+            return false;
+        }
+    }
+
+    return conditionals.empty();
+}
+
+bool SimpleCParser::ProcessDirective( const std::string &directive, const std::string &nextLine,
+                                      std::vector<bool> &conditionals )
+{
+    bool isActive = std::find( conditionals.begin(), conditionals.end(), false ) == conditionals.end();
+
+    size_t nameEnd = 0;
+    while( ( nameEnd < directive.size() ) && IsIdentifierChar( directive[nameEnd] ) )
+    {
+        nameEnd++;
+    }
+    std::string name = directive.substr( 0, nameEnd );
+    std::string argument = Trim( directive.substr( nameEnd ) );
+
+    if( ( name == "if" ) || ( name == "ifdef" ) || ( name == "ifndef" ) )
+    {
+        if( !isActive )
+        {
+            conditionals.push_back( false );
+            return true;
+        }
+
+        std::string macro = argument;
+        bool isNegated = ( name == "ifndef" );
+        if( ( name == "if" ) && ( argument != "0" ) && ( argument != "1" ) &&
+            !GetConditionalMacro( argument, macro, isNegated ) )
+        {
+            return false;
+        }
+
+        bool isDefined;
+        if( name == "if" && ( ( argument == "0" ) || ( argument == "1" ) ) )
+        {
+            isDefined = ( argument == "1" );
+        }
+        else if( m_macros.count( macro ) > 0 )
+        {
+            isDefined = true;
+        }
+        else if( macro == "__cplusplus" )
+        {
+            // Headers are always parsed as C
+            isDefined = false;
+        }
+        else if( isNegated && IsDefineDirective( nextLine, macro ) )
+        {
+            // Include guard, whose macro is assumed not to be defined anywhere else
+            isDefined = false;
+        }
+        else
+        {
+            // The macro could be predefined by the compiler
+            return false;
+        }
+
+        conditionals.push_back( isDefined != isNegated );
+    }
+    else if( name == "else" )
+    {
+        if( conditionals.empty() )
+        {
+            return false;
+        }
+
+        bool isParentActive = std::find( conditionals.begin(), conditionals.end() - 1, false ) == ( conditionals.end() - 1 );
+        if( isParentActive )
+        {
+            conditionals.back() = !conditionals.back();
+        }
+    }
+    else if( name == "endif" )
+    {
+        if( conditionals.empty() )
+        {
+            return false;
+        }
+
+        conditionals.pop_back();
+    }
+    else if( !isActive )
+    {
+        return ( name != "elif" );
+    }
+    else if( name == "define" )
+    {
+        size_t macroEnd = 0;
+        while( ( macroEnd < argument.size() ) && IsIdentifierChar( argument[macroEnd] ) )
+        {
+            macroEnd++;
+        }
+        m_macros.insert( argument.substr( 0, macroEnd ) );
+    }
+    else if( name == "undef" )
+    {
+        m_macros.erase( argument );
+    }
+    else if( name == "include" )
+    {
+        if( ( argument.size() < 2 ) ||
+            !( ( ( argument.front() == '<' ) && ( argument.back() == '>' ) ) ||
+               ( ( argument.front() == '"' ) && ( argument.back() == '"' ) ) ) )
+        {
+            return false;
+        }
+
+        return IncludeHeader( argument.substr( 1, argument.size() - 2 ) );
+    }
+    else if( name == "pragma" )
+    {
+        // Pragmas do not affect declarations, except the ones that make the header a system header
+        return ( argument.find( "system_header" ) == std::string::npos );
+    }
+    else if( !name.empty() )
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool SimpleCParser::IncludeHeader( const std::string &header )
+{
+    if( m_includedHeaders.count( header ) > 0 )
+    {
+        return true;
+    }
+
+    if( header == "stdbool.h" )
+    {
+        m_hasStdBool = true;
+    }
+    else
+    {
+        bool isStandardHeader = false;
+        for( const StandardTypedef &standardTypedef : STANDARD_TYPEDEFS )
+        {
+            if( header == standardTypedef.header )
+            {
+                isStandardHeader = true;
+                if( !AddTypedef( standardTypedef.name,
+                                 MakeType( standardTypedef.kind, false, GetBuiltinSpelling( standardTypedef.kind ) ) ) )
+                {
+                    return false;
+                }
+            }
+        }
+
+        if( !isStandardHeader )
+        {
+            return false;
+        }
+    }
+
+    m_includedHeaders.insert( header );
+    return true;
+}
+
+bool SimpleCParser::Tokenize( const std::string &line )
+{
+    std::vector<std::string> texts;
+    std::vector<int> kinds;
+    if( !SplitTokens( line, texts, kinds ) )
+    {
+        return false;
+    }
+
+    for( size_t i = 0; i < texts.size(); i++ )
+    {
+        Token token = { static_cast<Token::Kind>( kinds[i] ), texts[i] };
+
+        if( token.kind == Token::Kind::Identifier )
+        {
+            if( m_hasStdBool && ( token.text == "bool" ) )
+            {
+                token.text = "_Bool";
+            }
+            else if( m_hasStdBool && ( ( token.text == "true" ) || ( token.text == "false" ) ) )
+            {
+                token = { Token::Kind::Number, ( token.text == "true" ) ? "1" : "0" };
+            }
+            else if( m_macros.count( token.text ) > 0 )
+            {
+                // Macros are not expanded
+                return false;
+            }
+        }
+
+        m_tokens.push_back( token );
+    }
+
+    return true;
+}
+
+//*************************************************************************************************
+//                                             PARSING
+//*************************************************************************************************
+
+struct SimpleCParser::DeclSpecs
+{
+    bool isTypedef = false;
+    bool isExtern = false;
+    bool isConst = false;
+    bool hasTag = false;
+    bool isAnonymousTag = false;
+    std::map<std::string, int> basicKeywords;
+    std::shared_ptr<const Type> namedType;
+    bool isElaborated = false;
+};
+
+struct SimpleCParser::Declarator
+{
+    std::string name;
+    std::shared_ptr<const Type> type;
+    bool hasParameters = false;
+    std::vector<Parameter> parameters;
+};
+
+const SimpleCParser::Token* SimpleCParser::Peek( size_t offset ) const noexcept
+{
+    return ( ( m_pos + offset ) < m_tokens.size() ) ? &m_tokens[m_pos + offset] : nullptr;
+}
+
+bool SimpleCParser::IsPunctuator( size_t offset, const char *text ) const noexcept
+{
+    const Token *token = Peek( offset );
+    return ( token != nullptr ) && ( token->kind == Token::Kind::Punctuator ) && ( token->text == text );
+}
+
+bool SimpleCParser::Accept( const char *text ) noexcept
+{
+    if( IsPunctuator( 0, text ) )
+    {
+        m_pos++;
+        return true;
+    }
+
+    return false;
+}
+
+bool SimpleCParser::SkipBalanced()
+{
+    // Skips from an opening bracket to the matching closing one
+    std::string closings;
+    do
+    {
+        const Token *token = Peek();
+        if( token == nullptr )
+        {
+            return false;
+        }
+
+        if( token->kind == Token::Kind::Punctuator )
+        {
+            if( ( token->text == "(" ) || ( token->text == "[" ) || ( token->text == "{" ) )
+            {
+                closings += ( token->text == "(" ) ? ')' : ( ( token->text == "[" ) ? ']' : '}' );
+            }
+            else if( ( token->text == ")" ) || ( token->text == "]" ) || ( token->text == "}" ) )
+            {
+                if( closings.empty() || ( token->text[0] != closings.back() ) )
+                {
+                    return false;
+                }
+                closings.pop_back();
+            }
+        }
+
+        m_pos++;
+    }
+    while( !closings.empty() );
+
+    return true;
+}
+
+bool SimpleCParser::SkipExpression( const char *terminators )
+{
+    // Skips until any of the terminators is found out of brackets, which is not consumed
+    while( true )
+    {
+        const Token *token = Peek();
+        if( token == nullptr )
+        {
+            return false;
+        }
+
+        if( token->kind == Token::Kind::Punctuator )
+        {
+            if( std::strchr( terminators, token->text[0] ) != nullptr )
+            {
+                return true;
+            }
+            else if( ( token->text == "(" ) || ( token->text == "[" ) || ( token->text == "{" ) )
+            {
+                if( !SkipBalanced() )
+                {
+                    return false;
+                }
+                continue;
+            }
+            else if( ( token->text == ")" ) || ( token->text == "]" ) || ( token->text == "}" ) )
+            {
+                return false;
+            }
+        }
+
+        m_pos++;
+    }
+}
+
+bool SimpleCParser::AddTypedef( const std::string &name, const std::shared_ptr<const Type> &type )
+{
+    // Redefinitions are not supported
+    if( m_typedefs.count( name ) > 0 )
+    {
+        return false;
+    }
+
+    m_typedefs[name] = MakeType( CXType_Typedef, false, name, { type } );
+    return true;
+}
+
+bool SimpleCParser::IsDeclSpecStart( const Token *token ) const
+{
+    return ( token != nullptr ) && ( token->kind == Token::Kind::Identifier ) &&
+           ( IsBasicTypeKeyword( token->text ) || ( token->text == "const" ) || ( token->text == "struct" ) ||
+             ( token->text == "union" ) || ( token->text == "enum" ) || ( m_typedefs.count( token->text ) > 0 ) );
+}
+
+bool SimpleCParser::Parse( const std::string &contents )
+{
+    m_tokens.clear();
+    m_pos = 0;
+    m_hasStdBool = false;
+    m_macros.clear();
+    m_includedHeaders.clear();
+    m_typedefs.clear();
+    m_tags.clear();
+    m_definedTags.clear();
+    m_functions.clear();
+    m_declaredFunctions.clear();
+    m_definedFunctions.clear();
+
+    if( !Preprocess( contents ) )
+    {
+        return false;
+    }
+
+    while( m_pos < m_tokens.size() )
+    {
+        if( !Accept( ";" ) && !ParseExternalDeclaration() )
+        {
+            return false;
+        }
+    }
+
+    // Functions defined in the header are not mockable
+    m_functions.erase( std::remove_if( m_functions.begin(), m_functions.end(),
+                                       [this]( const FunctionDecl &function )
+                                       { return m_definedFunctions.count( function.name ) > 0; } ),
+                       m_functions.end() );
+
+    return true;
+}
+
+bool SimpleCParser::ParseExternalDeclaration()
+{
+    DeclSpecs specs;
+    if( !ParseDeclSpecs( specs, Scope::File ) )
+    {
+        return false;
+    }
+
+    if( Accept( ";" ) )
+    {
+        // Only declarations of tags (or of enumerators) are allowed without declarators
+        return specs.hasTag && !specs.isTypedef && ( !specs.isAnonymousTag || ( specs.namedType->m_kind == CXType_Enum ) );
+    }
+
+    std::shared_ptr<const Type> baseType;
+    if( specs.isAnonymousTag || !GetBaseType( specs, baseType ) )
+    {
+        return false;
+    }
+
+    bool isFirst = true;
+    while( true )
+    {
+        Declarator declarator;
+        if( !ParseDeclarator( baseType, Scope::File, declarator ) )
+        {
+            return false;
+        }
+
+        const Type &type = *declarator.type;
+        if( specs.isTypedef )
+        {
+            if( !AddTypedef( declarator.name, declarator.type ) )
+            {
+                return false;
+            }
+        }
+        else if( IsFunctionKind( type.m_kind ) )
+        {
+            // The parameter names are only known if the function is declared directly
+            if( !declarator.hasParameters || ( m_typedefs.count( declarator.name ) > 0 ) )
+            {
+                return false;
+            }
+
+            if( m_declaredFunctions.count( declarator.name ) == 0 )
+            {
+                m_declaredFunctions.insert( declarator.name );
+                m_functions.push_back( { declarator.name, type.m_subtypes[0], declarator.parameters } );
+            }
+
+            if( isFirst && IsPunctuator( 0, "{" ) )
+            {
+                m_definedFunctions.insert( declarator.name );
+                return SkipBalanced();
+            }
+        }
+        else if( IsFunctionKind( type.GetCanonicalType().m_kind ) )
+        {
+            // Functions declared using typedefs are not supported
+            return false;
+        }
+        else if( IsPunctuator( 0, "=" ) )
+        {
+            // Initializers of extern variables are warned by libclang
+            m_pos++;
+            if( specs.isExtern || !SkipExpression( ",;" ) )
+            {
+                return false;
+            }
+        }
+
+        isFirst = false;
+
+        if( Accept( ";" ) )
+        {
+            return true;
+        }
+        else if( !Accept( "," ) )
+        {
+            return false;
+        }
+    }
+}
+
+bool SimpleCParser::ParseDeclSpecs( DeclSpecs &specs, Scope scope )
+{
+    while( true )
+    {
+        const Token *token = Peek();
+        if( ( token == nullptr ) || ( token->kind != Token::Kind::Identifier ) )
+        {
+            break;
+        }
+
+        const std::string &text = token->text;
+        bool hasType = !specs.basicKeywords.empty() || specs.namedType;
+
+        if( text == "typedef" )
+        {
+            if( ( scope != Scope::File ) || specs.isTypedef )
+            {
+                return false;
+            }
+            specs.isTypedef = true;
+        }
+        else if( ( text == "extern" ) || ( text == "static" ) || ( text == "inline" ) )
+        {
+            if( scope != Scope::File )
+            {
+                return false;
+            }
+            specs.isExtern = specs.isExtern || ( text == "extern" );
+        }
+        else if( text == "const" )
+        {
+            specs.isConst = true;
+        }
+        else if( IsBasicTypeKeyword( text ) )
+        {
+            if( specs.namedType )
+            {
+                return false;
+            }
+            specs.basicKeywords[text]++;
+        }
+        else if( ( text == "struct" ) || ( text == "union" ) || ( text == "enum" ) )
+        {
+            if( hasType || !ParseTagSpec( specs, scope ) )
+            {
+                return false;
+            }
+            continue;
+        }
+        else if( text == "__typeof__" )
+        {
+            // Only supported to declare typedefs (as done by the type map when parsing single files)
+            if( hasType || !specs.isTypedef || !IsPunctuator( 1, "(" ) )
+            {
+                return false;
+            }
+            m_pos += 2;
+
+            DeclSpecs typeSpecs;
+            std::shared_ptr<const Type> baseType;
+            Declarator declarator;
+            if( !ParseDeclSpecs( typeSpecs, Scope::TypeName ) || !GetBaseType( typeSpecs, baseType ) ||
+                !ParseDeclarator( baseType, Scope::TypeName, declarator ) || !Accept( ")" ) )
+            {
+                return false;
+            }
+
+            specs.namedType = declarator.type;
+            continue;
+        }
+        else if( !hasType && ( m_typedefs.count( text ) > 0 ) )
+        {
+            specs.namedType = m_typedefs[text];
+            specs.isElaborated = true;
+        }
+        else
+        {
+            break;
+        }
+
+        m_pos++;
+    }
+
+    return true;
+}
+
+bool SimpleCParser::ParseTagSpec( DeclSpecs &specs, Scope scope )
+{
+    std::string keyword = Peek()->text;
+    m_pos++;
+
+    std::string tag;
+    const Token *token = Peek();
+    if( ( token != nullptr ) && ( token->kind == Token::Kind::Identifier ) )
+    {
+        if( IsReserved( token->text ) )
+        {
+            return false;
+        }
+        tag = token->text;
+        m_pos++;
+    }
+
+    std::string name = keyword + " " + tag;
+    bool isEnum = ( keyword == "enum" );
+
+    if( IsPunctuator( 0, "{" ) )
+    {
+        // Tags declared in prototypes are not visible outside of them (and libclang warns about it)
+        if( ( scope == Scope::Prototype ) || ( !tag.empty() && ( m_definedTags.count( name ) > 0 ) ) )
+        {
+            return false;
+        }
+        m_pos++;
+
+        if( !tag.empty() )
+        {
+            m_definedTags.insert( name );
+        }
+
+        if( !( isEnum ? ParseEnumerators() : ParseMembers() ) )
+        {
+            return false;
+        }
+
+        if( tag.empty() )
+        {
+            // Anonymous tags defined in typedefs are named after the first typedef name
+            token = Peek();
+            if( specs.isTypedef && ( token != nullptr ) && ( token->kind == Token::Kind::Identifier ) &&
+                ( IsPunctuator( 1, ";" ) || IsPunctuator( 1, "," ) ) )
+            {
+                name = token->text;
+            }
+            else if( specs.isTypedef || ( ( scope != Scope::File ) && ( scope != Scope::Member ) ) )
+            {
+                return false;
+            }
+            else
+            {
+                name = "";
+                specs.isAnonymousTag = ( scope == Scope::File );
+            }
+        }
+    }
+    else if( tag.empty() )
+    {
+        return false;
+    }
+
+    if( !tag.empty() )
+    {
+        if( ( scope == Scope::Prototype ) && ( m_tags.count( name ) == 0 ) )
+        {
+            return false;
+        }
+
+        // Forward references to enums are not allowed in standard C
+        if( isEnum && ( m_definedTags.count( name ) == 0 ) )
+        {
+            return false;
+        }
+
+        m_tags.insert( name );
+    }
+
+    specs.hasTag = true;
+    specs.namedType = MakeType( isEnum ? CXType_Enum : CXType_Record, false, name );
+    specs.isElaborated = true;
+    return true;
+}
+
+bool SimpleCParser::ParseMembers()
+{
+    while( !Accept( "}" ) )
+    {
+        DeclSpecs specs;
+        std::shared_ptr<const Type> baseType;
+        if( !ParseDeclSpecs( specs, Scope::Member ) || !GetBaseType( specs, baseType ) )
+        {
+            return false;
+        }
+
+        if( Accept( ";" ) )
+        {
+            // Only anonymous structs and unions are allowed without declarators
+            if( !specs.hasTag || !specs.namedType->m_name.empty() || ( specs.namedType->m_kind != CXType_Record ) )
+            {
+                return false;
+            }
+            continue;
+        }
+
+        do
+        {
+            if( !IsPunctuator( 0, ":" ) )
+            {
+                Declarator declarator;
+                if( !ParseDeclarator( baseType, Scope::Member, declarator ) ||
+                    IsFunctionKind( declarator.type->GetCanonicalType().m_kind ) )
+                {
+                    return false;
+                }
+            }
+
+            // Bit-fields
+            if( Accept( ":" ) && !SkipExpression( ",;" ) )
+            {
+                return false;
+            }
+        }
+        while( Accept( "," ) );
+
+        if( !Accept( ";" ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool SimpleCParser::ParseEnumerators()
+{
+    bool isEmpty = true;
+    while( !Accept( "}" ) )
+    {
+        const Token *token = Peek();
+        if( ( token == nullptr ) || ( token->kind != Token::Kind::Identifier ) || IsReserved( token->text ) ||
+            ( m_typedefs.count( token->text ) > 0 ) )
+        {
+            return false;
+        }
+        m_pos++;
+        isEmpty = false;
+
+        if( Accept( "=" ) && !SkipExpression( ",}" ) )
+        {
+            return false;
+        }
+
+        if( !Accept( "," ) && !IsPunctuator( 0, "}" ) )
+        {
+            return false;
+        }
+    }
+
+    return !isEmpty;
+}
+
+bool SimpleCParser::GetBaseType( const DeclSpecs &specs, std::shared_ptr<const Type> &type ) const
+{
+    if( specs.namedType )
+    {
+        if( specs.isElaborated )
+        {
+            // Qualifiers of arrays and functions declared using typedefs are not supported
+            CXTypeKind canonicalKind = specs.namedType->GetCanonicalType().m_kind;
+            if( specs.isConst && ( IsArrayKind( canonicalKind ) || IsFunctionKind( canonicalKind ) ) )
+            {
+                return false;
+            }
+
+            type = MakeType( CXType_Elaborated, specs.isConst, "", { specs.namedType } );
+        }
+        else
+        {
+            type = specs.namedType;
+        }
+        return true;
+    }
+
+    auto count = [&specs]( const char *keyword )
+    {
+        auto it = specs.basicKeywords.find( keyword );
+        return ( it != specs.basicKeywords.end() ) ? it->second : 0;
+    };
+
+    int numKeywords = 0;
+    for( const auto &keyword : specs.basicKeywords )
+    {
+        numKeywords += keyword.second;
+    }
+
+    int numSigned = count( "signed" );
+    int numUnsigned = count( "unsigned" );
+    int numShort = count( "short" );
+    int numLong = count( "long" );
+    int numInt = count( "int" );
+    bool isUnsigned = ( numUnsigned > 0 );
+
+    CXTypeKind kind;
+    if( ( numKeywords == 1 ) && ( count( "void" ) == 1 ) )
+    {
+        kind = CXType_Void;
+    }
+    else if( ( numKeywords == 1 ) && ( count( "_Bool" ) == 1 ) )
+    {
+        kind = CXType_Bool;
+    }
+    else if( ( numKeywords == 1 ) && ( count( "float" ) == 1 ) )
+    {
+        kind = CXType_Float;
+    }
+    else if( ( count( "double" ) == 1 ) && ( numKeywords == ( 1 + numLong ) ) && ( numLong <= 1 ) )
+    {
+        kind = ( numLong == 1 ) ? CXType_LongDouble : CXType_Double;
+    }
+    else if( ( count( "char" ) == 1 ) && ( numKeywords == ( 1 + numSigned + numUnsigned ) ) && ( numKeywords <= 2 ) )
+    {
+        kind = ( numSigned > 0 ) ? CXType_SChar : ( isUnsigned ? CXType_UChar : ( std::is_signed<char>::value ? CXType_Char_S : CXType_Char_U ) );
+    }
+    else if( ( numKeywords > 0 ) && ( numKeywords == ( numSigned + numUnsigned + numShort + numLong + numInt ) ) &&
+             ( ( numSigned + numUnsigned ) <= 1 ) && ( numInt <= 1 ) && ( numLong <= 2 ) && ( ( numShort == 0 ) || ( numLong == 0 ) ) &&
+             ( numShort <= 1 ) )
+    {
+        if( numShort > 0 )
+        {
+            kind = isUnsigned ? CXType_UShort : CXType_Short;
+        }
+        else if( numLong == 1 )
+        {
+            kind = isUnsigned ? CXType_ULong : CXType_Long;
+        }
+        else if( numLong == 2 )
+        {
+            kind = isUnsigned ? CXType_ULongLong : CXType_LongLong;
+        }
+        else
+        {
+            kind = isUnsigned ? CXType_UInt : CXType_Int;
+        }
+    }
+    else
+    {
+        // Also implicit int, which is not supported
+        return false;
+    }
+
+    type = MakeType( kind, specs.isConst, GetBuiltinSpelling( kind ) );
+    return true;
+}
+
+bool SimpleCParser::IsNestedDeclarator( Scope scope ) const
+{
+    // A parenthesis starts a nested declarator, unless it starts the parameters of an abstract declarator
+    if( ( scope == Scope::File ) || ( scope == Scope::Member ) )
+    {
+        return true;
+    }
+
+    const Token *token = Peek( 1 );
+    return IsPunctuator( 1, "*" ) || IsPunctuator( 1, "(" ) || IsPunctuator( 1, "[" ) ||
+           ( ( token != nullptr ) && ( token->kind == Token::Kind::Identifier ) && !IsDeclSpecStart( token ) );
+}
+
+bool SimpleCParser::ParseDeclarator( std::shared_ptr<const Type> type, Scope scope, Declarator &declarator )
+{
+    while( Accept( "*" ) )
+    {
+        bool isConst = false;
+        while( ( Peek() != nullptr ) && ( Peek()->text == "const" ) )
+        {
+            isConst = true;
+            m_pos++;
+        }
+
+        type = MakeType( CXType_Pointer, isConst, "", { type } );
+    }
+
+    const Token *token = Peek();
+    if( IsPunctuator( 0, "(" ) && IsNestedDeclarator( scope ) )
+    {
+        // The suffixes after the nested declarator apply first
+        size_t nestedPos = m_pos + 1;
+        if( !SkipBalanced() || !ParseSuffixes( type, nullptr ) )
+        {
+            return false;
+        }
+
+        size_t endPos = m_pos;
+        m_pos = nestedPos;
+        if( !ParseDeclarator( type, scope, declarator ) || !Accept( ")" ) )
+        {
+            return false;
+        }
+        m_pos = endPos;
+        return true;
+    }
+    else if( ( token != nullptr ) && ( token->kind == Token::Kind::Identifier ) )
+    {
+        if( ( scope == Scope::TypeName ) || IsReserved( token->text ) || ( m_typedefs.count( token->text ) > 0 ) )
+        {
+            return false;
+        }
+
+        declarator.name = token->text;
+        m_pos++;
+    }
+    else if( ( scope == Scope::File ) || ( scope == Scope::Member ) )
+    {
+        return false;
+    }
+
+    if( !ParseSuffixes( type, &declarator ) )
+    {
+        return false;
+    }
+
+    declarator.type = type;
+    return true;
+}
+
+bool SimpleCParser::ParseSuffixes( std::shared_ptr<const Type> &type, Declarator *declarator )
+{
+    struct Suffix
+    {
+        std::string array;
+        bool hasPrototype;
+        std::vector<Parameter> parameters;
+    };
+
+    std::vector<Suffix> suffixes;
+    while( true )
+    {
+        if( Accept( "[" ) )
+        {
+            Suffix suffix = { "[]", false, {} };
+            if( !Accept( "]" ) )
+            {
+                // Only sizes given by integer literals are supported, which are spelled in decimal
+                const Token *token = Peek();
+                if( ( token == nullptr ) || ( token->kind != Token::Kind::Number ) || !IsPunctuator( 1, "]" ) )
+                {
+                    return false;
+                }
+
+                std::string digits = token->text.substr( 0, token->text.find_first_of( "uUlL" ) );
+                if( token->text.find_first_not_of( "uUlL", digits.size() ) != std::string::npos )
+                {
+                    return false;
+                }
+
+                int base = ( digits.compare( 0, 2, "0x" ) == 0 ) || ( digits.compare( 0, 2, "0X" ) == 0 ) ? 16 :
+                           ( ( digits.size() > 1 ) && ( digits[0] == '0' ) ? 8 : 10 );
+                size_t numParsed = 0;
+                unsigned long long size = 0;
+                try
+                {
+                    size = std::stoull( digits, &numParsed, base );
+                }
+                catch( std::exception & )
+                {
+                    return false;
+                }
+
+                if( ( numParsed != digits.size() ) || ( size == 0 ) )
+                {
+                    return false;
+                }
+
+                suffix.array = "[" + std::to_string( size ) + "]";
+                m_pos += 2;
+            }
+            else if( !suffixes.empty() )
+            {
+                // Only the outermost array may be incomplete
+                return false;
+            }
+
+            suffixes.push_back( suffix );
+        }
+        else if( Accept( "(" ) )
+        {
+            Suffix suffix = { "", false, {} };
+            if( !ParseParameters( suffix.parameters, suffix.hasPrototype ) )
+            {
+                return false;
+            }
+
+            suffixes.push_back( suffix );
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // Suffixes apply from the innermost (i.e., the last one) to the outermost
+    for( auto it = suffixes.rbegin(); it != suffixes.rend(); it++ )
+    {
+        if( IsArrayKind( type->m_kind ) && it->array.empty() )
+        {
+            return false;
+        }
+
+        if( IsFunctionKind( type->m_kind ) )
+        {
+            return false;
+        }
+
+        if( !it->array.empty() )
+        {
+            type = MakeType( ( it->array == "[]" ) ? CXType_IncompleteArray : CXType_ConstantArray, false, "", { type },
+                             it->array );
+        }
+        else
+        {
+            std::vector<std::shared_ptr<const Type>> subtypes = { type };
+            for( const Parameter &parameter : it->parameters )
+            {
+                subtypes.push_back( parameter.type );
+            }
+
+            type = MakeType( it->hasPrototype ? CXType_FunctionProto : CXType_FunctionNoProto, false, "", subtypes );
+        }
+    }
+
+    if( ( declarator != nullptr ) && !suffixes.empty() && suffixes[0].array.empty() )
+    {
+        declarator->hasParameters = true;
+        declarator->parameters = suffixes[0].parameters;
+    }
+
+    return true;
+}
+
+bool SimpleCParser::ParseParameters( std::vector<Parameter> &parameters, bool &hasPrototype )
+{
+    hasPrototype = !Accept( ")" );
+    if( !hasPrototype )
+    {
+        return true;
+    }
+
+    if( ( Peek() != nullptr ) && ( Peek()->text == "void" ) && IsPunctuator( 1, ")" ) )
+    {
+        m_pos += 2;
+        return true;
+    }
+
+    do
+    {
+        // Variadic functions are not supported
+        DeclSpecs specs;
+        std::shared_ptr<const Type> baseType;
+        Declarator declarator;
+        if( !ParseDeclSpecs( specs, Scope::Prototype ) || !GetBaseType( specs, baseType ) ||
+            !ParseDeclarator( baseType, Scope::Prototype, declarator ) )
+        {
+            return false;
+        }
+
+        // Parameters of function type (which are adjusted to pointers) or of void type are not supported
+        CXTypeKind canonicalKind = declarator.type->GetCanonicalType().m_kind;
+        if( IsFunctionKind( canonicalKind ) || ( canonicalKind == CXType_Void ) )
+        {
+            return false;
+        }
+
+        parameters.push_back( { declarator.name, declarator.type } );
+    }
+    while( Accept( "," ) );
+
+    return Accept( ")" );
+}
@@ -0,0 +1,227 @@
+/**
+ * @file
+ * @brief      Header of SimpleCParser class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_SIMPLECPARSER_HPP_
+#define CPPUMOCKGEN_SIMPLECPARSER_HPP_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <clang-c/Index.h>
+
+/**
+ * Class used to parse simple C headers without libclang.
+ *
+ * Only a subset of C is supported: function prototypes, typedefs, structs, unions, enums, pointers and arrays, with
+ * include guards, @c __cplusplus conditionals and the standard headers that just declare basic types. The types are
+ * modeled like libclang does (i.e., same kinds, spellings, qualifiers and canonical types), so that functions can be
+ * processed exactly the same way than the ones parsed by libclang.
+ *
+ * Parsing is not attempted to be complete: as soon as any unsupported construct is found parsing is abandoned, and
+ * then the header must be parsed using libclang instead.
+ */
+class SimpleCParser
+{
+public:
+    /**
+     * Class that represents a C type, modeled like libclang does.
+     */
+    class Type
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param[in] kind Kind of the type
+         * @param[in] isConst Indicates if the type is const qualified
+         * @param[in] name Name of the type (for named types)
+         * @param[in] subtypes Types from which the type derives (pointee, element, named or result and parameters)
+         * @param[in] suffix Suffix of the declarator (for arrays)
+         */
+        Type( CXTypeKind kind, bool isConst, const std::string &name,
+              const std::vector<std::shared_ptr<const Type>> &subtypes, const std::string &suffix = "" );
+
+        /**
+         * Returns the kind of the type.
+         */
+        CXTypeKind GetKind() const noexcept
+        {
+            return m_kind;
+        }
+
+        /**
+         * Returns if the type is const qualified.
+         */
+        bool IsConst() const noexcept
+        {
+            return m_isConst;
+        }
+
+        /**
+         * Returns the spelling of the type, as libclang would return it.
+         */
+        const std::string& GetSpelling() const noexcept
+        {
+            return m_spelling;
+        }
+
+        /**
+         * Returns the type pointed by a pointer type, or an invalid type for other types.
+         */
+        const Type& GetPointeeType() const noexcept
+        {
+            return GetSubtype( CXType_Pointer );
+        }
+
+        /**
+         * Returns the type of the elements of an array type, or an invalid type for other types.
+         */
+        const Type& GetElementType() const noexcept
+        {
+            return ( m_kind == CXType_IncompleteArray ) ? GetSubtype( CXType_IncompleteArray ) : GetSubtype( CXType_ConstantArray );
+        }
+
+        /**
+         * Returns the type named by an elaborated type, or an invalid type for other types.
+         */
+        const Type& GetNamedType() const noexcept
+        {
+            return GetSubtype( CXType_Elaborated );
+        }
+
+        /**
+         * Returns the canonical type (i.e., with all typedefs and sugar resolved).
+         */
+        const Type& GetCanonicalType() const noexcept
+        {
+            return m_canonical ? *m_canonical : *this;
+        }
+
+        /**
+         * Returns the invalid type.
+         */
+        static const Type& Invalid() noexcept;
+
+    private:
+        const Type& GetSubtype( CXTypeKind kind ) const noexcept
+        {
+            return ( ( m_kind == kind ) && !m_subtypes.empty() ) ? *m_subtypes[0] : Invalid();
+        }
+
+        std::string Spell( const std::string &declarator ) const;
+
+        CXTypeKind m_kind;
+        bool m_isConst;
+        std::string m_name;
+        std::string m_suffix;
+        std::vector<std::shared_ptr<const Type>> m_subtypes;
+        std::shared_ptr<const Type> m_canonical;
+        std::string m_spelling;
+
+        friend class SimpleCParser;
+    };
+
+    /**
+     * Parameter of a function declaration.
+     */
+    struct Parameter
+    {
+        std::string name;
+        std::shared_ptr<const Type> type;
+    };
+
+    /**
+     * Function declaration.
+     */
+    struct FunctionDecl
+    {
+        std::string name;
+        std::shared_ptr<const Type> returnType;
+        std::vector<Parameter> parameters;
+    };
+
+    /**
+     * Parses the contents of a C header.
+     *
+     * @param[in] contents Contents of the C header
+     * @return @c true if the header could be parsed completely, @c false if it contains any unsupported construct
+     */
+    bool Parse( const std::string &contents );
+
+    /**
+     * Returns the mockable functions declared in the header parsed previously (i.e., the ones that are not defined in
+     * the header), in order of first declaration.
+     */
+    const std::vector<FunctionDecl>& GetFunctions() const noexcept
+    {
+        return m_functions;
+    }
+
+    /**
+     * Returns the standard headers included by the header parsed previously.
+     */
+    const std::set<std::string>& GetIncludedHeaders() const noexcept
+    {
+        return m_includedHeaders;
+    }
+
+private:
+    struct Token
+    {
+        enum class Kind { Identifier, Number, Literal, Punctuator };
+
+        Kind kind;
+        std::string text;
+    };
+
+    enum class Scope { File, Member, Prototype, TypeName };
+
+    struct DeclSpecs;
+    struct Declarator;
+
+    bool Preprocess( const std::string &contents );
+    bool ProcessDirective( const std::string &directive, const std::string &nextLine, std::vector<bool> &conditionals );
+    bool IncludeHeader( const std::string &header );
+    bool Tokenize( const std::string &line );
+
+    bool ParseExternalDeclaration();
+    bool ParseDeclSpecs( DeclSpecs &specs, Scope scope );
+    bool ParseTagSpec( DeclSpecs &specs, Scope scope );
+    bool GetBaseType( const DeclSpecs &specs, std::shared_ptr<const Type> &type ) const;
+    bool ParseMembers();
+    bool ParseEnumerators();
+    bool ParseDeclarator( std::shared_ptr<const Type> type, Scope scope, Declarator &declarator );
+    bool ParseSuffixes( std::shared_ptr<const Type> &type, Declarator *declarator );
+    bool ParseParameters( std::vector<Parameter> &parameters, bool &hasPrototype );
+    bool IsNestedDeclarator( Scope scope ) const;
+    bool IsDeclSpecStart( const Token *token ) const;
+    bool AddTypedef( const std::string &name, const std::shared_ptr<const Type> &type );
+    bool SkipBalanced();
+    bool SkipExpression( const char *terminators );
+
+    const Token* Peek( size_t offset = 0 ) const noexcept;
+    bool IsPunctuator( size_t offset, const char *text ) const noexcept;
+    bool Accept( const char *text ) noexcept;
+
+    std::vector<Token> m_tokens;
+    size_t m_pos = 0;
+    bool m_hasStdBool = false;
+    std::set<std::string> m_macros;
+    std::set<std::string> m_includedHeaders;
+    std::map<std::string, std::shared_ptr<const Type>> m_typedefs;
+    std::set<std::string> m_tags;
+    std::set<std::string> m_definedTags;
+    std::vector<FunctionDecl> m_functions;
+    std::set<std::string> m_declaredFunctions;
+    std::set<std::string> m_definedFunctions;
+};
+
+#endif // header guard
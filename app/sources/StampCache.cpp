@@ -0,0 +1,353 @@
+/**
+ * @file
+ * @brief      Implementation of StampCache class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "StampCache.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <system_error>
+
+#include "FileHelper.hpp"
+
+static const char STAMP_FILE_HEADER[] = "CppUMockGen stamp";
+static const char STAMP_FILE_EXTENSION[] = ".stamp";
+static const char MODEL_FILE_HEADER[] = "CppUMockGen model cache";
+static const char MODEL_FILE_EXTENSION[] = ".model";
+static const char SIGNATURE_TAG[] = "signature";
+static const char OUTPUT_TAG[] = "output";
+static const char INPUT_TAG[] = "input";
+static const char DEPENDENCY_TAG[] = "dependency";
+static const char MODEL_TAG[] = "model";
+
+static const uint64_t FNV_OFFSET_BASIS = 0xCBF29CE484222325ULL;
+static const uint64_t FNV_PRIME = 0x00000100000001B3ULL;
+
+static uint64_t Hash( const char *data, size_t size, uint64_t hash = FNV_OFFSET_BASIS ) noexcept
+{
+    for( size_t i = 0; i < size; i++ )
+    {
+        hash ^= static_cast<unsigned char>( data[i] );
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+static std::string HashToString( uint64_t hash )
+{
+    std::ostringstream hashStr;
+    hashStr << std::hex << std::setw( 16 ) << std::setfill( '0' ) << hash;
+    return hashStr.str();
+}
+
+static std::string HashString( const std::string &str )
+{
+    return HashToString( Hash( str.data(), str.size() ) );
+}
+
+static bool HashFile( const std::filesystem::path &filePath, std::string &hashStr )
+{
+    std::ifstream file( filePath, std::ios::binary );
+    if( !file.is_open() )
+    {
+        return false;
+    }
+
+    uint64_t hash = FNV_OFFSET_BASIS;
+    char buffer[ 65536 ];
+    while( file.read( buffer, sizeof( buffer ) ) || ( file.gcount() > 0 ) )
+    {
+        hash = Hash( buffer, static_cast<size_t>( file.gcount() ), hash );
+    }
+
+    hashStr = HashToString( hash );
+    return true;
+}
+
+static std::string NormalizePath( const std::filesystem::path &path )
+{
+    return std::filesystem::absolute( path ).lexically_normal().generic_string();
+}
+
+bool StampCache::ParseStampedFile( const std::string &line, std::string &tag, std::string &path ) const
+{
+    // Each line has the format "<tag> <hash> <path>"
+    size_t hashPos = line.find( ' ' );
+    size_t pathPos = ( hashPos != std::string::npos ) ? line.find( ' ', hashPos + 1 ) : std::string::npos;
+    if( pathPos == std::string::npos )
+    {
+        return false;
+    }
+
+    tag = line.substr( 0, hashPos );
+    path = line.substr( pathPos + 1 );
+
+    // The file must not have changed since it was stamped
+    std::string currentHash;
+    return GetFileHash( path, currentHash ) && ( currentHash == line.substr( hashPos + 1, pathPos - hashPos - 1 ) );
+}
+
+std::string StampCache::GetStampedFileLine( const char *tag, const std::filesystem::path &filePath ) const
+{
+    // Files that cannot be read are stamped with an invalid hash, so that they are never considered unchanged
+    std::string path = NormalizePath( filePath );
+    std::string hashStr;
+    if( !GetFileHash( path, hashStr ) )
+    {
+        hashStr = "-"; // LCOV_EXCL_LINE: Defensive
+    }
+
+    return std::string( tag ) + " " + hashStr + " " + path + "\n";
+}
+
+StampCache::StampCache( const std::filesystem::path &cacheDirPath ) noexcept
+: m_cacheDirPath( cacheDirPath )
+{
+}
+
+bool StampCache::GetFileHash( const std::string &path, std::string &hashStr, bool reread ) const
+{
+    std::error_code ec;
+    std::uintmax_t size = std::filesystem::file_size( path, ec );
+    std::filesystem::file_time_type writeTime;
+    if( !ec )
+    {
+        writeTime = std::filesystem::last_write_time( path, ec );
+    }
+    if( ec )
+    {
+        return false;
+    }
+
+    // Files read while parsing input files (e.g. common headers) are usually dependencies of many input files, hence
+    // they are only hashed again when their size or modification time change
+    if( !reread )
+    {
+        std::lock_guard<std::mutex> lock( m_fileHashesMutex );
+        auto it = m_fileHashes.find( path );
+        if( ( it != m_fileHashes.end() ) && ( it->second.size == size ) && ( it->second.writeTime == writeTime ) )
+        {
+            hashStr = it->second.hash;
+            return true;
+        }
+    }
+
+    // If the file changes while being hashed, the stored size or modification time will not match in the next lookup
+    if( !HashFile( path, hashStr ) )
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock( m_fileHashesMutex );
+    m_fileHashes[path] = { size, writeTime, hashStr };
+    return true;
+}
+
+std::filesystem::path StampCache::GetStampFilePath( const std::vector<std::filesystem::path> &outputFilePaths ) const
+{
+    std::string key;
+    for( const std::filesystem::path &outputFilePath : outputFilePaths )
+    {
+        key += NormalizePath( outputFilePath ) + "\n";
+    }
+
+    return m_cacheDirPath / ( HashString( key ) + STAMP_FILE_EXTENSION );
+}
+
+bool StampCache::IsUpToDate( const std::vector<std::filesystem::path> &outputFilePaths, const std::string &signature ) const
+{
+    std::ifstream stampFile( GetStampFilePath( outputFilePaths ) );
+    if( !stampFile.is_open() )
+    {
+        return false;
+    }
+
+    std::string line;
+    if( !std::getline( stampFile, line ) || ( line != STAMP_FILE_HEADER ) )
+    {
+        return false;
+    }
+
+    if( !std::getline( stampFile, line ) || ( line != std::string( SIGNATURE_TAG ) + " " + HashString( signature ) ) )
+    {
+        return false;
+    }
+
+    size_t numOutputs = 0;
+    while( std::getline( stampFile, line ) )
+    {
+        std::string tag;
+        std::string path;
+        if( !ParseStampedFile( line, tag, path ) )
+        {
+            return false;
+        }
+
+        if( tag == OUTPUT_TAG )
+        {
+            // Collisions of stamp file names are detected by checking the stamped output paths
+            if( ( numOutputs >= outputFilePaths.size() ) || ( path != NormalizePath( outputFilePaths[numOutputs] ) ) )
+            {
+                return false;
+            }
+            numOutputs++;
+        }
+        else if( tag != DEPENDENCY_TAG )
+        {
+            return false;
+        }
+    }
+
+    return ( numOutputs == outputFilePaths.size() );
+}
+
+void StampCache::Update( const std::vector<std::filesystem::path> &outputFilePaths, const std::string &signature,
+                         const std::vector<std::filesystem::path> &dependencies ) const
+{
+    std::ostringstream stamp;
+    stamp << STAMP_FILE_HEADER << std::endl;
+    stamp << SIGNATURE_TAG << " " << HashString( signature ) << std::endl;
+
+    std::string hashStr;
+
+    for( const std::filesystem::path &outputFilePath : outputFilePaths )
+    {
+        // Output files have just been written, hence they are always read again in case their modification time did
+        // not change
+        std::string path = NormalizePath( outputFilePath );
+        if( !GetFileHash( path, hashStr, true ) )
+        {
+            std::string errorMsg = "Output file '" + outputFilePath.generic_string() + "' could not be read to be stamped.";
+            throw std::runtime_error( errorMsg );
+        }
+        stamp << OUTPUT_TAG << " " << hashStr << " " << path << std::endl;
+    }
+
+    for( const std::filesystem::path &dependency : dependencies )
+    {
+        stamp << GetStampedFileLine( DEPENDENCY_TAG, dependency );
+    }
+
+    WriteCacheFile( GetStampFilePath( outputFilePaths ), stamp.str(), "Stamp file" );
+}
+
+std::filesystem::path StampCache::GetModelFilePath( const std::filesystem::path &inputFilePath, const std::string &signature ) const
+{
+    return m_cacheDirPath / ( HashString( NormalizePath( inputFilePath ) + "\n" + signature ) + MODEL_FILE_EXTENSION );
+}
+
+bool StampCache::GetModel( const std::filesystem::path &inputFilePath, const std::string &signature,
+                           std::string &model, std::vector<std::filesystem::path> &dependencies ) const
+{
+    std::ifstream modelFile( GetModelFilePath( inputFilePath, signature ), std::ios::binary );
+    if( !modelFile.is_open() )
+    {
+        return false;
+    }
+
+    std::string line;
+    if( !std::getline( modelFile, line ) || ( line != MODEL_FILE_HEADER ) )
+    {
+        return false;
+    }
+
+    if( !std::getline( modelFile, line ) || ( line != std::string( SIGNATURE_TAG ) + " " + HashString( signature ) ) )
+    {
+        return false;
+    }
+
+    const std::string modelPrefix = std::string( MODEL_TAG ) + " ";
+    std::vector<std::filesystem::path> stampedDependencies;
+    bool inputFound = false;
+    while( std::getline( modelFile, line ) )
+    {
+        // The model is stored after its size, following the stamped files
+        if( line.compare( 0, modelPrefix.size(), modelPrefix ) == 0 )
+        {
+            size_t modelSize;
+            std::istringstream modelSizeStream( line.substr( modelPrefix.size() ) );
+            if( !inputFound || !( modelSizeStream >> modelSize ) )
+            {
+                return false;
+            }
+
+            model.resize( modelSize );
+            if( !modelFile.read( &model[0], modelSize ) )
+            {
+                return false;
+            }
+
+            dependencies = std::move( stampedDependencies );
+            return true;
+        }
+
+        std::string tag;
+        std::string path;
+        if( !ParseStampedFile( line, tag, path ) )
+        {
+            return false;
+        }
+
+        if( tag == INPUT_TAG )
+        {
+            // Collisions of model file names are detected by checking the stamped input path
+            if( path != NormalizePath( inputFilePath ) )
+            {
+                return false;
+            }
+            inputFound = true;
+        }
+        else if( tag == DEPENDENCY_TAG )
+        {
+            stampedDependencies.push_back( path );
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+void StampCache::StoreModel( const std::filesystem::path &inputFilePath, const std::string &signature,
+                             const std::vector<std::filesystem::path> &dependencies, const std::string &model ) const
+{
+    std::ostringstream modelCache;
+    modelCache << MODEL_FILE_HEADER << std::endl;
+    modelCache << SIGNATURE_TAG << " " << HashString( signature ) << std::endl;
+
+    modelCache << GetStampedFileLine( INPUT_TAG, inputFilePath );
+    for( const std::filesystem::path &dependency : dependencies )
+    {
+        modelCache << GetStampedFileLine( DEPENDENCY_TAG, dependency );
+    }
+
+    modelCache << MODEL_TAG << " " << model.size() << std::endl;
+    modelCache << model;
+
+    WriteCacheFile( GetModelFilePath( inputFilePath, signature ), modelCache.str(), "Model cache file" );
+}
+
+void StampCache::WriteCacheFile( const std::filesystem::path &filePath, const std::string &contents, const char *description ) const
+{
+    std::error_code ec;
+    std::filesystem::create_directories( m_cacheDirPath, ec );
+
+    // The cache directory may be shared by several concurrent processes, therefore cache files are replaced atomically
+    // so that they are never read partially written
+    if( WriteFileIfChanged( filePath, contents ) == WriteResult::FAILED )
+    {
+        std::string errorMsg = std::string( description ) + " '" + filePath.generic_string() + "' could not be written.";
+        throw std::runtime_error( errorMsg );
+    }
+}
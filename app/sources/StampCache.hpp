@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @brief      Header of StampCache class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_STAMPCACHE_HPP_
+#define CPPUMOCKGEN_STAMPCACHE_HPP_
+
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+/**
+ * Class that manages a cache of stamps used to detect if generated output files are up to date.
+ *
+ * For each set of output files generated from an input file, a stamp file is stored in the cache directory, which
+ * records a hash of the contents of the output files, of the input file and of every file read while parsing it, and
+ * of a signature that identifies the generation options and the generator version.
+ *
+ * The model of each parsed input file is also stored in the cache directory, so that outputs can be generated again
+ * without parsing the input file while neither the input file, the files read while parsing it, nor the parsing
+ * options change.
+ *
+ * The hashes of the stamped files are kept in memory while their size and modification time do not change, so that
+ * files that are dependencies of many input files are only read once. The same cache can be used concurrently from
+ * several threads.
+ */
+class StampCache
+{
+public:
+    /**
+     * Constructor.
+     *
+     * @param[in] cacheDirPath Path to the cache directory
+     */
+    StampCache( const std::filesystem::path &cacheDirPath ) noexcept;
+
+    /**
+     * Checks if a set of output files is up to date.
+     *
+     * @param[in] outputFilePaths Paths to the output files
+     * @param[in] signature Signature of the generation options and generator version
+     * @return @c true if a stamp exists for the output files, the signature matches the stamped one, and neither the
+     *         output files nor the dependencies have changed since they were stamped, @c false otherwise
+     */
+    bool IsUpToDate( const std::vector<std::filesystem::path> &outputFilePaths, const std::string &signature ) const;
+
+    /**
+     * Stamps a set of output files that have been generated.
+     *
+     * @param[in] outputFilePaths Paths to the output files
+     * @param[in] signature Signature of the generation options and generator version
+     * @param[in] dependencies Paths to the files used to generate the output files
+     */
+    void Update( const std::vector<std::filesystem::path> &outputFilePaths, const std::string &signature,
+                 const std::vector<std::filesystem::path> &dependencies ) const;
+
+    /**
+     * Gets the model stored for an input file.
+     *
+     * @param[in] inputFilePath Path to the input file
+     * @param[in] signature Signature of the parsing options and generator version
+     * @param[out] model Model of the input file
+     * @param[out] dependencies Paths to the files read while parsing the input file
+     * @return @c true if a model exists for the input file, the signature matches the stored one, and neither the input
+     *         file nor the dependencies have changed since the model was stored, @c false otherwise
+     */
+    bool GetModel( const std::filesystem::path &inputFilePath, const std::string &signature,
+                   std::string &model, std::vector<std::filesystem::path> &dependencies ) const;
+
+    /**
+     * Stores the model of an input file that has been parsed.
+     *
+     * @param[in] inputFilePath Path to the input file
+     * @param[in] signature Signature of the parsing options and generator version
+     * @param[in] dependencies Paths to the files read while parsing the input file
+     * @param[in] model Model of the input file
+     */
+    void StoreModel( const std::filesystem::path &inputFilePath, const std::string &signature,
+                     const std::vector<std::filesystem::path> &dependencies, const std::string &model ) const;
+
+private:
+    struct FileHash
+    {
+        std::uintmax_t size;
+        std::filesystem::file_time_type writeTime;
+        std::string hash;
+    };
+
+    std::filesystem::path GetStampFilePath( const std::vector<std::filesystem::path> &outputFilePaths ) const;
+    std::filesystem::path GetModelFilePath( const std::filesystem::path &inputFilePath, const std::string &signature ) const;
+    void WriteCacheFile( const std::filesystem::path &filePath, const std::string &contents, const char *description ) const;
+    bool GetFileHash( const std::string &path, std::string &hashStr, bool reread = false ) const;
+    bool ParseStampedFile( const std::string &line, std::string &tag, std::string &path ) const;
+    std::string GetStampedFileLine( const char *tag, const std::filesystem::path &filePath ) const;
+
+    std::filesystem::path m_cacheDirPath;
+    mutable std::mutex m_fileHashesMutex;
+    mutable std::unordered_map<std::string, FileHash> m_fileHashes;
+};
+
+#endif // header guard
@@ -0,0 +1,41 @@
+/**
+ * @file
+ * @brief      Implementation of StringPool class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "StringPool.hpp"
+
+std::shared_ptr<const std::string> StringPool::Intern( const std::string &str )
+{
+    Shard &shard = m_shards[ std::hash<std::string_view>()( str ) % NUM_SHARDS ];
+
+    std::lock_guard<std::mutex> lock( shard.mutex );
+
+    auto it = shard.strings.find( str );
+    if( it != shard.strings.end() )
+    {
+        return it->second;
+    }
+
+    // The keys of the pool refer to the interned strings themselves, which do not move
+    std::shared_ptr<const std::string> internedStr = std::make_shared<const std::string>( str );
+    shard.strings.emplace( *internedStr, internedStr );
+    return internedStr;
+}
+
+size_t StringPool::GetSize() const noexcept
+{
+    size_t size = 0;
+
+    for( const Shard &shard : m_shards )
+    {
+        std::lock_guard<std::mutex> lock( shard.mutex );
+        size += shard.strings.size();
+    }
+
+    return size;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file
+ * @brief      Header of StringPool class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_STRINGPOOL_HPP_
+#define CPPUMOCKGEN_STRINGPOOL_HPP_
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * Class that interns strings, so that equal strings are stored only once.
+ *
+ * Interned strings are shared, therefore they remain valid after the pool is destroyed while they are still in use.
+ * A pool can be used from several threads at the same time. The strings are distributed by their hash among several
+ * shards, each one with its own lock, so that threads interning different strings rarely wait for each other.
+ */
+class StringPool
+{
+public:
+    /**
+     * Interns a string.
+     *
+     * @param[in] str String to be interned
+     * @return Shared instance of the string in the pool
+     */
+    std::shared_ptr<const std::string> Intern( const std::string &str );
+
+    /**
+     * Returns the number of distinct strings in the pool.
+     */
+    size_t GetSize() const noexcept;
+
+private:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        std::unordered_map<std::string_view, std::shared_ptr<const std::string>> strings;
+    };
+
+    Shard m_shards[ NUM_SHARDS ];
+};
+
+#endif // header guard
@@ -0,0 +1,249 @@
+/**
+ * @file
+ * @brief      Implementation of TimeReport class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "TimeReport.hpp"
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+
+static const char* const PHASE_NAMES[] =
+{
+    "options",
+    "input-file",
+    "output-file-parse",
+    "tu-parse",
+    "diagnostics",
+    "ast-traversal",
+    "simple-c-parse",
+    "function-parse",
+    "generation",
+    "file-write",
+};
+
+static const char* const COUNTER_NAMES[] =
+{
+    "input-files",
+    "functions",
+    "arguments",
+    "override-lookups",
+    "overrides-hit",
+};
+
+static_assert( ( sizeof( PHASE_NAMES ) / sizeof( PHASE_NAMES[0] ) ) == static_cast<size_t>( TimeReport::Phase::NUM_PHASES ),
+               "Missing phase names" );
+static_assert( ( sizeof( COUNTER_NAMES ) / sizeof( COUNTER_NAMES[0] ) ) == static_cast<size_t>( TimeReport::Counter::NUM_COUNTERS ),
+               "Missing counter names" );
+
+static uint64_t GetProcessCpuTime() noexcept
+{
+#ifdef WIN32
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    GetProcessTimes( GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime );
+    return ( ( ( static_cast<uint64_t>( kernelTime.dwHighDateTime ) << 32 ) | kernelTime.dwLowDateTime ) +
+             ( ( static_cast<uint64_t>( userTime.dwHighDateTime ) << 32 ) | userTime.dwLowDateTime ) ) * 100;
+#else
+    struct timespec time;
+    clock_gettime( CLOCK_PROCESS_CPUTIME_ID, &time );
+    return ( static_cast<uint64_t>( time.tv_sec ) * 1000000000 ) + static_cast<uint64_t>( time.tv_nsec );
+#endif
+}
+
+static std::string FormatMilliseconds( uint64_t time )
+{
+    std::ostringstream output;
+    output << std::fixed << std::setprecision( 3 ) << ( static_cast<double>( time ) / 1000000.0 );
+    return output.str();
+}
+
+static std::string FormatMicroseconds( uint64_t time )
+{
+    std::ostringstream output;
+    output << std::fixed << std::setprecision( 3 ) << ( static_cast<double>( time ) / 1000.0 );
+    return output.str();
+}
+
+static std::string EscapeJsonString( const std::string &str )
+{
+    std::string ret;
+    ret.reserve( str.size() );
+
+    for( char c : str )
+    {
+        switch( c )
+        {
+            case '"':
+                ret += "\\\"";
+                break;
+
+            case '\\':
+                ret += "\\\\";
+                break;
+
+            case '\n':
+                ret += "\\n";
+                break;
+
+            case '\t':
+                ret += "\\t";
+                break;
+
+            default:
+                if( static_cast<unsigned char>( c ) < 0x20 )
+                {
+                    char escapedChar[8];
+                    snprintf( escapedChar, sizeof( escapedChar ), "\\u%04x", static_cast<unsigned int>( c ) );
+                    ret += escapedChar;
+                }
+                else
+                {
+                    ret += c;
+                }
+                break;
+        }
+    }
+
+    return ret;
+}
+
+// Threads are identified in traces by small sequential numbers, which are easier to follow than system identifiers
+static unsigned int GetTraceThreadId() noexcept
+{
+    static std::atomic<unsigned int> s_lastThreadId { 0 };
+    thread_local unsigned int threadId = ( s_lastThreadId.fetch_add( 1, std::memory_order_relaxed ) + 1 );
+    return threadId;
+}
+
+static std::atomic<uint64_t> s_lastReportId { 0 };
+
+TimeReport::TimeReport() noexcept
+: m_startWallTime( GetWallTime() ), m_startCpuTime( GetProcessCpuTime() ),
+  m_id( s_lastReportId.fetch_add( 1, std::memory_order_relaxed ) + 1 )
+{
+}
+
+void TimeReport::AddTraceEvent( Phase phase, const std::string &label, uint64_t startWallTime, uint64_t endWallTime )
+{
+    // The buffer of the calling thread is cached, reports being identified by an id because a new report could be
+    // created at the address of a destroyed one
+    thread_local uint64_t bufferReportId = 0;
+    thread_local TraceBuffer *buffer = nullptr;
+
+    if( bufferReportId != m_id )
+    {
+        std::lock_guard<std::mutex> lock( m_traceMutex );
+        m_traceBuffers.push_back( std::make_unique<TraceBuffer>() );
+        buffer = m_traceBuffers.back().get();
+        buffer->threadId = GetTraceThreadId();
+        bufferReportId = m_id;
+    }
+
+    buffer->events.push_back( { phase, label, startWallTime, endWallTime } );
+}
+
+const char* TimeReport::GetName( Phase phase ) noexcept
+{
+    return PHASE_NAMES[ static_cast<size_t>( phase ) ];
+}
+
+const char* TimeReport::GetName( Counter counter ) noexcept
+{
+    return COUNTER_NAMES[ static_cast<size_t>( counter ) ];
+}
+
+std::string TimeReport::Format( OutputFormat format ) const
+{
+    std::string totalWallTime = FormatMilliseconds( GetWallTime() - m_startWallTime );
+    std::string totalCpuTime = FormatMilliseconds( GetProcessCpuTime() - m_startCpuTime );
+
+    std::ostringstream output;
+
+    if( format == OutputFormat::JSON )
+    {
+        output << "{\n";
+        output << "  \"wallTimeMs\": " << totalWallTime << ",\n";
+        output << "  \"cpuTimeMs\": " << totalCpuTime << ",\n";
+        output << "  \"phases\": [\n";
+        for( size_t i = 0; i < static_cast<size_t>( Phase::NUM_PHASES ); i++ )
+        {
+            Phase phase = static_cast<Phase>( i );
+            output << "    { \"name\": \"" << GetName( phase ) << "\", \"calls\": " << GetCalls( phase ) <<
+                      ", \"wallTimeMs\": " << FormatMilliseconds( GetWallTime( phase ) ) <<
+                      ", \"cpuTimeMs\": " << FormatMilliseconds( GetCpuTime( phase ) ) << " }" <<
+                      ( ( ( i + 1 ) < static_cast<size_t>( Phase::NUM_PHASES ) ) ? "," : "" ) << "\n";
+        }
+        output << "  ],\n";
+        output << "  \"counters\": {\n";
+        for( size_t i = 0; i < static_cast<size_t>( Counter::NUM_COUNTERS ); i++ )
+        {
+            Counter counter = static_cast<Counter>( i );
+            output << "    \"" << GetName( counter ) << "\": " << GetCount( counter ) <<
+                      ( ( ( i + 1 ) < static_cast<size_t>( Counter::NUM_COUNTERS ) ) ? "," : "" ) << "\n";
+        }
+        output << "  }\n";
+        output << "}\n";
+    }
+    else
+    {
+        // Times of phases run in parallel are accumulated, hence they may add up to more than the total times
+        output << std::left << std::setw( 32 ) << "Phase" << std::right << std::setw( 10 ) << "Calls" <<
+                  std::setw( 14 ) << "Wall (ms)" << std::setw( 14 ) << "CPU (ms)" << "\n";
+        for( size_t i = 0; i < static_cast<size_t>( Phase::NUM_PHASES ); i++ )
+        {
+            Phase phase = static_cast<Phase>( i );
+            output << std::left << std::setw( 32 ) << GetName( phase ) << std::right << std::setw( 10 ) << GetCalls( phase ) <<
+                      std::setw( 14 ) << FormatMilliseconds( GetWallTime( phase ) ) <<
+                      std::setw( 14 ) << FormatMilliseconds( GetCpuTime( phase ) ) << "\n";
+        }
+        output << std::left << std::setw( 42 ) << "total" << std::right << std::setw( 14 ) << totalWallTime <<
+                  std::setw( 14 ) << totalCpuTime << "\n";
+        output << "\n";
+        for( size_t i = 0; i < static_cast<size_t>( Counter::NUM_COUNTERS ); i++ )
+        {
+            Counter counter = static_cast<Counter>( i );
+            output << std::left << std::setw( 32 ) << GetName( counter ) << std::right << std::setw( 10 ) <<
+                      GetCount( counter ) << "\n";
+        }
+    }
+
+    return output.str();
+}
+
+std::string TimeReport::FormatTrace() const
+{
+    std::lock_guard<std::mutex> lock( m_traceMutex );
+
+    std::ostringstream output;
+
+    output << "{\n";
+    output << "  \"displayTimeUnit\": \"ms\",\n";
+    output << "  \"traceEvents\": [\n";
+    output << "    { \"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": { \"name\": \"CppUMockGen\" } }";
+
+    for( const std::unique_ptr<TraceBuffer> &buffer : m_traceBuffers )
+    {
+        output << ",\n    { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->threadId <<
+                  ", \"args\": { \"name\": \"Thread " << buffer->threadId << "\" } }";
+
+        for( const TraceEvent &event : buffer->events )
+        {
+            // Times are relative to the creation of the report, which precedes any measured phase
+            output << ",\n    { \"name\": \"" << ( event.label.empty() ? GetName( event.phase ) : EscapeJsonString( event.label ) ) <<
+                      "\", \"cat\": \"" << GetName( event.phase ) << "\", \"ph\": \"X\"" <<
+                      ", \"ts\": " << FormatMicroseconds( event.startWallTime - m_startWallTime ) <<
+                      ", \"dur\": " << FormatMicroseconds( event.endWallTime - event.startWallTime ) <<
+                      ", \"pid\": 1, \"tid\": " << buffer->threadId << " }";
+        }
+    }
+
+    output << "\n  ]\n";
+    output << "}\n";
+
+    return output.str();
+}
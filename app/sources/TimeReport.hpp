@@ -0,0 +1,363 @@
+/**
+ * @file
+ * @brief      Header of TimeReport class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_TIMEREPORT_HPP_
+#define CPPUMOCKGEN_TIMEREPORT_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef WIN32
+#include "windows.h"
+#else
+#include <time.h>
+#endif
+
+/**
+ * Class used to measure the time spent in each processing phase.
+ *
+ * Phases are measured by scopes placed around the code that implements them, which measure nothing unless a report
+ * is active, so that they can be placed in hot paths. Times measured in different threads are accumulated, and the
+ * time of nested phases is also included in the time of the phases that contain them.
+ *
+ * CPU times are measured for the thread that runs each phase, therefore they do not include the time spent by libclang
+ * in its own threads (e.g. when parsing translation units).
+ *
+ * When tracing is enabled, each measured phase is also recorded as an event tagged with the thread that ran it, which
+ * can be formatted as a trace viewable with chrome://tracing or Perfetto.
+ */
+class TimeReport
+{
+public:
+    /**
+     * Processing phases.
+     */
+    enum class Phase
+    {
+        OPTIONS,                        ///< Parsing of options and configuration files
+        INPUT_FILE,                     ///< Processing of input files (includes the rest of phases)
+        OUTPUT_FILE_PARSE,              ///< Parsing of previously existing output files
+        TU_PARSE,                       ///< Parsing of translation units by libclang
+        DIAGNOSTICS,                    ///< Formatting of libclang diagnostics
+        AST_TRAVERSAL,                  ///< Traversal of translation units (includes parsing of functions)
+        SIMPLE_C_PARSE,                 ///< Parsing of simple C headers without libclang (includes parsing of functions)
+        FUNCTION_PARSE,                 ///< Parsing of functions
+        GENERATION,                     ///< Generation of mocked functions and expectation functions
+        FILE_WRITE,                     ///< Writing of output files
+        NUM_PHASES
+    };
+
+    /**
+     * Processing counters.
+     */
+    enum class Counter
+    {
+        INPUT_FILES,        ///< Input files processed
+        FUNCTIONS,          ///< Functions parsed
+        ARGUMENTS,          ///< Arguments of the functions parsed
+        OVERRIDE_LOOKUPS,   ///< Type override lookups
+        OVERRIDES_HIT,      ///< Type override lookups that found a type override
+        NUM_COUNTERS
+    };
+
+    /**
+     * Class used to measure a phase while it is in scope.
+     */
+    class Scope
+    {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param[in] phase Phase to be measured
+         * @param[in] report Report where the phase is accumulated (the active report by default), or @c nullptr to
+         *                   measure nothing
+         */
+        explicit Scope( Phase phase, TimeReport *report = GetActive() ) noexcept
+        : m_report( report ), m_phase( phase ), m_startWallTime( 0 ), m_startCpuTime( 0 )
+        {
+            if( m_report != nullptr )
+            {
+                m_startWallTime = GetWallTime();
+                m_startCpuTime = GetThreadCpuTime();
+            }
+        }
+
+        /**
+         * Constructor for phases that are labelled in traces (e.g. with the path of the processed input file).
+         *
+         * @param[in] phase Phase to be measured
+         * @param[in] label Label of the trace event
+         * @param[in] report Report where the phase is accumulated (the active report by default), or @c nullptr to
+         *                   measure nothing
+         */
+        Scope( Phase phase, const std::string &label, TimeReport *report = GetActive() )
+        : Scope( phase, report )
+        {
+            if( ( m_report != nullptr ) && m_report->IsTracing() )
+            {
+                m_label = label;
+            }
+        }
+
+        /**
+         * Destructor.
+         */
+        ~Scope()
+        {
+            if( m_report != nullptr )
+            {
+                uint64_t endWallTime = GetWallTime();
+                m_report->Add( m_phase, endWallTime - m_startWallTime, GetThreadCpuTime() - m_startCpuTime );
+                if( m_report->IsTracing() )
+                {
+                    m_report->AddTraceEvent( m_phase, m_label, m_startWallTime, endWallTime );
+                }
+            }
+        }
+
+        Scope( const Scope & ) = delete;
+        Scope& operator=( const Scope & ) = delete;
+
+    private:
+        TimeReport *m_report;
+        Phase m_phase;
+        uint64_t m_startWallTime;
+        uint64_t m_startCpuTime;
+        std::string m_label;
+    };
+
+    /**
+     * Output formats of the report.
+     */
+    enum class OutputFormat { TEXT, JSON };
+
+    /**
+     * Constructor.
+     */
+    TimeReport() noexcept;
+
+    /**
+     * Destructor.
+     */
+    ~TimeReport()
+    {
+        Deactivate();
+    }
+
+    TimeReport( const TimeReport & ) = delete;
+    TimeReport& operator=( const TimeReport & ) = delete;
+
+    /**
+     * Makes this report the active report, where the phases measured by default are accumulated.
+     */
+    void Activate() noexcept
+    {
+        s_active.store( this, std::memory_order_release );
+    }
+
+    /**
+     * Makes this report inactive, if it is the active report.
+     */
+    void Deactivate() noexcept
+    {
+        TimeReport *report = this;
+        s_active.compare_exchange_strong( report, nullptr );
+    }
+
+    /**
+     * Enables recording of trace events. Must be called before measuring any phase.
+     */
+    void EnableTrace() noexcept
+    {
+        m_tracing = true;
+    }
+
+    /**
+     * Indicates if trace events are recorded.
+     */
+    bool IsTracing() const noexcept
+    {
+        return m_tracing;
+    }
+
+    /**
+     * Returns the active report, or @c nullptr if there is no active report.
+     */
+    static TimeReport* GetActive() noexcept
+    {
+        return s_active.load( std::memory_order_acquire );
+    }
+
+    /**
+     * Accumulates the time spent in a phase.
+     *
+     * @param[in] phase Phase
+     * @param[in] wallTime Wall-clock time spent in the phase, in nanoseconds
+     * @param[in] cpuTime CPU time spent in the phase, in nanoseconds
+     */
+    void Add( Phase phase, uint64_t wallTime, uint64_t cpuTime ) noexcept
+    {
+        PhaseTimes &times = m_phases[ static_cast<size_t>( phase ) ];
+        times.calls.fetch_add( 1, std::memory_order_relaxed );
+        times.wallTime.fetch_add( wallTime, std::memory_order_relaxed );
+        times.cpuTime.fetch_add( cpuTime, std::memory_order_relaxed );
+    }
+
+    /**
+     * Records a trace event for a phase in the buffer of the calling thread.
+     *
+     * @param[in] phase Phase
+     * @param[in] label Label of the event (the name of the phase is used if empty)
+     * @param[in] startWallTime Wall-clock time when the phase started, in nanoseconds
+     * @param[in] endWallTime Wall-clock time when the phase ended, in nanoseconds
+     */
+    void AddTraceEvent( Phase phase, const std::string &label, uint64_t startWallTime, uint64_t endWallTime );
+
+    /**
+     * Increments a counter of the active report, if any.
+     *
+     * @param[in] counter Counter
+     * @param[in] increment Increment
+     */
+    static void Count( Counter counter, uint64_t increment = 1 ) noexcept
+    {
+        TimeReport *report = GetActive();
+        if( report != nullptr )
+        {
+            report->m_counters[ static_cast<size_t>( counter ) ].fetch_add( increment, std::memory_order_relaxed );
+        }
+    }
+
+    /**
+     * Returns the number of times that a phase was measured.
+     */
+    uint64_t GetCalls( Phase phase ) const noexcept
+    {
+        return m_phases[ static_cast<size_t>( phase ) ].calls.load( std::memory_order_relaxed );
+    }
+
+    /**
+     * Returns the wall-clock time spent in a phase, in nanoseconds.
+     */
+    uint64_t GetWallTime( Phase phase ) const noexcept
+    {
+        return m_phases[ static_cast<size_t>( phase ) ].wallTime.load( std::memory_order_relaxed );
+    }
+
+    /**
+     * Returns the CPU time spent in a phase, in nanoseconds.
+     */
+    uint64_t GetCpuTime( Phase phase ) const noexcept
+    {
+        return m_phases[ static_cast<size_t>( phase ) ].cpuTime.load( std::memory_order_relaxed );
+    }
+
+    /**
+     * Returns the value of a counter.
+     */
+    uint64_t GetCount( Counter counter ) const noexcept
+    {
+        return m_counters[ static_cast<size_t>( counter ) ].load( std::memory_order_relaxed );
+    }
+
+    /**
+     * Returns the name of a phase.
+     */
+    static const char* GetName( Phase phase ) noexcept;
+
+    /**
+     * Returns the name of a counter.
+     */
+    static const char* GetName( Counter counter ) noexcept;
+
+    /**
+     * Formats the report.
+     *
+     * The total wall-clock and CPU times are measured since the report was created.
+     *
+     * @param[in] format Output format
+     * @return Formatted report
+     */
+    std::string Format( OutputFormat format ) const;
+
+    /**
+     * Formats the recorded trace events in the Trace Event Format (JSON) used by chrome://tracing and Perfetto.
+     *
+     * @return Formatted trace
+     */
+    std::string FormatTrace() const;
+
+    /**
+     * Returns the current wall-clock time, in nanoseconds since an arbitrary epoch.
+     */
+    static uint64_t GetWallTime() noexcept
+    {
+        return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          std::chrono::steady_clock::now().time_since_epoch() ).count() );
+    }
+
+    /**
+     * Returns the CPU time consumed by the calling thread, in nanoseconds.
+     */
+    static uint64_t GetThreadCpuTime() noexcept
+    {
+#ifdef WIN32
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        GetThreadTimes( GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime );
+        return ( ( ( static_cast<uint64_t>( kernelTime.dwHighDateTime ) << 32 ) | kernelTime.dwLowDateTime ) +
+                 ( ( static_cast<uint64_t>( userTime.dwHighDateTime ) << 32 ) | userTime.dwLowDateTime ) ) * 100;
+#else
+        struct timespec time;
+        clock_gettime( CLOCK_THREAD_CPUTIME_ID, &time );
+        return ( static_cast<uint64_t>( time.tv_sec ) * 1000000000 ) + static_cast<uint64_t>( time.tv_nsec );
+#endif
+    }
+
+private:
+    struct PhaseTimes
+    {
+        std::atomic<uint64_t> calls { 0 };
+        std::atomic<uint64_t> wallTime { 0 };
+        std::atomic<uint64_t> cpuTime { 0 };
+    };
+
+    struct TraceEvent
+    {
+        Phase phase;
+        std::string label;
+        uint64_t startWallTime;
+        uint64_t endWallTime;
+    };
+
+    // Events are recorded in a buffer for each thread, so that threads do not contend while tracing
+    struct TraceBuffer
+    {
+        unsigned int threadId;
+        std::vector<TraceEvent> events;
+    };
+
+    PhaseTimes m_phases[ static_cast<size_t>( Phase::NUM_PHASES ) ];
+    std::atomic<uint64_t> m_counters[ static_cast<size_t>( Counter::NUM_COUNTERS ) ] = {};
+    uint64_t m_startWallTime;
+    uint64_t m_startCpuTime;
+    uint64_t m_id;
+    bool m_tracing = false;
+    mutable std::mutex m_traceMutex;
+    std::vector<std::unique_ptr<TraceBuffer>> m_traceBuffers;
+
+    static inline std::atomic<TimeReport*> s_active { nullptr };
+};
+
+#endif // header guard
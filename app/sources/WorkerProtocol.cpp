@@ -0,0 +1,383 @@
+/**
+ * @file
+ * @brief      Implementation of WorkerProtocol class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "WorkerProtocol.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+
+/**
+ * Minimal reader of JSON values, which only supports the features needed to parse worker requests.
+ */
+class JsonReader
+{
+public:
+    JsonReader( const std::string &text ) noexcept
+    : m_text( text ), m_pos( 0 )
+    {
+    }
+
+    void SkipWhitespace() noexcept
+    {
+        while( ( m_pos < m_text.size() ) &&
+               ( ( m_text[m_pos] == ' ' ) || ( m_text[m_pos] == '\t' ) || ( m_text[m_pos] == '\r' ) || ( m_text[m_pos] == '\n' ) ) )
+        {
+            m_pos++;
+        }
+    }
+
+    bool AtEnd() noexcept
+    {
+        SkipWhitespace();
+        return ( m_pos >= m_text.size() );
+    }
+
+    char Peek()
+    {
+        SkipWhitespace();
+        if( m_pos >= m_text.size() )
+        {
+            throw std::runtime_error( "Unexpected end of request." );
+        }
+        return m_text[m_pos];
+    }
+
+    void Expect( char c )
+    {
+        if( Peek() != c )
+        {
+            Error( std::string( "'" ) + c + "' expected" );
+        }
+        m_pos++;
+    }
+
+    bool Accept( char c )
+    {
+        if( Peek() == c )
+        {
+            m_pos++;
+            return true;
+        }
+        return false;
+    }
+
+    std::string ReadString()
+    {
+        Expect( '"' );
+
+        std::string ret;
+        while( true )
+        {
+            if( m_pos >= m_text.size() )
+            {
+                throw std::runtime_error( "Unexpected end of request." );
+            }
+
+            char c = m_text[m_pos++];
+            if( c == '"' )
+            {
+                break;
+            }
+            else if( c != '\\' )
+            {
+                ret += c;
+            }
+            else if( m_pos < m_text.size() )
+            {
+                c = m_text[m_pos++];
+                switch( c )
+                {
+                    case '"':
+                    case '\\':
+                    case '/':
+                        ret += c;
+                        break;
+                    case 'b':
+                        ret += '\b';
+                        break;
+                    case 'f':
+                        ret += '\f';
+                        break;
+                    case 'n':
+                        ret += '\n';
+                        break;
+                    case 'r':
+                        ret += '\r';
+                        break;
+                    case 't':
+                        ret += '\t';
+                        break;
+                    case 'u':
+                        AppendUtf8( ret, ReadCodePoint() );
+                        break;
+                    default:
+                        Error( "Invalid escape sequence" );
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    long long ReadInteger()
+    {
+        SkipWhitespace();
+
+        size_t startPos = m_pos;
+        if( ( m_pos < m_text.size() ) && ( m_text[m_pos] == '-' ) )
+        {
+            m_pos++;
+        }
+        while( ( m_pos < m_text.size() ) && ( m_text[m_pos] >= '0' ) && ( m_text[m_pos] <= '9' ) )
+        {
+            m_pos++;
+        }
+
+        std::string number = m_text.substr( startPos, m_pos - startPos );
+        if( number.empty() || ( number == "-" ) )
+        {
+            Error( "Integer expected" );
+        }
+
+        return std::stoll( number );
+    }
+
+    void SkipValue()
+    {
+        char c = Peek();
+        if( c == '"' )
+        {
+            ReadString();
+        }
+        else if( ( c == '{' ) || ( c == '[' ) )
+        {
+            char end = ( c == '{' ) ? '}' : ']';
+            m_pos++;
+            if( !Accept( end ) )
+            {
+                do
+                {
+                    if( c == '{' )
+                    {
+                        ReadString();
+                        Expect( ':' );
+                    }
+                    SkipValue();
+                } while( Accept( ',' ) );
+                Expect( end );
+            }
+        }
+        else
+        {
+            // Numbers and literals (true, false, null)
+            size_t startPos = m_pos;
+            while( ( m_pos < m_text.size() ) && ( std::string( ",}] \t\r\n" ).find( m_text[m_pos] ) == std::string::npos ) )
+            {
+                m_pos++;
+            }
+            if( m_pos == startPos )
+            {
+                Error( "Value expected" );
+            }
+        }
+    }
+
+    [[noreturn]] void Error( const std::string &msg )
+    {
+        throw std::runtime_error( msg + " at position " + std::to_string( m_pos + 1 ) + " of request." );
+    }
+
+private:
+    unsigned int ReadHexQuad()
+    {
+        if( ( m_pos + 4 ) > m_text.size() )
+        {
+            Error( "Invalid unicode escape sequence" );
+        }
+
+        unsigned int value = 0;
+        for( size_t i = 0; i < 4; i++ )
+        {
+            char c = m_text[m_pos++];
+            value <<= 4;
+            if( ( c >= '0' ) && ( c <= '9' ) )
+            {
+                value |= static_cast<unsigned int>( c - '0' );
+            }
+            else if( ( c >= 'a' ) && ( c <= 'f' ) )
+            {
+                value |= static_cast<unsigned int>( c - 'a' + 10 );
+            }
+            else if( ( c >= 'A' ) && ( c <= 'F' ) )
+            {
+                value |= static_cast<unsigned int>( c - 'A' + 10 );
+            }
+            else
+            {
+                Error( "Invalid unicode escape sequence" );
+            }
+        }
+
+        return value;
+    }
+
+    unsigned int ReadCodePoint()
+    {
+        unsigned int codePoint = ReadHexQuad();
+
+        // Characters outside the basic multilingual plane are encoded as surrogate pairs, and surrogates cannot be
+        // encoded on their own
+        if( ( codePoint >= 0xDC00 ) && ( codePoint <= 0xDFFF ) )
+        {
+            Error( "Unpaired surrogate in unicode escape sequence" );
+        }
+        else if( ( codePoint >= 0xD800 ) && ( codePoint <= 0xDBFF ) )
+        {
+            if( m_text.compare( m_pos, 2, "\\u" ) != 0 )
+            {
+                Error( "Unpaired surrogate in unicode escape sequence" );
+            }
+
+            m_pos += 2;
+            unsigned int lowSurrogate = ReadHexQuad();
+            if( ( lowSurrogate < 0xDC00 ) || ( lowSurrogate > 0xDFFF ) )
+            {
+                Error( "Unpaired surrogate in unicode escape sequence" );
+            }
+
+            codePoint = 0x10000 + ( ( codePoint - 0xD800 ) << 10 ) + ( lowSurrogate - 0xDC00 );
+        }
+
+        return codePoint;
+    }
+
+    static void AppendUtf8( std::string &str, unsigned int codePoint )
+    {
+        if( codePoint < 0x80 )
+        {
+            str += static_cast<char>( codePoint );
+        }
+        else if( codePoint < 0x800 )
+        {
+            str += static_cast<char>( 0xC0 | ( codePoint >> 6 ) );
+            str += static_cast<char>( 0x80 | ( codePoint & 0x3F ) );
+        }
+        else if( codePoint < 0x10000 )
+        {
+            str += static_cast<char>( 0xE0 | ( codePoint >> 12 ) );
+            str += static_cast<char>( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+            str += static_cast<char>( 0x80 | ( codePoint & 0x3F ) );
+        }
+        else
+        {
+            str += static_cast<char>( 0xF0 | ( codePoint >> 18 ) );
+            str += static_cast<char>( 0x80 | ( ( codePoint >> 12 ) & 0x3F ) );
+            str += static_cast<char>( 0x80 | ( ( codePoint >> 6 ) & 0x3F ) );
+            str += static_cast<char>( 0x80 | ( codePoint & 0x3F ) );
+        }
+    }
+
+    const std::string &m_text;
+    size_t m_pos;
+};
+
+static std::string QuoteString( const std::string &str )
+{
+    std::string ret = "\"";
+
+    for( char c : str )
+    {
+        switch( c )
+        {
+            case '"':
+                ret += "\\\"";
+                break;
+            case '\\':
+                ret += "\\\\";
+                break;
+            case '\n':
+                ret += "\\n";
+                break;
+            case '\r':
+                ret += "\\r";
+                break;
+            case '\t':
+                ret += "\\t";
+                break;
+            default:
+                if( static_cast<unsigned char>( c ) < 0x20 )
+                {
+                    char escaped[7];
+                    std::snprintf( escaped, sizeof( escaped ), "\\u%04x", static_cast<unsigned int>( c ) );
+                    ret += escaped;
+                }
+                else
+                {
+                    ret += c;
+                }
+                break;
+        }
+    }
+
+    ret += "\"";
+    return ret;
+}
+
+WorkerProtocol::Request WorkerProtocol::ParseRequest( const std::string &line )
+{
+    Request request = { {}, 0 };
+
+    JsonReader reader( line );
+
+    reader.Expect( '{' );
+    if( !reader.Accept( '}' ) )
+    {
+        do
+        {
+            std::string key = reader.ReadString();
+            reader.Expect( ':' );
+
+            if( key == "arguments" )
+            {
+                reader.Expect( '[' );
+                if( !reader.Accept( ']' ) )
+                {
+                    do
+                    {
+                        request.arguments.push_back( reader.ReadString() );
+                    } while( reader.Accept( ',' ) );
+                    reader.Expect( ']' );
+                }
+            }
+            else if( key == "requestId" )
+            {
+                request.requestId = reader.ReadInteger();
+            }
+            else
+            {
+                reader.SkipValue();
+            }
+        } while( reader.Accept( ',' ) );
+        reader.Expect( '}' );
+    }
+
+    if( !reader.AtEnd() )
+    {
+        reader.Error( "Unexpected characters" );
+    }
+
+    return request;
+}
+
+std::string WorkerProtocol::FormatResponse( const Response &response )
+{
+    return "{\"exitCode\": " + std::to_string( response.exitCode ) +
+           ", \"output\": " + QuoteString( response.output ) +
+           ", \"requestId\": " + std::to_string( response.requestId ) + "}";
+}
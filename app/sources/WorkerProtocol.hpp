@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @brief      Header of WorkerProtocol class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_WORKERPROTOCOL_HPP_
+#define CPPUMOCKGEN_WORKERPROTOCOL_HPP_
+
+#include <string>
+#include <vector>
+
+/**
+ * Class that implements the messages exchanged with build systems in persistent worker mode.
+ *
+ * Each request and response is a JSON object written in a single line, following the JSON variant of the persistent
+ * worker protocol used by Bazel:
+ *
+ *     {"arguments": ["-m", "mocks/", "foo.h"], "requestId": 1}
+ *     {"exitCode": 0, "output": "SUCCESS: Mock generated into 'mocks/foo_mock.cpp'\n", "requestId": 1}
+ *
+ * Unknown fields in requests are ignored.
+ */
+class WorkerProtocol
+{
+public:
+    /**
+     * Generation request.
+     */
+    struct Request
+    {
+        std::vector<std::string> arguments;  ///< Command-line arguments
+        long long requestId;                 ///< Identifier to be echoed back in the response
+    };
+
+    /**
+     * Result of a generation request.
+     */
+    struct Response
+    {
+        int exitCode;           ///< Exit code of the generation
+        std::string output;     ///< Console output and diagnostics
+        long long requestId;    ///< Identifier of the request
+    };
+
+    /**
+     * Parses a request.
+     *
+     * @param[in] line Line containing the request JSON object
+     * @return Parsed request
+     * @throws std::runtime_error If the request is malformed
+     */
+    static Request ParseRequest( const std::string &line );
+
+    /**
+     * Formats a response.
+     *
+     * @param[in] response Response to be formatted
+     * @return Line containing the response JSON object (without line terminator)
+     */
+    static std::string FormatResponse( const Response &response );
+};
+
+#endif // header guard
@@ -0,0 +1,128 @@
+/**
+ * @file
+ * @brief      Implementation of the benchmark harness
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "Benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+//*************************************************************************************************
+//                                       ALLOCATION COUNTING
+//*************************************************************************************************
+
+static std::atomic<size_t> allocationCount( 0 );
+static std::atomic<size_t> allocationBytes( 0 );
+
+void* operator new( size_t size )
+{
+    allocationCount.fetch_add( 1, std::memory_order_relaxed );
+    allocationBytes.fetch_add( size, std::memory_order_relaxed );
+
+    void *ptr = std::malloc( ( size > 0 ) ? size : 1 );
+    if( ptr == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[]( size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void *ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void *ptr ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete( void *ptr, size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete[]( void *ptr, size_t ) noexcept
+{
+    std::free( ptr );
+}
+
+//*************************************************************************************************
+//                                         BENCHMARK RUNNING
+//*************************************************************************************************
+
+// Minimum time during which each operation is repeated
+static const std::chrono::nanoseconds minRunTime = std::chrono::milliseconds( 500 );
+
+static Benchmark *firstBenchmark = nullptr;
+static Benchmark **lastBenchmark = &firstBenchmark;
+
+Benchmark::Benchmark( const char *group, const char *name, void (*body)( Benchmark & ) ) noexcept
+: m_group( group ), m_name( name ), m_body( body ), m_next( nullptr )
+{
+    // Benchmarks are run in order of definition
+    *lastBenchmark = this;
+    lastBenchmark = &m_next;
+}
+
+std::string Benchmark::GetFullName() const
+{
+    return std::string( m_group ) + "." + m_name;
+}
+
+void Benchmark::Run( const std::function<void()> &operation, size_t itemsPerOperation )
+{
+    // Warm-up, so that lazy initializations and buffers that are reused do not count
+    operation();
+
+    size_t numOperations = 0;
+    size_t initialAllocationCount = allocationCount.load();
+    size_t initialAllocationBytes = allocationBytes.load();
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::chrono::nanoseconds elapsedTime;
+
+    do
+    {
+        operation();
+        numOperations++;
+        elapsedTime = std::chrono::steady_clock::now() - startTime;
+    }
+    while( elapsedTime < minRunTime );
+
+    double numItems = static_cast<double>( numOperations * itemsPerOperation );
+
+    std::printf( "%-48s %12.1f ns/item %10.2f allocs/item %12.1f bytes/item\n", GetFullName().c_str(),
+                 ( elapsedTime.count() / numItems ),
+                 ( ( allocationCount.load() - initialAllocationCount ) / numItems ),
+                 ( ( allocationBytes.load() - initialAllocationBytes ) / numItems ) );
+    std::fflush( stdout );
+}
+
+size_t Benchmark::RunAll( const std::string &filter )
+{
+    size_t numBenchmarks = 0;
+
+    for( Benchmark *benchmark = firstBenchmark; benchmark != nullptr; benchmark = benchmark->m_next )
+    {
+        if( benchmark->GetFullName().find( filter ) != std::string::npos )
+        {
+            benchmark->m_body( *benchmark );
+            numBenchmarks++;
+        }
+    }
+
+    return numBenchmarks;
+}
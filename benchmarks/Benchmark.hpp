@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @brief      Header of the benchmark harness
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_BENCHMARK_HPP_
+#define CPPUMOCKGEN_BENCHMARK_HPP_
+
+#include <string>
+#include <functional>
+
+/**
+ * Class used to run a benchmark.
+ *
+ * Each benchmark prepares its inputs and then calls Run() with the operation to be measured, which is repeated until
+ * enough time has elapsed to get stable measurements. The elapsed time, the number of memory allocations and the
+ * number of allocated bytes per item processed by the operation are reported.
+ */
+class Benchmark
+{
+public:
+    /**
+     * Constructor, which registers the benchmark.
+     *
+     * @param[in] group Name of the group of the benchmark
+     * @param[in] name Name of the benchmark
+     * @param[in] body Function that prepares and runs the benchmark
+     */
+    Benchmark( const char *group, const char *name, void (*body)( Benchmark & ) ) noexcept;
+
+    /**
+     * Measures an operation.
+     *
+     * @param[in] operation Operation to be measured
+     * @param[in] itemsPerOperation Number of items processed by each execution of the operation (e.g., functions)
+     */
+    void Run( const std::function<void()> &operation, size_t itemsPerOperation = 1 );
+
+    /**
+     * Runs the registered benchmarks whose full name (i.e., "group.name") contains @p filter.
+     *
+     * @return Number of benchmarks run
+     */
+    static size_t RunAll( const std::string &filter );
+
+private:
+    std::string GetFullName() const;
+
+    const char *m_group;
+    const char *m_name;
+    void (*m_body)( Benchmark & );
+    Benchmark *m_next;
+};
+
+/**
+ * Defines a benchmark, which is registered automatically.
+ */
+#define BENCHMARK( group, name ) \
+    static void Benchmark_##group##_##name( Benchmark &benchmark ); \
+    static Benchmark Benchmark_##group##_##name##_instance( #group, #name, Benchmark_##group##_##name ); \
+    static void Benchmark_##group##_##name( Benchmark &benchmark )
+
+#endif // header guard
@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @brief      Implementation of the inputs shared by the benchmarks
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include "BenchmarkInputs.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+static const char *typeDeclarations = "typedef unsigned int u32;\n"
+                                      "typedef struct Point { int x; int y; } Point;\n"
+                                      "enum Color { RED, GREEN, BLUE };\n";
+
+// Representative function declarations of a C header, where "%zu" is replaced by a unique number
+static const char *functionTemplates[] =
+{
+    "int register_read_%zu(u32 address);",
+    "void register_write_%zu(u32 address, u32 value);",
+    "const char *device_name_%zu(int index);",
+    "int point_get_%zu(const Point *point, Point *result);",
+    "void buffer_fill_%zu(const unsigned char *buffer, unsigned long size, double factor);",
+    "enum Color color_next_%zu(enum Color color, _Bool wrap, short *count);",
+};
+
+// Representative parameter types, cycled through for functions with many parameters
+static const char *parameterTypes[] =
+{
+    "int",
+    "u32",
+    "const char *",
+    "const Point *",
+    "Point *",
+    "unsigned long",
+    "double",
+    "enum Color",
+    "void *",
+    "short *",
+};
+
+std::string GenerateCHeader( size_t numFunctions )
+{
+    std::string header = typeDeclarations;
+
+    char declaration[256];
+    for( size_t i = 0; i < numFunctions; i++ )
+    {
+        const char *functionTemplate = functionTemplates[ i % ( sizeof( functionTemplates ) / sizeof( functionTemplates[0] ) ) ];
+        std::snprintf( declaration, sizeof( declaration ), functionTemplate, i );
+        header += declaration;
+        header += '\n';
+    }
+
+    return header;
+}
+
+std::string GenerateCHeaderWithManyParameters( size_t numFunctions, size_t numParameters )
+{
+    std::string header = typeDeclarations;
+
+    for( size_t i = 0; i < numFunctions; i++ )
+    {
+        header += "int function_" + std::to_string( i ) + "(";
+        for( size_t j = 0; j < numParameters; j++ )
+        {
+            const char *parameterType = parameterTypes[ ( i + j ) % ( sizeof( parameterTypes ) / sizeof( parameterTypes[0] ) ) ];
+            header += ( j > 0 ) ? ", " : "";
+            header += parameterType;
+            header += " p" + std::to_string( j );
+        }
+        header += ");\n";
+    }
+
+    return header;
+}
+
+std::filesystem::path WriteBenchmarkFile( const std::string &filename, const std::string &contents )
+{
+    std::filesystem::path dirPath = std::filesystem::temp_directory_path() / "CppUMockGen_benchmarks";
+    std::filesystem::create_directories( dirPath );
+
+    std::filesystem::path filePath = dirPath / filename;
+    std::ofstream file( filePath, std::ios::binary | std::ios::trunc );
+    file << contents;
+    if( !file )
+    {
+        AbortBenchmarks( "Benchmark file '" + filePath.generic_string() + "' could not be written" );
+    }
+
+    return filePath;
+}
+
+void AbortBenchmarks( const std::string &msg )
+{
+    std::fprintf( stderr, "%s\n", msg.c_str() );
+    std::exit( 1 );
+}
@@ -0,0 +1,50 @@
+/**
+ * @file
+ * @brief      Header of the inputs shared by the benchmarks
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#ifndef CPPUMOCKGEN_BENCHMARKINPUTS_HPP_
+#define CPPUMOCKGEN_BENCHMARKINPUTS_HPP_
+
+#include <string>
+#include <filesystem>
+
+/**
+ * Generates a representative C header, with type declarations followed by function declarations with a mix of
+ * return and parameter types.
+ *
+ * @param[in] numFunctions Number of functions declared
+ * @return Contents of the header
+ */
+std::string GenerateCHeader( size_t numFunctions );
+
+/**
+ * Generates a C header with functions that have many parameters of different types.
+ *
+ * @param[in] numFunctions Number of functions declared
+ * @param[in] numParameters Number of parameters of each function
+ * @return Contents of the header
+ */
+std::string GenerateCHeaderWithManyParameters( size_t numFunctions, size_t numParameters );
+
+/**
+ * Writes a file into the temporary directory used by the benchmarks.
+ *
+ * @param[in] filename Name of the file
+ * @param[in] contents Contents of the file
+ * @return Path of the file
+ */
+std::filesystem::path WriteBenchmarkFile( const std::string &filename, const std::string &contents );
+
+/**
+ * Aborts the benchmarks, when the inputs of a benchmark cannot be prepared.
+ *
+ * @param[in] msg Error message
+ */
+[[noreturn]] void AbortBenchmarks( const std::string &msg );
+
+#endif // header guard
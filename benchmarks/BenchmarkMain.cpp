@@ -0,0 +1,27 @@
+/**
+ * @file
+ * @brief      Main function of the benchmarks
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include <cstdio>
+#include <string>
+
+#include "Benchmark.hpp"
+
+int main( int argc, char* argv[] )
+{
+    // Optional argument: Only run the benchmarks whose name contains the given text
+    std::string filter = ( argc > 1 ) ? argv[1] : "";
+
+    if( Benchmark::RunAll( filter ) == 0 )
+    {
+        std::fprintf( stderr, "No benchmarks match '%s'\n", filter.c_str() );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file
+ * @brief      Benchmarks for the "Config" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.hpp"
+#include "BenchmarkInputs.hpp"
+#include "Config.hpp"
+
+//*************************************************************************************************
+//                                             INPUTS
+//*************************************************************************************************
+
+static const size_t numOverridesPerKind = 100;
+
+// Function-specific, generic and pattern overrides, as found in configuration files of big projects
+static std::vector<std::string> GenerateTypeOverrides()
+{
+    std::vector<std::string> typeOverrides;
+
+    for( size_t i = 0; i < numOverridesPerKind; i++ )
+    {
+        std::string index = std::to_string( i );
+        typeOverrides.push_back( "device_read_" + index + "#buffer=MemoryBuffer:$|size" );
+        typeOverrides.push_back( "#const Type" + index + " *=ConstPointer" );
+        typeOverrides.push_back( "%module" + index + "_*#handle=Pointer" );
+    }
+
+    return typeOverrides;
+}
+
+static std::vector<std::string> GenerateKeys( const char *prefix, const char *suffix )
+{
+    std::vector<std::string> keys;
+
+    for( size_t i = 0; i < numOverridesPerKind; i++ )
+    {
+        keys.push_back( prefix + std::to_string( i ) + suffix );
+    }
+
+    return keys;
+}
+
+static void LookupKeys( Benchmark &benchmark, const std::vector<std::string> &keys, bool found )
+{
+    Config config( false, "", false, GenerateTypeOverrides(), std::vector<std::string>() );
+
+    // Keys are checked beforehand, so that each benchmark measures the kind of lookup that it intends to
+    for( const std::string &key : keys )
+    {
+        if( ( config.GetTypeOverride( key ) != nullptr ) != found )
+        {
+            AbortBenchmarks( "Unexpected result looking up type override '" + key + "'" );
+        }
+    }
+
+    benchmark.Run( [&]()
+    {
+        for( const std::string &key : keys )
+        {
+            config.GetTypeOverride( key );
+        }
+    }, keys.size() );
+}
+
+//*************************************************************************************************
+//                                           BENCHMARKS
+//*************************************************************************************************
+
+/*
+ * Configuration constructed from type override options (i.e., override map construction).
+ */
+BENCHMARK( Config, ConstructOverrideMap )
+{
+    std::vector<std::string> typeOverrides = GenerateTypeOverrides();
+    std::vector<std::string> typeMap;
+
+    benchmark.Run( [&]()
+    {
+        Config config( false, "", false, typeOverrides, typeMap );
+    }, typeOverrides.size() );
+}
+
+/*
+ * Type override lookups of function-specific keys found by exact identifier.
+ */
+BENCHMARK( Config, LookupExactKey )
+{
+    LookupKeys( benchmark, GenerateKeys( "device_read_", "#buffer" ), true );
+}
+
+/*
+ * Type override lookups of generic keys found by exact identifier.
+ */
+BENCHMARK( Config, LookupGenericKey )
+{
+    LookupKeys( benchmark, GenerateKeys( "#const Type", " *" ), true );
+}
+
+/*
+ * Type override lookups of function-specific keys matched by a pattern.
+ */
+BENCHMARK( Config, LookupPatternKey )
+{
+    LookupKeys( benchmark, GenerateKeys( "module", "_open#handle" ), true );
+}
+
+/*
+ * Type override lookups of keys without override, which is the most frequent case.
+ */
+BENCHMARK( Config, LookupMissingKey )
+{
+    LookupKeys( benchmark, GenerateKeys( "other_function_", "#value" ), false );
+}
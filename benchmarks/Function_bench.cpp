@@ -0,0 +1,251 @@
+/**
+ * @file
+ * @brief      Benchmarks for the "Function" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <clang-c/Index.h>
+
+#include "Benchmark.hpp"
+#include "BenchmarkInputs.hpp"
+#include "Function.hpp"
+#include "Config.hpp"
+#include "SimpleCParser.hpp"
+#include "CodeEmitter.hpp"
+
+//*************************************************************************************************
+//                                             INPUTS
+//*************************************************************************************************
+
+static const size_t numFunctions = 1000;
+static const size_t numParameters = 8;
+
+static const std::vector<std::string> typeOverrides =
+{
+    "#const char *=String",
+    "#const Point *=ConstPointer",
+    "#Point *=Output",
+    "function_*#p0=LongInt",
+};
+
+static std::vector<SimpleCParser::FunctionDecl> ParseDeclarations( const std::string &header )
+{
+    SimpleCParser parser;
+    if( !parser.Parse( header ) )
+    {
+        AbortBenchmarks( "Benchmark header could not be parsed" );
+    }
+
+    return parser.GetFunctions();
+}
+
+static std::vector<std::unique_ptr<const Function>> ParseFunctions()
+{
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    std::vector<std::unique_ptr<const Function>> functions;
+    for( const SimpleCParser::FunctionDecl &declaration : ParseDeclarations( GenerateCHeader( numFunctions ) ) )
+    {
+        std::unique_ptr<Function> function( new Function );
+        if( function->Parse( declaration, config ) )
+        {
+            functions.emplace_back( function.release() );
+        }
+    }
+
+    return functions;
+}
+
+//*************************************************************************************************
+//                                           BENCHMARKS
+//*************************************************************************************************
+
+/*
+ * Functions parsed from declarations of a C header parsed without libclang.
+ */
+BENCHMARK( Function, ParseSimpleC )
+{
+    std::vector<SimpleCParser::FunctionDecl> declarations = ParseDeclarations( GenerateCHeader( numFunctions ) );
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    benchmark.Run( [&]()
+    {
+        Function::TypeCache typeCache;
+        for( const SimpleCParser::FunctionDecl &declaration : declarations )
+        {
+            Function function;
+            function.Parse( declaration, config );
+        }
+    }, declarations.size() );
+}
+
+/*
+ * Functions parsed from the cursors of a translation unit parsed by libclang (the translation unit is parsed only
+ * once).
+ */
+BENCHMARK( Function, ParseClang )
+{
+    std::string header = GenerateCHeader( numFunctions );
+    const char *headerFilename = "benchmark.h";
+    CXUnsavedFile unsavedFile = { headerFilename, header.c_str(), (unsigned long) header.size() };
+    const char *clangOpts[] = { "-xc" };
+
+    CXIndex index = clang_createIndex( 0, 0 );
+    CXTranslationUnit tu;
+    if( clang_parseTranslationUnit2( index, headerFilename, clangOpts, 1, &unsavedFile, 1, CXTranslationUnit_None, &tu ) != CXError_Success )
+    {
+        AbortBenchmarks( "Benchmark header could not be parsed by libclang" );
+    }
+
+    std::vector<CXCursor> cursors;
+    clang_visitChildren(
+        clang_getTranslationUnitCursor( tu ),
+        []( CXCursor cursor, CXCursor, CXClientData clientData )
+        {
+            if( clang_getCursorKind( cursor ) == CXCursor_FunctionDecl )
+            {
+                static_cast<std::vector<CXCursor>*>( clientData )->push_back( cursor );
+            }
+            return CXChildVisit_Continue;
+        },
+        &cursors );
+
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    benchmark.Run( [&]()
+    {
+        Function::TypeCache typeCache;
+        for( const CXCursor &cursor : cursors )
+        {
+            Function function;
+            function.Parse( cursor, config );
+        }
+    }, cursors.size() );
+
+    clang_disposeTranslationUnit( tu );
+    clang_disposeIndex( index );
+}
+
+/*
+ * Parameters of functions with many parameters processed into arguments, without type overrides.
+ */
+BENCHMARK( Function, ProcessArguments )
+{
+    std::vector<SimpleCParser::FunctionDecl> declarations =
+            ParseDeclarations( GenerateCHeaderWithManyParameters( numFunctions, numParameters ) );
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    benchmark.Run( [&]()
+    {
+        Function::TypeCache typeCache;
+        for( const SimpleCParser::FunctionDecl &declaration : declarations )
+        {
+            Function function;
+            function.Parse( declaration, config );
+        }
+    }, declarations.size() * numParameters );
+}
+
+/*
+ * Parameters of functions with many parameters processed into arguments, with generic and function-specific type
+ * overrides.
+ */
+BENCHMARK( Function, ProcessArgumentsWithOverrides )
+{
+    std::vector<SimpleCParser::FunctionDecl> declarations =
+            ParseDeclarations( GenerateCHeaderWithManyParameters( numFunctions, numParameters ) );
+    Config config( false, "", false, typeOverrides, std::vector<std::string>() );
+
+    benchmark.Run( [&]()
+    {
+        Function::TypeCache typeCache;
+        for( const SimpleCParser::FunctionDecl &declaration : declarations )
+        {
+            Function function;
+            function.Parse( declaration, config );
+        }
+    }, declarations.size() * numParameters );
+}
+
+/*
+ * Mocks generated into strings returned by value and written to a string stream.
+ */
+BENCHMARK( Function, GenerateMockToString )
+{
+    std::vector<std::unique_ptr<const Function>> functions = ParseFunctions();
+
+    benchmark.Run( [&]()
+    {
+        std::ostringstream output;
+        for( const std::unique_ptr<const Function> &function : functions )
+        {
+            output << function->GenerateMock() << std::endl;
+        }
+    }, functions.size() );
+}
+
+/*
+ * Mocks generated into a reused emitter.
+ */
+BENCHMARK( Function, GenerateMockToEmitter )
+{
+    std::vector<std::unique_ptr<const Function>> functions = ParseFunctions();
+    CodeEmitter emitter;
+
+    benchmark.Run( [&]()
+    {
+        emitter.Clear();
+        for( const std::unique_ptr<const Function> &function : functions )
+        {
+            function->GenerateMock( emitter );
+            emitter << '\n';
+        }
+    }, functions.size() );
+}
+
+/*
+ * Expectation prototypes and implementations generated into strings returned by value and written to a string stream.
+ */
+BENCHMARK( Function, GenerateExpectationToString )
+{
+    std::vector<std::unique_ptr<const Function>> functions = ParseFunctions();
+
+    benchmark.Run( [&]()
+    {
+        std::ostringstream output;
+        for( const std::unique_ptr<const Function> &function : functions )
+        {
+            output << function->GenerateExpectation( true ) << std::endl;
+            output << function->GenerateExpectation( false ) << std::endl;
+        }
+    }, functions.size() );
+}
+
+/*
+ * Expectation prototypes and implementations generated into a reused emitter.
+ */
+BENCHMARK( Function, GenerateExpectationToEmitter )
+{
+    std::vector<std::unique_ptr<const Function>> functions = ParseFunctions();
+    CodeEmitter emitter;
+
+    benchmark.Run( [&]()
+    {
+        emitter.Clear();
+        for( const std::unique_ptr<const Function> &function : functions )
+        {
+            function->GenerateExpectation( true, emitter );
+            emitter << '\n';
+            function->GenerateExpectation( false, emitter );
+            emitter << '\n';
+        }
+    }, functions.size() );
+}
@@ -0,0 +1,75 @@
+/**
+ * @file
+ * @brief      Benchmarks for the "OutputFileParser" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "Benchmark.hpp"
+#include "BenchmarkInputs.hpp"
+#include "OutputFileParser.hpp"
+#include "Parser.hpp"
+#include "Config.hpp"
+
+//*************************************************************************************************
+//                                             INPUTS
+//*************************************************************************************************
+
+static const size_t numFunctions = 1000;
+static const size_t numUserCodeLines = 50;
+
+// Mock output file as generated for a representative header, with generation options and user code
+static std::string GenerateMockOutput()
+{
+    std::filesystem::path headerPath = WriteBenchmarkFile( "output_benchmark.h", GenerateCHeader( numFunctions ) );
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    Parser parser;
+    std::ostringstream error;
+    if( !parser.Parse( headerPath, config, false, std::vector<std::string>(), std::vector<std::string>(), error ) )
+    {
+        AbortBenchmarks( "Benchmark header could not be parsed:\n" + error.str() );
+    }
+
+    std::string userCode;
+    for( size_t i = 0; i < numUserCodeLines; i++ )
+    {
+        userCode += "static int userVariable" + std::to_string( i ) + " = 0;\n";
+    }
+
+    std::ostringstream output;
+    parser.GenerateMock( "-t \"#const char *=String\"", userCode, headerPath.parent_path(), output );
+    return output.str();
+}
+
+//*************************************************************************************************
+//                                           BENCHMARKS
+//*************************************************************************************************
+
+/*
+ * Previously generated mock output file parsed to get its user code and generation options.
+ */
+BENCHMARK( OutputFileParser, Parse )
+{
+    std::string mockOutput = GenerateMockOutput();
+    std::filesystem::path mockOutputPath = WriteBenchmarkFile( "output_benchmark_mock.cpp", mockOutput );
+    size_t numLines = std::count( mockOutput.begin(), mockOutput.end(), '\n' );
+
+    benchmark.Run( [&]()
+    {
+        OutputFileParser outputFileParser;
+        outputFileParser.Parse( mockOutputPath );
+        if( outputFileParser.GetUserCode().empty() )
+        {
+            AbortBenchmarks( "User code not found in benchmark output file" );
+        }
+    }, numLines );
+}
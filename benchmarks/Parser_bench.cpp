@@ -0,0 +1,104 @@
+/**
+ * @file
+ * @brief      Benchmarks for the "Parser" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "Benchmark.hpp"
+#include "BenchmarkInputs.hpp"
+#include "Parser.hpp"
+#include "Config.hpp"
+#include "CodeEmitter.hpp"
+
+//*************************************************************************************************
+//                                             INPUTS
+//*************************************************************************************************
+
+static const size_t numFunctions = 1000;
+
+static const std::vector<std::string> noIncludePaths;
+static const std::vector<std::string> noCompileArgs;
+
+static void ParseHeader( Benchmark &benchmark, Parser &parser )
+{
+    std::filesystem::path headerPath = WriteBenchmarkFile( "parser_benchmark.h", GenerateCHeader( numFunctions ) );
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    benchmark.Run( [&]()
+    {
+        std::ostringstream error;
+        if( !parser.Parse( headerPath, config, false, noIncludePaths, noCompileArgs, error ) )
+        {
+            AbortBenchmarks( "Benchmark header could not be parsed:\n" + error.str() );
+        }
+    }, numFunctions );
+}
+
+//*************************************************************************************************
+//                                           BENCHMARKS
+//*************************************************************************************************
+
+/*
+ * Header parsed by libclang, including the traversal of the translation unit and the parsing of the functions.
+ */
+BENCHMARK( Parser, Parse )
+{
+    Parser parser;
+    ParseHeader( benchmark, parser );
+}
+
+/*
+ * Header parsed by libclang skipping function bodies.
+ */
+BENCHMARK( Parser, ParseFast )
+{
+    Parser parser( false, true );
+    ParseHeader( benchmark, parser );
+}
+
+/*
+ * Header parsed without libclang, since it is simple enough.
+ */
+BENCHMARK( Parser, ParseSimpleC )
+{
+    Parser parser( false, false, false, true );
+    ParseHeader( benchmark, parser );
+}
+
+/*
+ * Mock and expectations of a parsed header generated in a single pass into reused emitters.
+ */
+BENCHMARK( Parser, Generate )
+{
+    std::filesystem::path headerPath = WriteBenchmarkFile( "parser_benchmark.h", GenerateCHeader( numFunctions ) );
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+    Parser parser;
+    std::ostringstream error;
+    if( !parser.Parse( headerPath, config, false, noIncludePaths, noCompileArgs, error ) )
+    {
+        AbortBenchmarks( "Benchmark header could not be parsed:\n" + error.str() );
+    }
+
+    CodeEmitter mockOutput;
+    CodeEmitter expectationHeaderOutput;
+    CodeEmitter expectationImplOutput;
+    Parser::Outputs outputs = { &mockOutput, &expectationHeaderOutput, &expectationImplOutput };
+    std::filesystem::path baseDirPath = headerPath.parent_path();
+
+    benchmark.Run( [&]()
+    {
+        mockOutput.Clear();
+        expectationHeaderOutput.Clear();
+        expectationImplOutput.Clear();
+        parser.Generate( "", "", baseDirPath, baseDirPath, baseDirPath / "parser_benchmark_expect.hpp", outputs );
+    }, numFunctions );
+}
@@ -0,0 +1,41 @@
+/**
+ * @file
+ * @brief      Benchmarks for the "SimpleCParser" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+#include <string>
+
+#include "Benchmark.hpp"
+#include "BenchmarkInputs.hpp"
+#include "SimpleCParser.hpp"
+
+//*************************************************************************************************
+//                                             INPUTS
+//*************************************************************************************************
+
+static const size_t numFunctions = 1000;
+
+//*************************************************************************************************
+//                                           BENCHMARKS
+//*************************************************************************************************
+
+/*
+ * Declarations of a C header parsed without libclang (the functions are not parsed into models).
+ */
+BENCHMARK( SimpleCParser, Parse )
+{
+    std::string header = GenerateCHeader( numFunctions );
+
+    benchmark.Run( [&]()
+    {
+        SimpleCParser parser;
+        if( !parser.Parse( header ) )
+        {
+            AbortBenchmarks( "Benchmark header could not be parsed" );
+        }
+    }, numFunctions );
+}
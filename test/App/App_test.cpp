@@ -24,6 +24,7 @@
 #include <sstream>
 #include <fstream>
 #include <filesystem>
+#include <chrono>
 
 #include "App.hpp"
 
@@ -31,6 +32,12 @@
 #include "ConsoleColorizer_expect.hpp"
 #include "Config_expect.hpp"
 #include "OutputFileParser_expect.hpp"
+#include "BatchFileParser_expect.hpp"
+#include "StampCache_expect.hpp"
+#include "DependencyFile_expect.hpp"
+#include "CompilationDatabase_expect.hpp"
+#include "FileWatcher_expect.hpp"
+#include "Prelude_expect.hpp"
 
 using CppUMockGen::IgnoreParameter;
 
@@ -67,6 +74,31 @@ public:
 
 StdVectorOfStringsComparator stdVectorOfStringsComparator;
 
+class StdVectorOfPathsComparator : public MockNamedValueComparator
+{
+public:
+    bool isEqual(const void* object1, const void* object2)
+    {
+        const std::vector<std::filesystem::path> *o1 = (const std::vector<std::filesystem::path>*) object1;
+        const std::vector<std::filesystem::path> *o2 = (const std::vector<std::filesystem::path>*) object2;
+
+        return (*o1) == (*o2);
+    }
+
+    SimpleString valueToString(const void* object)
+    {
+        SimpleString ret;
+        const std::vector<std::filesystem::path> *o = (const std::vector<std::filesystem::path>*) object;
+        for( unsigned int i = 0; i < o->size(); i++ )
+        {
+            ret += StringFromFormat("<%u>%s\n", i, (*o)[i].generic_string().c_str() );
+        }
+        return ret;
+    }
+};
+
+StdVectorOfPathsComparator stdVectorOfPathsComparator;
+
 class StdOstreamCopier : public MockNamedValueCopier
 {
 public:
@@ -78,6 +110,28 @@ public:
 
 StdOstreamCopier stdOstreamCopier;
 
+class StdStringCopier : public MockNamedValueCopier
+{
+public:
+    virtual void copy(void* out, const void* in)
+    {
+        *(std::string*)out = *(const std::string*)in;
+    }
+};
+
+StdStringCopier stdStringCopier;
+
+class StdVectorOfPathsCopier : public MockNamedValueCopier
+{
+public:
+    virtual void copy(void* out, const void* in)
+    {
+        *(std::vector<std::filesystem::path>*)out = *(const std::vector<std::filesystem::path>*)in;
+    }
+};
+
+StdVectorOfPathsCopier stdVectorOfPathsCopier;
+
 static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
 static const std::filesystem::path outDirPath = ( tempDirPath / "" );
 static const std::string inputFilename = "foo.h";
@@ -87,6 +141,8 @@ static const std::string expectationHeaderOutputFilename = "foo_expect.hpp";
 static const std::string expectationHeaderOutputFilePath = (outDirPath / expectationHeaderOutputFilename).generic_string();
 static const std::string expectationImplOutputFilename = "foo_expect.cpp";
 static const std::string expectationImplOutputFilePath = (outDirPath / expectationImplOutputFilename).generic_string();
+static const std::string mockDepFilePath = (outDirPath / "foo_mock.d").generic_string();
+static const std::string expectationDepFilePath = (outDirPath / "foo_expect.d").generic_string();
 
 static void CheckFileContains( const std::string &filepath, const std::string &contents )
 {
@@ -102,6 +158,9 @@ static void CheckFileContains( const std::string &filepath, const std::string &c
 }
 
 static const std::string EMPTY_STRING;
+static const std::vector<std::string> EMPTY_COMPILE_ARGS;
+static std::vector<std::string> EMPTY_PRELUDE_HEADERS;
+static std::vector<std::string> EMPTY_TYPE_MAP;
 
 /*===========================================================================
  *                          TEST GROUP DEFINITION
@@ -113,6 +172,8 @@ TEST_GROUP( App )
     std::string outputFilepath1;
     std::string outputFilepath2;
     std::string outputFilepath3;
+    std::string outputFilepath4;
+    std::string outputFilepath5;
 
     TEST_SETUP()
     {
@@ -135,6 +196,14 @@ TEST_GROUP( App )
         {
             std::filesystem::remove( outputFilepath3 );
         }
+        if( !outputFilepath4.empty() )
+        {
+            std::filesystem::remove( outputFilepath4 );
+        }
+        if( !outputFilepath5.empty() )
+        {
+            std::filesystem::remove( outputFilepath5 );
+        }
     }
 };
 
@@ -196,6 +265,132 @@ TEST( App, Version )
     STRCMP_EQUAL( "", error.str().c_str() );
 }
 
+/*
+ * Check that in worker mode requests are read from the input and responses are written to the output
+ */
+TEST( App, Worker_Requests )
+{
+    // Prepare
+    std::istringstream input( "\n"
+                              "{\"arguments\": [\"-v\"], \"requestId\": 1}\n"
+                              "not a request\n"
+                              "{\"arguments\": [\"--worker\"], \"requestId\": 2}\n" );
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( input, output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    expect::Options$::Options$ctor( 3 );
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::Parse( 2, IgnoreParameter::YES, 2, IgnoreParameter::YES );
+    expect::Options$::IsHelpRequested( 3, IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( 2, IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 4, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( "{\"exitCode\": 0, \"output\": \"CppUMockGenFoo vF.O.O\\n\", \"requestId\": 1}\n"
+                  "{\"exitCode\": 1, \"output\": \"ERROR: '{' expected at position 1 of request.\\n\", \"requestId\": 0}\n"
+                  "{\"exitCode\": 1, \"output\": \"ERROR: The worker option (--worker) cannot be used in worker requests.\\n\", \"requestId\": 2}\n",
+                  output.str().c_str() );
+    STRCMP_EQUAL( "", error.str().c_str() );
+}
+
+/*
+ * Check that in worker mode generation results and diagnostics are reported in the response output
+ */
+TEST( App, Worker_MockOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::istringstream input( "{\"arguments\": [\"-m\", \"out/\", \"foo.h\"], \"requestId\": 7}" );
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( input, output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT1#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor( 2 );
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::Parse( IgnoreParameter::YES, 4, IgnoreParameter::YES );
+    expect::Options$::IsHelpRequested( 2, IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( 2, IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, IgnoreParameter::YES, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( ( "{\"exitCode\": 0, \"output\": \"SUCCESS: Mock generated into '" + outputFilepath1 + "'\\n\", \"requestId\": 7}\n" ).c_str(),
+                  output.str().c_str() );
+    STRCMP_EQUAL( "", error.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+}
+
 /*
  * Check that if no input is specified, an error is displayed
  */
@@ -209,11 +404,15 @@ TEST( App, NoInput )
     int argc = 0;
     const char* argv[] = { "don't", "care" };
 
+    std::vector<std::string> inputPaths;
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, "" );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
     // Exercise
@@ -239,11 +438,15 @@ TEST( App, NoOutput )
     int argc = 99;
     const char* argv[] = { "don't", "care" };
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -286,29 +489,49 @@ TEST( App, MockOutput_OutDir_WithEndingPathSeparator )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -351,29 +574,49 @@ TEST( App, MockOutput_OutDir_WithoutEndingPathSeparator )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -416,29 +659,49 @@ TEST( App, MockOutput_NoOutFile )
 
     std::filesystem::current_path( tempDirPath );
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilename.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename, IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename, IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), "", &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -479,29 +742,49 @@ TEST( App, MockOutput_OutFile_CppExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -542,29 +825,49 @@ TEST( App, MockOutput_OutFile_CcExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -607,29 +910,49 @@ TEST( App, MockOutput_OutFile_OtherExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -672,29 +995,49 @@ TEST( App, MockOutput_OutFile_NoExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -730,26 +1073,46 @@ TEST( App, MockOutput_ConsoleOutput )
     std::vector<std::string> includePaths;
     std::string outputText = "#####TEXT4#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -762,9 +1125,9 @@ TEST( App, MockOutput_ConsoleOutput )
 }
 
 /*
- * Check that if the output file cannot be opened, an error is displayed
+ * Check that if the output file cannot be written, an error is displayed
  */
-TEST( App, MockOutput_CannotOpenFile )
+TEST( App, MockOutput_CannotWriteFile )
 {
     // Prepare
     mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
@@ -781,17 +1144,51 @@ TEST( App, MockOutput_CannotOpenFile )
     std::string nonExistantDirpathStr = nonExistantDirPath.generic_string();
     std::string outputFilepathStr = (nonExistantDirPath / mockOutputFilename).generic_string();
 
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT1#####";
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, nonExistantDirpathStr.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", IgnoreParameter::YES, &outputText );
 
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepathStr.c_str() );
@@ -804,7 +1201,7 @@ TEST( App, MockOutput_CannotOpenFile )
    // Verify
    CHECK_EQUAL( 1, ret );
    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
-   STRCMP_CONTAINS( ("Mock output file '" + outputFilepathStr + "' could not be opened").c_str(), error.str().c_str() );
+   STRCMP_CONTAINS( ("Mock output file '" + outputFilepathStr + "' could not be written").c_str(), error.str().c_str() );
    STRCMP_EQUAL( "", output.str().c_str() );
 }
 
@@ -830,26 +1227,46 @@ TEST( App, MockOutput_InterpretAsCpp_CppHeader )
     std::vector<std::string> includePaths;
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilenameCpp };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilenameCpp.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilenameCpp.c_str(), IgnoreParameter::YES, true, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilenameCpp.c_str(), IgnoreParameter::YES, true, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -881,26 +1298,46 @@ TEST( App, MockOutput_InterpretAsCpp_Forced )
     std::vector<std::string> includePaths;
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, true );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( true, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( true, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -932,26 +1369,46 @@ TEST( App, MockOutput_LanguageStandard )
     std::vector<std::string> includePaths;
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "lang-std" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "lang-std", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "lang-std", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -983,26 +1440,46 @@ TEST( App, MockOutput_UseUnderlyingTypedefType )
     std::vector<std::string> includePaths;
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, true );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", true, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", true, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -1034,26 +1511,46 @@ TEST( App, MockOutput_IncludePaths )
     std::vector<std::string> includePaths = { "IncludePath1", "IncludePath2" };
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -1085,26 +1582,46 @@ TEST( App, MockOutput_TypeOverrideOptions )
     std::vector<std::string> includePaths;
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
 
     // Exercise
@@ -1136,26 +1653,46 @@ TEST( App, MockOutput_GenerationOptions )
     std::vector<std::string> includePaths;
     std::string outputText = "#####FOO#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "-t ####SOME_OPTIONS#### -f whatever" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "-t ####SOME_OPTIONS#### -f whatever", "", "", &outputText );
 
     // Exercise
@@ -1186,26 +1723,46 @@ TEST( App, MockOutput_ParseError )
     std::vector<std::string> typeOverrideOptions;
     std::vector<std::string> includePaths;
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, false );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, false );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
     // Exercise
@@ -1249,26 +1806,46 @@ TEST( App, ExpectationOutput_OutDir )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath1.c_str(), &outputText2 );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -1318,26 +1895,46 @@ TEST( App, ExpectationOutput_NoOutFile )
 
     std::filesystem::current_path( tempDirPath );
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename, IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename, IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", "", &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilename1.c_str(), &outputText2 );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -1383,26 +1980,46 @@ TEST( App, ExpectationOutput_OutFile_HppExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath1.c_str(), &outputText2 );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -1448,26 +2065,46 @@ TEST( App, ExpectationOutput_OutFile_CppExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepath2.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath1.c_str(), &outputText2 );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -1515,26 +2152,46 @@ TEST( App, ExpectationOutput_OutFile_OtherExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath1.c_str(), &outputText2 );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -1582,26 +2239,46 @@ TEST( App, ExpectationOutput_OutFile_NoExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath1.c_str(), &outputText2 );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
@@ -1639,26 +2316,46 @@ TEST( App, ExpectationOutput_ConsoleOutput )
     std::string outputText1 = "#####TEXT4455#####";
     std::string outputText2 = "#####TEXT5642#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", "", &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", "@", &outputText2 );
 
@@ -1672,9 +2369,9 @@ TEST( App, ExpectationOutput_ConsoleOutput )
 }
 
 /*
- * Check that if the output file cannot be opened, an error is displayed
+ * Check that if the output file cannot be written, an error is displayed
  */
-TEST( App, ExpectationOutput_CannotOpenFile )
+TEST( App, ExpectationOutput_CannotWriteFile )
 {
     // Prepare
     mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
@@ -1689,17 +2386,53 @@ TEST( App, ExpectationOutput_CannotOpenFile )
 
     std::string outputDir = (outDirPath / "NonExistantDirectory123898876354874" / "").generic_string();
 
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText1 = "#####TEXT1#####";
+    std::string outputText2 = "#####TEXT2#####";
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputDir.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", IgnoreParameter::YES, &outputText1 );
+    expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", IgnoreParameter::YES, &outputText2 );
 
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
@@ -1709,7 +2442,7 @@ TEST( App, ExpectationOutput_CannotOpenFile )
     // Verify
     CHECK_EQUAL( 1, ret );
     STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
-    STRCMP_CONTAINS( ("Expectation header output file '" + outputDir + expectationHeaderOutputFilename + "' could not be opened").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( ("Expectation header output file '" + outputDir + expectationHeaderOutputFilename + "' could not be written").c_str(), error.str().c_str() );
     STRCMP_EQUAL( "", output.str().c_str() );
 }
 
@@ -1734,26 +2467,46 @@ TEST( App, ExpectationOutput_GenerationOptions )
     std::string outputText1 = "#####TEXT4455#####";
     std::string outputText2 = "#####TEXT5642#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "-t ####SOME_OPTIONS#### -f whatever" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "-t ####SOME_OPTIONS#### -f whatever", "", &outputText1 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "-t ####SOME_OPTIONS#### -f whatever", "@", &outputText2 );
 
@@ -1785,26 +2538,46 @@ TEST( App, ExpectationOutput_ParseError )
     std::vector<std::string> typeOverrideOptions;
     std::vector<std::string> includePaths;
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, false );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, false );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, false );
     expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
     // Exercise
@@ -1854,29 +2627,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Both )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathMock.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathExpect.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -1933,29 +2726,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutDir )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2015,29 +2828,49 @@ TEST( App, CombinedMockAndExpectationOutput_NoOutFile )
 
     std::filesystem::current_path( tempDirPath );
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilename1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename, IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename, IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), "", &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", "", &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilename2.c_str(), &outputText3 );
@@ -2091,29 +2924,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Mock_CppExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2167,29 +3020,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Expect_HppExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepath2.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2243,29 +3116,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Expect_CppExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepath3.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2321,29 +3214,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Mock_OtherExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2399,29 +3312,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Mock_NoExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2477,29 +3410,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Expect_OtherExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2555,29 +3508,49 @@ TEST( App, CombinedMockAndExpectationOutput_OutFile_Expect_NoExtension )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathOther.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
     expect::OutputFileParser$::OutputFileParser$ctor();
     expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
     expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2619,26 +3592,46 @@ TEST( App, CombinedMockAndExpectationOutput_Mock_ConsoleOutput )
     std::string outputText2 = "#####TEXT56424#####";
     std::string outputText3 = "#####TEXT12345#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", "", &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", "@", &outputText3 );
@@ -2674,26 +3667,46 @@ TEST( App, CombinedMockAndExpectationOutput_Expect_ConsoleOutput )
     std::string outputText2 = "#####TEXT524#####";
     std::string outputText3 = "#####TEXT125#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", "", &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", "@", &outputText3 );
@@ -2731,26 +3744,46 @@ TEST( App, MockOutput_BaseDirectory )
     std::string outputText2 = "#####FOO2#####";
     std::string outputText3 = "#####FOO3#####";
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, baseDirectory.c_str() );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", baseDirectory.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", baseDirectory.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", "@", &outputText3 );
@@ -2782,11 +3815,15 @@ TEST( App, MockOutput_BaseDirectory_NotExists )
 
     std::string baseDirectory = ( outDirPath / "NonExistantDirectory123898876354874" ).generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, baseDirectory.c_str() );
@@ -2840,20 +3877,40 @@ TEST( App, Regeneration_FromMock )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathMock.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathExpect.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
@@ -2864,8 +3921,8 @@ TEST( App, Regeneration_FromMock )
     expect::OutputFileParser$::GetGenerationOptions( IgnoreParameter::YES, &generationOptions );
     expect::Options$::Parse( IgnoreParameter::YES, generationOptions.c_str() );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "",  expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "",  expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -2922,20 +3979,40 @@ TEST( App, Regeneration_FromExpectationHeader )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathMock.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathExpect.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
@@ -2948,8 +4025,8 @@ TEST( App, Regeneration_FromExpectationHeader )
     expect::OutputFileParser$::GetGenerationOptions( IgnoreParameter::YES, &generationOptions );
     expect::Options$::Parse( IgnoreParameter::YES, generationOptions.c_str() );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "",  expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "",  expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -3006,20 +4083,40 @@ TEST( App, Regeneration_FromExpectationImpl )
 
     std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
 
+    std::vector<std::string> inputPaths = { inputFilename };
+
     expect::Options$::Options$ctor();
     expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
     expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
     expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
-    expect::Options$::GetInputPath( IgnoreParameter::YES, inputFilename.c_str() );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
     expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
     expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
     expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathMock.c_str() );
     expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathExpect.c_str() );
     expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
     expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
     expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
     expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
     expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
     expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
     expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
     expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
@@ -3034,8 +4131,8 @@ TEST( App, Regeneration_FromExpectationImpl )
     expect::OutputFileParser$::GetGenerationOptions( IgnoreParameter::YES, &generationOptions );
     expect::Options$::Parse( IgnoreParameter::YES, generationOptions.c_str() );
 
-    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions );
-    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, &error, true );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
     expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "",  expectedBaseDirPath.c_str(), &outputText1 );
     expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "",  expectedBaseDirPath.c_str(), &outputText2 );
     expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
@@ -3054,3 +4151,2710 @@ TEST( App, Regeneration_FromExpectationImpl )
     CheckFileContains( outputFilepath2, outputText2 );
     CheckFileContains( outputFilepath3, outputText3 );
 }
+
+/*
+ * Check that several input files passed in the command line are processed sharing the same configuration and parser.
+ */
+TEST( App, MultipleInputs )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = (outDirPath / "bar_mock.cpp").generic_string();
+    std::filesystem::remove( outputFilepath2 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 3;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string inputFilename2 = "bar.h";
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText1 = "#####TEXT1#####";
+    std::string outputText2 = "#####TEXT2#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename, inputFilename2 };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor(2);
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath2.c_str() );
+    expect::OutputFileParser$::GetUserCode( 2, IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename2.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText1 );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText2 );
+    expect::ConsoleColorizer$::SetColor( 4, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath2 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText1 );
+    CheckFileContains( outputFilepath2, outputText2 );
+}
+
+/*
+ * Check that input files listed in a batch file are processed with their own output paths.
+ */
+TEST( App, BatchFile )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = (outDirPath / "my_mock.cpp").generic_string();
+    std::filesystem::remove( outputFilepath2 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 3;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string batchFilename = "batch.txt";
+    std::string inputFilename2 = "bar.h";
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText1 = "#####TEXT1#####";
+    std::string outputText2 = "#####TEXT2#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths;
+    std::vector<BatchFileParser::Entry> batchEntries = { { inputFilename, "", "" }, { inputFilename2, outputFilepath2, "" } };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, batchFilename.c_str() );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::BatchFileParser$::BatchFileParser$ctor();
+    expect::BatchFileParser$::Parse( IgnoreParameter::YES, batchFilename.c_str() );
+    expect::BatchFileParser$::GetEntries( IgnoreParameter::YES, &batchEntries );
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor(2);
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath2.c_str() );
+    expect::OutputFileParser$::GetUserCode( 2, IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename2.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText1 );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText2 );
+    expect::ConsoleColorizer$::SetColor( 4, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath2 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText1 );
+    CheckFileContains( outputFilepath2, outputText2 );
+}
+
+/*
+ * Check that an error processing an input file does not prevent processing the rest of input files.
+ */
+TEST( App, MultipleInputs_ParseError )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = (outDirPath / "bar_mock.cpp").generic_string();
+    std::filesystem::remove( outputFilepath2 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 3;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string inputFilename2 = "bar.h";
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText2 = "#####TEXT2#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename, inputFilename2 };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor(2);
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath2.c_str() );
+    expect::OutputFileParser$::GetUserCode( 2, IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, false );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename2.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText2 );
+    expect::ConsoleColorizer$::SetColor( 4, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 2, ret );
+    STRCMP_CONTAINS( ("Output could not be generated due to errors parsing the input file '" + inputFilename + "'").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath2 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath2, outputText2 );
+}
+
+/*
+ * Check that an error is displayed if several input files would be generated into the same output file.
+ */
+TEST( App, MultipleInputs_OutputFile )
+{
+    // Prepare
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 3;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outputFilepathStr = (outDirPath / "my_mock.cpp").generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename, "bar.h" };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock output path '" + outputFilepathStr + "' must be a directory when processing several input files").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that an error is displayed if regeneration is requested with several input files.
+ */
+TEST( App, MultipleInputs_Regeneration )
+{
+    // Prepare
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 3;
+    const char* argv[] = { "don't", "care" };
+
+    std::vector<std::string> inputPaths = { inputFilename, "bar.h" };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The regeneration option (-r) can only be used with a single input file", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that when the outputs are up to date, the input file is not parsed and the outputs are not generated
+ */
+TEST( App, Cache_UpToDate )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string cacheDirPathStr = ( tempDirPath / "CppUMockGen_cache" ).generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::filesystem::path> outputFilePaths = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, cacheDirPathStr.c_str() );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, mockOutputFilePath.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::StampCache$::StampCache$ctor( cacheDirPathStr.c_str() );
+    expect::StampCache$::IsUpToDate( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "UP-TO-DATE:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Outputs for input file '" + inputFilename + "' are up to date").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CHECK_FALSE( std::filesystem::exists( outputFilepath1 ) );
+}
+
+/*
+ * Check that when the outputs are out of date, the outputs are generated and stamped, and the model of the input file
+ * is stored
+ */
+TEST( App, Cache_OutOfDate )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+    mock().installCopier( "std::string", stdStringCopier );
+    mock().installCopier( "std::vector<std::filesystem::path>", stdVectorOfPathsCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::string outputText = "#####TEXT1#####";
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h" };
+    std::string modelText = "#####MODEL1#####";
+    std::string noModel;
+    std::vector<std::filesystem::path> noDependencies;
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string cacheDirPathStr = ( tempDirPath / "CppUMockGen_cache" ).generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::filesystem::path> outputFilePaths = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, cacheDirPathStr.c_str() );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, mockOutputFilePath.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::StampCache$::StampCache$ctor( cacheDirPathStr.c_str() );
+    expect::StampCache$::IsUpToDate( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, false );
+    expect::StampCache$::GetModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, noModel, noDependencies, false );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::Parser$::GetDependencies( IgnoreParameter::YES, dependencies );
+    expect::Parser$::SaveModel( IgnoreParameter::YES, &modelText );
+    expect::StampCache$::StoreModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, dependencies, modelText.c_str() );
+    expect::StampCache$::Update( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, dependencies );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "SUCCESS:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+}
+
+/*
+ * Check that when the outputs are out of date but the model of the input file is stored in the cache, the outputs are
+ * generated from the stored model without parsing the input file
+ */
+TEST( App, Cache_OutOfDate_ModelLoaded )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+    mock().installCopier( "std::string", stdStringCopier );
+    mock().installCopier( "std::vector<std::filesystem::path>", stdVectorOfPathsCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::string outputText = "#####TEXT1#####";
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h" };
+    std::string modelText = "#####MODEL1#####";
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string cacheDirPathStr = ( tempDirPath / "CppUMockGen_cache" ).generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::filesystem::path> outputFilePaths = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, cacheDirPathStr.c_str() );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, mockOutputFilePath.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::StampCache$::StampCache$ctor( cacheDirPathStr.c_str() );
+    expect::StampCache$::IsUpToDate( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, false );
+    expect::StampCache$::GetModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, modelText, dependencies, true );
+    expect::Parser$::LoadModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, IgnoreParameter::YES, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::StampCache$::Update( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, dependencies );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "SUCCESS:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+}
+
+/*
+ * Check that when the outputs are out of date and the stored model of the input file cannot be used (e.g. because
+ * type overrides changed), the input file is parsed again and its model is stored
+ */
+TEST( App, Cache_OutOfDate_ModelRejected )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+    mock().installCopier( "std::string", stdStringCopier );
+    mock().installCopier( "std::vector<std::filesystem::path>", stdVectorOfPathsCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::string outputText = "#####TEXT1#####";
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h" };
+    std::string modelText = "#####MODEL1#####";
+    std::string oldModelText = "#####MODEL0#####";
+    std::vector<std::filesystem::path> oldDependencies = { inputFilename };
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string cacheDirPathStr = ( tempDirPath / "CppUMockGen_cache" ).generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::filesystem::path> outputFilePaths = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, cacheDirPathStr.c_str() );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, mockOutputFilePath.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::StampCache$::StampCache$ctor( cacheDirPathStr.c_str() );
+    expect::StampCache$::IsUpToDate( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, false );
+    expect::StampCache$::GetModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, oldModelText, oldDependencies, true );
+    expect::Parser$::LoadModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, IgnoreParameter::YES, false );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::Parser$::GetDependencies( IgnoreParameter::YES, dependencies );
+    expect::Parser$::SaveModel( IgnoreParameter::YES, &modelText );
+    expect::StampCache$::StoreModel( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, dependencies, modelText.c_str() );
+    expect::StampCache$::Update( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, dependencies );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "SUCCESS:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+}
+
+/*
+ * Check that in check mode, out of date outputs are reported but not generated
+ */
+TEST( App, Check_OutOfDate )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+    std::string cacheDirPathStr = ( tempDirPath / "CppUMockGen_cache" ).generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::filesystem::path> outputFilePaths = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, cacheDirPathStr.c_str() );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, mockOutputFilePath.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::StampCache$::StampCache$ctor( cacheDirPathStr.c_str() );
+    expect::StampCache$::IsUpToDate( IgnoreParameter::YES, outputFilePaths, IgnoreParameter::YES, false );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 3, ret );
+    STRCMP_CONTAINS( "OUT-OF-DATE:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Outputs for input file '" + inputFilename + "' are out of date").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CHECK_FALSE( std::filesystem::exists( outputFilepath1 ) );
+}
+
+/*
+ * Check that an error is reported if check mode is requested without a cache directory
+ */
+TEST( App, Check_NoCacheDirectory )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The check option (--check) requires a cache directory (--cache-dir).", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that an existing output file is not rewritten if its contents do not change
+ */
+TEST( App, MockOutput_Unchanged )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    {
+        std::ofstream existingFile( outputFilepath1 );
+        existingFile << "#####TEXT1#####";
+    }
+    std::filesystem::file_time_type initialWriteTime = std::filesystem::last_write_time( outputFilepath1 ) - std::chrono::hours( 1 );
+    std::filesystem::last_write_time( outputFilepath1, initialWriteTime );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT1#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "SUCCESS:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "' (unchanged)").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+    CHECK( initialWriteTime == std::filesystem::last_write_time( outputFilepath1 ) );
+}
+
+/*
+ * Check that an existing output file is replaced if its contents change, keeping its permissions
+ */
+TEST( App, MockOutput_Changed )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    {
+        std::ofstream existingFile( outputFilepath1 );
+        existingFile << "#####OLD#####";
+    }
+    std::filesystem::file_time_type initialWriteTime = std::filesystem::last_write_time( outputFilepath1 ) - std::chrono::hours( 1 );
+    std::filesystem::last_write_time( outputFilepath1, initialWriteTime );
+    std::filesystem::perms initialPermissions = ( std::filesystem::perms::owner_read | std::filesystem::perms::owner_write );
+    std::filesystem::permissions( outputFilepath1, initialPermissions );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT1#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "SUCCESS:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'\n").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+    CHECK( initialWriteTime != std::filesystem::last_write_time( outputFilepath1 ) );
+    CHECK( initialPermissions == std::filesystem::status( outputFilepath1 ).permissions() );
+}
+
+/*
+ * Check that an existing output file is left untouched if the input file cannot be parsed
+ */
+TEST( App, MockOutput_ParseError_ExistingOutputFile )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    {
+        std::ofstream existingFile( outputFilepath1 );
+        existingFile << "#####OLD#####";
+    }
+    std::filesystem::file_time_type initialWriteTime = std::filesystem::last_write_time( outputFilepath1 ) - std::chrono::hours( 1 );
+    std::filesystem::last_write_time( outputFilepath1, initialWriteTime );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT1#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, false );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 2, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, "#####OLD#####" );
+    CHECK( initialWriteTime == std::filesystem::last_write_time( outputFilepath1 ) );
+}
+
+/*
+ * Check that a dependency file listing the dependencies of the input file is generated next to the mock output file
+ */
+TEST( App, DepFile_MockOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = mockDepFilePath;
+    std::filesystem::remove( outputFilepath2 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+    std::string depFileText = "#####DEPFILE#####";
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h" };
+    std::vector<std::filesystem::path> targets = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::Parser$::GetDependencies( IgnoreParameter::YES, dependencies );
+    expect::DependencyFile$::DependencyFile$ctor( targets );
+    expect::DependencyFile$::Generate( IgnoreParameter::YES, dependencies, depFileText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+    CheckFileContains( outputFilepath2, depFileText );
+}
+
+/*
+ * Check that dependency files are generated next to the mock and expectation output files
+ */
+TEST( App, DepFile_CombinedMockAndExpectationOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = expectationHeaderOutputFilePath;
+    std::filesystem::remove( outputFilepath2 );
+
+    outputFilepath3 = expectationImplOutputFilePath;
+    std::filesystem::remove( outputFilepath3 );
+
+    outputFilepath4 = mockDepFilePath;
+    std::filesystem::remove( outputFilepath4 );
+
+    outputFilepath5 = expectationDepFilePath;
+    std::filesystem::remove( outputFilepath5 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText1 = "#####TEXT1#####";
+    std::string outputText2 = "#####TEXT2#####";
+    std::string outputText3 = "#####TEXT3#####";
+    std::string depFileText = "#####DEPFILE#####";
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h" };
+    std::vector<std::filesystem::path> mockTargets = { mockOutputFilePath };
+    std::vector<std::filesystem::path> expectationTargets = { expectationHeaderOutputFilePath, expectationImplOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText1 );
+    expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
+    expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
+    expect::Parser$::GetDependencies( IgnoreParameter::YES, dependencies );
+    expect::DependencyFile$::DependencyFile$ctor( mockTargets );
+    expect::DependencyFile$::DependencyFile$ctor( expectationTargets );
+    expect::DependencyFile$::Generate( 2, IgnoreParameter::YES, dependencies, depFileText );
+    expect::ConsoleColorizer$::SetColor( 4, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( ("Expectations generated into '" + outputFilepath2 + "' and '" + outputFilepath3 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText1 );
+    CheckFileContains( outputFilepath2, outputText2 );
+    CheckFileContains( outputFilepath3, outputText3 );
+    CheckFileContains( outputFilepath4, depFileText );
+    CheckFileContains( outputFilepath5, depFileText );
+}
+
+/*
+ * Check that dependency files are not generated for outputs printed to the console
+ */
+TEST( App, DepFile_ConsoleOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( "", error.str().c_str() );
+    STRCMP_EQUAL( outputText.c_str(), output.str().c_str() );
+}
+
+/*
+ * Check that the flags taken from the compilation database are used to parse the input file
+ */
+TEST( App, CompilationDatabase_Flags )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+    CompilationDatabase::Flags flags = { { "-DFOO", "-I/usr/include/foo" }, true };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "build/compile_commands.json" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::CompilationDatabase$::CompilationDatabase$ctor( "build/compile_commands.json" );
+    expect::CompilationDatabase$::GetFlags( IgnoreParameter::YES, inputFilename.c_str(), &flags );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, true, includePaths, flags.args, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( "", error.str().c_str() );
+    STRCMP_EQUAL( outputText.c_str(), output.str().c_str() );
+}
+
+/*
+ * Check that the input file is parsed without additional flags if the compilation database has no flags for it
+ */
+TEST( App, CompilationDatabase_NoFlags )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "build/compile_commands.json" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::CompilationDatabase$::CompilationDatabase$ctor( "build/compile_commands.json" );
+    expect::CompilationDatabase$::GetFlags( IgnoreParameter::YES, inputFilename.c_str(), nullptr );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( "", error.str().c_str() );
+    STRCMP_EQUAL( outputText.c_str(), output.str().c_str() );
+}
+
+/*
+ * Check that in watch mode input files are processed again when any of their dependencies change
+ */
+TEST( App, Watch_MockOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText1 = "#####TEXT1#####";
+    std::string outputText2 = "#####TEXT2#####";
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h" };
+    std::vector<std::filesystem::path> watchedFiles = { std::filesystem::absolute( "bar.h" ).lexically_normal(),
+                                                        std::filesystem::absolute( inputFilename ).lexically_normal() };
+    std::vector<std::filesystem::path> changedFiles = { watchedFiles[0] };
+    std::vector<std::filesystem::path> noChangedFiles;
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor( 2 );
+    expect::OutputFileParser$::Parse( 2, IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( 2, IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( 2, IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GetDependencies( 2, IgnoreParameter::YES, dependencies );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText1 );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText2 );
+    expect::FileWatcher$::FileWatcher$ctor();
+    expect::FileWatcher$::Watch( 2, IgnoreParameter::YES, watchedFiles );
+    expect::FileWatcher$::WaitForChanges( IgnoreParameter::YES, changedFiles );
+    expect::FileWatcher$::WaitForChanges( IgnoreParameter::YES, noChangedFiles );
+    expect::FileWatcher$::FileWatcher$dtor();
+    expect::ConsoleColorizer$::SetColor( 8, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( "WATCHING:", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText2 );
+}
+
+/*
+ * Check that watch mode cannot be combined with the check option
+ */
+TEST( App, Watch_CheckOption )
+{
+    // Prepare
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The watch option (--watch) cannot be used with the check option (--check).", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that the input files are parsed using the precompiled prelude, and that the files included by the prelude are
+ * reported as dependencies
+ */
+TEST( App, Prelude_DepFile )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = mockDepFilePath;
+    std::filesystem::remove( outputFilepath2 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+    std::string depFileText = "#####DEPFILE#####";
+    std::vector<std::string> preludeHeaders = { "prelude.h" };
+    std::string preludeContents = "#include \"/path/to/prelude.h\"\n";
+    Prelude::PrecompiledHeader precompiledPrelude = { "/tmp/prelude0.pch", { "/path/to/prelude.h", "/usr/include/string" } };
+    std::vector<std::string> compileArgs = { "-include-pch", "/tmp/prelude0.pch" };
+    std::vector<std::filesystem::path> parserDependencies = { inputFilename, "bar.h" };
+    std::vector<std::filesystem::path> dependencies = { inputFilename, "bar.h", "/path/to/prelude.h", "/usr/include/string" };
+    std::vector<std::filesystem::path> targets = { mockOutputFilePath };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, preludeHeaders );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Prelude$::Prelude$ctor( preludeHeaders );
+    expect::Prelude$::IsEmpty( IgnoreParameter::YES, false );
+    expect::Prelude$::GetContents( IgnoreParameter::YES, preludeContents );
+    expect::Prelude$::GetPrecompiledHeader( IgnoreParameter::YES, IgnoreParameter::YES, IgnoreParameter::YES, false, includePaths,
+                                            EMPTY_COMPILE_ARGS, &EMPTY_STRING, precompiledPrelude );
+    expect::Prelude$::Prelude$dtor();
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, compileArgs, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::Parser$::GetDependencies( IgnoreParameter::YES, parserDependencies );
+    expect::DependencyFile$::DependencyFile$ctor( targets );
+    expect::DependencyFile$::Generate( IgnoreParameter::YES, dependencies, depFileText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+    CheckFileContains( outputFilepath2, depFileText );
+}
+
+/*
+ * Check that when the automatic prelude is requested but the input files do not have common includes, the input files
+ * are parsed without a precompiled prelude
+ */
+TEST( App, Prelude_AutoEmpty )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installComparator( "std::vector<std::filesystem::path>", stdVectorOfPathsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+    std::vector<std::string> preludeHeaders;
+    std::vector<std::filesystem::path> inputFilePaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, preludeHeaders );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Prelude$::Prelude$ctor( preludeHeaders );
+    expect::Prelude$::AddCommonIncludes( IgnoreParameter::YES, inputFilePaths );
+    expect::Prelude$::IsEmpty( IgnoreParameter::YES, true );
+    expect::Prelude$::Prelude$dtor();
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+}
+
+/*
+ * Check that when parsing single files the type map is passed to the configuration
+ */
+TEST( App, SingleFile_TypeMap )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::string outputText = "#####TEXT1#####";
+    std::vector<std::string> typeMap = { "uint32_t=unsigned int", "handle_t=struct handle *" };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, typeMap );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, typeMap );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText );
+}
+
+/*
+ * Check that an error is displayed if a prelude is requested when parsing single files
+ */
+TEST( App, SingleFile_Prelude )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::string> typeMap;
+    std::vector<std::string> preludeHeaders = { "prelude.h" };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, preludeHeaders );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, typeMap );
+
+    expect::Prelude$::Prelude$ctor( preludeHeaders );
+    expect::Prelude$::IsEmpty( IgnoreParameter::YES, false );
+    expect::Prelude$::Prelude$dtor();
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The prelude options (--prelude, --auto-prelude) cannot be used with the single file option (--single-file).", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that an error is displayed if umbrella parsing is requested when parsing single files
+ */
+TEST( App, Umbrella_SingleFile )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+    std::vector<std::string> typeMap;
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, typeMap );
+
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The umbrella option (--umbrella) cannot be used with the single file option (--single-file).", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that an error is displayed if umbrella parsing is requested in watch mode
+ */
+TEST( App, Umbrella_WatchOption )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The umbrella option (--umbrella) cannot be used with the watch option (--watch).", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that combined mock and expectation functions are generated and saved to the output files in streaming mode
+ */
+TEST( App, Streaming_CombinedMockAndExpectationOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 2;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outputFilepathMock = (outDirPath / "my_mock").generic_string();
+    std::string outputFilepathExpect = (outDirPath / "my_expect").generic_string();
+
+    outputFilepath1 = (outDirPath / "my_mock.cpp").generic_string();
+    std::filesystem::remove( outputFilepath1 );
+
+    outputFilepath2 = (outDirPath / "my_expect.hpp").generic_string();
+    std::filesystem::remove( outputFilepath2 );
+
+    outputFilepath3 = (outDirPath / "my_expect.cpp").generic_string();
+    std::filesystem::remove( outputFilepath3 );
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText1 = "#####TEXT0943#####";
+    std::string outputText2 = "#####TEXT2083#####";
+    std::string outputText3 = "#####TEXT7818#####";
+    std::string userCode = "~~USER CODE 66561~~~";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outputFilepathMock.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, outputFilepathExpect.c_str() );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &userCode );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", userCode.c_str(), expectedBaseDirPath.c_str(), &outputText1 );
+    expect::Parser$::GenerateExpectationHeader( IgnoreParameter::YES, "", expectedBaseDirPath.c_str(), &outputText2 );
+    expect::Parser$::GenerateExpectationImpl( IgnoreParameter::YES, "", outputFilepath2.c_str(), &outputText3 );
+    expect::ConsoleColorizer$::SetColor( 4, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_CONTAINS( "SUCCESS:", error.str().c_str() );
+    STRCMP_CONTAINS( ("Mock generated into '" + outputFilepath1 + "'").c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( ("Expectations generated into '" + outputFilepath2 + "' and '" + outputFilepath3 + "'").c_str(), error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, outputText1 );
+    CheckFileContains( outputFilepath2, outputText2 );
+    CheckFileContains( outputFilepath3, outputText3 );
+}
+
+/*
+ * Check that existing output files are not modified in streaming mode if the input file cannot be parsed, and that the
+ * code generated until then is discarded
+ */
+TEST( App, Streaming_ParseError_ExistingOutputFile )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    {
+        std::ofstream existingFile( outputFilepath1 );
+        existingFile << "#####OLD#####";
+    }
+    std::filesystem::file_time_type initialWriteTime = std::filesystem::last_write_time( outputFilepath1 ) - std::chrono::hours( 1 );
+    std::filesystem::last_write_time( outputFilepath1, initialWriteTime );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT1#####";
+
+    std::string expectedBaseDirPath = outDirPath.parent_path().generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, true );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::OutputFileParser$::OutputFileParser$ctor();
+    expect::OutputFileParser$::Parse( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::OutputFileParser$::GetUserCode( IgnoreParameter::YES, &EMPTY_STRING );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, false );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", expectedBaseDirPath.c_str(), &outputText );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 2, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+    CheckFileContains( outputFilepath1, "#####OLD#####" );
+    CHECK( initialWriteTime == std::filesystem::last_write_time( outputFilepath1 ) );
+    for( const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator( outDirPath ) )
+    {
+        CHECK_TEXT( entry.path().filename().generic_string().find( ".tmp" ) == std::string::npos, entry.path().generic_string().c_str() );
+    }
+}
+
+/*
+ * Check that an error is displayed if streaming is requested with umbrella parsing
+ */
+TEST( App, Streaming_UmbrellaOption )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    outputFilepath1 = mockOutputFilePath;
+    std::filesystem::remove( outputFilepath1 );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 1;
+    const char* argv[] = { "don't", "care" };
+
+    std::string outDirPathStr = outDirPath.generic_string();
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, outDirPathStr.c_str() );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, true );
+    expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 1, ret );
+    STRCMP_CONTAINS( "ERROR:", error.str().c_str() );
+    STRCMP_CONTAINS( "The streaming option (--stream) cannot be used with the umbrella option (--umbrella).", error.str().c_str() );
+    STRCMP_EQUAL( "", output.str().c_str() );
+}
+
+/*
+ * Check that the time report is printed to console as text
+ */
+TEST( App, TimeReport_ConsoleOutput )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 2;
+    const char* argv[] = { "don't", "care" };
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT5123#####";
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( outputText.c_str(), output.str().c_str() );
+    STRCMP_CONTAINS( "Phase                                Calls     Wall (ms)      CPU (ms)\n", error.str().c_str() );
+    STRCMP_CONTAINS( "\noptions                                  2 ", error.str().c_str() );
+    STRCMP_CONTAINS( "\ninput-files                              1\n", error.str().c_str() );
+}
+
+/*
+ * Check that the time report is saved to a file as JSON
+ */
+TEST( App, TimeReport_JsonFile )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 2;
+    const char* argv[] = { "don't", "care" };
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT5124#####";
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    outputFilepath1 = (outDirPath / "time_report.json").generic_string();
+    std::filesystem::remove( outputFilepath1 );
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, "" );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( outputText.c_str(), output.str().c_str() );
+    STRCMP_EQUAL( "", error.str().c_str() );
+
+    std::ifstream reportFile( outputFilepath1 );
+    CHECK_TRUE( reportFile.is_open() );
+    std::stringstream report;
+    report << reportFile.rdbuf();
+    STRCMP_CONTAINS( "{\n  \"wallTimeMs\": ", report.str().c_str() );
+    STRCMP_CONTAINS( "{ \"name\": \"options\", \"calls\": 2, ", report.str().c_str() );
+    STRCMP_CONTAINS( "{ \"name\": \"file-write\", \"calls\": 0, ", report.str().c_str() );
+    STRCMP_CONTAINS( "\"input-files\": 1,", report.str().c_str() );
+}
+
+/*
+ * Check that the trace is saved to a file
+ */
+TEST( App, Trace_File )
+{
+    // Prepare
+    mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    std::ostringstream output;
+    std::ostringstream error;
+    App app( output, error );
+
+    int argc = 2;
+    const char* argv[] = { "don't", "care" };
+
+    std::vector<std::string> typeOverrideOptions;
+    std::vector<std::string> includePaths;
+    std::string outputText = "#####TEXT5125#####";
+
+    std::vector<std::string> inputPaths = { inputFilename };
+
+    outputFilepath1 = (outDirPath / "trace.json").generic_string();
+    std::filesystem::remove( outputFilepath1 );
+
+    expect::Options$::Options$ctor();
+    expect::Options$::Parse( IgnoreParameter::YES, argc, argv );
+    expect::Options$::IsHelpRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsVersionRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWorkerRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetInputPaths( IgnoreParameter::YES, inputPaths );
+    expect::Options$::GetBatchFilePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsMockRequested( IgnoreParameter::YES, true );
+    expect::Options$::IsExpectationsRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetMockOutputPath( IgnoreParameter::YES, "@" );
+    expect::Options$::GetExpectationsOutputPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetBaseDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::IsRegenerationRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetNumJobs( IgnoreParameter::YES, 1 );
+    expect::Options$::GetCacheDirectory( IgnoreParameter::YES, "" );
+    expect::Options$::GetCompilationDatabasePath( IgnoreParameter::YES, "" );
+    expect::Options$::IsCheckRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsDepFileRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsWatchRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetPreludeHeaders( IgnoreParameter::YES, EMPTY_PRELUDE_HEADERS );
+    expect::Options$::IsAutoPreludeRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsUmbrellaParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsStreamingRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTimeReportPath( IgnoreParameter::YES, "" );
+    expect::Options$::GetTracePath( IgnoreParameter::YES, outputFilepath1.c_str() );
+    expect::Options$::InterpretAsCpp( IgnoreParameter::YES, false );
+    expect::Options$::GetLanguageStandard( IgnoreParameter::YES, "" );
+    expect::Options$::UseUnderlyingTypedef( IgnoreParameter::YES, false );
+    expect::Options$::IsFastParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSingleFileParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::IsSimpleCParseRequested( IgnoreParameter::YES, false );
+    expect::Options$::GetTypeMap( IgnoreParameter::YES, EMPTY_TYPE_MAP );
+    expect::Options$::GetTypeOverrides( IgnoreParameter::YES, typeOverrideOptions );
+    expect::Options$::GetIncludePaths( IgnoreParameter::YES, includePaths );
+    expect::Options$::GetGenerationOptions( IgnoreParameter::YES, "" );
+
+    expect::Config$::Config$ctor( false, "", false, typeOverrideOptions, EMPTY_TYPE_MAP );
+    expect::Parser$::Parse( IgnoreParameter::YES, inputFilename.c_str(), IgnoreParameter::YES, false, includePaths, EMPTY_COMPILE_ARGS, &error, true );
+    expect::Parser$::GenerateMock( IgnoreParameter::YES, "", "", "", &outputText );
+
+    // Exercise
+    int ret = app.Execute( argc, argv );
+
+    // Verify
+    CHECK_EQUAL( 0, ret );
+    STRCMP_EQUAL( outputText.c_str(), output.str().c_str() );
+    STRCMP_EQUAL( "", error.str().c_str() );
+
+    std::ifstream traceFile( outputFilepath1 );
+    CHECK_TRUE( traceFile.is_open() );
+    std::stringstream trace;
+    trace << traceFile.rdbuf();
+    STRCMP_CONTAINS( "\"traceEvents\": [\n", trace.str().c_str() );
+    STRCMP_CONTAINS( ( "{ \"name\": \"" + inputFilename + "\", \"cat\": \"input-file\", \"ph\": \"X\", " ).c_str(), trace.str().c_str() );
+    STRCMP_CONTAINS( "{ \"name\": \"options\", \"cat\": \"options\", \"ph\": \"X\", ", trace.str().c_str() );
+}
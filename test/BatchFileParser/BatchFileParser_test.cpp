@@ -0,0 +1,235 @@
+/**
+ * @file
+ * @brief      Unit tests for the "BatchFileParser" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <fstream>
+#include <string>
+#include <filesystem>
+
+#include "BatchFileParser.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string tempDirPathStr = tempDirPath.generic_string();
+static const std::string defaultTempFilename = "CppUMockGen_batch.txt";
+static const std::string nonexistingFilePath = ( tempDirPath / "CppUMockGen_batch_not_existing.txt" ).generic_string();
+
+TEST_GROUP( BatchFileParser )
+{
+    std::string tempFilePath;
+
+    TEST_TEARDOWN()
+    {
+        if( !tempFilePath.empty() )
+        {
+            std::filesystem::remove( tempFilePath );
+        }
+    }
+
+    void SetupTempFile( const SimpleString& contents )
+    {
+        auto tempPath = ( tempDirPath / defaultTempFilename );
+
+        std::ofstream tempFile( tempPath );
+        tempFile << contents.asCharString();
+        tempFile.close();
+
+        tempFilePath = tempPath.generic_string();
+    }
+
+    std::string TempPath( const std::string &path )
+    {
+        return ( tempDirPath / path ).lexically_normal().generic_string();
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that entries with and without output paths are obtained properly from the file.
+ */
+TEST( BatchFileParser, Entries )
+{
+    // Prepare
+    SimpleString fileContents =
+            "foo.h\n"
+            "bar.h -m bar_mock.cpp\n"
+            "  baz.h   -e expect/   -m mocks/baz  \n";
+    SetupTempFile( fileContents );
+
+    BatchFileParser batchFileParser;
+
+    // Exercise
+    batchFileParser.Parse( tempFilePath );
+
+    // Verify
+    auto entries = batchFileParser.GetEntries();
+    CHECK_EQUAL( 3, entries.size() );
+    STRCMP_EQUAL( TempPath( "foo.h" ).c_str(), entries[0].inputPath.c_str() );
+    STRCMP_EQUAL( "", entries[0].mockOutputPath.c_str() );
+    STRCMP_EQUAL( "", entries[0].expectationsOutputPath.c_str() );
+    STRCMP_EQUAL( TempPath( "bar.h" ).c_str(), entries[1].inputPath.c_str() );
+    STRCMP_EQUAL( TempPath( "bar_mock.cpp" ).c_str(), entries[1].mockOutputPath.c_str() );
+    STRCMP_EQUAL( "", entries[1].expectationsOutputPath.c_str() );
+    STRCMP_EQUAL( TempPath( "baz.h" ).c_str(), entries[2].inputPath.c_str() );
+    STRCMP_EQUAL( TempPath( "mocks/baz" ).c_str(), entries[2].mockOutputPath.c_str() );
+    STRCMP_EQUAL( TempPath( "expect/" ).c_str(), entries[2].expectationsOutputPath.c_str() );
+}
+
+/*
+ * Check that empty lines and comments are ignored, and that absolute paths and console outputs are kept unchanged.
+ */
+TEST( BatchFileParser, CommentsAndSpecialPaths )
+{
+    // Prepare
+    SimpleString fileContents =
+            "# This is a comment\n"
+            "\n"
+            "   \n"
+            "/abs/foo.h -m @ -e /abs/out/\n";
+    SetupTempFile( fileContents );
+
+    BatchFileParser batchFileParser;
+
+    // Exercise
+    batchFileParser.Parse( tempFilePath );
+
+    // Verify
+    auto entries = batchFileParser.GetEntries();
+    CHECK_EQUAL( 1, entries.size() );
+    STRCMP_EQUAL( "/abs/foo.h", entries[0].inputPath.c_str() );
+    STRCMP_EQUAL( "@", entries[0].mockOutputPath.c_str() );
+    STRCMP_EQUAL( "/abs/out/", entries[0].expectationsOutputPath.c_str() );
+}
+
+/*
+ * Check that paths with spaces can be passed using quotes.
+ */
+TEST( BatchFileParser, QuotedPaths )
+{
+    // Prepare
+    SimpleString fileContents =
+            "\"my dir/foo.h\" -m \"my \\\"mocks\\\"/\"\n";
+    SetupTempFile( fileContents );
+
+    BatchFileParser batchFileParser;
+
+    // Exercise
+    batchFileParser.Parse( tempFilePath );
+
+    // Verify
+    auto entries = batchFileParser.GetEntries();
+    CHECK_EQUAL( 1, entries.size() );
+    STRCMP_EQUAL( TempPath( "my dir/foo.h" ).c_str(), entries[0].inputPath.c_str() );
+    STRCMP_EQUAL( TempPath( "my \"mocks\"/" ).c_str(), entries[0].mockOutputPath.c_str() );
+}
+
+/*
+ * Check that an error is reported if an output option has no path.
+ */
+TEST( BatchFileParser, MissingOutputPath )
+{
+    // Prepare
+    SimpleString fileContents =
+            "foo.h\n"
+            "bar.h -e\n";
+    SetupTempFile( fileContents );
+
+    BatchFileParser batchFileParser;
+
+    // Exercise & Verify
+    try
+    {
+        batchFileParser.Parse( tempFilePath );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( ( "In batch file '" + tempFilePath + "':2: Option '-e' requires a path." ).c_str(), e.what() );
+    }
+}
+
+/*
+ * Check that an error is reported if a line contains unexpected parameters.
+ */
+TEST( BatchFileParser, UnexpectedParameter )
+{
+    // Prepare
+    SimpleString fileContents =
+            "foo.h bar.h\n";
+    SetupTempFile( fileContents );
+
+    BatchFileParser batchFileParser;
+
+    // Exercise & Verify
+    try
+    {
+        batchFileParser.Parse( tempFilePath );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( ( "In batch file '" + tempFilePath + "':1: Unexpected parameter 'bar.h'." ).c_str(), e.what() );
+    }
+}
+
+/*
+ * Check that an error is reported if a line does not contain an input file.
+ */
+TEST( BatchFileParser, NoInput )
+{
+    // Prepare
+    SimpleString fileContents =
+            "-m mocks/\n";
+    SetupTempFile( fileContents );
+
+    BatchFileParser batchFileParser;
+
+    // Exercise & Verify
+    try
+    {
+        batchFileParser.Parse( tempFilePath );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( ( "In batch file '" + tempFilePath + "':1: No input file specified." ).c_str(), e.what() );
+    }
+}
+
+/*
+ * Check that an error is reported if the batch file cannot be opened.
+ */
+TEST( BatchFileParser, CannotOpenFile )
+{
+    // Prepare
+    BatchFileParser batchFileParser;
+
+    // Exercise & Verify
+    try
+    {
+        batchFileParser.Parse( nonexistingFilePath );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( ( "Batch file '" + nonexistingFilePath + "' could not be opened." ).c_str(), e.what() );
+    }
+}
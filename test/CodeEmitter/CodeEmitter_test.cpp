@@ -0,0 +1,129 @@
+/**
+ * @file
+ * @brief      Unit tests for the "CodeEmitter" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <string>
+
+#include "CodeEmitter.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( CodeEmitter )
+{
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that strings, characters and partial strings are appended to the emitted code.
+ */
+TEST( CodeEmitter, Append )
+{
+    // Prepare
+    CodeEmitter emitter;
+    std::string name = "function1";
+
+    // Exercise
+    emitter << "void " << name << '(';
+    emitter.Write( "int a, int b", 5 );
+    emitter << ");";
+
+    // Verify
+    STRCMP_EQUAL( "void function1(int a);", emitter.GetBuffer().c_str() );
+    UNSIGNED_LONGS_EQUAL( 22, emitter.GetSize() );
+}
+
+/*
+ * Check that the code emitted after a given size can be discarded.
+ */
+TEST( CodeEmitter, Truncate )
+{
+    // Prepare
+    CodeEmitter emitter;
+    emitter << "int a";
+    size_t mark = emitter.GetSize();
+    emitter << ", ";
+
+    // Exercise
+    emitter.Truncate( mark );
+
+    // Verify
+    STRCMP_EQUAL( "int a", emitter.GetBuffer().c_str() );
+}
+
+/*
+ * Check that only the spaces surrounding the code emitted after a given size are trimmed.
+ */
+TEST( CodeEmitter, Trim )
+{
+    // Prepare
+    CodeEmitter emitter;
+    emitter << "f(int a, ";
+    size_t start1 = emitter.GetSize();
+    emitter << " int  ";
+
+    // Exercise
+    emitter.Trim( start1 );
+    emitter << ", ";
+    size_t start2 = emitter.GetSize();
+    emitter << "char *b";
+    emitter.Trim( start2 );
+    emitter << ", ";
+    size_t start3 = emitter.GetSize();
+    emitter << "   ";
+    emitter.Trim( start3 );
+
+    // Verify
+    STRCMP_EQUAL( "f(int a, int, char *b,    ", emitter.GetBuffer().c_str() );
+}
+
+/*
+ * Check that the buffer is kept when the emitted code is cleared.
+ */
+TEST( CodeEmitter, Clear )
+{
+    // Prepare
+    CodeEmitter emitter;
+    emitter.Reserve( 1000 );
+    emitter << "void function1();\n";
+    const char *buffer = emitter.GetBuffer().data();
+
+    // Exercise
+    emitter.Clear();
+    emitter << "void function2();\n";
+
+    // Verify
+    STRCMP_EQUAL( "void function2();\n", emitter.GetBuffer().c_str() );
+    POINTERS_EQUAL( buffer, emitter.GetBuffer().data() );
+}
+
+/*
+ * Check that the emitted code can be released.
+ */
+TEST( CodeEmitter, Release )
+{
+    // Prepare
+    CodeEmitter emitter;
+    emitter << "void function1();\n";
+
+    // Exercise
+    std::string code = emitter.Release();
+
+    // Verify
+    STRCMP_EQUAL( "void function1();\n", code.c_str() );
+}
@@ -0,0 +1,234 @@
+/**
+ * @file
+ * @brief      Unit tests for the "CompilationDatabase" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <stdexcept>
+
+#include "CompilationDatabase.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::absolute( std::filesystem::temp_directory_path() / "CppUMockGen_CompilationDatabase_test" );
+static const std::filesystem::path buildDirPath = tempDirPath / "build";
+static const std::string buildDir = buildDirPath.generic_string();
+static const std::string projectDir = tempDirPath.generic_string();
+
+TEST_GROUP( CompilationDatabase )
+{
+    TEST_SETUP()
+    {
+        std::filesystem::remove_all( tempDirPath );
+        std::filesystem::create_directories( buildDirPath );
+    }
+
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove_all( tempDirPath );
+    }
+
+    void WriteDatabase( const std::vector<std::string> &entries )
+    {
+        std::ofstream file( buildDirPath / "compile_commands.json" );
+        file << "[\n";
+        for( size_t i = 0; i < entries.size(); i++ )
+        {
+            file << ( ( i > 0 ) ? ",\n" : "" ) << entries[i];
+        }
+        file << "\n]\n";
+    }
+
+    std::string Entry( const std::string &file, const std::string &command )
+    {
+        return "{ \"directory\": \"" + buildDir + "\", \"command\": \"" + command + "\", \"file\": \"" + file + "\" }";
+    }
+
+    std::string FlagsToString( const CompilationDatabase::Flags *flags )
+    {
+        std::string ret;
+        for( const std::string &arg : flags->args )
+        {
+            ret += arg + " ";
+        }
+        return ret;
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that an error is reported if the compilation database does not exist.
+ */
+TEST( CompilationDatabase, NonExistingDatabase )
+{
+    // Exercise & Verify
+    try
+    {
+        CompilationDatabase compilationDatabase( tempDirPath / "nonexisting" );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_CONTAINS( "Compilation database", e.what() );
+        STRCMP_CONTAINS( "does not exist", e.what() );
+    }
+}
+
+/*
+ * Check that the compilation database can be loaded passing the path to the database file or to its directory.
+ */
+TEST( CompilationDatabase, DatabasePath )
+{
+    // Prepare
+    WriteDatabase( { Entry( projectDir + "/src/foo.c", "cc -DFOO -c ../src/foo.c" ) } );
+
+    for( const std::filesystem::path &path : { buildDirPath, buildDirPath / "compile_commands.json" } )
+    {
+        // Exercise
+        CompilationDatabase compilationDatabase( path );
+        const CompilationDatabase::Flags *flags = compilationDatabase.GetFlags( tempDirPath / "src" / "foo.h" );
+
+        // Verify
+        CHECK( flags != nullptr );
+        STRCMP_EQUAL( "-DFOO ", FlagsToString( flags ).c_str() );
+    }
+}
+
+/*
+ * Check that only the arguments relevant for parsing are taken, and that relative paths are resolved from the
+ * compilation directory.
+ */
+TEST( CompilationDatabase, Arguments )
+{
+    // Prepare
+    WriteDatabase( { Entry( "../src/foo.c", "cc -O2 -Wall -DFOO -D BAR=1 -UBAZ -I../include -I /usr/include/xyz "
+                                            "-isystem ../sys -iquote../quote -include ../config.h -std=gnu11 "
+                                            "-MF foo.d -o foo.o -c ../src/foo.c" ) } );
+
+    // Exercise
+    CompilationDatabase compilationDatabase( buildDirPath );
+    const CompilationDatabase::Flags *flags = compilationDatabase.GetFlags( tempDirPath / "src" / "foo.h" );
+
+    // Verify
+    CHECK( flags != nullptr );
+    std::string expectedFlags = "-DFOO -DBAR=1 -UBAZ -I " + projectDir + "/include -I /usr/include/xyz -isystem " +
+                                projectDir + "/sys -iquote " + projectDir + "/quote -include " + projectDir +
+                                "/config.h -std=gnu11 ";
+    STRCMP_EQUAL( expectedFlags.c_str(), FlagsToString( flags ).c_str() );
+    CHECK_FALSE( flags->isCpp );
+}
+
+/*
+ * Check that translation units are detected as C++ by their extension, language option or language standard.
+ */
+TEST( CompilationDatabase, Language )
+{
+    // Prepare
+    WriteDatabase( { Entry( projectDir + "/a/unit.c", "cc -c unit.c" ),
+                     Entry( projectDir + "/b/unit.cpp", "c++ -c unit.cpp" ),
+                     Entry( projectDir + "/c/unit.c", "cc -x c++ -c unit.c" ),
+                     Entry( projectDir + "/d/unit.c", "cc -std=c++17 -c unit.c" ) } );
+
+    // Exercise
+    CompilationDatabase compilationDatabase( buildDirPath );
+
+    // Verify
+    CHECK_FALSE( compilationDatabase.GetFlags( tempDirPath / "a" / "unit.h" )->isCpp );
+    CHECK_TRUE( compilationDatabase.GetFlags( tempDirPath / "b" / "unit.h" )->isCpp );
+    CHECK_TRUE( compilationDatabase.GetFlags( tempDirPath / "c" / "unit.h" )->isCpp );
+    CHECK_TRUE( compilationDatabase.GetFlags( tempDirPath / "d" / "unit.h" )->isCpp );
+}
+
+/*
+ * Check that the translation unit with the same name in the same directory as the header is preferred.
+ */
+TEST( CompilationDatabase, Lookup_SameNameSameDirectory )
+{
+    // Prepare
+    WriteDatabase( { Entry( projectDir + "/src/bar.c", "cc -DBAR -c bar.c" ),
+                     Entry( projectDir + "/other/foo.c", "cc -DOTHER_FOO -c foo.c" ),
+                     Entry( projectDir + "/src/foo.c", "cc -DFOO -c foo.c" ) } );
+
+    // Exercise
+    CompilationDatabase compilationDatabase( buildDirPath );
+    const CompilationDatabase::Flags *flags = compilationDatabase.GetFlags( tempDirPath / "src" / "foo.h" );
+
+    // Verify
+    CHECK( flags != nullptr );
+    STRCMP_EQUAL( "-DFOO ", FlagsToString( flags ).c_str() );
+}
+
+/*
+ * Check that the translation unit with the same name in the nearest directory to the header is used if there is no
+ * translation unit with the same name in the same directory.
+ */
+TEST( CompilationDatabase, Lookup_SameNameNearestDirectory )
+{
+    // Prepare
+    WriteDatabase( { Entry( projectDir + "/lib1/src/foo.c", "cc -DLIB1_FOO -c foo.c" ),
+                     Entry( projectDir + "/lib2/src/foo.c", "cc -DLIB2_FOO -c foo.c" ),
+                     Entry( projectDir + "/lib2/include/bar.c", "cc -DLIB2_BAR -c bar.c" ) } );
+
+    // Exercise
+    CompilationDatabase compilationDatabase( buildDirPath );
+    const CompilationDatabase::Flags *flags = compilationDatabase.GetFlags( tempDirPath / "lib2" / "include" / "foo.h" );
+
+    // Verify
+    CHECK( flags != nullptr );
+    STRCMP_EQUAL( "-DLIB2_FOO ", FlagsToString( flags ).c_str() );
+}
+
+/*
+ * Check that a translation unit in the nearest parent directory is used if there is no translation unit with the same
+ * name as the header.
+ */
+TEST( CompilationDatabase, Lookup_NearestParentDirectory )
+{
+    // Prepare
+    WriteDatabase( { Entry( projectDir + "/lib1/main.c", "cc -DLIB1 -c main.c" ),
+                     Entry( projectDir + "/lib2/main.c", "cc -DLIB2 -c main.c" ),
+                     Entry( projectDir + "/lib2/sub/other.c", "cc -DLIB2_OTHER -c other.c" ) } );
+
+    // Exercise
+    CompilationDatabase compilationDatabase( buildDirPath );
+    const CompilationDatabase::Flags *flags = compilationDatabase.GetFlags( tempDirPath / "lib2" / "include" / "foo.h" );
+
+    // Verify
+    CHECK( flags != nullptr );
+    STRCMP_EQUAL( "-DLIB2 ", FlagsToString( flags ).c_str() );
+}
+
+/*
+ * Check that no flags are returned if no translation unit is related to the header.
+ */
+TEST( CompilationDatabase, Lookup_NotFound )
+{
+    // Prepare
+    WriteDatabase( { Entry( projectDir + "/lib1/main.c", "cc -DLIB1 -c main.c" ) } );
+
+    // Exercise
+    CompilationDatabase compilationDatabase( buildDirPath );
+    const CompilationDatabase::Flags *flags = compilationDatabase.GetFlags( tempDirPath / "lib2" / "foo.h" );
+
+    // Verify
+    CHECK( flags == nullptr );
+}
@@ -48,8 +48,8 @@ TEST_GROUP( Config )
 TEST( Config, InterpretAsCpp )
 {
     // Prepare
-    Config testConfigTrue( true, "", false, std::vector<std::string>() );
-    Config testConfigFalse( false, "", false, std::vector<std::string>() );
+    Config testConfigTrue( true, "", false, std::vector<std::string>(), std::vector<std::string>() );
+    Config testConfigFalse( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
 
     // Exercise & Verify
     CHECK_TRUE( testConfigTrue.InterpretAsCpp() );
@@ -64,8 +64,8 @@ TEST( Config, InterpretAsCpp )
 TEST( Config, LanguageStandard )
 {
     // Prepare
-    Config testConfigEmpty( false, "", false, std::vector<std::string>() );
-    Config testConfigNonEmpty( false, "std-xxx", false, std::vector<std::string>() );
+    Config testConfigEmpty( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+    Config testConfigNonEmpty( false, "std-xxx", false, std::vector<std::string>(), std::vector<std::string>() );
 
     // Exercise & Verify
     CHECK( testConfigEmpty.GetLanguageStandard().empty() );
@@ -80,8 +80,8 @@ TEST( Config, LanguageStandard )
 TEST( Config, UseUnderlyingTypedefType )
 {
     // Prepare
-    Config testConfigTrue( false, "", true, std::vector<std::string>() );
-    Config testConfigFalse( false, "", false, std::vector<std::string>() );
+    Config testConfigTrue( false, "", true, std::vector<std::string>(), std::vector<std::string>() );
+    Config testConfigFalse( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
 
     // Exercise & Verify
     CHECK_TRUE( testConfigTrue.UseUnderlyingTypedefType() );
@@ -96,7 +96,7 @@ TEST( Config, UseUnderlyingTypedefType )
 TEST( Config, OverrideOptions_Empty )
 {
     // Prepare
-    Config testConfig( false, "", false, std::vector<std::string>() );
+    Config testConfig( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
 
     // Exercise & Verify
     POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("") );
@@ -114,7 +114,7 @@ TEST( Config, OverrideOptions_Empty )
 TEST( Config, SpecificTypeOverrideOptions_Simple )
 {
     // Prepare
-    Config testConfig( false, "", false, std::vector<std::string> { "function1#p=Int", "ns1::function2@=ConstPointer" } );
+    Config testConfig( false, "", false, std::vector<std::string> { "function1#p=Int", "ns1::function2@=ConstPointer" }, std::vector<std::string>() );
 
     // Exercise
     const Config::OverrideSpec* override1 = testConfig.GetTypeOverride("function1#p");
@@ -153,7 +153,7 @@ TEST( Config, SpecificTypeOverrideOptions_Simple )
 TEST( Config, GenericTypeOverrideOptions_Simple )
 {
     // Prepare
-    Config testConfig( false, "", false, std::vector<std::string> { "#class1=Int", "@class2 *=ConstPointer" } );
+    Config testConfig( false, "", false, std::vector<std::string> { "#class1=Int", "@class2 *=ConstPointer" }, std::vector<std::string>() );
 
     // Exercise
     const Config::OverrideSpec* override1 = testConfig.GetTypeOverride("#class1");
@@ -184,6 +184,138 @@ TEST( Config, GenericTypeOverrideOptions_Simple )
     // Cleanup
 }
 
+/*
+ * Check that type override options with patterns are handled properly.
+ */
+TEST( Config, TypeOverrideOptions_Patterns )
+{
+    // Prepare
+    Config testConfig( false, "", false,
+                       std::vector<std::string> { "%#*_handle_t=Pointer", "%mylib::*#buf=Output", "%*#size=UnsignedLongInt",
+                                                  "#int *=ConstPointer", "%#int?=Int", "%@*_t=LongInt", "%mylib::f?@=Bool",
+                                                  "%#const *Struct* \\*=InputPOD", "%#void (\\*)(?*)=Pointer",
+                                                  "%#char \\*\\*=String", "%#*=Skip", "mylib::func1#buf=Int" },
+                       std::vector<std::string>() );
+
+    // Exercise & Verify
+    const Config::OverrideSpec* testedOverride;
+
+    // Patterns match any sequence of characters
+    testedOverride = testConfig.GetTypeOverride("#conn_handle_t");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Pointer, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("mylib::ns::func2#buf");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Output, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("func3#size");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::UnsignedLong, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("@size_t");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Long, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("#const struct Struct1 *");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::InputPOD, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("#void (*)(int, char)");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Pointer, (int)testedOverride->GetType() );
+
+    // Patterns match any single character
+    testedOverride = testConfig.GetTypeOverride("#int8");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Int, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("mylib::f1@");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Bool, (int)testedOverride->GetType() );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("mylib::f12@") );
+
+    // Escaped characters match themselves
+    testedOverride = testConfig.GetTypeOverride("#char **");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::String, (int)testedOverride->GetType() );
+
+    // Exact keys take preference over patterns
+    testedOverride = testConfig.GetTypeOverride("#int *");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::ConstPointer, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("mylib::func1#buf");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Int, (int)testedOverride->GetType() );
+
+    // The first pattern passed that matches is applied
+    testedOverride = testConfig.GetTypeOverride("#int **");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Skip, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("#int_handle_t");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Pointer, (int)testedOverride->GetType() );
+
+    // Function-specific patterns do not match generic keys
+    testedOverride = testConfig.GetTypeOverride("#size");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Skip, (int)testedOverride->GetType() );
+
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("mylib::func1#p") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("otherlib::func1#buf") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("@int") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("func3@") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("mylib::ns::func2#buf2") );
+
+    // Cleanup
+}
+
+/*
+ * Check that '?' and '*' are ordinary characters in keys that are not patterns (e.g. in operators or pointer types).
+ */
+TEST( Config, TypeOverrideOptions_OperatorKeys )
+{
+    // Prepare
+    Config testConfig( false, "", false,
+                       std::vector<std::string> { "Class1::operator*#arg=Int", "Class1::operator*=#arg=Double",
+                                                  "Class1::operator*@=Bool", "#int **=Pointer", "#void (*)(int)=ConstPointer" },
+                       std::vector<std::string>() );
+
+    // Exercise & Verify
+    const Config::OverrideSpec* testedOverride;
+
+    testedOverride = testConfig.GetTypeOverride("Class1::operator*#arg");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Int, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("Class1::operator*=#arg");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Double, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("Class1::operator*@");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Bool, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("#int **");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::Pointer, (int)testedOverride->GetType() );
+
+    testedOverride = testConfig.GetTypeOverride("#void (*)(int)");
+    CHECK( testedOverride != NULL );
+    CHECK_EQUAL( (int)MockedType::ConstPointer, (int)testedOverride->GetType() );
+
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("Class1::operator+#arg") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("Class1::operator*=@") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("Class1::operator*#arg2") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("#int ***") );
+    POINTERS_EQUAL( NULL, testConfig.GetTypeOverride("#void (*)(char)") );
+
+    // Cleanup
+}
+
 /*
  * Check that specific type override options allowed types are accepted.
  */
@@ -212,7 +344,7 @@ TEST( Config, SpecificTypeOverrideOptions_AllowedTypes )
         "function1#p16=InputPOD",
         "function1#p17=MemoryBuffer:p17_size",
         "function1#p18=OutputPOD",
-    } );
+    }, std::vector<std::string>() );
 
     // Verify
     CHECK( testConfig.GetTypeOverride("function1#p1") != NULL );
@@ -265,7 +397,7 @@ TEST( Config, GenericTypeOverrideOptions_AllowedTypes )
         "#type16=InputPOD",
         "#type17=MemoryBuffer:sizeof(*$)",
         "#type18=OutputPOD",
-    } );
+    }, std::vector<std::string>() );
 
     // Verify
     CHECK( testConfig.GetTypeOverride("#type1") != NULL );
@@ -308,7 +440,7 @@ TEST( Config, SpecificTypeOverrideOptions_WithExpressions )
                                                   "func8#p=MemoryBuffer:sizeof(*$)",
                                                   "func9#p1=MemoryBuffer:p3~&$",
                                                   "func10#p=MemoryBuffer:getSize($)~$.get()",
-                                                } );
+                                                }, std::vector<std::string>() );
 
     // Exercise
     const Config::OverrideSpec* override1 = testConfig.GetTypeOverride("function1#p");
@@ -455,7 +587,7 @@ TEST( Config, GenericTypeOverrideOptions_WithExpressions )
                                                   "#typeJ=OutputOfType:TypeL<OtherTypeD~&$->getL()", 
                                                   "#typeM=MemoryBuffer:p3~&$",
                                                   "#typeN=MemoryBuffer:getSize($)~$.get()",
-                                                } );
+                                                }, std::vector<std::string>() );
 
     // Exercise
     const Config::OverrideSpec* override1 = testConfig.GetTypeOverride("#const int *");
@@ -557,19 +689,19 @@ TEST( Config, Exception_TypeOverride_OverallBadFormat )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p" }, std::vector<std::string>() ) );
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1@" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1@" }, std::vector<std::string>() ) );
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#class1" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#class1" }, std::vector<std::string>() ) );
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@class1" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@class1" }, std::vector<std::string>() ) );
 
 
     // Cleanup
@@ -584,22 +716,28 @@ TEST( Config, Exception_TypeOverride_KeyBadFormat )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "=Int" } ) );
+                  Config( false, "", false, std::vector<std::string> { "=Int" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p#=Int" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p#=Int" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#function1#p=Int" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#function1#p=Int" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type1#=Int" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type1#=Int" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1@p=Int" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1@p=Int" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@type1@=Int" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@type1@=Int" }, std::vector<std::string>() ) );
+
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string> { "%=Int" }, std::vector<std::string>() ) );
+
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string> { "%#type\\=Int" }, std::vector<std::string>() ) );
 
     // Cleanup
 }
@@ -613,52 +751,52 @@ TEST( Config, Exception_TypeOverride_SpecificValueBadFormat )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=abc" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=abc" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=~" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=~" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=Int~" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=Int~" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=Int~abc" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=Int~abc" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1@=Output" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1@=Output" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1@=Skip" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1@=Skip" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:a<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:a<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:<a" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=InputOfType:<a" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:a<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:a<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:<a" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function2#p=OutputOfType:<a" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function3#p=MemoryBuffer:" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function3#p=MemoryBuffer:" }, std::vector<std::string>() ) );
 
     // Cleanup
 }
@@ -671,52 +809,52 @@ TEST( Config, Exception_TypeOverride_GenericValueBadFormat )
     // Prepare
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@class1=" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@class1=" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type1=abc" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type1=abc" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@class1=~" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@class1=~" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#class1=Int~" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#class1=Int~" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type2=Int~abc" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type2=Int~abc" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@class1=Output" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@class1=Output" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@class1=Skip" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@class1=Skip" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:a<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:a<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:<a" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type3=InputOfType:<a" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:a<" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:a<" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:<a" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type4=OutputOfType:<a" }, std::vector<std::string>() ) );
 
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#type5=MemoryBuffer:" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#type5=MemoryBuffer:" }, std::vector<std::string>() ) );
 
     // Cleanup
 }
@@ -730,7 +868,7 @@ TEST( Config, Exception_FunctionParameterRepeated )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1#p=Int", "function1#p=Double" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1#p=Int", "function1#p=Double" }, std::vector<std::string>() ) );
 }
 
 /*
@@ -742,7 +880,7 @@ TEST( Config, Exception_FunctionReturnRepeated )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "function1@=Int", "function1@=Double" } ) );
+                  Config( false, "", false, std::vector<std::string> { "function1@=Int", "function1@=Double" }, std::vector<std::string>() ) );
 }
 
 /*
@@ -754,7 +892,7 @@ TEST( Config, Exception_TypeParameterRepeated )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "#class1=Int", "#class1=Double" } ) );
+                  Config( false, "", false, std::vector<std::string> { "#class1=Int", "#class1=Double" }, std::vector<std::string>() ) );
 }
 
 /*
@@ -766,5 +904,81 @@ TEST( Config, Exception_TypeReturnRepeated )
 
     // Exercise & Verify
     CHECK_THROWS( std::runtime_error,
-                  Config( false, "", false, std::vector<std::string> { "@class1=Int", "@class1=Double" } ) );
+                  Config( false, "", false, std::vector<std::string> { "@class1=Int", "@class1=Double" }, std::vector<std::string>() ) );
+}
+
+/*
+ * Check that an exception is thrown when a type override option pattern is repeated.
+ */
+TEST( Config, Exception_TypePatternRepeated )
+{
+    // Prepare
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string> { "%#*_t=Int", "%#*_t=Double" }, std::vector<std::string>() ) );
+
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string> { "%ns::*#p=Int", "%ns::**#p=Double" }, std::vector<std::string>() ) );
+
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string> { "#int *=Int", "%#int \\*=Double" }, std::vector<std::string>() ) );
+}
+
+/*
+ * Check that type map options are converted into type declarations.
+ */
+TEST( Config, TypeMap )
+{
+    // Prepare
+    Config testConfigEmpty( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+    Config testConfig( false, "", false, std::vector<std::string>(),
+                       std::vector<std::string> { "uint32_t=unsigned int", " ctx_t = struct ctx ", "callback_t=void(*)(int)" } );
+
+    // Exercise & Verify
+    STRCMP_EQUAL( "", testConfigEmpty.GetTypeMapDeclarations().c_str() );
+    STRCMP_EQUAL( "typedef __typeof__(unsigned int) uint32_t;\n"
+                  "typedef __typeof__(struct ctx) ctx_t;\n"
+                  "typedef __typeof__(void(*)(int)) callback_t;\n",
+                  testConfig.GetTypeMapDeclarations().c_str() );
+}
+
+/*
+ * Check that an exception is thrown when a type map option is not valid.
+ */
+TEST( Config, Exception_TypeMap_BadFormat )
+{
+    // Prepare
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "uint32_t" } ) );
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "=int" } ) );
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "1type=int" } ) );
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "ns::type=int" } ) );
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "type=" } ) );
+}
+
+/*
+ * Check that an exception is thrown when a type map option type name is repeated.
+ */
+TEST( Config, Exception_TypeMap_Repeated )
+{
+    // Prepare
+
+    // Exercise & Verify
+    CHECK_THROWS( std::runtime_error,
+                  Config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "type1=int", "type1=long" } ) );
 }
@@ -0,0 +1,99 @@
+/**
+ * @file
+ * @brief      Unit tests for the "DependencyFile" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <vector>
+#include <string>
+#include <filesystem>
+
+#include "DependencyFile.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( DependencyFile )
+{
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that a rule without prerequisites is generated when there are no dependencies.
+ */
+TEST( DependencyFile, NoDependencies )
+{
+    // Prepare
+    DependencyFile dependencyFile( { "out/foo_mock.cpp" } );
+
+    // Exercise
+    std::string contents = dependencyFile.Generate( {} );
+
+    // Verify
+    STRCMP_EQUAL( "out/foo_mock.cpp:\n", contents.c_str() );
+}
+
+/*
+ * Check that all dependencies are listed as prerequisites of the target, one per line.
+ */
+TEST( DependencyFile, SingleTarget )
+{
+    // Prepare
+    DependencyFile dependencyFile( { "out/foo_mock.cpp" } );
+
+    // Exercise
+    std::string contents = dependencyFile.Generate( { "foo.h", "include/bar.h", "/usr/include/stdint.h" } );
+
+    // Verify
+    STRCMP_EQUAL( "out/foo_mock.cpp: \\\n"
+                  "  foo.h \\\n"
+                  "  include/bar.h \\\n"
+                  "  /usr/include/stdint.h\n", contents.c_str() );
+}
+
+/*
+ * Check that several targets can share the same dependencies.
+ */
+TEST( DependencyFile, MultipleTargets )
+{
+    // Prepare
+    DependencyFile dependencyFile( { "out/foo_expect.hpp", "out/foo_expect.cpp" } );
+
+    // Exercise
+    std::string contents = dependencyFile.Generate( { "foo.h" } );
+
+    // Verify
+    STRCMP_EQUAL( "out/foo_expect.hpp out/foo_expect.cpp: \\\n"
+                  "  foo.h\n", contents.c_str() );
+}
+
+/*
+ * Check that characters with special meaning in Makefiles are escaped in paths.
+ */
+TEST( DependencyFile, SpecialCharacters )
+{
+    // Prepare
+    DependencyFile dependencyFile( { "my out/foo_mock.cpp" } );
+
+    // Exercise
+    std::string contents = dependencyFile.Generate( { "my dir/foo#1.h", "$bar.h" } );
+
+    // Verify
+    STRCMP_EQUAL( "my\\ out/foo_mock.cpp: \\\n"
+                  "  my\\ dir/foo\\#1.h \\\n"
+                  "  $$bar.h\n", contents.c_str() );
+}
@@ -0,0 +1,51 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const std::string &=String~$.c_str()" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include "BatchFileParser_expect.hpp"
+
+namespace expect { namespace BatchFileParser$ {
+MockExpectedCall& BatchFileParser$ctor()
+{
+    return BatchFileParser$ctor(1);
+}
+MockExpectedCall& BatchFileParser$ctor(unsigned int __numCalls__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "BatchFileParser::BatchFileParser");
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace BatchFileParser$ {
+MockExpectedCall& Parse(CppUMockGen::Parameter<const BatchFileParser*> __object__, CppUMockGen::Parameter<const char*> filepath)
+{
+    return Parse(1, __object__, filepath);
+}
+MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const BatchFileParser*> __object__, CppUMockGen::Parameter<const char*> filepath)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "BatchFileParser::Parse");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<BatchFileParser*>(__object__.getValue())); }
+    if(filepath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("filepath", filepath.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace BatchFileParser$ {
+MockExpectedCall& GetEntries(CppUMockGen::Parameter<const BatchFileParser*> __object__, const std::vector<BatchFileParser::Entry> * __return__)
+{
+    return GetEntries(1, __object__, __return__);
+}
+MockExpectedCall& GetEntries(unsigned int __numCalls__, CppUMockGen::Parameter<const BatchFileParser*> __object__, const std::vector<BatchFileParser::Entry> * __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "BatchFileParser::GetEntries");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<BatchFileParser*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(__return__));
+    return __expectedCall__;
+}
+} }
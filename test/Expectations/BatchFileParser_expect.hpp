@@ -0,0 +1,28 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const std::string &=String~$.c_str()" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include <CppUMockGen.hpp>
+
+#include "BatchFileParser.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+namespace expect { namespace BatchFileParser$ {
+MockExpectedCall& BatchFileParser$ctor();
+MockExpectedCall& BatchFileParser$ctor(unsigned int __numCalls__);
+} }
+
+namespace expect { namespace BatchFileParser$ {
+MockExpectedCall& Parse(CppUMockGen::Parameter<const BatchFileParser*> __object__, CppUMockGen::Parameter<const char*> filepath);
+MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const BatchFileParser*> __object__, CppUMockGen::Parameter<const char*> filepath);
+} }
+
+namespace expect { namespace BatchFileParser$ {
+MockExpectedCall& GetEntries(CppUMockGen::Parameter<const BatchFileParser*> __object__, const std::vector<BatchFileParser::Entry> * __return__);
+MockExpectedCall& GetEntries(unsigned int __numCalls__, CppUMockGen::Parameter<const BatchFileParser*> __object__, const std::vector<BatchFileParser::Entry> * __return__);
+} }
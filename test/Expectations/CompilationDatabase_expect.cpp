@@ -0,0 +1,42 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include "CompilationDatabase_expect.hpp"
+
+namespace expect { namespace CompilationDatabase$ {
+MockExpectedCall& CompilationDatabase$ctor(CppUMockGen::Parameter<const char*> path)
+{
+    return CompilationDatabase$ctor(1, path);
+}
+MockExpectedCall& CompilationDatabase$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const char*> path)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "CompilationDatabase::CompilationDatabase");
+    if(path.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("path", path.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace CompilationDatabase$ {
+MockExpectedCall& GetFlags(CppUMockGen::Parameter<const CompilationDatabase*> __object__, CppUMockGen::Parameter<const char*> headerFilePath, const CompilationDatabase::Flags * __return__)
+{
+    return GetFlags(1, __object__, headerFilePath, __return__);
+}
+MockExpectedCall& GetFlags(unsigned int __numCalls__, CppUMockGen::Parameter<const CompilationDatabase*> __object__, CppUMockGen::Parameter<const char*> headerFilePath, const CompilationDatabase::Flags * __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "CompilationDatabase::GetFlags");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<CompilationDatabase*>(__object__.getValue())); }
+    if(headerFilePath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("headerFilePath", headerFilePath.getValue()); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(__return__));
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
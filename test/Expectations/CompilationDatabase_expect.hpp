@@ -0,0 +1,24 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include <CppUMockGen.hpp>
+
+#include "CompilationDatabase.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+namespace expect { namespace CompilationDatabase$ {
+MockExpectedCall& CompilationDatabase$ctor(CppUMockGen::Parameter<const char*> path);
+MockExpectedCall& CompilationDatabase$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const char*> path);
+} }
+
+namespace expect { namespace CompilationDatabase$ {
+MockExpectedCall& GetFlags(CppUMockGen::Parameter<const CompilationDatabase*> __object__, CppUMockGen::Parameter<const char*> headerFilePath, const CompilationDatabase::Flags * __return__);
+MockExpectedCall& GetFlags(unsigned int __numCalls__, CppUMockGen::Parameter<const CompilationDatabase*> __object__, CppUMockGen::Parameter<const char*> headerFilePath, const CompilationDatabase::Flags * __return__);
+} }
+
@@ -137,11 +137,11 @@ MockExpectedCall& GetExpectationArgTypeName(unsigned int __numCalls__, CppUMockG
 } } }
 
 namespace expect { namespace Config$ {
-MockExpectedCall& Config$ctor(CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions)
+MockExpectedCall& Config$ctor(CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions, CppUMockGen::Parameter<const std::vector<std::string> &> typeMapOptions)
 {
-    return Config$ctor(1, interpretAsCpp, languageStandard, useUnderlyingTypedefType, typeOverrideOptions);
+    return Config$ctor(1, interpretAsCpp, languageStandard, useUnderlyingTypedefType, typeOverrideOptions, typeMapOptions);
 }
-MockExpectedCall& Config$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions)
+MockExpectedCall& Config$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions, CppUMockGen::Parameter<const std::vector<std::string> &> typeMapOptions)
 {
     bool __ignoreOtherParams__ = false;
     MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Config::Config");
@@ -149,6 +149,7 @@ MockExpectedCall& Config$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<
     if(languageStandard.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("languageStandard", languageStandard.getValue()); }
     if(useUnderlyingTypedefType.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withBoolParameter("useUnderlyingTypedefType", useUnderlyingTypedefType.getValue()); }
     if(typeOverrideOptions.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "typeOverrideOptions", &typeOverrideOptions.getValue()); }
+    if(typeMapOptions.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "typeMapOptions", &typeMapOptions.getValue()); }
     if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
     return __expectedCall__;
 }
@@ -213,3 +214,17 @@ MockExpectedCall& GetTypeOverride(unsigned int __numCalls__, CppUMockGen::Parame
 }
 } }
 
+namespace expect { namespace Config$ {
+MockExpectedCall& GetTypeMapDeclarations(CppUMockGen::Parameter<const Config*> __object__, const std::string * __return__)
+{
+    return GetTypeMapDeclarations(1, __object__, __return__);
+}
+MockExpectedCall& GetTypeMapDeclarations(unsigned int __numCalls__, CppUMockGen::Parameter<const Config*> __object__, const std::string * __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Config::GetTypeMapDeclarations");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Config*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(__return__));
+    return __expectedCall__;
+}
+} }
+
@@ -58,8 +58,8 @@ MockExpectedCall& GetExpectationArgTypeName(unsigned int __numCalls__, CppUMockG
 } } }
 
 namespace expect { namespace Config$ {
-MockExpectedCall& Config$ctor(CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions);
-MockExpectedCall& Config$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions);
+MockExpectedCall& Config$ctor(CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions, CppUMockGen::Parameter<const std::vector<std::string> &> typeMapOptions);
+MockExpectedCall& Config$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<bool> interpretAsCpp, CppUMockGen::Parameter<const char*> languageStandard, CppUMockGen::Parameter<bool> useUnderlyingTypedefType, CppUMockGen::Parameter<const std::vector<std::string> &> typeOverrideOptions, CppUMockGen::Parameter<const std::vector<std::string> &> typeMapOptions);
 } }
 
 namespace expect { namespace Config$ {
@@ -82,3 +82,8 @@ MockExpectedCall& GetTypeOverride(CppUMockGen::Parameter<const Config*> __object
 MockExpectedCall& GetTypeOverride(unsigned int __numCalls__, CppUMockGen::Parameter<const Config*> __object__, CppUMockGen::Parameter<const char*> key, const Config::OverrideSpec * __return__);
 } }
 
+namespace expect { namespace Config$ {
+MockExpectedCall& GetTypeMapDeclarations(CppUMockGen::Parameter<const Config*> __object__, const std::string * __return__);
+MockExpectedCall& GetTypeMapDeclarations(unsigned int __numCalls__, CppUMockGen::Parameter<const Config*> __object__, const std::string * __return__);
+} }
+
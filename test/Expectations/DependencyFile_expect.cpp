@@ -0,0 +1,40 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ */
+
+#include "DependencyFile_expect.hpp"
+
+namespace expect { namespace DependencyFile$ {
+MockExpectedCall& DependencyFile$ctor(CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> targets)
+{
+    return DependencyFile$ctor(1, targets);
+}
+MockExpectedCall& DependencyFile$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> targets)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "DependencyFile::DependencyFile");
+    if(targets.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "targets", &targets.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace DependencyFile$ {
+MockExpectedCall& Generate(CppUMockGen::Parameter<const DependencyFile*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, std::string &__return__)
+{
+    return Generate(1, __object__, dependencies, __return__);
+}
+MockExpectedCall& Generate(unsigned int __numCalls__, CppUMockGen::Parameter<const DependencyFile*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, std::string &__return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "DependencyFile::Generate");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<DependencyFile*>(__object__.getValue())); }
+    if(dependencies.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies.getValue()); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
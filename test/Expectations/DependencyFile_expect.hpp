@@ -0,0 +1,22 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ */
+
+#include <CppUMockGen.hpp>
+
+#include "DependencyFile.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+namespace expect { namespace DependencyFile$ {
+MockExpectedCall& DependencyFile$ctor(CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> targets);
+MockExpectedCall& DependencyFile$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> targets);
+} }
+
+namespace expect { namespace DependencyFile$ {
+MockExpectedCall& Generate(CppUMockGen::Parameter<const DependencyFile*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, std::string &__return__);
+MockExpectedCall& Generate(unsigned int __numCalls__, CppUMockGen::Parameter<const DependencyFile*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, std::string &__return__);
+} }
+
@@ -0,0 +1,65 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17
+ */
+
+#include "FileWatcher_expect.hpp"
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& FileWatcher$ctor()
+{
+    return FileWatcher$ctor(1);
+}
+MockExpectedCall& FileWatcher$ctor(unsigned int __numCalls__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "FileWatcher::FileWatcher");
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& FileWatcher$dtor(CppUMockGen::Parameter<const FileWatcher*> __object__)
+{
+    return FileWatcher$dtor(1, __object__);
+}
+MockExpectedCall& FileWatcher$dtor(unsigned int __numCalls__, CppUMockGen::Parameter<const FileWatcher*> __object__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "FileWatcher::~FileWatcher");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<FileWatcher*>(__object__.getValue())); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& Watch(CppUMockGen::Parameter<const FileWatcher*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> filePaths)
+{
+    return Watch(1, __object__, filePaths);
+}
+MockExpectedCall& Watch(unsigned int __numCalls__, CppUMockGen::Parameter<const FileWatcher*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> filePaths)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "FileWatcher::Watch");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<FileWatcher*>(__object__.getValue())); }
+    if(filePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "filePaths", &filePaths.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& WaitForChanges(CppUMockGen::Parameter<const FileWatcher*> __object__, std::vector<std::filesystem::path> &__return__)
+{
+    return WaitForChanges(1, __object__, __return__);
+}
+MockExpectedCall& WaitForChanges(unsigned int __numCalls__, CppUMockGen::Parameter<const FileWatcher*> __object__, std::vector<std::filesystem::path> &__return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "FileWatcher::WaitForChanges");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<FileWatcher*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    return __expectedCall__;
+}
+} }
+
@@ -0,0 +1,34 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17
+ */
+
+#include <CppUMockGen.hpp>
+
+#include "FileWatcher.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& FileWatcher$ctor();
+MockExpectedCall& FileWatcher$ctor(unsigned int __numCalls__);
+} }
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& FileWatcher$dtor(CppUMockGen::Parameter<const FileWatcher*> __object__ = ::CppUMockGen::IgnoreParameter::YES);
+MockExpectedCall& FileWatcher$dtor(unsigned int __numCalls__, CppUMockGen::Parameter<const FileWatcher*> __object__ = ::CppUMockGen::IgnoreParameter::YES);
+} }
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& Watch(CppUMockGen::Parameter<const FileWatcher*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> filePaths);
+MockExpectedCall& Watch(unsigned int __numCalls__, CppUMockGen::Parameter<const FileWatcher*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> filePaths);
+} }
+
+namespace expect { namespace FileWatcher$ {
+MockExpectedCall& WaitForChanges(CppUMockGen::Parameter<const FileWatcher*> __object__, std::vector<std::filesystem::path> &__return__);
+MockExpectedCall& WaitForChanges(unsigned int __numCalls__, CppUMockGen::Parameter<const FileWatcher*> __object__, std::vector<std::filesystem::path> &__return__);
+} }
+
@@ -82,6 +82,38 @@ MockExpectedCall& GenerateExpectation(unsigned int __numCalls__, CppUMockGen::Pa
 }
 } }
 
+namespace expect { namespace Function$ {
+MockExpectedCall& Serialize(CppUMockGen::Parameter<const Function*> __object__, const std::string* output)
+{
+    return Serialize(1, __object__, output);
+}
+MockExpectedCall& Serialize(unsigned int __numCalls__, CppUMockGen::Parameter<const Function*> __object__, const std::string* output)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Function::Serialize");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Function*>(__object__.getValue())); }
+    __expectedCall__.withOutputParameterOfTypeReturning("std::ostream", "output", output);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Function$ {
+MockExpectedCall& Deserialize(CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<void*> input, CppUMockGen::Parameter<const void*> config, bool __return__)
+{
+    return Deserialize(1, __object__, input, config, __return__);
+}
+MockExpectedCall& Deserialize(unsigned int __numCalls__, CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<void*> input, CppUMockGen::Parameter<const void*> config, bool __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Function::Deserialize");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Function*>(__object__.getValue())); }
+    if(input.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withPointerParameter("input", input.getValue()); }
+    if(config.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withConstPointerParameter("config", config.getValue()); }
+    __expectedCall__.andReturnValue(__return__);
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
 namespace expect { namespace Function$ {
 MockExpectedCall& IsMockable(CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<const void*> cursor, bool __return__)
 {
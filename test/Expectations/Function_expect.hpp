@@ -37,6 +37,16 @@ MockExpectedCall& GenerateExpectation(CppUMockGen::Parameter<const Function*> __
 MockExpectedCall& GenerateExpectation(unsigned int __numCalls__, CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<bool> proto, const char* __return__);
 } }
 
+namespace expect { namespace Function$ {
+MockExpectedCall& Serialize(CppUMockGen::Parameter<const Function*> __object__, const std::string* output);
+MockExpectedCall& Serialize(unsigned int __numCalls__, CppUMockGen::Parameter<const Function*> __object__, const std::string* output);
+} }
+
+namespace expect { namespace Function$ {
+MockExpectedCall& Deserialize(CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<void*> input, CppUMockGen::Parameter<const void*> config, bool __return__);
+MockExpectedCall& Deserialize(unsigned int __numCalls__, CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<void*> input, CppUMockGen::Parameter<const void*> config, bool __return__);
+} }
+
 namespace expect { namespace Function$ {
 MockExpectedCall& IsMockable(CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<const void*> cursor, bool __return__);
 MockExpectedCall& IsMockable(unsigned int __numCalls__, CppUMockGen::Parameter<const Function*> __object__, CppUMockGen::Parameter<const void*> cursor, bool __return__);
@@ -96,13 +96,41 @@ MockExpectedCall& IsVersionRequested(unsigned int __numCalls__, CppUMockGen::Par
 } }
 
 namespace expect { namespace Options$ {
-MockExpectedCall& GetInputPath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+MockExpectedCall& IsWorkerRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
 {
-    return GetInputPath(1, __object__, __return__);
+    return IsWorkerRequested(1, __object__, __return__);
 }
-MockExpectedCall& GetInputPath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+MockExpectedCall& IsWorkerRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
 {
-    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetInputPath");
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsWorkerRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetInputPaths(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
+{
+    return GetInputPaths(1, __object__, __return__);
+}
+MockExpectedCall& GetInputPaths(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetInputPaths");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetBatchFilePath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    return GetBatchFilePath(1, __object__, __return__);
+}
+MockExpectedCall& GetBatchFilePath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetBatchFilePath");
     if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
     __expectedCall__.andReturnValue(__return__);
     return __expectedCall__;
@@ -193,6 +221,174 @@ MockExpectedCall& IsRegenerationRequested(unsigned int __numCalls__, CppUMockGen
 }
 } }
 
+namespace expect { namespace Options$ {
+MockExpectedCall& GetNumJobs(CppUMockGen::Parameter<const Options*> __object__, unsigned int __return__)
+{
+    return GetNumJobs(1, __object__, __return__);
+}
+MockExpectedCall& GetNumJobs(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, unsigned int __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetNumJobs");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetCacheDirectory(CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    return GetCacheDirectory(1, __object__, __return__);
+}
+MockExpectedCall& GetCacheDirectory(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetCacheDirectory");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetCompilationDatabasePath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    return GetCompilationDatabasePath(1, __object__, __return__);
+}
+MockExpectedCall& GetCompilationDatabasePath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetCompilationDatabasePath");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsCheckRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsCheckRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsCheckRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsCheckRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsDepFileRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsDepFileRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsDepFileRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsDepFileRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsWatchRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsWatchRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsWatchRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsWatchRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetPreludeHeaders(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
+{
+    return GetPreludeHeaders(1, __object__, __return__);
+}
+MockExpectedCall& GetPreludeHeaders(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetPreludeHeaders");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsAutoPreludeRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsAutoPreludeRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsAutoPreludeRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsAutoPreludeRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsUmbrellaParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsUmbrellaParseRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsUmbrellaParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsUmbrellaParseRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsStreamingRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsStreamingRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsStreamingRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsStreamingRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetTimeReportPath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    return GetTimeReportPath(1, __object__, __return__);
+}
+MockExpectedCall& GetTimeReportPath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetTimeReportPath");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetTracePath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    return GetTracePath(1, __object__, __return__);
+}
+MockExpectedCall& GetTracePath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetTracePath");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
 namespace expect { namespace Options$ {
 MockExpectedCall& InterpretAsCpp(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
 {
@@ -235,6 +431,48 @@ MockExpectedCall& UseUnderlyingTypedef(unsigned int __numCalls__, CppUMockGen::P
 }
 } }
 
+namespace expect { namespace Options$ {
+MockExpectedCall& IsFastParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsFastParseRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsFastParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsFastParseRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsSingleFileParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsSingleFileParseRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsSingleFileParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsSingleFileParseRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsSimpleCParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    return IsSimpleCParseRequested(1, __object__, __return__);
+}
+MockExpectedCall& IsSimpleCParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::IsSimpleCParseRequested");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
 namespace expect { namespace Options$ {
 MockExpectedCall& GetTypeOverrides(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
 {
@@ -249,6 +487,20 @@ MockExpectedCall& GetTypeOverrides(unsigned int __numCalls__, CppUMockGen::Param
 }
 } }
 
+namespace expect { namespace Options$ {
+MockExpectedCall& GetTypeMap(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
+{
+    return GetTypeMap(1, __object__, __return__);
+}
+MockExpectedCall& GetTypeMap(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Options::GetTypeMap");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Options*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    return __expectedCall__;
+}
+} }
+
 namespace expect { namespace Options$ {
 MockExpectedCall& GetIncludePaths(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__)
 {
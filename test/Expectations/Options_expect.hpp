@@ -43,8 +43,18 @@ MockExpectedCall& IsVersionRequested(unsigned int __numCalls__, CppUMockGen::Par
 } }
 
 namespace expect { namespace Options$ {
-MockExpectedCall& GetInputPath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
-MockExpectedCall& GetInputPath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+MockExpectedCall& IsWorkerRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsWorkerRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetInputPaths(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
+MockExpectedCall& GetInputPaths(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetBatchFilePath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+MockExpectedCall& GetBatchFilePath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
 } }
 
 namespace expect { namespace Options$ {
@@ -77,6 +87,66 @@ MockExpectedCall& IsRegenerationRequested(CppUMockGen::Parameter<const Options*>
 MockExpectedCall& IsRegenerationRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
 } }
 
+namespace expect { namespace Options$ {
+MockExpectedCall& GetNumJobs(CppUMockGen::Parameter<const Options*> __object__, unsigned int __return__);
+MockExpectedCall& GetNumJobs(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, unsigned int __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetCacheDirectory(CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+MockExpectedCall& GetCacheDirectory(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetCompilationDatabasePath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+MockExpectedCall& GetCompilationDatabasePath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsCheckRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsCheckRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsDepFileRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsDepFileRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsWatchRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsWatchRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetPreludeHeaders(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
+MockExpectedCall& GetPreludeHeaders(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsAutoPreludeRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsAutoPreludeRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsUmbrellaParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsUmbrellaParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsStreamingRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsStreamingRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetTimeReportPath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+MockExpectedCall& GetTimeReportPath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& GetTracePath(CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+MockExpectedCall& GetTracePath(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, const char* __return__);
+} }
+
 namespace expect { namespace Options$ {
 MockExpectedCall& InterpretAsCpp(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
 MockExpectedCall& InterpretAsCpp(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
@@ -92,11 +162,31 @@ MockExpectedCall& UseUnderlyingTypedef(CppUMockGen::Parameter<const Options*> __
 MockExpectedCall& UseUnderlyingTypedef(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
 } }
 
+namespace expect { namespace Options$ {
+MockExpectedCall& IsFastParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsFastParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsSingleFileParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsSingleFileParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Options$ {
+MockExpectedCall& IsSimpleCParseRequested(CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+MockExpectedCall& IsSimpleCParseRequested(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, bool __return__);
+} }
+
 namespace expect { namespace Options$ {
 MockExpectedCall& GetTypeOverrides(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
 MockExpectedCall& GetTypeOverrides(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
 } }
 
+namespace expect { namespace Options$ {
+MockExpectedCall& GetTypeMap(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
+MockExpectedCall& GetTypeMap(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
+} }
+
 namespace expect { namespace Options$ {
 MockExpectedCall& GetIncludePaths(CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
 MockExpectedCall& GetIncludePaths(unsigned int __numCalls__, CppUMockGen::Parameter<const Options*> __object__, std::vector<std::string> &__return__);
@@ -3,17 +3,17 @@
  *
  * Contents will NOT be preserved if it is regenerated!!!
  *
- * Generation options: -s c++17 -t "Parser::Parse#error=Pointer~&$" -t "#const std::string &=String~$.c_str()" -t "#const Config &=ConstPointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ * Generation options: -s c++17 -t "Parser::Parse#error=Pointer~&$" -t "#const std::string &=String~$.c_str()" -t "#const Config &=ConstPointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$" -t "#const std::filesystem::path &=String~$.generic_string().c_str()" -t "Parser::LoadModel#input=Pointer~&$"
  */
 
 #include "Parser_expect.hpp"
 
 namespace expect { namespace Parser$ {
-MockExpectedCall& Parse(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<void*> error, bool __return__)
+MockExpectedCall& Parse(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, CppUMockGen::Parameter<void*> error, bool __return__)
 {
-    return Parse(1, __object__, inputFilepath, config, isCppHeader, includePaths, error, __return__);
+    return Parse(1, __object__, inputFilepath, config, isCppHeader, includePaths, compileArgs, error, __return__);
 }
-MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<void*> error, bool __return__)
+MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, CppUMockGen::Parameter<void*> error, bool __return__)
 {
     bool __ignoreOtherParams__ = false;
     MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Parser::Parse");
@@ -22,6 +22,7 @@ MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const
     if(config.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withConstPointerParameter("config", config.getValue()); }
     if(isCppHeader.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withBoolParameter("isCppHeader", isCppHeader.getValue()); }
     if(includePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "includePaths", &includePaths.getValue()); }
+    if(compileArgs.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "compileArgs", &compileArgs.getValue()); }
     if(error.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withPointerParameter("error", error.getValue()); }
     __expectedCall__.andReturnValue(__return__);
     if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
@@ -29,6 +30,30 @@ MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const
 }
 } }
 
+namespace expect { namespace Parser$ {
+MockExpectedCall& BuildPrecompiledHeader(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> headerFilepath, CppUMockGen::Parameter<const char*> pchFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, std::vector<std::filesystem::path> & dependencies, const std::string* error, bool __return__)
+{
+    return BuildPrecompiledHeader(1, __object__, headerFilepath, pchFilepath, config, isCppHeader, includePaths, compileArgs, dependencies, error, __return__);
+}
+MockExpectedCall& BuildPrecompiledHeader(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> headerFilepath, CppUMockGen::Parameter<const char*> pchFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, std::vector<std::filesystem::path> & dependencies, const std::string* error, bool __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Parser::BuildPrecompiledHeader");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Parser*>(__object__.getValue())); }
+    if(headerFilepath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("headerFilepath", headerFilepath.getValue()); }
+    if(pchFilepath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("pchFilepath", pchFilepath.getValue()); }
+    if(config.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withConstPointerParameter("config", config.getValue()); }
+    if(isCppHeader.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withBoolParameter("isCppHeader", isCppHeader.getValue()); }
+    if(includePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "includePaths", &includePaths.getValue()); }
+    if(compileArgs.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "compileArgs", &compileArgs.getValue()); }
+    __expectedCall__.withOutputParameterOfTypeReturning("std::vector<std::filesystem::path>", "dependencies", &dependencies);
+    __expectedCall__.withOutputParameterOfTypeReturning("std::ostream", "error", error);
+    __expectedCall__.andReturnValue(__return__);
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
 namespace expect { namespace Parser$ {
 MockExpectedCall& GenerateMock(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> genOpts, CppUMockGen::Parameter<const char*> userCode, CppUMockGen::Parameter<const char*> baseDirPath, const std::string* output)
 {
@@ -84,3 +109,50 @@ MockExpectedCall& GenerateExpectationImpl(unsigned int __numCalls__, CppUMockGen
 }
 } }
 
+namespace expect { namespace Parser$ {
+MockExpectedCall& GetDependencies(CppUMockGen::Parameter<const Parser*> __object__, const std::vector<std::filesystem::path> & __return__)
+{
+    return GetDependencies(1, __object__, __return__);
+}
+MockExpectedCall& GetDependencies(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, const std::vector<std::filesystem::path> & __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Parser::GetDependencies");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Parser*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Parser$ {
+MockExpectedCall& SaveModel(CppUMockGen::Parameter<const Parser*> __object__, const std::string* output)
+{
+    return SaveModel(1, __object__, output);
+}
+MockExpectedCall& SaveModel(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, const std::string* output)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Parser::SaveModel");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Parser*>(__object__.getValue())); }
+    __expectedCall__.withOutputParameterOfTypeReturning("std::ostream", "output", output);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Parser$ {
+MockExpectedCall& LoadModel(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<void*> input, bool __return__)
+{
+    return LoadModel(1, __object__, inputFilepath, config, input, __return__);
+}
+MockExpectedCall& LoadModel(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<void*> input, bool __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Parser::LoadModel");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Parser*>(__object__.getValue())); }
+    if(inputFilepath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("inputFilepath", inputFilepath.getValue()); }
+    if(config.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withConstPointerParameter("config", config.getValue()); }
+    if(input.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withPointerParameter("input", input.getValue()); }
+    __expectedCall__.andReturnValue(__return__);
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
@@ -3,7 +3,7 @@
  *
  * Contents will NOT be preserved if it is regenerated!!!
  *
- * Generation options: -s c++17 -t "Parser::Parse#error=Pointer~&$" -t "#const std::string &=String~$.c_str()" -t "#const Config &=ConstPointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ * Generation options: -s c++17 -t "Parser::Parse#error=Pointer~&$" -t "#const std::string &=String~$.c_str()" -t "#const Config &=ConstPointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$" -t "#const std::filesystem::path &=String~$.generic_string().c_str()" -t "Parser::LoadModel#input=Pointer~&$"
  */
 
 #include <CppUMockGen.hpp>
@@ -13,8 +13,13 @@
 #include <CppUTestExt/MockSupport.h>
 
 namespace expect { namespace Parser$ {
-MockExpectedCall& Parse(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<void*> error, bool __return__);
-MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<void*> error, bool __return__);
+MockExpectedCall& Parse(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, CppUMockGen::Parameter<void*> error, bool __return__);
+MockExpectedCall& Parse(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, CppUMockGen::Parameter<void*> error, bool __return__);
+} }
+
+namespace expect { namespace Parser$ {
+MockExpectedCall& BuildPrecompiledHeader(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> headerFilepath, CppUMockGen::Parameter<const char*> pchFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, std::vector<std::filesystem::path> & dependencies, const std::string* error, bool __return__);
+MockExpectedCall& BuildPrecompiledHeader(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> headerFilepath, CppUMockGen::Parameter<const char*> pchFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, std::vector<std::filesystem::path> & dependencies, const std::string* error, bool __return__);
 } }
 
 namespace expect { namespace Parser$ {
@@ -32,3 +37,18 @@ MockExpectedCall& GenerateExpectationImpl(CppUMockGen::Parameter<const Parser*>
 MockExpectedCall& GenerateExpectationImpl(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> genOpts, CppUMockGen::Parameter<const char*> headerFilepath, const std::string* output);
 } }
 
+namespace expect { namespace Parser$ {
+MockExpectedCall& GetDependencies(CppUMockGen::Parameter<const Parser*> __object__, const std::vector<std::filesystem::path> & __return__);
+MockExpectedCall& GetDependencies(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, const std::vector<std::filesystem::path> & __return__);
+} }
+
+namespace expect { namespace Parser$ {
+MockExpectedCall& SaveModel(CppUMockGen::Parameter<const Parser*> __object__, const std::string* output);
+MockExpectedCall& SaveModel(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, const std::string* output);
+} }
+
+namespace expect { namespace Parser$ {
+MockExpectedCall& LoadModel(CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<void*> input, bool __return__);
+MockExpectedCall& LoadModel(unsigned int __numCalls__, CppUMockGen::Parameter<const Parser*> __object__, CppUMockGen::Parameter<const char*> inputFilepath, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<void*> input, bool __return__);
+} }
+
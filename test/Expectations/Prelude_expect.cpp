@@ -0,0 +1,120 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const Config &=ConstPointer~&$" -t "#Parser &=Pointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$"
+ */
+
+#include "Prelude_expect.hpp"
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& Prelude$ctor(CppUMockGen::Parameter<const std::vector<std::string> &> headerPaths)
+{
+    return Prelude$ctor(1, headerPaths);
+}
+MockExpectedCall& Prelude$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const std::vector<std::string> &> headerPaths)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::Prelude");
+    if(headerPaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "headerPaths", &headerPaths.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& Prelude$dtor(CppUMockGen::Parameter<const Prelude*> __object__)
+{
+    return Prelude$dtor(1, __object__);
+}
+MockExpectedCall& Prelude$dtor(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::~Prelude");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Prelude*>(__object__.getValue())); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& AddCommonIncludes(CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> inputFilePaths)
+{
+    return AddCommonIncludes(1, __object__, inputFilePaths);
+}
+MockExpectedCall& AddCommonIncludes(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> inputFilePaths)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::AddCommonIncludes");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Prelude*>(__object__.getValue())); }
+    if(inputFilePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "inputFilePaths", &inputFilePaths.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& IsEmpty(CppUMockGen::Parameter<const Prelude*> __object__, bool __return__)
+{
+    return IsEmpty(1, __object__, __return__);
+}
+MockExpectedCall& IsEmpty(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, bool __return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::IsEmpty");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Prelude*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(__return__);
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& GetContents(CppUMockGen::Parameter<const Prelude*> __object__, std::string &__return__)
+{
+    return GetContents(1, __object__, __return__);
+}
+MockExpectedCall& GetContents(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, std::string &__return__)
+{
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::GetContents");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Prelude*>(__object__.getValue())); }
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& GetPrecompiledHeader(CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<void*> parser, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, const std::string* error, const Prelude::PrecompiledHeader & __return__)
+{
+    return GetPrecompiledHeader(1, __object__, parser, config, isCppHeader, includePaths, compileArgs, error, __return__);
+}
+MockExpectedCall& GetPrecompiledHeader(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<void*> parser, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, const std::string* error, const Prelude::PrecompiledHeader & __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::GetPrecompiledHeader");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Prelude*>(__object__.getValue())); }
+    if(parser.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withPointerParameter("parser", parser.getValue()); }
+    if(config.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withConstPointerParameter("config", config.getValue()); }
+    if(isCppHeader.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withBoolParameter("isCppHeader", isCppHeader.getValue()); }
+    if(includePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "includePaths", &includePaths.getValue()); }
+    if(compileArgs.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::string>", "compileArgs", &compileArgs.getValue()); }
+    __expectedCall__.withOutputParameterOfTypeReturning("std::ostream", "error", error);
+    __expectedCall__.andReturnValue(static_cast<const void*>(&__return__));
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& Invalidate(CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> changedFilePaths)
+{
+    return Invalidate(1, __object__, changedFilePaths);
+}
+MockExpectedCall& Invalidate(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> changedFilePaths)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "Prelude::Invalidate");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<Prelude*>(__object__.getValue())); }
+    if(changedFilePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "changedFilePaths", &changedFilePaths.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
@@ -0,0 +1,49 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const Config &=ConstPointer~&$" -t "#Parser &=Pointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$"
+ */
+
+#include <CppUMockGen.hpp>
+
+#include "Prelude.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& Prelude$ctor(CppUMockGen::Parameter<const std::vector<std::string> &> headerPaths);
+MockExpectedCall& Prelude$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const std::vector<std::string> &> headerPaths);
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& Prelude$dtor(CppUMockGen::Parameter<const Prelude*> __object__ = ::CppUMockGen::IgnoreParameter::YES);
+MockExpectedCall& Prelude$dtor(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__ = ::CppUMockGen::IgnoreParameter::YES);
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& AddCommonIncludes(CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> inputFilePaths);
+MockExpectedCall& AddCommonIncludes(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> inputFilePaths);
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& IsEmpty(CppUMockGen::Parameter<const Prelude*> __object__, bool __return__);
+MockExpectedCall& IsEmpty(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, bool __return__);
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& GetContents(CppUMockGen::Parameter<const Prelude*> __object__, std::string &__return__);
+MockExpectedCall& GetContents(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, std::string &__return__);
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& GetPrecompiledHeader(CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<void*> parser, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, const std::string* error, const Prelude::PrecompiledHeader & __return__);
+MockExpectedCall& GetPrecompiledHeader(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<void*> parser, CppUMockGen::Parameter<const void*> config, CppUMockGen::Parameter<bool> isCppHeader, CppUMockGen::Parameter<const std::vector<std::string> &> includePaths, CppUMockGen::Parameter<const std::vector<std::string> &> compileArgs, const std::string* error, const Prelude::PrecompiledHeader & __return__);
+} }
+
+namespace expect { namespace Prelude$ {
+MockExpectedCall& Invalidate(CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> changedFilePaths);
+MockExpectedCall& Invalidate(unsigned int __numCalls__, CppUMockGen::Parameter<const Prelude*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> changedFilePaths);
+} }
+
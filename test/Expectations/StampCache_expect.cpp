@@ -0,0 +1,100 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const std::string &=String~$.c_str()" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include "StampCache_expect.hpp"
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& StampCache$ctor(CppUMockGen::Parameter<const char*> cacheDirPath)
+{
+    return StampCache$ctor(1, cacheDirPath);
+}
+MockExpectedCall& StampCache$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const char*> cacheDirPath)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "StampCache::StampCache");
+    if(cacheDirPath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("cacheDirPath", cacheDirPath.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& IsUpToDate(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, bool __return__)
+{
+    return IsUpToDate(1, __object__, outputFilePaths, signature, __return__);
+}
+MockExpectedCall& IsUpToDate(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, bool __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "StampCache::IsUpToDate");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<StampCache*>(__object__.getValue())); }
+    if(outputFilePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "outputFilePaths", &outputFilePaths.getValue()); }
+    if(signature.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("signature", signature.getValue()); }
+    __expectedCall__.andReturnValue(__return__);
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& Update(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies)
+{
+    return Update(1, __object__, outputFilePaths, signature, dependencies);
+}
+MockExpectedCall& Update(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "StampCache::Update");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<StampCache*>(__object__.getValue())); }
+    if(outputFilePaths.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "outputFilePaths", &outputFilePaths.getValue()); }
+    if(signature.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("signature", signature.getValue()); }
+    if(dependencies.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& GetModel(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, std::string & model, std::vector<std::filesystem::path> & dependencies, bool __return__)
+{
+    return GetModel(1, __object__, inputFilePath, signature, model, dependencies, __return__);
+}
+MockExpectedCall& GetModel(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, std::string & model, std::vector<std::filesystem::path> & dependencies, bool __return__)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "StampCache::GetModel");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<StampCache*>(__object__.getValue())); }
+    if(inputFilePath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("inputFilePath", inputFilePath.getValue()); }
+    if(signature.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("signature", signature.getValue()); }
+    __expectedCall__.withOutputParameterOfTypeReturning("std::string", "model", &model);
+    __expectedCall__.withOutputParameterOfTypeReturning("std::vector<std::filesystem::path>", "dependencies", &dependencies);
+    __expectedCall__.andReturnValue(__return__);
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& StoreModel(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, CppUMockGen::Parameter<const char*> model)
+{
+    return StoreModel(1, __object__, inputFilePath, signature, dependencies, model);
+}
+MockExpectedCall& StoreModel(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, CppUMockGen::Parameter<const char*> model)
+{
+    bool __ignoreOtherParams__ = false;
+    MockExpectedCall& __expectedCall__ = mock().expectNCalls(__numCalls__, "StampCache::StoreModel");
+    if(!__object__.isIgnored()) { __expectedCall__.onObject(const_cast<StampCache*>(__object__.getValue())); }
+    if(inputFilePath.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("inputFilePath", inputFilePath.getValue()); }
+    if(signature.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("signature", signature.getValue()); }
+    if(dependencies.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies.getValue()); }
+    if(model.isIgnored()) { __ignoreOtherParams__ = true; } else { __expectedCall__.withStringParameter("model", model.getValue()); }
+    if(__ignoreOtherParams__) { __expectedCall__.ignoreOtherParameters(); }
+    return __expectedCall__;
+}
+} }
+
@@ -0,0 +1,39 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Contents will NOT be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const std::string &=String~$.c_str()" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include <CppUMockGen.hpp>
+
+#include "StampCache.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& StampCache$ctor(CppUMockGen::Parameter<const char*> cacheDirPath);
+MockExpectedCall& StampCache$ctor(unsigned int __numCalls__, CppUMockGen::Parameter<const char*> cacheDirPath);
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& IsUpToDate(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, bool __return__);
+MockExpectedCall& IsUpToDate(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, bool __return__);
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& Update(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies);
+MockExpectedCall& Update(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> outputFilePaths, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies);
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& GetModel(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, std::string & model, std::vector<std::filesystem::path> & dependencies, bool __return__);
+MockExpectedCall& GetModel(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, std::string & model, std::vector<std::filesystem::path> & dependencies, bool __return__);
+} }
+
+namespace expect { namespace StampCache$ {
+MockExpectedCall& StoreModel(CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, CppUMockGen::Parameter<const char*> model);
+MockExpectedCall& StoreModel(unsigned int __numCalls__, CppUMockGen::Parameter<const StampCache*> __object__, CppUMockGen::Parameter<const char*> inputFilePath, CppUMockGen::Parameter<const char*> signature, CppUMockGen::Parameter<const std::vector<std::filesystem::path> &> dependencies, CppUMockGen::Parameter<const char*> model);
+} }
+
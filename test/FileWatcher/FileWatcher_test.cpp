@@ -0,0 +1,218 @@
+/**
+ * @file
+ * @brief      Unit tests for the "FileWatcher" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <stdexcept>
+#include <filesystem>
+
+#include "FileWatcher.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path() / "CppUMockGen_FileWatcher_test";
+static const std::filesystem::path subDirPath = tempDirPath / "sub";
+static const std::filesystem::path file1Path = tempDirPath / "foo.h";
+static const std::filesystem::path file2Path = subDirPath / "bar.h";
+static const std::filesystem::path otherFilePath = tempDirPath / "other.h";
+
+TEST_GROUP( FileWatcher )
+{
+    std::thread modifierThread;
+
+    TEST_SETUP()
+    {
+        std::filesystem::remove_all( tempDirPath );
+        std::filesystem::create_directories( subDirPath );
+
+        WriteFile( file1Path, "void foo();\n" );
+        WriteFile( file2Path, "void bar();\n" );
+    }
+
+    TEST_TEARDOWN()
+    {
+        if( modifierThread.joinable() )
+        {
+            modifierThread.join();
+        }
+
+        std::filesystem::remove_all( tempDirPath );
+    }
+
+    static void WriteFile( const std::filesystem::path &filePath, const std::string &contents )
+    {
+        std::ofstream file( filePath );
+        file << contents;
+    }
+
+    template<typename Modifier>
+    void ModifyLater( Modifier modifier )
+    {
+        modifierThread = std::thread( [modifier]()
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            modifier();
+        } );
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that changes to watched files are reported, and changes to other files are ignored.
+ */
+TEST( FileWatcher, FileModified )
+{
+    // Prepare
+    FileWatcher fileWatcher;
+    fileWatcher.Watch( { file1Path, file2Path } );
+
+    ModifyLater( []()
+    {
+        WriteFile( otherFilePath, "void other();\n" );
+        WriteFile( file2Path, "void bar(int);\n" );
+    } );
+
+    // Exercise
+    std::vector<std::filesystem::path> changedFiles = fileWatcher.WaitForChanges();
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 1, changedFiles.size() );
+    STRCMP_EQUAL( file2Path.generic_string().c_str(), changedFiles[0].generic_string().c_str() );
+}
+
+/*
+ * Check that watched files replaced by other files (as done by many editors) are reported, and that several changes
+ * happening at once are reported together.
+ */
+TEST( FileWatcher, FilesReplaced )
+{
+    // Prepare
+    FileWatcher fileWatcher;
+    fileWatcher.Watch( { file1Path, file2Path } );
+
+    ModifyLater( []()
+    {
+        WriteFile( otherFilePath, "void foo(int);\n" );
+        std::filesystem::rename( otherFilePath, file1Path );
+        std::filesystem::remove( file2Path );
+    } );
+
+    // Exercise
+    std::vector<std::filesystem::path> changedFiles = fileWatcher.WaitForChanges();
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 2, changedFiles.size() );
+    CHECK( std::find( changedFiles.begin(), changedFiles.end(), file1Path ) != changedFiles.end() );
+    CHECK( std::find( changedFiles.begin(), changedFiles.end(), file2Path ) != changedFiles.end() );
+}
+
+/*
+ * Check that the watched files are replaced when watching again.
+ */
+TEST( FileWatcher, WatchAgain )
+{
+    // Prepare
+    FileWatcher fileWatcher;
+    fileWatcher.Watch( { file1Path, file2Path } );
+    fileWatcher.Watch( { file2Path } );
+
+    ModifyLater( []()
+    {
+        WriteFile( file1Path, "void foo(int);\n" );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+        WriteFile( file2Path, "void bar(int);\n" );
+    } );
+
+    // Exercise
+    std::vector<std::filesystem::path> changedFiles = fileWatcher.WaitForChanges();
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 1, changedFiles.size() );
+    STRCMP_EQUAL( file2Path.generic_string().c_str(), changedFiles[0].generic_string().c_str() );
+}
+
+/*
+ * Check that an error is reported when waiting for changes without watched files.
+ */
+TEST( FileWatcher, NoWatchedFiles )
+{
+    // Prepare
+    FileWatcher fileWatcher;
+
+    // Exercise & Verify
+    try
+    {
+        fileWatcher.WaitForChanges();
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( "There are no files to be watched.", e.what() );
+    }
+}
+
+#ifdef __linux__
+/*
+ * Check that an error is reported when the directory of a watched file does not exist.
+ */
+TEST( FileWatcher, NonExistingDirectory )
+{
+    // Prepare
+    FileWatcher fileWatcher;
+    std::filesystem::path nonExistingDirPath = tempDirPath / "nonexisting";
+
+    // Exercise & Verify
+    try
+    {
+        fileWatcher.Watch( { nonExistingDirPath / "foo.h" } );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( ( "Directory '" + nonExistingDirPath.generic_string() + "' cannot be watched." ).c_str(), e.what() );
+    }
+}
+
+/*
+ * Check that no changes are reported when the directories of the watched files are removed.
+ */
+TEST( FileWatcher, DirectoryRemoved )
+{
+    // Prepare
+    FileWatcher fileWatcher;
+    fileWatcher.Watch( { subDirPath / "nonexisting.h" } );
+
+    ModifyLater( []()
+    {
+        std::filesystem::remove_all( subDirPath );
+    } );
+
+    // Exercise
+    std::vector<std::filesystem::path> changedFiles = fileWatcher.WaitForChanges();
+
+    // Verify
+    CHECK_TRUE( changedFiles.empty() );
+}
+#endif
@@ -24,6 +24,7 @@
 #include "ClangCompileHelper.hpp"
 
 #include "Function.hpp"
+#include "StringPool.hpp"
 
 #include "Config_expect.hpp"
 
@@ -185,6 +186,10 @@ TEST_GROUP_EX( TypeOverrides )
 {    
 };
 
+TEST_GROUP_EX( TypeCache )
+{
+};
+
 /*===========================================================================
  *                    TEST CASES IMPLEMENTATION
  *===========================================================================*/
@@ -6246,3 +6251,111 @@ TEST_EX( TypeOverrides, ReturnOverride )
         mock().clear();
     }
 }
+
+//*************************************************************************************************
+//
+//                                           TYPE CACHE
+//
+//*************************************************************************************************
+
+/*
+ * Check that types shared by several functions are processed only once when a type cache is used, and that the
+ * generated mocks are the same as without the cache.
+ */
+TEST_EX( TypeCache, SharedTypes )
+{
+    // Prepare
+    Config* config = GetMockConfig();
+    expect::Config$::GetTypeOverride( config, "function1@", nullptr );
+    expect::Config$::GetTypeOverride( config, "function1#p1", nullptr );
+    expect::Config$::GetTypeOverride( config, "function1#p2", nullptr );
+    expect::Config$::GetTypeOverride( config, "function2@", nullptr );
+    expect::Config$::GetTypeOverride( config, "function2#p1", nullptr );
+    expect::Config$::GetTypeOverride( config, "function2#p2", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "@short", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "#const Struct1 *", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "#short", nullptr );
+    // Once per return and parameter to look up the cache, plus once to process the structure the first time
+    expect::Config$::UseUnderlyingTypedefType( 7, config, false );
+
+    SimpleString testHeader =
+            "typedef struct { int a; } Struct1;\n"
+            "short function1(const Struct1 *p1, short p2);\n"
+            "short function2(const Struct1 *p1, short p2);\n";
+
+    // Exercise
+    std::vector<std::string> results;
+    unsigned int functionCount;
+    {
+        Function::TypeCache typeCache;
+        functionCount = ParseHeader( testHeader, *config, results );
+    }
+
+    // Verify
+    mock().checkExpectations();
+    CHECK_EQUAL( 2, functionCount );
+    CHECK_EQUAL( 2, results.size() );
+    STRCMP_EQUAL( "short function1(const Struct1 * p1, short p2)\n{\n"
+                  "    return static_cast<short>(mock().actualCall(\"function1\").withParameterOfType(\"Struct1\", \"p1\", p1)"
+                       ".withIntParameter(\"p2\", p2).returnIntValue());\n"
+                  "}\n", results[0].c_str() );
+    STRCMP_EQUAL( "short function2(const Struct1 * p1, short p2)\n{\n"
+                  "    return static_cast<short>(mock().actualCall(\"function2\").withParameterOfType(\"Struct1\", \"p1\", p1)"
+                       ".withIntParameter(\"p2\", p2).returnIntValue());\n"
+                  "}\n", results[1].c_str() );
+    CHECK_TRUE( ClangCompileHelper::CheckMockCompilation( testHeader.asCharString(), results[0] + results[1] ) );
+
+    // Cleanup
+}
+
+/*
+ * Check that the strings of the parsed functions are interned in the string pool of the type cache, so that parsing
+ * the same functions again does not add new strings to the pool.
+ */
+TEST_EX( TypeCache, StringPool )
+{
+    // Prepare
+    Config* config = GetMockConfig();
+    expect::Config$::GetTypeOverride( 2, config, "function1@", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "function1#p1", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "function1#p2", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "@short", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "#const char *", nullptr );
+    expect::Config$::GetTypeOverride( 2, config, "#short", nullptr );
+    expect::Config$::UseUnderlyingTypedefType( 6, config, false );
+
+    SimpleString testHeader = "short function1(const char *p1, short p2);";
+
+    StringPool stringPool;
+
+    // Exercise
+    std::vector<std::string> results1;
+    std::vector<std::string> results2;
+    unsigned int functionCount1;
+    unsigned int functionCount2;
+    {
+        Function::TypeCache typeCache( &stringPool );
+        functionCount1 = ParseHeader( testHeader, *config, results1 );
+    }
+    size_t poolSize = stringPool.GetSize();
+    {
+        Function::TypeCache typeCache( &stringPool );
+        functionCount2 = ParseHeader( testHeader, *config, results2 );
+    }
+
+    // Verify
+    mock().checkExpectations();
+    CHECK_EQUAL( 1, functionCount1 );
+    CHECK_EQUAL( 1, functionCount2 );
+    CHECK_EQUAL( 1, results1.size() );
+    CHECK_EQUAL( 1, results2.size() );
+    STRCMP_EQUAL( "short function1(const char * p1, short p2)\n{\n"
+                  "    return static_cast<short>(mock().actualCall(\"function1\").withStringParameter(\"p1\", p1)"
+                       ".withIntParameter(\"p2\", p2).returnIntValue());\n"
+                  "}\n", results1[0].c_str() );
+    STRCMP_EQUAL( results1[0].c_str(), results2[0].c_str() );
+    CHECK( poolSize > 0 );
+    UNSIGNED_LONGS_EQUAL( poolSize, stringPool.GetSize() );
+
+    // Cleanup
+}
@@ -0,0 +1,174 @@
+/**
+ * @file
+ * @brief      Unit tests for the "Function" class (model serialization)
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <sstream>
+#include <vector>
+#include <string>
+
+#include "ClangParseHelper.hpp"
+
+#include "Function.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( Function_Serialization )
+{
+    const std::string testHeader =
+            "struct Struct1 { int a; };\n"
+            "void function1();\n"
+            "bool function2(bool a, int b, unsigned int c, long d, unsigned long e, double f);\n"
+            "const char* function3(const char* s, char* out, const void* p, void* q);\n"
+            "void* function4(const int* buf, unsigned long size);\n"
+            "const void* function5(const Struct1 &s1, Struct1 &s2, int x) noexcept;\n"
+            "unsigned int function6(const Struct1 *s1, Struct1 *s2, short s);\n"
+            "long function7(int skipped, float f);\n"
+            "unsigned long function8(const char *p);\n"
+            "double function9(Struct1 s);\n";
+
+    const std::vector<std::string> typeOverrideOptions = {
+            "function4#buf=MemoryBuffer:sizeof(*$)*size",
+            "function5#s1=InputOfType:Struct1",
+            "function6#s1=InputOfType:TStruct1<Struct1~$",
+            "function6#s2=OutputOfType:TStruct1~$",
+            "function7#skipped=Skip",
+            "function8#p=ConstPointer~(const void*)$",
+            "function8@=UnsignedLongInt~$+1",
+            "#short=Int~(int)$",
+    };
+
+    struct SerializedFunction
+    {
+        std::string mock;
+        std::string expectationHeader;
+        std::string expectationImpl;
+        std::string model;
+    };
+
+    std::vector<SerializedFunction> ParseAndSerialize( const Config &config )
+    {
+        std::vector<SerializedFunction> results;
+
+        ClangParseHelper::ParseHeader( testHeader, [&]( CXCursor cursor )
+        {
+            Function function;
+            if( function.Parse( cursor, config ) )
+            {
+                std::ostringstream model;
+                function.Serialize( model );
+                results.push_back( { function.GenerateMock(), function.GenerateExpectation( true ),
+                                     function.GenerateExpectation( false ), model.str() } );
+            }
+        } );
+
+        return results;
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that a deserialized function generates the same mocks and expectations than the parsed function.
+ */
+TEST( Function_Serialization, RoundTrip )
+{
+    // Prepare
+    Config config( true, "", false, typeOverrideOptions, std::vector<std::string>() );
+    std::vector<SerializedFunction> parsedFunctions = ParseAndSerialize( config );
+
+    // Exercise & Verify
+    CHECK_EQUAL( 9, parsedFunctions.size() );
+    for( const SerializedFunction &parsedFunction : parsedFunctions )
+    {
+        Function function;
+        std::istringstream model( parsedFunction.model );
+
+        CHECK_TRUE( function.Deserialize( model, config ) );
+        STRCMP_EQUAL( parsedFunction.mock.c_str(), function.GenerateMock().c_str() );
+        STRCMP_EQUAL( parsedFunction.expectationHeader.c_str(), function.GenerateExpectation( true ).c_str() );
+        STRCMP_EQUAL( parsedFunction.expectationImpl.c_str(), function.GenerateExpectation( false ).c_str() );
+
+        // The deserialized function must be serialized back to the same model
+        std::ostringstream model2;
+        function.Serialize( model2 );
+        STRCMP_EQUAL( parsedFunction.model.c_str(), model2.str().c_str() );
+    }
+}
+
+/*
+ * Check that the type overrides are applied when deserializing, so that the model does not depend on them.
+ */
+TEST( Function_Serialization, OverridesChanged )
+{
+    // Prepare
+    Config config( true, "", false, typeOverrideOptions, std::vector<std::string>() );
+    std::vector<SerializedFunction> parsedFunctions = ParseAndSerialize( config );
+
+    std::vector<std::string> changedTypeOverrideOptions = typeOverrideOptions;
+    changedTypeOverrideOptions[0] = "function4#buf=MemoryBuffer:size";          // Changed override
+    changedTypeOverrideOptions.push_back( "function2#c=Int" );                  // Added override
+    changedTypeOverrideOptions.erase( changedTypeOverrideOptions.begin() + 4 ); // Removed override (function7)
+    changedTypeOverrideOptions.push_back( "function10#p=Int" );                 // Unrelated override
+    Config changedConfig( true, "", false, changedTypeOverrideOptions, std::vector<std::string>() );
+
+    std::vector<SerializedFunction> reparsedFunctions = ParseAndSerialize( changedConfig );
+
+    // Exercise & Verify
+    CHECK_EQUAL( 9, parsedFunctions.size() );
+    CHECK_EQUAL( 9, reparsedFunctions.size() );
+    for( size_t i = 0; i < parsedFunctions.size(); i++ )
+    {
+        Function function;
+        std::istringstream model( parsedFunctions[i].model );
+
+        CHECK_TRUE( function.Deserialize( model, changedConfig ) );
+        STRCMP_EQUAL( reparsedFunctions[i].mock.c_str(), function.GenerateMock().c_str() );
+        STRCMP_EQUAL( reparsedFunctions[i].expectationHeader.c_str(), function.GenerateExpectation( true ).c_str() );
+        STRCMP_EQUAL( reparsedFunctions[i].expectationImpl.c_str(), function.GenerateExpectation( false ).c_str() );
+
+        // The model does not depend on the type overrides
+        STRCMP_EQUAL( reparsedFunctions[i].model.c_str(), parsedFunctions[i].model.c_str() );
+    }
+}
+
+/*
+ * Check that deserialization fails if the model is truncated or corrupted.
+ */
+TEST( Function_Serialization, InvalidModel )
+{
+    // Prepare
+    Config config( true, "", false, typeOverrideOptions, std::vector<std::string>() );
+    std::vector<SerializedFunction> parsedFunctions = ParseAndSerialize( config );
+
+    // Exercise & Verify
+    for( const SerializedFunction &parsedFunction : parsedFunctions )
+    {
+        const std::string &model = parsedFunction.model;
+        for( size_t length = 0; length < model.size(); length++ )
+        {
+            Function function;
+            std::istringstream truncatedModel( model.substr( 0, length ) );
+            CHECK_FALSE( function.Deserialize( truncatedModel, config ) );
+        }
+    }
+
+    Function function;
+    std::istringstream corruptedModel( "9:function1\n0:\n0\n0\n0\n1\n18:9999\n0\n4:void\n0\n0\n\n0\n" );
+    CHECK_FALSE( function.Deserialize( corruptedModel, config ) );
+}
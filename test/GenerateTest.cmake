@@ -38,6 +38,9 @@ target_link_libraries( ${PROJECT_NAME} ${CppUTest_LIBRARIES} )
 
 target_link_libraries( ${PROJECT_NAME} ${LibClang_LIBRARIES} )
 
+find_package( Threads REQUIRED )
+target_link_libraries( ${PROJECT_NAME} Threads::Threads )
+
 if( (CMAKE_CXX_COMPILER_ID STREQUAL "GNU") AND (CMAKE_CXX_COMPILER_VERSION VERSION_LESS "9.0.0") )
     target_link_libraries( ${PROJECT_NAME} stdc++fs )
 endif()
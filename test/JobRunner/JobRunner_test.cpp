@@ -0,0 +1,231 @@
+/**
+ * @file
+ * @brief      Unit tests for the "JobRunner" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include "JobRunner.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( JobRunner )
+{
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the number of threads is set to the number of hardware threads when 0 is passed.
+ */
+TEST( JobRunner, NumThreads_Automatic )
+{
+    // Prepare
+    unsigned int expectedNumThreads = std::thread::hardware_concurrency();
+    if( expectedNumThreads == 0 )
+    {
+        expectedNumThreads = 1;
+    }
+
+    // Exercise
+    JobRunner jobRunner( 0 );
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( expectedNumThreads, jobRunner.GetNumThreads() );
+}
+
+/*
+ * Check that the number of threads is set to the value passed explicitly.
+ */
+TEST( JobRunner, NumThreads_Explicit )
+{
+    // Exercise
+    JobRunner jobRunner( 7 );
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 7, jobRunner.GetNumThreads() );
+}
+
+/*
+ * Check that nothing is executed when there are no jobs.
+ */
+TEST( JobRunner, Run_NoJobs )
+{
+    // Prepare
+    JobRunner jobRunner( 4 );
+    unsigned int numCalls = 0;
+
+    // Exercise
+    jobRunner.Run( 0, [&]( size_t, unsigned int ) { numCalls++; }, [&]( size_t ) { numCalls++; } );
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 0, numCalls );
+}
+
+/*
+ * Check that jobs are run sequentially in the calling thread when a single thread is used.
+ */
+TEST( JobRunner, Run_SingleThread )
+{
+    // Prepare
+    JobRunner jobRunner( 1 );
+    std::thread::id callingThreadId = std::this_thread::get_id();
+    std::vector<std::string> events;
+
+    // Exercise
+    jobRunner.Run( 3,
+                   [&]( size_t jobIndex, unsigned int threadIndex )
+                   {
+                       CHECK( std::this_thread::get_id() == callingThreadId );
+                       UNSIGNED_LONGS_EQUAL( 0, threadIndex );
+                       events.push_back( "job" + std::to_string( jobIndex ) );
+                   },
+                   [&]( size_t jobIndex )
+                   {
+                       events.push_back( "completion" + std::to_string( jobIndex ) );
+                   } );
+
+    // Verify
+    std::vector<std::string> expectedEvents = { "job0", "completion0", "job1", "completion1", "job2", "completion2" };
+    CHECK( expectedEvents == events );
+}
+
+/*
+ * Check that jobs are distributed between several threads, each job is run exactly once, and completion is reported
+ * in the calling thread following the job index order.
+ */
+TEST( JobRunner, Run_MultipleThreads )
+{
+    // Prepare
+    const size_t numJobs = 200;
+    const unsigned int numThreads = 4;
+
+    JobRunner jobRunner( numThreads );
+    std::thread::id callingThreadId = std::this_thread::get_id();
+    std::vector<std::atomic<unsigned int>> jobRunCount( numJobs );
+    std::atomic<bool> invalidThreadIndex( false );
+    std::vector<size_t> completedJobs;
+    bool completionInOtherThread = false;
+    bool completionBeforeJob = false;
+
+    // Exercise
+    jobRunner.Run( numJobs,
+                   [&]( size_t jobIndex, unsigned int threadIndex )
+                   {
+                       if( threadIndex >= numThreads )
+                       {
+                           invalidThreadIndex = true;
+                       }
+                       jobRunCount[ jobIndex ]++;
+                   },
+                   [&]( size_t jobIndex )
+                   {
+                       if( std::this_thread::get_id() != callingThreadId )
+                       {
+                           completionInOtherThread = true;
+                       }
+                       if( jobRunCount[ jobIndex ] == 0 )
+                       {
+                           completionBeforeJob = true;
+                       }
+                       completedJobs.push_back( jobIndex );
+                   } );
+
+    // Verify
+    CHECK_FALSE( invalidThreadIndex );
+    CHECK_FALSE( completionInOtherThread );
+    CHECK_FALSE( completionBeforeJob );
+    UNSIGNED_LONGS_EQUAL( numJobs, completedJobs.size() );
+    for( size_t i = 0; i < numJobs; i++ )
+    {
+        UNSIGNED_LONGS_EQUAL( 1, jobRunCount[ i ] );
+        UNSIGNED_LONGS_EQUAL( i, completedJobs[ i ] );
+    }
+}
+
+/*
+ * Check that no more threads than jobs are used.
+ */
+TEST( JobRunner, Run_MoreThreadsThanJobs )
+{
+    // Prepare
+    JobRunner jobRunner( 16 );
+    std::atomic<unsigned int> maxThreadIndex( 0 );
+    unsigned int numCompleted = 0;
+
+    // Exercise
+    jobRunner.Run( 2,
+                   [&]( size_t, unsigned int threadIndex )
+                   {
+                       unsigned int current = maxThreadIndex;
+                       while( ( threadIndex > current ) && !maxThreadIndex.compare_exchange_weak( current, threadIndex ) );
+                   },
+                   [&]( size_t )
+                   {
+                       numCompleted++;
+                   } );
+
+    // Verify
+    CHECK( maxThreadIndex < 2 );
+    UNSIGNED_LONGS_EQUAL( 2, numCompleted );
+}
+
+/*
+ * Check that if jobs throw exceptions, the rest of jobs are still run and the exception from the job with the lowest
+ * index is rethrown.
+ */
+TEST( JobRunner, Run_JobException )
+{
+    for( unsigned int numThreads : { 1, 3 } )
+    {
+        // Prepare
+        JobRunner jobRunner( numThreads );
+        std::atomic<unsigned int> numRun( 0 );
+        unsigned int numCompleted = 0;
+
+        // Exercise & Verify
+        try
+        {
+            jobRunner.Run( 10,
+                           [&]( size_t jobIndex, unsigned int )
+                           {
+                               numRun++;
+                               if( ( jobIndex == 3 ) || ( jobIndex == 7 ) )
+                               {
+                                   throw std::runtime_error( "Job " + std::to_string( jobIndex ) + " failed" );
+                               }
+                           },
+                           [&]( size_t )
+                           {
+                               numCompleted++;
+                           } );
+            FAIL( "Exception should have been thrown" );
+        }
+        catch( std::runtime_error &e )
+        {
+            STRCMP_EQUAL( "Job 3 failed", e.what() );
+        }
+
+        UNSIGNED_LONGS_EQUAL( 10, numRun );
+        UNSIGNED_LONGS_EQUAL( 10, numCompleted );
+    }
+}
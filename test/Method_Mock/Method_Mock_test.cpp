@@ -24,6 +24,7 @@
 #include "ClangCompileHelper.hpp"
 
 #include "Method.hpp"
+#include "ClangHelper.hpp"
 
 /*===========================================================================
  *                      COMMON TEST DEFINES & MACROS
@@ -577,3 +578,66 @@ TEST( Method_Mock, PublicStaticMethod )
 
     // Cleanup
 }
+
+/*
+ * Check that methods in nested scopes are mocked properly when the information about their scopes is cached.
+ */
+TEST( Method_Mock, NestedScopesWithCursorCache )
+{
+    // Prepare
+    Config *config = GetMockConfig();
+
+    SimpleString testHeader =
+            "namespace ns1 { namespace ns2 {\n"
+            "class class1 {\n"
+            "public:\n"
+            "    void method1();\n"
+            "    class class2 {\n"
+            "    public:\n"
+            "        void method2();\n"
+            "        void method3();\n"
+            "    };\n"
+            "    void method4();\n"
+            "private:\n"
+            "    class class3 {\n"
+            "    public:\n"
+            "        void method5();\n"
+            "        void method6();\n"
+            "    };\n"
+            "};\n"
+            "} }";
+
+    std::vector<std::string> expectedResults;
+    ParseHeader( testHeader, *config, expectedResults );
+
+    // Exercise
+    std::vector<std::string> results;
+    unsigned int methodCount;
+    {
+        CursorCache cursorCache;
+        methodCount = ParseHeader( testHeader, *config, results );
+    }
+
+    // Verify
+    CHECK_EQUAL( 6, methodCount );
+    CHECK_EQUAL( 4, results.size() );
+    STRCMP_EQUAL( "void ns1::ns2::class1::method1()\n{\n"
+                  "    mock().actualCall(\"ns1::ns2::class1::method1\").onObject(this);\n"
+                  "}\n", results[0].c_str() );
+    STRCMP_EQUAL( "void ns1::ns2::class1::class2::method2()\n{\n"
+                  "    mock().actualCall(\"ns1::ns2::class1::class2::method2\").onObject(this);\n"
+                  "}\n", results[1].c_str() );
+    STRCMP_EQUAL( "void ns1::ns2::class1::class2::method3()\n{\n"
+                  "    mock().actualCall(\"ns1::ns2::class1::class2::method3\").onObject(this);\n"
+                  "}\n", results[2].c_str() );
+    STRCMP_EQUAL( "void ns1::ns2::class1::method4()\n{\n"
+                  "    mock().actualCall(\"ns1::ns2::class1::method4\").onObject(this);\n"
+                  "}\n", results[3].c_str() );
+    CHECK_EQUAL( expectedResults.size(), results.size() );
+    for( size_t i = 0; i < results.size(); i++ )
+    {
+        STRCMP_EQUAL( expectedResults[i].c_str(), results[i].c_str() );
+    }
+
+    // Cleanup
+}
@@ -0,0 +1,29 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Only contents in the user code section will be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const std::string &=String~$.c_str()" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include "BatchFileParser.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+// CPPUMOCKGEN_USER_CODE_BEGIN
+// CPPUMOCKGEN_USER_CODE_END
+
+BatchFileParser::BatchFileParser()
+{
+    mock().actualCall("BatchFileParser::BatchFileParser");
+}
+
+void BatchFileParser::Parse(const std::filesystem::path & filepath)
+{
+    mock().actualCall("BatchFileParser::Parse").onObject(this).withStringParameter("filepath", filepath.generic_string().c_str());
+}
+
+const std::vector<BatchFileParser::Entry> & BatchFileParser::GetEntries() const
+{
+    return *static_cast<const std::vector<BatchFileParser::Entry>*>(mock().actualCall("BatchFileParser::GetEntries").onObject(this).returnConstPointerValue());
+}
@@ -0,0 +1,25 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Only contents in the user code section will be preserved if it is regenerated!!!
+ *
+ * Generation options: -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include "CompilationDatabase.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+// CPPUMOCKGEN_USER_CODE_BEGIN
+// CPPUMOCKGEN_USER_CODE_END
+
+CompilationDatabase::CompilationDatabase(const std::filesystem::path & path)
+{
+    mock().actualCall("CompilationDatabase::CompilationDatabase").withStringParameter("path", path.generic_string().c_str());
+}
+
+const CompilationDatabase::Flags * CompilationDatabase::GetFlags(const std::filesystem::path & headerFilePath) const noexcept
+{
+    return static_cast<const CompilationDatabase::Flags*>(mock().actualCall("CompilationDatabase::GetFlags").onObject(this).withStringParameter("headerFilePath", headerFilePath.generic_string().c_str()).returnConstPointerValue());
+}
+
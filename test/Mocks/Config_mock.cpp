@@ -61,10 +61,10 @@ const std::string & Config::OverrideSpec::GetExpectationArgTypeName() const noex
     return *static_cast<const std::string*>(mock().actualCall("Config::OverrideSpec::GetExpectationArgTypeName").onObject(this).returnConstPointerValue());
 }
 
-Config::Config(bool interpretAsCpp, const std::string & languageStandard, bool useUnderlyingTypedefType, const std::vector<std::string> & typeOverrideOptions)
+Config::Config(bool interpretAsCpp, const std::string & languageStandard, bool useUnderlyingTypedefType, const std::vector<std::string> & typeOverrideOptions, const std::vector<std::string> & typeMapOptions)
 : m_typeOverrideMap( std::vector<std::string>() )
 {
-    mock().actualCall("Config::Config").withBoolParameter("interpretAsCpp", interpretAsCpp).withStringParameter("languageStandard", languageStandard.c_str()).withBoolParameter("useUnderlyingTypedefType", useUnderlyingTypedefType).withParameterOfType("std::vector<std::string>", "typeOverrideOptions", &typeOverrideOptions);
+    mock().actualCall("Config::Config").withBoolParameter("interpretAsCpp", interpretAsCpp).withStringParameter("languageStandard", languageStandard.c_str()).withBoolParameter("useUnderlyingTypedefType", useUnderlyingTypedefType).withParameterOfType("std::vector<std::string>", "typeOverrideOptions", &typeOverrideOptions).withParameterOfType("std::vector<std::string>", "typeMapOptions", &typeMapOptions);
 }
 
 bool Config::InterpretAsCpp() const noexcept
@@ -82,8 +82,13 @@ bool Config::UseUnderlyingTypedefType() const noexcept
     return mock().actualCall("Config::UseUnderlyingTypedefType").onObject(this).returnBoolValue();
 }
 
-const Config::OverrideSpec * Config::GetTypeOverride(const std::string & key) const noexcept
+const Config::OverrideSpec * Config::GetTypeOverride(std::string_view key) const noexcept
 {
-    return static_cast<const Config::OverrideSpec*>(mock().actualCall("Config::GetTypeOverride").onObject(this).withStringParameter("key", key.c_str()).returnConstPointerValue());
+    return static_cast<const Config::OverrideSpec*>(mock().actualCall("Config::GetTypeOverride").onObject(this).withStringParameter("key", std::string(key).c_str()).returnConstPointerValue());
+}
+
+const std::string & Config::GetTypeMapDeclarations() const noexcept
+{
+    return *static_cast<const std::string*>(mock().actualCall("Config::GetTypeMapDeclarations").onObject(this).returnConstPointerValue());
 }
 
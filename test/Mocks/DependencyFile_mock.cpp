@@ -0,0 +1,23 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Only contents in the user code section will be preserved if it is regenerated!!!
+ */
+
+#include "DependencyFile.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+// CPPUMOCKGEN_USER_CODE_BEGIN
+// CPPUMOCKGEN_USER_CODE_END
+
+DependencyFile::DependencyFile(const std::vector<std::filesystem::path> & targets) noexcept
+{
+    mock().actualCall("DependencyFile::DependencyFile").withParameterOfType("std::vector<std::filesystem::path>", "targets", &targets);
+}
+
+std::string DependencyFile::Generate(const std::vector<std::filesystem::path> & dependencies) const
+{
+    return *static_cast<const std::string*>(mock().actualCall("DependencyFile::Generate").onObject(this).withParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies).returnConstPointerValue());
+}
+
@@ -0,0 +1,35 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Only contents in the user code section will be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17
+ */
+
+#include "FileWatcher.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+// CPPUMOCKGEN_USER_CODE_BEGIN
+// CPPUMOCKGEN_USER_CODE_END
+
+FileWatcher::FileWatcher() noexcept
+{
+    mock().actualCall("FileWatcher::FileWatcher");
+}
+
+FileWatcher::~FileWatcher()
+{
+    mock().actualCall("FileWatcher::~FileWatcher").onObject(this);
+}
+
+void FileWatcher::Watch(const std::vector<std::filesystem::path> & filePaths)
+{
+    mock().actualCall("FileWatcher::Watch").onObject(this).withParameterOfType("std::vector<std::filesystem::path>", "filePaths", &filePaths);
+}
+
+std::vector<std::filesystem::path> FileWatcher::WaitForChanges()
+{
+    return *static_cast<const std::vector<std::filesystem::path>*>(mock().actualCall("FileWatcher::WaitForChanges").onObject(this).returnConstPointerValue());
+}
+
@@ -18,6 +18,30 @@ class Function::Argument
 class Function::Return
 {};
 
+// Type caches are not mocked, since they do not affect the behavior of parsers
+
+struct Function::TypeCache::Entries
+{};
+
+Function::TypeCache::TypeCache( StringPool *stringPool, bool keepRawTypes )
+: m_entries( new Entries ), m_stringPool( stringPool ), m_keepRawTypes( keepRawTypes ), m_previous( nullptr )
+{}
+
+Function::TypeCache::~TypeCache() noexcept
+{}
+
+// Emitters are not mocked, the generated code is obtained from the mocked functions that return it
+
+void Function::GenerateMock( CodeEmitter &output ) const noexcept
+{
+    output << GenerateMock();
+}
+
+void Function::GenerateExpectation( bool proto, CodeEmitter &output ) const noexcept
+{
+    output << GenerateExpectation( proto );
+}
+
 // CPPUMOCKGEN_USER_CODE_END
 
 Function::Function() noexcept
@@ -35,6 +59,11 @@ bool Function::Parse(const CXCursor & cursor, const Config & config)
     return mock().actualCall("Function::Parse").onObject(this).withConstPointerParameter("cursor", &cursor).withConstPointerParameter("config", &config).returnBoolValue();
 }
 
+bool Function::Parse(const SimpleCParser::FunctionDecl & function, const Config & config)
+{
+    return mock().actualCall("Function::Parse").onObject(this).withConstPointerParameter("function", &function).withConstPointerParameter("config", &config).returnBoolValue();
+}
+
 std::string Function::GenerateMock() const noexcept
 {
     return mock().actualCall("Function::GenerateMock").onObject(this).returnStringValue();
@@ -45,6 +74,16 @@ std::string Function::GenerateExpectation(bool proto) const noexcept
     return mock().actualCall("Function::GenerateExpectation").onObject(this).withBoolParameter("proto", proto).returnStringValue();
 }
 
+void Function::Serialize(std::ostream & output) const
+{
+    mock().actualCall("Function::Serialize").onObject(this).withOutputParameterOfType("std::ostream", "output", &output);
+}
+
+bool Function::Deserialize(std::istream & input, const Config & config)
+{
+    return mock().actualCall("Function::Deserialize").onObject(this).withPointerParameter("input", &input).withConstPointerParameter("config", &config).returnBoolValue();
+}
+
 bool Function::IsMockable(const CXCursor & cursor) const noexcept
 {
     return mock().actualCall("Function::IsMockable").onObject(this).withConstPointerParameter("cursor", &cursor).returnBoolValue();
@@ -44,9 +44,19 @@ bool Options::IsVersionRequested() const
     return mock().actualCall("Options::IsVersionRequested").onObject(this).returnBoolValue();
 }
 
-std::string Options::GetInputPath() const
+bool Options::IsWorkerRequested() const
 {
-    return mock().actualCall("Options::GetInputPath").onObject(this).returnStringValue();
+    return mock().actualCall("Options::IsWorkerRequested").onObject(this).returnBoolValue();
+}
+
+std::vector<std::string> Options::GetInputPaths() const
+{
+    return *static_cast<const std::vector<std::string>*>(mock().actualCall("Options::GetInputPaths").onObject(this).returnConstPointerValue());
+}
+
+std::string Options::GetBatchFilePath() const
+{
+    return mock().actualCall("Options::GetBatchFilePath").onObject(this).returnStringValue();
 }
 
 std::string Options::GetBaseDirectory() const
@@ -79,6 +89,66 @@ bool Options::IsRegenerationRequested() const
     return mock().actualCall("Options::IsRegenerationRequested").onObject(this).returnBoolValue();
 }
 
+unsigned int Options::GetNumJobs() const
+{
+    return mock().actualCall("Options::GetNumJobs").onObject(this).returnUnsignedIntValue();
+}
+
+std::string Options::GetCacheDirectory() const
+{
+    return mock().actualCall("Options::GetCacheDirectory").onObject(this).returnStringValue();
+}
+
+std::string Options::GetCompilationDatabasePath() const
+{
+    return mock().actualCall("Options::GetCompilationDatabasePath").onObject(this).returnStringValue();
+}
+
+bool Options::IsCheckRequested() const
+{
+    return mock().actualCall("Options::IsCheckRequested").onObject(this).returnBoolValue();
+}
+
+bool Options::IsDepFileRequested() const
+{
+    return mock().actualCall("Options::IsDepFileRequested").onObject(this).returnBoolValue();
+}
+
+bool Options::IsWatchRequested() const
+{
+    return mock().actualCall("Options::IsWatchRequested").onObject(this).returnBoolValue();
+}
+
+std::vector<std::string> Options::GetPreludeHeaders() const
+{
+    return *static_cast<const std::vector<std::string>*>(mock().actualCall("Options::GetPreludeHeaders").onObject(this).returnConstPointerValue());
+}
+
+bool Options::IsAutoPreludeRequested() const
+{
+    return mock().actualCall("Options::IsAutoPreludeRequested").onObject(this).returnBoolValue();
+}
+
+bool Options::IsUmbrellaParseRequested() const
+{
+    return mock().actualCall("Options::IsUmbrellaParseRequested").onObject(this).returnBoolValue();
+}
+
+bool Options::IsStreamingRequested() const
+{
+    return mock().actualCall("Options::IsStreamingRequested").onObject(this).returnBoolValue();
+}
+
+std::string Options::GetTimeReportPath() const
+{
+    return mock().actualCall("Options::GetTimeReportPath").onObject(this).returnStringValue();
+}
+
+std::string Options::GetTracePath() const
+{
+    return mock().actualCall("Options::GetTracePath").onObject(this).returnStringValue();
+}
+
 bool Options::InterpretAsCpp() const
 {
     return mock().actualCall("Options::InterpretAsCpp").onObject(this).returnBoolValue();
@@ -94,11 +164,31 @@ bool Options::UseUnderlyingTypedef() const
     return mock().actualCall("Options::UseUnderlyingTypedef").onObject(this).returnBoolValue();
 }
 
+bool Options::IsFastParseRequested() const
+{
+    return mock().actualCall("Options::IsFastParseRequested").onObject(this).returnBoolValue();
+}
+
+bool Options::IsSingleFileParseRequested() const
+{
+    return mock().actualCall("Options::IsSingleFileParseRequested").onObject(this).returnBoolValue();
+}
+
+bool Options::IsSimpleCParseRequested() const
+{
+    return mock().actualCall("Options::IsSimpleCParseRequested").onObject(this).returnBoolValue();
+}
+
 std::vector<std::string> Options::GetTypeOverrides() const
 {
     return *static_cast<const std::vector<std::string>*>(mock().actualCall("Options::GetTypeOverrides").onObject(this).returnConstPointerValue());
 }
 
+std::vector<std::string> Options::GetTypeMap() const
+{
+    return *static_cast<const std::vector<std::string>*>(mock().actualCall("Options::GetTypeMap").onObject(this).returnConstPointerValue());
+}
+
 std::vector<std::string> Options::GetIncludePaths() const
 {
     return *static_cast<const std::vector<std::string>*>(mock().actualCall("Options::GetIncludePaths").onObject(this).returnConstPointerValue());
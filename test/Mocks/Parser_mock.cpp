@@ -3,7 +3,7 @@
  *
  * Only contents in the user code section will be preserved if it is regenerated!!!
  *
- * Generation options: -s c++17 -t "Parser::Parse#error=Pointer~&$" -t "#const std::string &=String~$.c_str()" -t "#const Config &=ConstPointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ * Generation options: -s c++17 -t "Parser::Parse#error=Pointer~&$" -t "#const std::string &=String~$.c_str()" -t "#const Config &=ConstPointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$" -t "#const std::filesystem::path &=String~$.generic_string().c_str()" -t "Parser::LoadModel#input=Pointer~&$"
  */
 
 #include "Parser.hpp"
@@ -11,11 +11,57 @@
 #include <CppUTestExt/MockSupport.h>
 
 // CPPUMOCKGEN_USER_CODE_BEGIN
+
+#include <sstream>
+
+// Generation in a single pass is not mocked, the generated code is obtained from the mocked functions for each output
+
+void Parser::Generate( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                       const std::filesystem::path &expectationBaseDirPath, const std::filesystem::path &expectationHeaderFilepath,
+                       const Outputs &outputs ) const
+{
+    if( outputs.mock )
+    {
+        std::ostringstream output;
+        GenerateMock( genOpts, userCode, mockBaseDirPath, output );
+        *outputs.mock << output.str();
+    }
+
+    if( outputs.expectationHeader )
+    {
+        std::ostringstream output;
+        GenerateExpectationHeader( genOpts, expectationBaseDirPath, output );
+        *outputs.expectationHeader << output.str();
+    }
+
+    if( outputs.expectationImpl )
+    {
+        std::ostringstream output;
+        GenerateExpectationImpl( genOpts, expectationHeaderFilepath, output );
+        *outputs.expectationImpl << output.str();
+    }
+}
+
+// Generation in streaming mode is not mocked either, the whole generated code is flushed at once
+
+void Parser::StartStreaming( const std::string &genOpts, const std::string &userCode, const std::filesystem::path &mockBaseDirPath,
+                             const std::filesystem::path &expectationBaseDirPath, const std::filesystem::path &expectationHeaderFilepath,
+                             const Outputs &outputs, const FlushFunction &flush )
+{
+    Generate( genOpts, userCode, mockBaseDirPath, expectationBaseDirPath, expectationHeaderFilepath, outputs );
+    flush( outputs );
+}
+
 // CPPUMOCKGEN_USER_CODE_END
 
-bool Parser::Parse(const std::filesystem::path & inputFilepath, const Config & config, bool isCppHeader, const std::vector<std::string> & includePaths, std::ostream & error)
+bool Parser::Parse(const std::filesystem::path & inputFilepath, const Config & config, bool isCppHeader, const std::vector<std::string> & includePaths, const std::vector<std::string> & compileArgs, std::ostream & error)
 {
-    return mock().actualCall("Parser::Parse").onObject(this).withStringParameter("inputFilepath", inputFilepath.generic_string().c_str()).withConstPointerParameter("config", &config).withBoolParameter("isCppHeader", isCppHeader).withParameterOfType("std::vector<std::string>", "includePaths", &includePaths).withPointerParameter("error", &error).returnBoolValue();
+    return mock().actualCall("Parser::Parse").onObject(this).withStringParameter("inputFilepath", inputFilepath.generic_string().c_str()).withConstPointerParameter("config", &config).withBoolParameter("isCppHeader", isCppHeader).withParameterOfType("std::vector<std::string>", "includePaths", &includePaths).withParameterOfType("std::vector<std::string>", "compileArgs", &compileArgs).withPointerParameter("error", &error).returnBoolValue();
+}
+
+bool Parser::BuildPrecompiledHeader(const std::filesystem::path & headerFilepath, const std::filesystem::path & pchFilepath, const Config & config, bool isCppHeader, const std::vector<std::string> & includePaths, const std::vector<std::string> & compileArgs, std::vector<std::filesystem::path> & dependencies, std::ostream & error)
+{
+    return mock().actualCall("Parser::BuildPrecompiledHeader").onObject(this).withStringParameter("headerFilepath", headerFilepath.generic_string().c_str()).withStringParameter("pchFilepath", pchFilepath.generic_string().c_str()).withConstPointerParameter("config", &config).withBoolParameter("isCppHeader", isCppHeader).withParameterOfType("std::vector<std::string>", "includePaths", &includePaths).withParameterOfType("std::vector<std::string>", "compileArgs", &compileArgs).withOutputParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies).withOutputParameterOfType("std::ostream", "error", &error).returnBoolValue();
 }
 
 void Parser::GenerateMock(const std::string & genOpts, const std::string & userCode, const std::filesystem::path & baseDirPath, std::ostream & output) const noexcept
@@ -33,3 +79,18 @@ void Parser::GenerateExpectationImpl(const std::string & genOpts, const std::fil
     mock().actualCall("Parser::GenerateExpectationImpl").onObject(this).withStringParameter("genOpts", genOpts.c_str()).withStringParameter("headerFilepath", headerFilepath.generic_string().c_str()).withOutputParameterOfType("std::ostream", "output", &output);
 }
 
+const std::vector<std::filesystem::path> & Parser::GetDependencies() const noexcept
+{
+    return *static_cast<const std::vector<std::filesystem::path>*>(mock().actualCall("Parser::GetDependencies").onObject(this).returnConstPointerValue());
+}
+
+void Parser::SaveModel(std::ostream & output) const
+{
+    mock().actualCall("Parser::SaveModel").onObject(this).withOutputParameterOfType("std::ostream", "output", &output);
+}
+
+bool Parser::LoadModel(const std::filesystem::path & inputFilepath, const Config & config, std::istream & input)
+{
+    return mock().actualCall("Parser::LoadModel").onObject(this).withStringParameter("inputFilepath", inputFilepath.generic_string().c_str()).withConstPointerParameter("config", &config).withPointerParameter("input", &input).returnBoolValue();
+}
+
@@ -0,0 +1,50 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Only contents in the user code section will be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const Config &=ConstPointer~&$" -t "#Parser &=Pointer~&$" -t "#std::ostream &=OutputOfType:std::ostream<std::string~&$"
+ */
+
+#include "Prelude.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+// CPPUMOCKGEN_USER_CODE_BEGIN
+// CPPUMOCKGEN_USER_CODE_END
+
+Prelude::Prelude(const std::vector<std::string> & headerPaths) noexcept
+{
+    mock().actualCall("Prelude::Prelude").withParameterOfType("std::vector<std::string>", "headerPaths", &headerPaths);
+}
+
+Prelude::~Prelude()
+{
+    mock().actualCall("Prelude::~Prelude").onObject(this);
+}
+
+void Prelude::AddCommonIncludes(const std::vector<std::filesystem::path> & inputFilePaths)
+{
+    mock().actualCall("Prelude::AddCommonIncludes").onObject(this).withParameterOfType("std::vector<std::filesystem::path>", "inputFilePaths", &inputFilePaths);
+}
+
+bool Prelude::IsEmpty() const noexcept
+{
+    return mock().actualCall("Prelude::IsEmpty").onObject(this).returnBoolValue();
+}
+
+std::string Prelude::GetContents() const
+{
+    return *static_cast<const std::string*>(mock().actualCall("Prelude::GetContents").onObject(this).returnConstPointerValue());
+}
+
+const Prelude::PrecompiledHeader & Prelude::GetPrecompiledHeader(Parser & parser, const Config & config, bool isCppHeader, const std::vector<std::string> & includePaths, const std::vector<std::string> & compileArgs, std::ostream & error)
+{
+    return *static_cast<const Prelude::PrecompiledHeader*>(mock().actualCall("Prelude::GetPrecompiledHeader").onObject(this).withPointerParameter("parser", &parser).withConstPointerParameter("config", &config).withBoolParameter("isCppHeader", isCppHeader).withParameterOfType("std::vector<std::string>", "includePaths", &includePaths).withParameterOfType("std::vector<std::string>", "compileArgs", &compileArgs).withOutputParameterOfType("std::ostream", "error", &error).returnConstPointerValue());
+}
+
+void Prelude::Invalidate(const std::vector<std::filesystem::path> & changedFilePaths)
+{
+    mock().actualCall("Prelude::Invalidate").onObject(this).withParameterOfType("std::vector<std::filesystem::path>", "changedFilePaths", &changedFilePaths);
+}
+
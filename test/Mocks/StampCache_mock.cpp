@@ -0,0 +1,40 @@
+/*
+ * This file has been auto-generated by CppUMockGen v0.6.
+ *
+ * Only contents in the user code section will be preserved if it is regenerated!!!
+ *
+ * Generation options: -s c++17 -t "#const std::string &=String~$.c_str()" -t "#const std::filesystem::path &=String~$.generic_string().c_str()"
+ */
+
+#include "StampCache.hpp"
+
+#include <CppUTestExt/MockSupport.h>
+
+// CPPUMOCKGEN_USER_CODE_BEGIN
+// CPPUMOCKGEN_USER_CODE_END
+
+StampCache::StampCache(const std::filesystem::path & cacheDirPath) noexcept
+{
+    mock().actualCall("StampCache::StampCache").withStringParameter("cacheDirPath", cacheDirPath.generic_string().c_str());
+}
+
+bool StampCache::IsUpToDate(const std::vector<std::filesystem::path> & outputFilePaths, const std::string & signature) const
+{
+    return mock().actualCall("StampCache::IsUpToDate").onObject(this).withParameterOfType("std::vector<std::filesystem::path>", "outputFilePaths", &outputFilePaths).withStringParameter("signature", signature.c_str()).returnBoolValue();
+}
+
+void StampCache::Update(const std::vector<std::filesystem::path> & outputFilePaths, const std::string & signature, const std::vector<std::filesystem::path> & dependencies) const
+{
+    mock().actualCall("StampCache::Update").onObject(this).withParameterOfType("std::vector<std::filesystem::path>", "outputFilePaths", &outputFilePaths).withStringParameter("signature", signature.c_str()).withParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies);
+}
+
+bool StampCache::GetModel(const std::filesystem::path & inputFilePath, const std::string & signature, std::string & model, std::vector<std::filesystem::path> & dependencies) const
+{
+    return mock().actualCall("StampCache::GetModel").onObject(this).withStringParameter("inputFilePath", inputFilePath.generic_string().c_str()).withStringParameter("signature", signature.c_str()).withOutputParameterOfType("std::string", "model", &model).withOutputParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies).returnBoolValue();
+}
+
+void StampCache::StoreModel(const std::filesystem::path & inputFilePath, const std::string & signature, const std::vector<std::filesystem::path> & dependencies, const std::string & model) const
+{
+    mock().actualCall("StampCache::StoreModel").onObject(this).withStringParameter("inputFilePath", inputFilePath.generic_string().c_str()).withStringParameter("signature", signature.c_str()).withParameterOfType("std::vector<std::filesystem::path>", "dependencies", &dependencies).withStringParameter("model", model.c_str());
+}
+
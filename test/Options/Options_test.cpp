@@ -97,21 +97,41 @@ TEST( Options_FromCommandLine, None )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK_FALSE( options.IsWorkerRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    STRCMP_EQUAL( "", options.GetBatchFilePath().c_str() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
     STRCMP_EQUAL( "", options.GetExpectationsOutputPath().c_str() );
     STRCMP_EQUAL( "", options.GetBaseDirectory().c_str() );
     CHECK_FALSE( options.IsRegenerationRequested() );
+    UNSIGNED_LONGS_EQUAL( 0, options.GetNumJobs() );
+    STRCMP_EQUAL( "", options.GetCacheDirectory().c_str() );
+    STRCMP_EQUAL( "", options.GetCompilationDatabasePath().c_str() );
+    CHECK_FALSE( options.IsCheckRequested() );
+    CHECK_FALSE( options.IsDepFileRequested() );
+    CHECK_FALSE( options.IsWatchRequested() );
+    CHECK( options.GetPreludeHeaders().empty() );
+    CHECK_FALSE( options.IsAutoPreludeRequested() );
+    CHECK_FALSE( options.IsUmbrellaParseRequested() );
+    CHECK_FALSE( options.IsStreamingRequested() );
+    STRCMP_EQUAL( "", options.GetTimeReportPath().c_str() );
+    STRCMP_EQUAL( "", options.GetTracePath().c_str() );
     CHECK_FALSE( options.InterpretAsCpp() );
     STRCMP_EQUAL( "", options.GetLanguageStandard().c_str() );
     CHECK_FALSE( options.UseUnderlyingTypedef() );
+    CHECK_FALSE( options.IsFastParseRequested() );
+    CHECK_FALSE( options.IsSingleFileParseRequested() );
+    CHECK_FALSE( options.IsSimpleCParseRequested() );
     STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
 
     auto typeOverrideOptions = options.GetTypeOverrides();
     CHECK( typeOverrideOptions.empty() );
 
+    auto typeMapOptions = options.GetTypeMap();
+    CHECK( typeMapOptions.empty() );
+
     auto includePaths = options.GetIncludePaths();
     CHECK( includePaths.empty() );
 }
@@ -129,7 +149,7 @@ TEST( Options_FromCommandLine, Help_Short )
     // Verify
     CHECK_TRUE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -164,7 +184,7 @@ TEST( Options_FromCommandLine, Help_Long )
     // Verify
     CHECK_TRUE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -199,7 +219,7 @@ TEST( Options_FromCommandLine, Version_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_TRUE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -231,7 +251,7 @@ TEST( Options_FromCommandLine, Version_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_TRUE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -263,7 +283,8 @@ TEST( Options_FromCommandLine, Input_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT_PATH", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT_PATH", options.GetInputPaths()[0].c_str() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -295,7 +316,8 @@ TEST( Options_FromCommandLine, Input_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT_PATH", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT_PATH", options.GetInputPaths()[0].c_str() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -327,7 +349,8 @@ TEST( Options_FromCommandLine, Input_Positional )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT_PATH", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT_PATH", options.GetInputPaths()[0].c_str() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -346,6 +369,351 @@ TEST( Options_FromCommandLine, Input_Positional )
     CHECK( includePaths.empty() );
 }
 
+TEST( Options_FromCommandLine, Input_Multiple )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "INPUT_PATH1", "-i", "INPUT_PATH2", "INPUT_PATH3" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK_EQUAL( 3, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT_PATH1", options.GetInputPaths()[0].c_str() );
+    STRCMP_EQUAL( "INPUT_PATH2", options.GetInputPaths()[1].c_str() );
+    STRCMP_EQUAL( "INPUT_PATH3", options.GetInputPaths()[2].c_str() );
+    STRCMP_EQUAL( "", options.GetBatchFilePath().c_str() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "", options.GetBaseDirectory().c_str() );
+    CHECK_FALSE( options.IsRegenerationRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, BatchFile_Short )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "-b", "BATCH_FILE" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    STRCMP_EQUAL( "BATCH_FILE", options.GetBatchFilePath().c_str() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "", options.GetBaseDirectory().c_str() );
+    CHECK_FALSE( options.IsRegenerationRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, BatchFile_Long )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--batch-file", "BATCH_FILE" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    STRCMP_EQUAL( "BATCH_FILE", options.GetBatchFilePath().c_str() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "", options.GetBaseDirectory().c_str() );
+    CHECK_FALSE( options.IsRegenerationRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, NumJobs_Short )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "-j", "4" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    UNSIGNED_LONGS_EQUAL( 4, options.GetNumJobs() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, NumJobs_Long )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--jobs", "4" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    UNSIGNED_LONGS_EQUAL( 4, options.GetNumJobs() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, CacheDirectory )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--cache-dir", "CACHE_DIR" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "CACHE_DIR", options.GetCacheDirectory().c_str() );
+    CHECK_FALSE( options.IsCheckRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Check )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--check" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "", options.GetCacheDirectory().c_str() );
+    CHECK_TRUE( options.IsCheckRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, CompilationDatabase )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--compile-commands", "BUILD_DIR" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "BUILD_DIR", options.GetCompilationDatabasePath().c_str() );
+    CHECK( options.GetIncludePaths().empty() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, DepFile )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--depfile" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    CHECK_FALSE( options.IsCheckRequested() );
+    CHECK_TRUE( options.IsDepFileRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Watch )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--watch" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    CHECK_FALSE( options.IsCheckRequested() );
+    CHECK_FALSE( options.IsDepFileRequested() );
+    CHECK_TRUE( options.IsWatchRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Prelude )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--prelude", "Prelude1.h", "--prelude", "Prelude2.h", "--auto-prelude" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+
+    auto preludeHeaders = options.GetPreludeHeaders();
+    CHECK_EQUAL( 2, preludeHeaders.size() );
+    STRCMP_EQUAL( "Prelude1.h", preludeHeaders[0].c_str() );
+    STRCMP_EQUAL( "Prelude2.h", preludeHeaders[1].c_str() );
+    CHECK_TRUE( options.IsAutoPreludeRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Umbrella )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--umbrella" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    CHECK_FALSE( options.IsWatchRequested() );
+    CHECK_TRUE( options.IsUmbrellaParseRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Streaming )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--stream" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    CHECK_FALSE( options.IsUmbrellaParseRequested() );
+    CHECK_TRUE( options.IsStreamingRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, TimeReport )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--time-report", "report.json" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "report.json", options.GetTimeReportPath().c_str() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Trace )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--trace", "trace.json" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsMockRequested() );
+    CHECK_FALSE( options.IsExpectationsRequested() );
+    STRCMP_EQUAL( "", options.GetTimeReportPath().c_str() );
+    STRCMP_EQUAL( "trace.json", options.GetTracePath().c_str() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, Worker )
+{
+    for( const char *option : { "--worker", "--persistent_worker" } )
+    {
+        // Prepare
+        std::vector<const char *> args = { "CppUMockGen.exe", option };
+
+        Options options;
+
+        // Exercise
+        options.Parse( (int) args.size(), args.data() );
+
+        // Verify
+        CHECK_FALSE( options.IsHelpRequested() );
+        CHECK_FALSE( options.IsVersionRequested() );
+        CHECK_TRUE( options.IsWorkerRequested() );
+        CHECK( options.GetInputPaths().empty() );
+        CHECK_FALSE( options.IsMockRequested() );
+        CHECK_FALSE( options.IsExpectationsRequested() );
+    }
+}
+
 TEST( Options_FromCommandLine, Mock_Short_NoPath )
 {
     // Prepare
@@ -359,7 +727,7 @@ TEST( Options_FromCommandLine, Mock_Short_NoPath )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -391,7 +759,7 @@ TEST( Options_FromCommandLine, Mock_Short_WithPath )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "OUTPUT_PATH", options.GetMockOutputPath().c_str() );
@@ -423,7 +791,7 @@ TEST( Options_FromCommandLine, Mock_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "OUTPUT_PATH", options.GetMockOutputPath().c_str() );
@@ -455,7 +823,7 @@ TEST( Options_FromCommandLine, Expectations_Short_NoPath )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -487,7 +855,7 @@ TEST( Options_FromCommandLine, Expectations_Short_WithPath )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -519,7 +887,7 @@ TEST( Options_FromCommandLine, Expectations_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -551,7 +919,7 @@ TEST( Options_FromCommandLine, BaseDirectory_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -583,7 +951,7 @@ TEST( Options_FromCommandLine, BaseDirectory_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -615,7 +983,7 @@ TEST( Options_FromCommandLine, Regeneration_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -647,7 +1015,7 @@ TEST( Options_FromCommandLine, Regeneration_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -679,7 +1047,7 @@ TEST( Options_FromCommandLine, InterpretAsCpp_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -711,7 +1079,7 @@ TEST( Options_FromCommandLine, InterpretAsCpp_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -743,7 +1111,7 @@ TEST( Options_FromCommandLine, LanguageStandard_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -775,7 +1143,7 @@ TEST( Options_FromCommandLine, LanguageStandard_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -807,7 +1175,7 @@ TEST( Options_FromCommandLine, UseUnderlyingTypedef_Short )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -839,7 +1207,7 @@ TEST( Options_FromCommandLine, UseUnderlyingTypedef_Long )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -858,6 +1226,91 @@ TEST( Options_FromCommandLine, UseUnderlyingTypedef_Long )
     CHECK( includePaths.empty() );
 }
 
+TEST( Options_FromCommandLine, FastParse )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--fast-parse" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.InterpretAsCpp() );
+    STRCMP_EQUAL( "", options.GetLanguageStandard().c_str() );
+    CHECK_FALSE( options.UseUnderlyingTypedef() );
+    CHECK_TRUE( options.IsFastParseRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, SingleFile )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--single-file" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsFastParseRequested() );
+    CHECK_TRUE( options.IsSingleFileParseRequested() );
+    CHECK( options.GetTypeMap().empty() );
+    STRCMP_EQUAL( "--single-file", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, SimpleC )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--simple-c" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_FALSE( options.IsFastParseRequested() );
+    CHECK_FALSE( options.IsSingleFileParseRequested() );
+    CHECK_TRUE( options.IsSimpleCParseRequested() );
+    STRCMP_EQUAL( "", options.GetGenerationOptions().c_str() );
+}
+
+TEST( Options_FromCommandLine, TypeMap )
+{
+    // Prepare
+    std::vector<const char *> args = { "CppUMockGen.exe", "--single-file", "--type-map", "uint32_t=unsigned int",
+                                       "--type-map", "size_t=unsigned long" };
+
+    Options options;
+
+    // Exercise
+    options.Parse( (int) args.size(), args.data() );
+
+    // Verify
+    CHECK_FALSE( options.IsHelpRequested() );
+    CHECK_FALSE( options.IsVersionRequested() );
+    CHECK( options.GetInputPaths().empty() );
+    CHECK_TRUE( options.IsSingleFileParseRequested() );
+    STRCMP_EQUAL( "--single-file --type-map \"uint32_t=unsigned int\" --type-map \"size_t=unsigned long\"", options.GetGenerationOptions().c_str() );
+
+    auto typeMapOptions = options.GetTypeMap();
+    CHECK_EQUAL( 2, typeMapOptions.size() );
+    STRCMP_EQUAL( "uint32_t=unsigned int", typeMapOptions[0].c_str() );
+    STRCMP_EQUAL( "size_t=unsigned long", typeMapOptions[1].c_str() );
+}
+
 TEST( Options_FromCommandLine, IncludePaths )
 {
     // Prepare
@@ -871,7 +1324,7 @@ TEST( Options_FromCommandLine, IncludePaths )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -905,7 +1358,7 @@ TEST( Options_FromCommandLine, TypeOverrides )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -941,7 +1394,8 @@ TEST( Options_FromCommandLine, Combination )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT FILE", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT FILE", options.GetInputPaths()[0].c_str() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -1004,7 +1458,7 @@ TEST( Options_FromString, Empty )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -1036,7 +1490,8 @@ TEST( Options_FromString, Combination )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT FILE", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT FILE", options.GetInputPaths()[0].c_str() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "OUTPUT PATH", options.GetMockOutputPath().c_str() );
@@ -1101,7 +1556,7 @@ TEST( Options_FromString, EscapedQuotes )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -1167,7 +1622,7 @@ TEST( Options_FromConfigFile, EmptyFile )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -1204,7 +1659,8 @@ TEST( Options_FromConfigFile, Combination )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT FILE", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT FILE", options.GetInputPaths()[0].c_str() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "OUTPUT PATH", options.GetMockOutputPath().c_str() );
@@ -1316,7 +1772,7 @@ TEST( Options_FromConfigFile, IncludeOtherConfigFile_1Level )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -1372,7 +1828,8 @@ TEST( Options_FromConfigFile, IncludeOtherConfigFile_2Level )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "INPUT FILE", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "INPUT FILE", options.GetInputPaths()[0].c_str() );
     CHECK_TRUE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "@", options.GetMockOutputPath().c_str() );
@@ -1455,7 +1912,8 @@ TEST( Options_FromConfigFile, IncludeOtherConfigFile_Recursive )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "Input File", options.GetInputPath().c_str() );
+    CHECK_EQUAL( 1, options.GetInputPaths().size() );
+    STRCMP_EQUAL( "Input File", options.GetInputPaths()[0].c_str() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_TRUE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -1495,7 +1953,7 @@ TEST( Options_FromConfigFile, EscapedQuotes )
     // Verify
     CHECK_FALSE( options.IsHelpRequested() );
     CHECK_FALSE( options.IsVersionRequested() );
-    STRCMP_EQUAL( "", options.GetInputPath().c_str() );
+    CHECK( options.GetInputPaths().empty() );
     CHECK_FALSE( options.IsMockRequested() );
     CHECK_FALSE( options.IsExpectationsRequested() );
     STRCMP_EQUAL( "", options.GetMockOutputPath().c_str() );
@@ -55,6 +55,17 @@ Config* GetMockConfig()
     return (Config*) (void*) 836487567;
 }
 
+class StdOstreamCopier : public MockNamedValueCopier
+{
+public:
+    virtual void copy(void* out, const void* in)
+    {
+        *(std::ostream*)out << *(const std::string*)in;
+    }
+};
+
+StdOstreamCopier stdOstreamCopier;
+
 /*===========================================================================
  *                          TEST GROUP DEFINITION
  *===========================================================================*/
@@ -63,6 +74,7 @@ static const std::string EMPTY_STRING;
 
 static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
 static const std::string defaultTempFilename = "CppUMockGen_Parser.h";
+static const std::string includedTempFilename = "CppUMockGen_Parser_Included.h";
 static const std::string nonexistingFilePath = ( tempDirPath / "CppUMockGen_Parser_NotExisting.h" ).generic_string();
 
 TEST_GROUP( Parser )
@@ -138,7 +150,7 @@ TEST( Parser, MockedFunction )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -239,7 +251,7 @@ TEST( Parser, MockedMethod )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -340,7 +352,7 @@ TEST( Parser, MockedConstructor )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -441,7 +453,7 @@ TEST( Parser, MockedDestructor )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -544,7 +556,7 @@ TEST( Parser, MockedMethod_Cpp17 )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -647,7 +659,7 @@ TEST( Parser, MockedMethod_Cpp14 )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -750,7 +762,7 @@ TEST( Parser, MockedMethod_Gnu98 )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -855,7 +867,7 @@ TEST( Parser, MultipleMockableFunctionsAndMethods )
         expect::Function$::Parse( 4, IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -974,7 +986,7 @@ TEST( Parser, FunctionNonMockable )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( false, result );
@@ -1025,7 +1037,7 @@ TEST( Parser, MethodNonMockable )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( false, result );
@@ -1076,7 +1088,7 @@ TEST( Parser, ConstructorNonMockable )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( false, result );
@@ -1127,7 +1139,7 @@ TEST( Parser, DestructorNonMockable )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( false, result );
@@ -1183,7 +1195,7 @@ TEST( Parser, MixedMockableNonMockableFunctionsAndMethods )
         expect::Function$::Function$dtor(2);
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -1286,7 +1298,7 @@ TEST( Parser, SyntaxError )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( false, result );
@@ -1334,7 +1346,7 @@ TEST( Parser, Warning )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -1428,7 +1440,7 @@ TEST( Parser, NonExistingInputFile )
         expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
 
         // Exercise
-        bool result = parser->Parse( nonexistingFilePath, *config, false, std::vector<std::string>(), error );
+        bool result = parser->Parse( nonexistingFilePath, *config, false, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( false, result );
@@ -1477,7 +1489,7 @@ TEST( Parser, IncludePaths )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>{includePath}, error );
+        bool result = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>{includePath}, std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -1496,6 +1508,343 @@ TEST( Parser, IncludePaths )
     SUBTEST_END
 }
 
+/*
+ * Check that additional compiler arguments are processed properly.
+ */
+TEST( Parser, CompileArgs )
+{
+    SUBTEST_BEGIN( "Parser instance creation" )
+
+        // Exercise
+        Parser *parser = new Parser();
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::Parse invocation" )
+
+        // Prepare
+        Config* config = GetMockConfig();
+        std::ostringstream error;
+
+        SimpleString testHeader =
+                "#ifdef ENABLE_FUNCTION\n"
+                "void function1(FUNCTION_TYPE a);\n"
+                "#endif\n";
+        SetupTempFile( testHeader );
+
+        std::filesystem::current_path( tempDirPath );
+
+        std::vector<std::string> compileArgs = { "-DENABLE_FUNCTION", "-DFUNCTION_TYPE=int" };
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor();
+        expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>(), compileArgs, error );
+
+        // Verify
+        CHECK_EQUAL( true, result );
+        CHECK_EQUAL( 0, error.tellp() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser instance deletion" )
+
+        // Prepare
+        expect::Function$::Function$dtor();
+
+        // Exercise
+        delete( parser );
+
+    SUBTEST_END
+}
+
+/*
+ * Check that the files read while parsing are reported as dependencies.
+ */
+TEST( Parser, Dependencies )
+{
+    SUBTEST_BEGIN( "Parser instance creation" )
+
+        // Exercise
+        Parser *parser = new Parser();
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::Parse invocation" )
+
+        // Prepare
+        Config* config = GetMockConfig();
+        std::ostringstream error;
+
+        SimpleString includedHeader =
+                "typedef int Type1;\n";
+        SetupTempFile( includedTempFilename, includedHeader );
+
+        SimpleString testHeader =
+                "#include \"CppUMockGen_Parser_Included.h\"\n"
+                "void function1(Type1 t);\n";
+        SetupTempFile( testHeader );
+
+        std::filesystem::current_path( tempDirPath );
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor();
+        expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>{}, std::vector<std::string>(), error );
+
+        // Verify
+        CHECK_EQUAL( true, result );
+        CHECK_EQUAL( 0, error.tellp() );
+
+        std::filesystem::remove( tempDirPath / includedTempFilename );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::GetDependencies invocation" )
+
+        // Exercise
+        const std::vector<std::filesystem::path> &dependencies = parser->GetDependencies();
+
+        // Verify
+        CHECK_EQUAL( 2, dependencies.size() );
+        STRCMP_EQUAL( defaultTempFilename.c_str(), dependencies[0].filename().generic_string().c_str() );
+        STRCMP_EQUAL( includedTempFilename.c_str(), dependencies[1].filename().generic_string().c_str() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser instance deletion" )
+
+        // Prepare
+        expect::Function$::Function$dtor();
+
+        // Exercise
+        delete( parser );
+
+    SUBTEST_END
+}
+
+/*
+ * Check that when the translation unit is kept, parsing the same file again with the same options takes into account
+ * the changes in the included files, and that parsing it with different options also works.
+ */
+TEST( Parser, KeepTranslationUnit )
+{
+    SUBTEST_BEGIN( "Parser instance creation" )
+
+        // Exercise
+        Parser *parser = new Parser( true );
+
+    SUBTEST_END
+
+    Config* config = GetMockConfig();
+
+    SUBTEST_BEGIN( "Parser::Parse first invocation" )
+
+        // Prepare
+        std::ostringstream error;
+
+        SimpleString includedHeader =
+                "#define NUM_FUNCTIONS 1\n";
+        SetupTempFile( includedTempFilename, includedHeader );
+
+        SimpleString testHeader =
+                "#include \"CppUMockGen_Parser_Included.h\"\n"
+                "void function1();\n"
+                "#if NUM_FUNCTIONS > 1\n"
+                "void function2();\n"
+                "#endif\n";
+        SetupTempFile( testHeader );
+
+        std::filesystem::current_path( tempDirPath );
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor();
+        expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
+
+        // Verify
+        CHECK_EQUAL( true, result );
+        CHECK_EQUAL( 0, error.tellp() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::Parse invocation after changing included file" )
+
+        // Prepare
+        std::ostringstream error2;
+
+        std::ofstream includedFile( tempDirPath / includedTempFilename );
+        includedFile << "#define NUM_FUNCTIONS ( 1 + 1 )\n";
+        includedFile.close();
+
+        expect::Function$::Function$dtor();
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor( 2 );
+        expect::Function$::Parse( 2, IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result2 = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>(), std::vector<std::string>(), error2 );
+
+        // Verify
+        CHECK_EQUAL( true, result2 );
+        CHECK_EQUAL( 0, error2.tellp() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::Parse invocation with different options" )
+
+        // Prepare
+        std::ostringstream error3;
+
+        std::vector<std::string> compileArgs = { "-DUNUSED" };
+
+        expect::Function$::Function$dtor( 2 );
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor( 2 );
+        expect::Function$::Parse( 2, IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result3 = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>(), compileArgs, error3 );
+
+        // Verify
+        CHECK_EQUAL( true, result3 );
+        CHECK_EQUAL( 0, error3.tellp() );
+
+        std::filesystem::remove( tempDirPath / includedTempFilename );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser instance deletion" )
+
+        // Prepare
+        expect::Function$::Function$dtor( 2 );
+
+        // Exercise
+        delete( parser );
+
+    SUBTEST_END
+}
+
+/*
+ * Check that a precompiled header can be built and then used to parse an input file, and that building it fails if
+ * the header has errors.
+ */
+TEST( Parser, BuildPrecompiledHeader )
+{
+    SUBTEST_BEGIN( "Parser instance creation" )
+
+        // Exercise
+        Parser *parser = new Parser();
+
+    SUBTEST_END
+
+    Config* config = GetMockConfig();
+    std::string preludeTempFilename = "CppUMockGen_Parser_Prelude.h";
+    std::filesystem::path pchFilePath = tempDirPath / "CppUMockGen_Parser_Prelude.pch";
+
+    SUBTEST_BEGIN( "Parser::BuildPrecompiledHeader invocation" )
+
+        // Prepare
+        std::ostringstream error;
+        std::vector<std::filesystem::path> dependencies;
+
+        SimpleString includedHeader =
+                "typedef int Type1;\n";
+        SetupTempFile( includedTempFilename, includedHeader );
+
+        SimpleString preludeHeader =
+                "#include \"CppUMockGen_Parser_Included.h\"\n";
+        SetupTempFile( preludeTempFilename, preludeHeader );
+
+        std::filesystem::current_path( tempDirPath );
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+
+        // Exercise
+        bool result = parser->BuildPrecompiledHeader( preludeTempFilename, pchFilePath, *config, true, std::vector<std::string>(),
+                                                      std::vector<std::string>(), dependencies, error );
+
+        // Verify
+        CHECK_EQUAL( true, result );
+        CHECK_EQUAL( 0, error.tellp() );
+        CHECK_TRUE( std::filesystem::exists( pchFilePath ) );
+        CHECK_EQUAL( 2, dependencies.size() );
+        STRCMP_EQUAL( preludeTempFilename.c_str(), dependencies[0].filename().generic_string().c_str() );
+        STRCMP_EQUAL( includedTempFilename.c_str(), dependencies[1].filename().generic_string().c_str() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::Parse invocation using the precompiled header" )
+
+        // Prepare
+        std::ostringstream error2;
+
+        // The type is only declared in the precompiled header
+        SimpleString testHeader =
+                "void function1(Type1 t);\n";
+        SetupTempFile( testHeader );
+
+        std::vector<std::string> compileArgs = { "-include-pch", pchFilePath.generic_string() };
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor();
+        expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result2 = parser->Parse( defaultTempFilename, *config, true, std::vector<std::string>(), compileArgs, error2 );
+
+        // Verify
+        CHECK_EQUAL( true, result2 );
+        CHECK_EQUAL( 0, error2.tellp() );
+
+        std::filesystem::remove( tempDirPath / includedTempFilename );
+        std::filesystem::remove( tempDirPath / preludeTempFilename );
+        std::filesystem::remove( pchFilePath );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::BuildPrecompiledHeader invocation with errors" )
+
+        // Prepare
+        std::ostringstream error3;
+        std::vector<std::filesystem::path> dependencies3;
+
+        SimpleString wrongPreludeHeader =
+                "#include \"CppUMockGen_Parser_NotExisting.h\"\n";
+        SetupTempFile( preludeTempFilename, wrongPreludeHeader );
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::ConsoleColorizer$::SetColor( 2, IgnoreParameter::YES, IgnoreParameter::YES );
+
+        // Exercise
+        bool result3 = parser->BuildPrecompiledHeader( preludeTempFilename, pchFilePath, *config, true, std::vector<std::string>(),
+                                                       std::vector<std::string>(), dependencies3, error3 );
+
+        // Verify
+        CHECK_EQUAL( false, result3 );
+        STRCMP_CONTAINS( "PARSE ERROR:", error3.str().c_str() );
+        STRCMP_CONTAINS( "CppUMockGen_Parser_NotExisting.h", error3.str().c_str() );
+        CHECK_FALSE( std::filesystem::exists( pchFilePath ) );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser instance deletion" )
+
+        // Prepare
+        expect::Function$::Function$dtor();
+
+        // Exercise
+        delete( parser );
+
+    SUBTEST_END
+}
+
 /*
  * Check that regeneration options are stored properly.
  */
@@ -1562,7 +1911,7 @@ TEST( Parser, BaseDirectory )
         expect::Function$::Parse( IgnoreParameter::YES, IgnoreParameter::YES, config, true );
 
         // Exercise
-        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), error );
+        bool result = parser->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
 
         // Verify
         CHECK_EQUAL( true, result );
@@ -1673,3 +2022,220 @@ TEST( Parser, UserCode )
 
     SUBTEST_END
 }
+
+/*
+ * Check that the model of a parsed input file can be saved and then loaded into another parser to generate the same
+ * outputs without parsing the input file again.
+ */
+TEST( Parser, SaveAndLoadModel )
+{
+    mock().installCopier( "std::ostream", stdOstreamCopier );
+
+    Config* config = GetMockConfig();
+
+    SUBTEST_BEGIN( "Parser instances creation" )
+
+        // Exercise
+        Parser *parser1 = new Parser();
+        Parser *parser2 = new Parser();
+        parser1->SetModelSaved( true );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::Parse invocation" )
+
+        // Prepare
+        std::ostringstream error;
+
+        SimpleString testHeader =
+                "void function1();\n"
+                "class class1 {\n"
+                "public:\n"
+                "    class1();\n"
+                "    ~class1();\n"
+                "    void method1();\n"
+                "};";
+        SetupTempFile( testHeader );
+
+        expect::Config$::GetLanguageStandard( config, &EMPTY_STRING );
+        expect::Function$::Function$ctor( 4 );
+        expect::Constructor$::Constructor$ctor();
+        expect::Destructor$::Destructor$ctor();
+        expect::Method$::Method$ctor();
+        expect::Function$::Parse( 4, IgnoreParameter::YES, IgnoreParameter::YES, config, true );
+
+        // Exercise
+        bool result = parser1->Parse( tempFilePath, *config, true, std::vector<std::string>(), std::vector<std::string>(), error );
+
+        // Verify
+        CHECK_EQUAL( true, result );
+        CHECK_EQUAL( 0, error.tellp() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::SaveModel invocation" )
+
+        // Prepare
+        std::ostringstream model;
+        const std::string functionModel = "###FUNCTION_MODEL###\n";
+
+        expect::Function$::Serialize( 4, IgnoreParameter::YES, &functionModel );
+
+        // Exercise
+        parser1->SaveModel( model );
+
+        // Verify
+        STRCMP_EQUAL( "CppUMockGen model\n"
+                      "1\n"
+                      "4\n"
+                      "function\n"
+                      "###FUNCTION_MODEL###\n"
+                      "constructor\n"
+                      "###FUNCTION_MODEL###\n"
+                      "destructor\n"
+                      "###FUNCTION_MODEL###\n"
+                      "method\n"
+                      "###FUNCTION_MODEL###\n",
+                      model.str().c_str() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::LoadModel invocation" )
+
+        // Prepare
+        std::istringstream model2( "CppUMockGen model\n"
+                                   "1\n"
+                                   "4\n"
+                                   "function\n"
+                                   "constructor\n"
+                                   "destructor\n"
+                                   "method\n" );
+
+        expect::Function$::Function$ctor( 4 );
+        expect::Constructor$::Constructor$ctor();
+        expect::Destructor$::Destructor$ctor();
+        expect::Method$::Method$ctor();
+        expect::Function$::Deserialize( 4, IgnoreParameter::YES, &model2, config, true );
+
+        // Exercise
+        bool result2 = parser2->LoadModel( "my_header.h", *config, model2 );
+
+        // Verify
+        CHECK_EQUAL( true, result2 );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser::GenerateMock invocation" )
+
+        // Prepare
+        std::ostringstream output;
+        const char* testMock = "###MOCK###";
+
+        expect::Function$::GenerateMock( 4, IgnoreParameter::YES, testMock );
+
+        // Exercise
+        parser2->GenerateMock( "", "", "", output );
+
+        // Verify
+        STRCMP_CONTAINS( testMock, output.str().c_str() );
+        STRCMP_CONTAINS( "#include \"my_header.h\"\n", output.str().c_str() );
+        STRCMP_CONTAINS( "#include <CppUTestExt/MockSupport.h>\n", output.str().c_str() );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Parser instances deletion" )
+
+        // Prepare
+        expect::Function$::Function$dtor( 8 );
+
+        // Exercise
+        delete( parser1 );
+        delete( parser2 );
+
+    SUBTEST_END
+
+    mock().removeAllComparatorsAndCopiers();
+}
+
+/*
+ * Check that loading a model fails if it is not valid.
+ */
+TEST( Parser, LoadModel_Invalid )
+{
+    // Prepare
+    Config* config = GetMockConfig();
+    Parser parser;
+
+    SUBTEST_BEGIN( "Invalid header" )
+
+        // Prepare
+        std::istringstream model( "CppUMockGen something\n1\n0\n" );
+
+        // Exercise
+        bool result = parser.LoadModel( "my_header.h", *config, model );
+
+        // Verify
+        CHECK_EQUAL( false, result );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Invalid language" )
+
+        // Prepare
+        std::istringstream model2( "CppUMockGen model\n2\n0\n" );
+
+        // Exercise
+        bool result2 = parser.LoadModel( "my_header.h", *config, model2 );
+
+        // Verify
+        CHECK_EQUAL( false, result2 );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Missing functions" )
+
+        // Prepare
+        std::istringstream model3( "CppUMockGen model\n0\n2\nfunction\n" );
+
+        expect::Function$::Function$ctor();
+        expect::Function$::Deserialize( IgnoreParameter::YES, &model3, config, true );
+        expect::Function$::Function$dtor();
+
+        // Exercise
+        bool result3 = parser.LoadModel( "my_header.h", *config, model3 );
+
+        // Verify
+        CHECK_EQUAL( false, result3 );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Unknown function kind" )
+
+        // Prepare
+        std::istringstream model4( "CppUMockGen model\n0\n1\noperator\n" );
+
+        // Exercise
+        bool result4 = parser.LoadModel( "my_header.h", *config, model4 );
+
+        // Verify
+        CHECK_EQUAL( false, result4 );
+
+    SUBTEST_END
+
+    SUBTEST_BEGIN( "Function rejected" )
+
+        // Prepare
+        std::istringstream model5( "CppUMockGen model\n0\n1\nfunction\n" );
+
+        expect::Function$::Function$ctor();
+        expect::Function$::Deserialize( IgnoreParameter::YES, &model5, config, false );
+        expect::Function$::Function$dtor();
+
+        // Exercise
+        bool result5 = parser.LoadModel( "my_header.h", *config, model5 );
+
+        // Verify
+        CHECK_EQUAL( false, result5 );
+
+    SUBTEST_END
+}
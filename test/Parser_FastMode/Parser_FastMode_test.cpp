@@ -0,0 +1,236 @@
+/**
+ * @file
+ * @brief      Conformance tests for the "Parser" class when skipping function bodies
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "Parser.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string inputFilename = "CppUMockGen_Parser_FastMode.h";
+static const std::string includedFilename = "CppUMockGen_Parser_FastMode.inl";
+static const std::string preludeFilename = "CppUMockGen_Parser_FastMode_prelude.hpp";
+static const std::string pchFilename = "CppUMockGen_Parser_FastMode_prelude.pch";
+
+TEST_GROUP( Parser_FastMode )
+{
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove( tempDirPath / inputFilename );
+        std::filesystem::remove( tempDirPath / includedFilename );
+        std::filesystem::remove( tempDirPath / preludeFilename );
+        std::filesystem::remove( tempDirPath / pchFilename );
+    }
+
+    void SetupTempFile( const std::string &filename, const std::string &contents )
+    {
+        std::ofstream tempFile( tempDirPath / filename );
+        tempFile << contents;
+    }
+
+    std::string Generate( bool skipFunctionBodies, bool isCppHeader, bool usePrelude )
+    {
+        Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+        Parser parser( false, skipFunctionBodies );
+        std::ostringstream error;
+
+        std::vector<std::string> compileArgs;
+        if( usePrelude )
+        {
+            std::vector<std::filesystem::path> dependencies;
+            CHECK_TRUE( parser.BuildPrecompiledHeader( tempDirPath / preludeFilename, tempDirPath / pchFilename, config,
+                                                       isCppHeader, std::vector<std::string>(), std::vector<std::string>(),
+                                                       dependencies, error ) );
+            compileArgs = { "-include-pch", ( tempDirPath / pchFilename ).generic_string() };
+        }
+
+        CHECK_TRUE( parser.Parse( tempDirPath / inputFilename, config, isCppHeader, std::vector<std::string>(),
+                                  compileArgs, error ) );
+        STRCMP_EQUAL( "", error.str().c_str() );
+
+        std::ostringstream output;
+        parser.GenerateMock( "", "", "", output );
+        parser.GenerateExpectationHeader( "", "", output );
+        parser.GenerateExpectationImpl( "", "expect.h", output );
+        return output.str();
+    }
+
+    void CheckConformance( bool isCppHeader, const std::vector<std::string> &mockedFunctions,
+                           const std::vector<std::string> &notMockedFunctions, bool usePrelude = false )
+    {
+        // Exercise
+        std::string normalOutput = Generate( false, isCppHeader, usePrelude );
+        std::string fastOutput = Generate( true, isCppHeader, usePrelude );
+
+        // Verify
+        STRCMP_EQUAL( normalOutput.c_str(), fastOutput.c_str() );
+        for( const std::string &function : mockedFunctions )
+        {
+            STRCMP_CONTAINS( ( "\"" + function + "\"" ).c_str(), fastOutput.c_str() );
+        }
+        for( const std::string &function : notMockedFunctions )
+        {
+            CHECK_TEXT( fastOutput.find( "\"" + function + "\"" ) == std::string::npos, function.c_str() );
+        }
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the same C functions are mocked when skipping function bodies.
+ */
+TEST( Parser_FastMode, C_Functions )
+{
+    // Prepare
+    SetupTempFile( inputFilename,
+                   "struct Struct1 { int a; };\n"
+                   "void function1(void);\n"
+                   "int function2(int a), function3(const char *s);\n"
+                   "static inline int function4(int a) { return a + 1; }\n"
+                   "void function5(struct Struct1 *s);\n"
+                   "void function5(struct Struct1 *s) { s->a = 0; }\n"
+                   "unsigned long function6(void) /* comment */ ;\n"
+                   "double function7(double d) // comment\n"
+                   "{\n"
+                   "    return d * 2;\n"
+                   "}\n"
+                   "#define BODY { }\n"
+                   "void function8(void) BODY\n"
+                   "void function9(void);\n"
+                   "void function9(void);\n" );
+
+    // Exercise & Verify
+    CheckConformance( false,
+                      { "function1", "function2", "function3", "function6", "function9" },
+                      { "function4", "function5", "function7", "function8" } );
+}
+
+/*
+ * Check that the same C++ functions and methods are mocked when skipping function bodies.
+ */
+TEST( Parser_FastMode, Cpp_Methods )
+{
+    // Prepare
+    SetupTempFile( inputFilename,
+                   "namespace ns1 {\n"
+                   "class Base {\n"
+                   "public:\n"
+                   "    virtual ~Base();\n"
+                   "    virtual void virtual1() const;\n"
+                   "    virtual void pure1() = 0;\n"
+                   "};\n"
+                   "class Class1 : public Base {\n"
+                   "public:\n"
+                   "    Class1();\n"
+                   "    Class1(int a) : m_a(a) {}\n"
+                   "    Class1(char c) try : m_a(c) {} catch(...) {}\n"
+                   "    Class1(const Class1 &other) = default;\n"
+                   "    Class1& operator=(const Class1 &other) = delete;\n"
+                   "    ~Class1() override;\n"
+                   "    void virtual1() const override { }\n"
+                   "    void pure1() override;\n"
+                   "    int method1(int a) const;\n"
+                   "    int method2(int a) const noexcept { return a; }\n"
+                   "    auto method3() -> int { return m_a; }\n"
+                   "    auto method4() { return m_a; }\n"
+                   "    constexpr int method5() const { return 5; }\n"
+                   "    void method6();\n"
+                   "    void method7()\n"
+                   "    /* comment */\n"
+                   "    {\n"
+                   "    }\n"
+                   "    template<typename T> void method8(T t) { }\n"
+                   "    static int method9(), method10();\n"
+                   "private:\n"
+                   "    int m_a;\n"
+                   "};\n"
+                   "inline void Class1::method6() { }\n"
+                   "constexpr int function1(int a) { return a * 2; }\n"
+                   "int function2(int a);\n"
+                   "}\n" );
+
+    // Exercise & Verify
+    CheckConformance( true,
+                      { "ns1::Base::~Base", "ns1::Base::virtual1", "ns1::Class1::Class1", "ns1::Class1::~Class1",
+                        "ns1::Class1::pure1", "ns1::Class1::method1", "ns1::Class1::method9", "ns1::Class1::method10",
+                        "ns1::function2" },
+                      { "ns1::Base::pure1", "ns1::Class1::virtual1", "ns1::Class1::method2", "ns1::Class1::method3",
+                        "ns1::Class1::method4", "ns1::Class1::method5", "ns1::Class1::method6", "ns1::Class1::method7",
+                        "ns1::Class1::method8", "ns1::function1" } );
+}
+
+/*
+ * Check that functions declared in the input file but defined in a file included by it are not mocked when skipping
+ * function bodies.
+ */
+TEST( Parser_FastMode, DefinitionInIncludedFile )
+{
+    // Prepare
+    SetupTempFile( includedFilename,
+                   "inline int Class1::method1() const { return 1; }\n"
+                   "inline void function1() { }\n" );
+    SetupTempFile( inputFilename,
+                   "class Class1 {\n"
+                   "public:\n"
+                   "    int method1() const;\n"
+                   "    int method2() const;\n"
+                   "};\n"
+                   "void function1();\n"
+                   "void function2();\n"
+                   "#include \"" + includedFilename + "\"\n" );
+
+    // Exercise & Verify
+    CheckConformance( true,
+                      { "Class1::method2", "function2" },
+                      { "Class1::method1", "function1" } );
+}
+
+/*
+ * Check that functions declared in the input file but defined in a precompiled prelude are not mocked when skipping
+ * function bodies.
+ */
+TEST( Parser_FastMode, DefinitionInPrelude )
+{
+    // Prepare
+    SetupTempFile( preludeFilename,
+                   "inline void function1() { }\n"
+                   "namespace NS1 {\n"
+                   "    inline int function2(int a) { return a; }\n"
+                   "}\n" );
+    SetupTempFile( inputFilename,
+                   "void function1();\n"
+                   "namespace NS1 {\n"
+                   "    int function2(int a);\n"
+                   "    int function3(int a);\n"
+                   "}\n"
+                   "void function4();\n" );
+
+    // Exercise & Verify
+    CheckConformance( true,
+                      { "NS1::function3", "function4" },
+                      { "function1", "NS1::function2" },
+                      true );
+}
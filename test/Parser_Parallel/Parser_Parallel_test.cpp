@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @brief      Conformance tests for the "Parser" class when generating code in parallel
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "Parser.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string inputFilename = "CppUMockGen_Parser_Parallel.h";
+
+TEST_GROUP( Parser_Parallel )
+{
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove( tempDirPath / inputFilename );
+    }
+
+    void SetupTempFile( unsigned int numFunctions )
+    {
+        std::ofstream tempFile( tempDirPath / inputFilename );
+        tempFile << "typedef struct { int a; } Struct1;\n";
+        for( unsigned int i = 0; i < numFunctions; i++ )
+        {
+            tempFile << "int function" << i << "(const Struct1 *s, unsigned long *p, const char *str);\n";
+        }
+    }
+
+    std::string Generate( unsigned int numThreads )
+    {
+        Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+        Parser parser;
+        parser.SetNumGenerationThreads( numThreads );
+        std::ostringstream error;
+
+        CHECK_TRUE( parser.Parse( tempDirPath / inputFilename, config, false, std::vector<std::string>(),
+                                  std::vector<std::string>(), error ) );
+        STRCMP_EQUAL( "", error.str().c_str() );
+
+        std::ostringstream output;
+        parser.GenerateMock( "", "", "", output );
+        parser.GenerateExpectationHeader( "", "", output );
+        parser.GenerateExpectationImpl( "", "expect.h", output );
+        return output.str();
+    }
+
+    void CheckConformance( unsigned int numFunctions )
+    {
+        // Prepare
+        SetupTempFile( numFunctions );
+
+        // Exercise
+        std::string sequentialOutput = Generate( 1 );
+        std::string parallelOutput = Generate( 4 );
+
+        // Verify
+        STRCMP_EQUAL( sequentialOutput.c_str(), parallelOutput.c_str() );
+        STRCMP_CONTAINS( ( "\"function" + std::to_string( numFunctions - 1 ) + "\"" ).c_str(), parallelOutput.c_str() );
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the same code is generated in parallel for headers with less functions than a chunk.
+ */
+TEST( Parser_Parallel, SingleChunk )
+{
+    // Exercise & Verify
+    CheckConformance( 10 );
+}
+
+/*
+ * Check that the same code is generated in parallel for headers with many functions, in the same order.
+ */
+TEST( Parser_Parallel, ManyChunks )
+{
+    // Exercise & Verify
+    CheckConformance( 2000 );
+}
@@ -0,0 +1,183 @@
+/**
+ * @file
+ * @brief      Conformance tests for the "Parser" class when parsing single files
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "Parser.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string inputFilename = "CppUMockGen_Parser_SingleFile.h";
+static const std::string includedFilename = "CppUMockGen_Parser_SingleFile_types.h";
+
+TEST_GROUP( Parser_SingleFile )
+{
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove( tempDirPath / inputFilename );
+        std::filesystem::remove( tempDirPath / includedFilename );
+    }
+
+    void SetupTempFile( const std::string &filename, const std::string &contents )
+    {
+        std::ofstream tempFile( tempDirPath / filename );
+        tempFile << contents;
+    }
+
+    std::string Generate( bool singleFileParse, bool isCppHeader, const std::vector<std::string> &typeMap )
+    {
+        Config config( false, "", false, std::vector<std::string>(), typeMap );
+        Parser parser( false, false, singleFileParse );
+        std::ostringstream error;
+
+        CHECK_TRUE( parser.Parse( tempDirPath / inputFilename, config, isCppHeader, std::vector<std::string>(),
+                                  std::vector<std::string>(), error ) );
+        STRCMP_EQUAL( "", error.str().c_str() );
+
+        std::ostringstream output;
+        parser.GenerateMock( "", "", "", output );
+        parser.GenerateExpectationHeader( "", "", output );
+        parser.GenerateExpectationImpl( "", "expect.h", output );
+        return output.str();
+    }
+
+    void CheckConformance( bool isCppHeader, const std::vector<std::string> &typeMap,
+                           const std::vector<std::string> &mockedFunctions )
+    {
+        // Exercise
+        std::string normalOutput = Generate( false, isCppHeader, std::vector<std::string>() );
+        std::string singleFileOutput = Generate( true, isCppHeader, typeMap );
+
+        // Verify
+        STRCMP_EQUAL( normalOutput.c_str(), singleFileOutput.c_str() );
+        for( const std::string &function : mockedFunctions )
+        {
+            STRCMP_CONTAINS( ( "\"" + function + "\"" ).c_str(), singleFileOutput.c_str() );
+        }
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the same C functions are mocked when parsing single files with the types declared in included files
+ * mapped to their definitions.
+ */
+TEST( Parser_SingleFile, C_TypeMap )
+{
+    // Prepare
+    SetupTempFile( includedFilename,
+                   "typedef unsigned int uint32_t;\n"
+                   "typedef struct Handle *handle_t;\n"
+                   "typedef void (*callback_t)(int);\n" );
+    SetupTempFile( inputFilename,
+                   "#include \"" + includedFilename + "\"\n"
+                   "uint32_t function1(const uint32_t *p);\n"
+                   "void function2(handle_t h, callback_t cb);\n"
+                   "callback_t function3(void);\n" );
+
+    // Exercise & Verify
+    CheckConformance( false,
+                      { "uint32_t=unsigned int", "handle_t=struct Handle *", "callback_t=void (*)(int)" },
+                      { "function1", "function2", "function3" } );
+}
+
+/*
+ * Check that the same C++ functions and methods are mocked when parsing single files with the types declared in
+ * included files mapped to their definitions.
+ */
+TEST( Parser_SingleFile, Cpp_TypeMap )
+{
+    // Prepare
+    SetupTempFile( includedFilename,
+                   "typedef unsigned long size_type;\n"
+                   "struct Buffer { int a; };\n"
+                   "typedef Buffer buffer_t;\n" );
+    SetupTempFile( inputFilename,
+                   "#include \"" + includedFilename + "\"\n"
+                   "class Class1 {\n"
+                   "public:\n"
+                   "    size_type method1(const buffer_t &b) const;\n"
+                   "    void method2(buffer_t *b, size_type n);\n"
+                   "};\n" );
+
+    // Exercise & Verify
+    CheckConformance( true,
+                      { "size_type=unsigned long", "buffer_t=struct Buffer" },
+                      { "Class1::method1", "Class1::method2" } );
+}
+
+/*
+ * Check that files included by the input file are neither read nor reported as dependencies when parsing single
+ * files, even if they do not exist.
+ */
+TEST( Parser_SingleFile, IncludedFilesIgnored )
+{
+    // Prepare
+    SetupTempFile( inputFilename,
+                   "#include \"" + includedFilename + "\"\n"
+                   "#include <non_existing_header.h>\n"
+                   "uint32_t function1(void);\n" );
+
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "uint32_t=unsigned int" } );
+    Parser parser( false, false, true );
+    std::ostringstream error;
+
+    // Exercise
+    bool result = parser.Parse( tempDirPath / inputFilename, config, false, std::vector<std::string>(),
+                                std::vector<std::string>(), error );
+
+    // Verify
+    CHECK_TRUE( result );
+    STRCMP_EQUAL( "", error.str().c_str() );
+    CHECK_EQUAL( 1, parser.GetDependencies().size() );
+    CHECK( std::filesystem::equivalent( tempDirPath / inputFilename, parser.GetDependencies()[0] ) );
+}
+
+/*
+ * Check that errors are reported at their location in the input file when parsing single files, and that types that
+ * are not mapped cause errors.
+ */
+TEST( Parser_SingleFile, UnmappedType )
+{
+    // Prepare
+    SetupTempFile( inputFilename,
+                   "#include \"" + includedFilename + "\"\n"
+                   "uint32_t function1(void);\n"
+                   "uint64_t function2(void);\n" );
+
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string> { "uint32_t=unsigned int" } );
+    Parser parser( false, false, true );
+    std::ostringstream error;
+
+    // Exercise
+    bool result = parser.Parse( tempDirPath / inputFilename, config, false, std::vector<std::string>(),
+                                std::vector<std::string>(), error );
+
+    // Verify
+    CHECK_FALSE( result );
+    STRCMP_CONTAINS( ( inputFilename + ":3:" ).c_str(), error.str().c_str() );
+    STRCMP_CONTAINS( "uint64_t", error.str().c_str() );
+}
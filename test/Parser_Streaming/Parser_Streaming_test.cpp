@@ -0,0 +1,172 @@
+/**
+ * @file
+ * @brief      Conformance tests for the "Parser" class when generating code in streaming mode
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "Parser.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string inputFilename = "CppUMockGen_Parser_Streaming.h";
+
+TEST_GROUP( Parser_Streaming )
+{
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove( tempDirPath / inputFilename );
+    }
+
+    void SetupTempFile( const std::string &contents )
+    {
+        std::ofstream tempFile( tempDirPath / inputFilename );
+        tempFile << contents;
+    }
+
+    std::string GetContents( unsigned int numFunctions )
+    {
+        std::string contents = "typedef struct { int a; } Struct1;\n";
+        for( unsigned int i = 0; i < numFunctions; i++ )
+        {
+            contents += "int function" + std::to_string( i ) + "(const Struct1 *s, unsigned long *p, const char *str);\n";
+        }
+        return contents;
+    }
+
+    std::string Generate( bool simpleCParse )
+    {
+        Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+        Parser parser( false, false, false, simpleCParse );
+        std::ostringstream error;
+
+        CHECK_TRUE( parser.Parse( tempDirPath / inputFilename, config, false, std::vector<std::string>(),
+                                  std::vector<std::string>(), error ) );
+        STRCMP_EQUAL( "", error.str().c_str() );
+
+        std::ostringstream output;
+        parser.GenerateMock( "", "", "", output );
+        parser.GenerateExpectationHeader( "", "", output );
+        parser.GenerateExpectationImpl( "", "expect.h", output );
+        return output.str();
+    }
+
+    bool GenerateStreaming( bool simpleCParse, std::string &output, unsigned int &numFlushes, std::ostream &error )
+    {
+        Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+        Parser parser( false, false, false, simpleCParse );
+        CodeEmitter mock;
+        CodeEmitter expectationHeader;
+        CodeEmitter expectationImpl;
+        std::string mockOutput;
+        std::string expectationHeaderOutput;
+        std::string expectationImplOutput;
+        numFlushes = 0;
+
+        parser.StartStreaming( "", "", "", "", "expect.h", { &mock, &expectationHeader, &expectationImpl },
+                               [&]( const Parser::Outputs &outputs )
+                               {
+                                   mockOutput += outputs.mock->GetBuffer();
+                                   expectationHeaderOutput += outputs.expectationHeader->GetBuffer();
+                                   expectationImplOutput += outputs.expectationImpl->GetBuffer();
+                                   outputs.mock->Clear();
+                                   outputs.expectationHeader->Clear();
+                                   outputs.expectationImpl->Clear();
+                                   numFlushes++;
+                               } );
+        bool result = parser.Parse( tempDirPath / inputFilename, config, false, std::vector<std::string>(),
+                                    std::vector<std::string>(), error );
+
+        output = mockOutput + expectationHeaderOutput + expectationImplOutput;
+        return result;
+    }
+
+    void CheckConformance( bool simpleCParse, unsigned int numFunctions, unsigned int minFlushes )
+    {
+        // Prepare
+        SetupTempFile( GetContents( numFunctions ) );
+
+        // Exercise
+        std::string normalOutput = Generate( simpleCParse );
+        std::string streamedOutput;
+        unsigned int numFlushes;
+        std::ostringstream error;
+        bool result = GenerateStreaming( simpleCParse, streamedOutput, numFlushes, error );
+
+        // Verify
+        CHECK_TRUE( result );
+        STRCMP_EQUAL( "", error.str().c_str() );
+        STRCMP_EQUAL( normalOutput.c_str(), streamedOutput.c_str() );
+        CHECK_TRUE( numFlushes >= minFlushes );
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the same code is generated in streaming mode for headers with few functions, flushed at once.
+ */
+TEST( Parser_Streaming, FewFunctions )
+{
+    // Exercise & Verify
+    CheckConformance( false, 10, 1 );
+}
+
+/*
+ * Check that the same code is generated in streaming mode for headers with many functions, flushed in chunks.
+ */
+TEST( Parser_Streaming, ManyFunctions )
+{
+    // Exercise & Verify
+    CheckConformance( false, 2000, 2 );
+}
+
+/*
+ * Check that the same code is generated in streaming mode for headers parsed without libclang.
+ */
+TEST( Parser_Streaming, SimpleC )
+{
+    // Exercise & Verify
+    CheckConformance( true, 100, 1 );
+}
+
+/*
+ * Check that the generated code is not flushed at the end in streaming mode when the header cannot be parsed, and that
+ * streaming mode only applies to one parse.
+ */
+TEST( Parser_Streaming, ParseError )
+{
+    // Prepare
+    SetupTempFile( "void function1(UnknownType a);\n" );
+
+    // Exercise
+    std::string streamedOutput;
+    unsigned int numFlushes;
+    std::ostringstream error;
+    bool result = GenerateStreaming( false, streamedOutput, numFlushes, error );
+
+    // Verify
+    CHECK_FALSE( result );
+    STRCMP_CONTAINS( "UnknownType", error.str().c_str() );
+    UNSIGNED_LONGS_EQUAL( 0, numFlushes );
+}
@@ -0,0 +1,241 @@
+/**
+ * @file
+ * @brief      Conformance tests for the "Parser" class when parsing input files in an umbrella translation unit
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+
+#include "Parser.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string inputFilename1 = "CppUMockGen_Parser_Umbrella1.h";
+static const std::string inputFilename2 = "CppUMockGen_Parser_Umbrella2.h";
+static const std::string inputFilename3 = "CppUMockGen_Parser_Umbrella3.hpp";
+static const std::string includedFilename = "CppUMockGen_Parser_Umbrella_types.h";
+
+TEST_GROUP( Parser_Umbrella )
+{
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove( tempDirPath / inputFilename1 );
+        std::filesystem::remove( tempDirPath / inputFilename2 );
+        std::filesystem::remove( tempDirPath / inputFilename3 );
+        std::filesystem::remove( tempDirPath / includedFilename );
+    }
+
+    void SetupTempFile( const std::string &filename, const std::string &contents )
+    {
+        std::ofstream tempFile( tempDirPath / filename );
+        tempFile << contents;
+    }
+
+    std::string Generate( Parser &parser, const std::string &filename, std::ostream &error,
+                          std::vector<std::filesystem::path> &dependencies )
+    {
+        Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+
+        bool isCppHeader = ( std::filesystem::path( filename ).extension() == ".hpp" );
+        CHECK_TRUE( parser.Parse( tempDirPath / filename, config, isCppHeader, std::vector<std::string>(),
+                                  std::vector<std::string>(), error ) );
+
+        std::ostringstream output;
+        parser.GenerateMock( "", "", "", output );
+        parser.GenerateExpectationHeader( "", "", output );
+        parser.GenerateExpectationImpl( "", "expect.h", output );
+        dependencies = parser.GetDependencies();
+        return output.str();
+    }
+
+    bool HasDependency( const std::vector<std::filesystem::path> &dependencies, const std::string &filename )
+    {
+        return std::any_of( dependencies.begin(), dependencies.end(),
+                            [&filename]( const std::filesystem::path &dependency )
+                            { return dependency.filename() == filename; } );
+    }
+
+    void CheckConformance( const std::vector<std::string> &filenames )
+    {
+        // Prepare
+        std::vector<std::filesystem::path> umbrellaFiles;
+        for( const std::string &filename : filenames )
+        {
+            umbrellaFiles.push_back( tempDirPath / filename );
+        }
+
+        Parser umbrellaParser;
+        umbrellaParser.SetUmbrellaFiles( umbrellaFiles );
+
+        for( const std::string &filename : filenames )
+        {
+            // Exercise
+            Parser normalParser;
+            std::ostringstream normalError;
+            std::ostringstream umbrellaError;
+            std::vector<std::filesystem::path> normalDependencies;
+            std::vector<std::filesystem::path> umbrellaDependencies;
+            std::string normalOutput = Generate( normalParser, filename, normalError, normalDependencies );
+            std::string umbrellaOutput = Generate( umbrellaParser, filename, umbrellaError, umbrellaDependencies );
+
+            // Verify
+            STRCMP_EQUAL( normalOutput.c_str(), umbrellaOutput.c_str() );
+            STRCMP_EQUAL( "", normalError.str().c_str() );
+            STRCMP_EQUAL( "", umbrellaError.str().c_str() );
+            for( const std::filesystem::path &dependency : normalDependencies )
+            {
+                CHECK_TEXT( HasDependency( umbrellaDependencies, dependency.filename().generic_string() ),
+                            dependency.generic_string().c_str() );
+            }
+        }
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the same functions are mocked when C headers that share an included file are parsed together.
+ */
+TEST( Parser_Umbrella, SharedInclude )
+{
+    // Prepare
+    SetupTempFile( includedFilename,
+                   "#ifndef TYPES_H\n"
+                   "#define TYPES_H\n"
+                   "typedef struct { int a; } Struct1;\n"
+                   "typedef unsigned int u32;\n"
+                   "void included1(void);\n"
+                   "#endif\n" );
+    SetupTempFile( inputFilename1,
+                   "#include \"" + includedFilename + "\"\n"
+                   "void function1(Struct1 *s);\n"
+                   "u32 function2(int a);\n" );
+    SetupTempFile( inputFilename2,
+                   "#include \"" + includedFilename + "\"\n"
+                   "static inline int function3(int a) { return a; }\n"
+                   "void function4(const Struct1 *s, u32 b);\n" );
+
+    // Exercise & Verify
+    CheckConformance( { inputFilename1, inputFilename2 } );
+}
+
+/*
+ * Check that functions are partitioned by file when an input file includes another one.
+ */
+TEST( Parser_Umbrella, IncludedInputFile )
+{
+    // Prepare
+    SetupTempFile( inputFilename1,
+                   "#ifndef INPUT1_H\n"
+                   "#define INPUT1_H\n"
+                   "void function1(int a);\n"
+                   "#endif\n" );
+    SetupTempFile( inputFilename2,
+                   "#include \"" + inputFilename1 + "\"\n"
+                   "void function2(int a);\n" );
+
+    // Exercise & Verify
+    CheckConformance( { inputFilename2, inputFilename1 } );
+}
+
+/*
+ * Check that C and C++ headers are parsed in different umbrella translation units.
+ */
+TEST( Parser_Umbrella, MixedLanguages )
+{
+    // Prepare
+    SetupTempFile( inputFilename1,
+                   "void function1(int a);\n" );
+    SetupTempFile( inputFilename2,
+                   "int function2(const char *s);\n" );
+    SetupTempFile( inputFilename3,
+                   "class Class1 {\n"
+                   "public:\n"
+                   "    void method1(int a);\n"
+                   "    int method2() const { return 0; }\n"
+                   "};\n" );
+
+    // Exercise & Verify
+    CheckConformance( { inputFilename1, inputFilename3, inputFilename2 } );
+}
+
+/*
+ * Check that the input files parsed in an umbrella translation unit depend on all the files read to parse it.
+ */
+TEST( Parser_Umbrella, Dependencies )
+{
+    // Prepare
+    SetupTempFile( inputFilename1,
+                   "void function1(int a);\n" );
+    SetupTempFile( inputFilename2,
+                   "void function2(int a);\n" );
+
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+    Parser parser;
+    parser.SetUmbrellaFiles( { tempDirPath / inputFilename1, tempDirPath / inputFilename2 } );
+    std::ostringstream error;
+
+    // Exercise
+    CHECK_TRUE( parser.Parse( tempDirPath / inputFilename2, config, false, std::vector<std::string>(),
+                              std::vector<std::string>(), error ) );
+
+    // Verify
+    STRCMP_EQUAL( "", error.str().c_str() );
+    CHECK_TRUE( HasDependency( parser.GetDependencies(), inputFilename1 ) );
+    CHECK_TRUE( HasDependency( parser.GetDependencies(), inputFilename2 ) );
+    CHECK_FALSE( HasDependency( parser.GetDependencies(), "CppUMockGen_umbrella.h" ) );
+}
+
+/*
+ * Check that input files are parsed individually when the umbrella translation unit has errors, so that errors are
+ * reported for the input file that contains them.
+ */
+TEST( Parser_Umbrella, Errors )
+{
+    // Prepare
+    SetupTempFile( inputFilename1,
+                   "void function1(int a);\n" );
+    SetupTempFile( inputFilename2,
+                   "void function2(UnknownType a);\n" );
+
+    Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+    Parser parser;
+    parser.SetUmbrellaFiles( { tempDirPath / inputFilename1, tempDirPath / inputFilename2 } );
+    std::ostringstream error1;
+    std::ostringstream error2;
+
+    // Exercise
+    bool result1 = parser.Parse( tempDirPath / inputFilename1, config, false, std::vector<std::string>(),
+                                 std::vector<std::string>(), error1 );
+    std::vector<std::filesystem::path> dependencies1 = parser.GetDependencies();
+    bool result2 = parser.Parse( tempDirPath / inputFilename2, config, false, std::vector<std::string>(),
+                                 std::vector<std::string>(), error2 );
+
+    // Verify
+    CHECK_TRUE( result1 );
+    STRCMP_EQUAL( "", error1.str().c_str() );
+    CHECK_FALSE( HasDependency( dependencies1, inputFilename2 ) );
+    CHECK_FALSE( result2 );
+    STRCMP_CONTAINS( inputFilename2.c_str(), error2.str().c_str() );
+    STRCMP_CONTAINS( "UnknownType", error2.str().c_str() );
+}
@@ -0,0 +1,389 @@
+/**
+ * @file
+ * @brief      Unit tests for the "Prelude" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <stdexcept>
+
+#include "Prelude.hpp"
+
+#include "Parser_expect.hpp"
+
+using CppUMockGen::IgnoreParameter;
+
+/*===========================================================================
+ *                      COMMON TEST DEFINES & MACROS
+ *===========================================================================*/
+
+class StdVectorOfStringsComparator : public MockNamedValueComparator
+{
+public:
+    bool isEqual(const void* object1, const void* object2)
+    {
+        const std::vector<std::string> *o1 = (const std::vector<std::string>*) object1;
+        const std::vector<std::string> *o2 = (const std::vector<std::string>*) object2;
+
+        return (*o1) == (*o2);
+    }
+
+    SimpleString valueToString(const void* object)
+    {
+        SimpleString ret;
+        const std::vector<std::string> *o = (const std::vector<std::string>*) object;
+        for( unsigned int i = 0; i < o->size(); i++ )
+        {
+            ret += StringFromFormat("<%u>%s\n", i, (*o)[i].c_str() );
+        }
+        return ret;
+    }
+};
+
+StdVectorOfStringsComparator stdVectorOfStringsComparator;
+
+class StdVectorOfPathsCopier : public MockNamedValueCopier
+{
+public:
+    virtual void copy(void* out, const void* in)
+    {
+        *(std::vector<std::filesystem::path>*)out = *(const std::vector<std::filesystem::path>*)in;
+    }
+};
+
+StdVectorOfPathsCopier stdVectorOfPathsCopier;
+
+class StdOstreamCopier : public MockNamedValueCopier
+{
+public:
+    virtual void copy(void* out, const void* in)
+    {
+        *(std::ostream*)out << *(const std::string*)in;
+    }
+};
+
+StdOstreamCopier stdOstreamCopier;
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path() / "CppUMockGen_Prelude_test";
+
+static Config* GetMockConfig()
+{
+    return (Config*) (void*) 836487567;
+}
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( Prelude )
+{
+    std::vector<std::string> includePaths = { "IncludePath1", "IncludePath2" };
+    std::vector<std::string> compileArgs = { "-DFOO" };
+    std::string noError;
+
+    TEST_SETUP()
+    {
+        mock().installComparator( "std::vector<std::string>", stdVectorOfStringsComparator );
+        mock().installCopier( "std::vector<std::filesystem::path>", stdVectorOfPathsCopier );
+        mock().installCopier( "std::ostream", stdOstreamCopier );
+
+        std::filesystem::remove_all( tempDirPath );
+        std::filesystem::create_directories( tempDirPath );
+    }
+
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove_all( tempDirPath );
+    }
+
+    void WriteFile( const std::filesystem::path &filePath, const std::string &contents )
+    {
+        std::ofstream file( filePath );
+        file << contents;
+    }
+
+    std::string ReadFile( const std::filesystem::path &filePath )
+    {
+        std::ifstream file( filePath );
+        std::stringstream contents;
+        contents << file.rdbuf();
+        return contents.str();
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that a prelude without headers is empty.
+ */
+TEST( Prelude, Empty )
+{
+    // Exercise
+    Prelude prelude( {} );
+
+    // Verify
+    CHECK_TRUE( prelude.IsEmpty() );
+    STRCMP_EQUAL( "", prelude.GetContents().c_str() );
+}
+
+/*
+ * Check that the explicit prelude headers are included using their absolute paths.
+ */
+TEST( Prelude, Headers )
+{
+    // Prepare
+    std::filesystem::path headerPath = tempDirPath / "sub" / ".." / "prelude1.h";
+    std::string expectedContents = "#include \"" + ( std::filesystem::current_path() / "foo.h" ).generic_string() + "\"\n"
+                                   "#include \"" + ( tempDirPath / "prelude1.h" ).generic_string() + "\"\n";
+
+    // Exercise
+    Prelude prelude( { "foo.h", headerPath.string() } );
+
+    // Verify
+    CHECK_FALSE( prelude.IsEmpty() );
+    STRCMP_EQUAL( expectedContents.c_str(), prelude.GetContents().c_str() );
+}
+
+/*
+ * Check that the system headers included at the beginning of all the input files are added to the prelude, skipping
+ * comments and include guards.
+ */
+TEST( Prelude, AddCommonIncludes )
+{
+    // Prepare
+    WriteFile( tempDirPath / "foo.h", "/*\n * Foo\n */\n#ifndef FOO_H\n#define FOO_H\n\n#include <string>\n"
+                                      "#include <vector> // Comment\n#include <map>\n\nvoid foo();\n#endif\n" );
+    WriteFile( tempDirPath / "bar.h", "#pragma once\n// Bar\n  #include <string>\n#include   <vector>\n#include <list>\n" );
+    WriteFile( tempDirPath / "baz.h", "/* Baz */ #include <string>\n#include <vector>\n" );
+
+    Prelude prelude( {} );
+
+    // Exercise
+    prelude.AddCommonIncludes( { tempDirPath / "foo.h", tempDirPath / "bar.h", tempDirPath / "baz.h" } );
+
+    // Verify
+    CHECK_FALSE( prelude.IsEmpty() );
+    STRCMP_EQUAL( "#include <string>\n#include <vector>\n", prelude.GetContents().c_str() );
+}
+
+/*
+ * Check that the scan of the beginning of the input files stops at the first directive that is not a system include,
+ * since it may change the meaning of the following includes.
+ */
+TEST( Prelude, AddCommonIncludes_StopsAtOtherDirectives )
+{
+    // Prepare
+    WriteFile( tempDirPath / "foo.h", "#include <string>\n#define _GNU_SOURCE\n#include <vector>\n" );
+    WriteFile( tempDirPath / "bar.h", "#include <string>\n#include \"local.h\"\n#include <vector>\n" );
+    WriteFile( tempDirPath / "baz.h", "#ifdef FOO\n#include <string>\n#endif\n" );
+
+    Prelude prelude1( {} );
+    Prelude prelude2( {} );
+    Prelude prelude3( {} );
+
+    // Exercise
+    prelude1.AddCommonIncludes( { tempDirPath / "foo.h" } );
+    prelude2.AddCommonIncludes( { tempDirPath / "bar.h" } );
+    prelude3.AddCommonIncludes( { tempDirPath / "baz.h" } );
+
+    // Verify
+    STRCMP_EQUAL( "#include <string>\n", prelude1.GetContents().c_str() );
+    STRCMP_EQUAL( "#include <string>\n", prelude2.GetContents().c_str() );
+    CHECK_TRUE( prelude3.IsEmpty() );
+}
+
+/*
+ * Check that common includes already in the prelude are not duplicated, and that input files with nothing in common
+ * do not add anything.
+ */
+TEST( Prelude, AddCommonIncludes_NothingNew )
+{
+    // Prepare
+    WriteFile( tempDirPath / "foo.h", "#include <string>\n#include <vector>\n" );
+    WriteFile( tempDirPath / "bar.h", "#include <vector>\n#include <string>\n" );
+
+    Prelude prelude1( {} );
+    Prelude prelude2( {} );
+    prelude2.AddCommonIncludes( { tempDirPath / "foo.h" } );
+
+    // Exercise
+    prelude1.AddCommonIncludes( { tempDirPath / "foo.h", tempDirPath / "bar.h" } );
+    prelude2.AddCommonIncludes( { tempDirPath / "foo.h" } );
+
+    // Verify
+    CHECK_TRUE( prelude1.IsEmpty() );
+    STRCMP_EQUAL( "#include <string>\n#include <vector>\n", prelude2.GetContents().c_str() );
+}
+
+/*
+ * Check that the prelude is precompiled once for each set of options, and that the temporary files are removed when
+ * the prelude is destroyed.
+ */
+TEST( Prelude, GetPrecompiledHeader )
+{
+    // Prepare
+    Parser parser;
+    const Config* config = GetMockConfig();
+    std::ostringstream error;
+    std::filesystem::path preludeHeaderPath = tempDirPath / "prelude.h";
+    std::vector<std::filesystem::path> dependencies1 = { preludeHeaderPath, "/usr/include/string" };
+    std::vector<std::filesystem::path> dependencies2 = { preludeHeaderPath };
+    std::vector<std::string> otherCompileArgs = { "-DBAR" };
+    std::filesystem::path pchDirPath;
+
+    {
+        Prelude prelude( { preludeHeaderPath.string() } );
+
+        expect::Parser$::BuildPrecompiledHeader( &parser, IgnoreParameter::YES, IgnoreParameter::YES, config, true, includePaths,
+                                                 compileArgs, dependencies1, &noError, true );
+        expect::Parser$::BuildPrecompiledHeader( &parser, IgnoreParameter::YES, IgnoreParameter::YES, config, false, includePaths,
+                                                 otherCompileArgs, dependencies2, &noError, true );
+
+        // Exercise
+        const Prelude::PrecompiledHeader &pch1 = prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error );
+        const Prelude::PrecompiledHeader &pch2 = prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error );
+        const Prelude::PrecompiledHeader &pch3 = prelude.GetPrecompiledHeader( parser, *config, false, includePaths, otherCompileArgs, error );
+
+        // Verify
+        mock().checkExpectations();
+        POINTERS_EQUAL( &pch1, &pch2 );
+        CHECK( pch1.filePath != pch3.filePath );
+        CHECK( pch1.filePath.parent_path() == pch3.filePath.parent_path() );
+        STRCMP_EQUAL( ( "#include \"" + preludeHeaderPath.generic_string() + "\"\n" ).c_str(),
+                      ReadFile( pch1.filePath.parent_path() / "prelude.h" ).c_str() );
+        CHECK( dependencies1 == pch1.dependencies );
+        CHECK( dependencies2 == pch3.dependencies );
+        STRCMP_EQUAL( "", error.str().c_str() );
+
+        pchDirPath = pch1.filePath.parent_path();
+        CHECK_TRUE( std::filesystem::exists( pchDirPath ) );
+    }
+
+    // Verify
+    CHECK_FALSE( std::filesystem::exists( pchDirPath ) );
+
+    // Cleanup
+    mock().clear();
+}
+
+/*
+ * Check that the temporary prelude file is not reported as a dependency of the precompiled header.
+ */
+TEST( Prelude, GetPrecompiledHeader_TemporaryFileNotDependency )
+{
+    // Prepare
+    Parser parser;
+    const Config* config = GetMockConfig();
+    std::ostringstream error;
+    std::vector<std::filesystem::path> dependencies = { "/usr/include/string" };
+
+    Prelude prelude( { "prelude.h" } );
+
+    expect::Parser$::BuildPrecompiledHeader( &parser, IgnoreParameter::YES, IgnoreParameter::YES, config, true, includePaths,
+                                             compileArgs, dependencies, &noError, true );
+
+    const Prelude::PrecompiledHeader &pch1 = prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error );
+    std::filesystem::path tempPreludeFilePath = pch1.filePath.parent_path() / "prelude.h";
+
+    // Exercise
+    std::vector<std::filesystem::path> dependencies2 = { tempPreludeFilePath, "/usr/include/string" };
+    expect::Parser$::BuildPrecompiledHeader( &parser, IgnoreParameter::YES, IgnoreParameter::YES, config, false, includePaths,
+                                             compileArgs, dependencies2, &noError, true );
+    const Prelude::PrecompiledHeader &pch2 = prelude.GetPrecompiledHeader( parser, *config, false, includePaths, compileArgs, error );
+
+    // Verify
+    mock().checkExpectations();
+    CHECK( dependencies == pch2.dependencies );
+
+    // Cleanup
+    mock().clear();
+}
+
+/*
+ * Check that if the prelude cannot be precompiled, an exception is thrown, and that it is not tried again.
+ */
+TEST( Prelude, GetPrecompiledHeader_Error )
+{
+    // Prepare
+    Parser parser;
+    const Config* config = GetMockConfig();
+    std::ostringstream error;
+    std::vector<std::filesystem::path> dependencies;
+    std::string errorText = "ERROR: Bad header";
+
+    Prelude prelude( { "prelude.h" } );
+
+    expect::Parser$::BuildPrecompiledHeader( &parser, IgnoreParameter::YES, IgnoreParameter::YES, config, true, includePaths,
+                                             compileArgs, dependencies, &errorText, false );
+
+    // Exercise & Verify
+    for( int i = 0; i < 2; i++ )
+    {
+        try
+        {
+            prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error );
+            FAIL( "Exception should have been thrown" );
+        }
+        catch( std::runtime_error &e )
+        {
+            STRCMP_EQUAL( "The prelude could not be precompiled.", e.what() );
+        }
+    }
+
+    // Verify
+    mock().checkExpectations();
+    STRCMP_EQUAL( errorText.c_str(), error.str().c_str() );
+
+    // Cleanup
+    mock().clear();
+}
+
+/*
+ * Check that precompiled headers are built again after any of their dependencies change.
+ */
+TEST( Prelude, Invalidate )
+{
+    // Prepare
+    Parser parser;
+    const Config* config = GetMockConfig();
+    std::ostringstream error;
+    std::filesystem::path preludeHeaderPath = tempDirPath / "prelude.h";
+    std::vector<std::filesystem::path> dependencies = { preludeHeaderPath };
+
+    Prelude prelude( { preludeHeaderPath.string() } );
+
+    expect::Parser$::BuildPrecompiledHeader( 2, &parser, IgnoreParameter::YES, IgnoreParameter::YES, config, true, includePaths,
+                                             compileArgs, dependencies, &noError, true );
+
+    std::filesystem::path pchFilePath1 = prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error ).filePath;
+
+    // Exercise
+    prelude.Invalidate( { tempDirPath / "other.h" } );
+    std::filesystem::path pchFilePath2 = prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error ).filePath;
+    prelude.Invalidate( { preludeHeaderPath } );
+    std::filesystem::path pchFilePath3 = prelude.GetPrecompiledHeader( parser, *config, true, includePaths, compileArgs, error ).filePath;
+
+    // Verify
+    mock().checkExpectations();
+    CHECK( pchFilePath1 == pchFilePath2 );
+    CHECK( pchFilePath1 != pchFilePath3 );
+
+    // Cleanup
+    mock().clear();
+}
@@ -0,0 +1,327 @@
+/**
+ * @file
+ * @brief      Unit and conformance tests for the "SimpleCParser" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "SimpleCParser.hpp"
+#include "Parser.hpp"
+#include "Config.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( SimpleCParser )
+{
+    const SimpleCParser::FunctionDecl& GetFunction( const SimpleCParser &parser, const std::string &name )
+    {
+        for( const SimpleCParser::FunctionDecl &function : parser.GetFunctions() )
+        {
+            if( function.name == name )
+            {
+                return function;
+            }
+        }
+
+        FAIL( ( "Function " + name + " not found" ).c_str() );
+        return parser.GetFunctions().front(); // LCOV_EXCL_LINE: Unreachable
+    }
+
+    void CheckUnsupported( const std::string &contents )
+    {
+        SimpleCParser parser;
+        CHECK_FALSE_TEXT( parser.Parse( contents ), contents.c_str() );
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that mockable functions are extracted in declaration order.
+ */
+TEST( SimpleCParser, Functions )
+{
+    // Prepare
+    SimpleCParser parser;
+
+    // Exercise
+    CHECK_TRUE( parser.Parse( "void function1(void);\n"
+                              "int function2(int a), function3(const char *s);\n"
+                              "static inline int function4(int a) { return a + 1; }\n"
+                              "void function5(int a);\n"
+                              "void function5(int a) { }\n"
+                              "void function1(void);\n"
+                              "int function6();\n" ) );
+
+    // Verify
+    const std::vector<SimpleCParser::FunctionDecl> &functions = parser.GetFunctions();
+    CHECK_EQUAL( 4, functions.size() );
+    STRCMP_EQUAL( "function1", functions[0].name.c_str() );
+    STRCMP_EQUAL( "function2", functions[1].name.c_str() );
+    STRCMP_EQUAL( "function3", functions[2].name.c_str() );
+    STRCMP_EQUAL( "function6", functions[3].name.c_str() );
+
+    CHECK_EQUAL( 0, functions[0].parameters.size() );
+    CHECK_EQUAL( CXType_Void, functions[0].returnType->GetKind() );
+    CHECK_EQUAL( 1, functions[1].parameters.size() );
+    STRCMP_EQUAL( "a", functions[1].parameters[0].name.c_str() );
+    STRCMP_EQUAL( "int", functions[1].parameters[0].type->GetSpelling().c_str() );
+    STRCMP_EQUAL( "s", functions[2].parameters[0].name.c_str() );
+    STRCMP_EQUAL( "const char *", functions[2].parameters[0].type->GetSpelling().c_str() );
+}
+
+/*
+ * Check that types are spelled and qualified like libclang does.
+ */
+TEST( SimpleCParser, TypeSpelling )
+{
+    // Prepare
+    SimpleCParser parser;
+
+    // Exercise
+    CHECK_TRUE( parser.Parse( "void function1(int *const a[2], const int *const b[], char *const *c, unsigned long int d);\n"
+                              "void function2(int (*const fp)(void), int (*(*x)(int))[3], void (*h)(), int e[0x10]);\n" ) );
+
+    // Verify
+    const SimpleCParser::FunctionDecl &function1 = GetFunction( parser, "function1" );
+    STRCMP_EQUAL( "int *const[2]", function1.parameters[0].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_ConstantArray, function1.parameters[0].type->GetKind() );
+    CHECK_TRUE( function1.parameters[0].type->GetElementType().IsConst() );
+    STRCMP_EQUAL( "const int *const[]", function1.parameters[1].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_IncompleteArray, function1.parameters[1].type->GetKind() );
+    STRCMP_EQUAL( "char *const *", function1.parameters[2].type->GetSpelling().c_str() );
+    CHECK_TRUE( function1.parameters[2].type->GetPointeeType().IsConst() );
+    STRCMP_EQUAL( "unsigned long", function1.parameters[3].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_ULong, function1.parameters[3].type->GetKind() );
+
+    const SimpleCParser::FunctionDecl &function2 = GetFunction( parser, "function2" );
+    STRCMP_EQUAL( "int (*const)(void)", function2.parameters[0].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_FunctionProto, function2.parameters[0].type->GetPointeeType().GetKind() );
+    STRCMP_EQUAL( "int (*(*)(int))[3]", function2.parameters[1].type->GetSpelling().c_str() );
+    STRCMP_EQUAL( "void (*)()", function2.parameters[2].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_FunctionNoProto, function2.parameters[2].type->GetPointeeType().GetKind() );
+    STRCMP_EQUAL( "int[16]", function2.parameters[3].type->GetSpelling().c_str() );
+}
+
+/*
+ * Check that typedefs and tagged types are resolved to their canonical types.
+ */
+TEST( SimpleCParser, CanonicalTypes )
+{
+    // Prepare
+    SimpleCParser parser;
+
+    // Exercise
+    CHECK_TRUE( parser.Parse( "#include <stdint.h>\n"
+                              "typedef struct { int a; } Anon_t;\n"
+                              "typedef const int cint;\n"
+                              "struct Struct1 { int a; };\n"
+                              "void function1(const Anon_t *a, cint b, struct Struct1 s, uint32_t c);\n" ) );
+
+    // Verify
+    const SimpleCParser::FunctionDecl &function1 = GetFunction( parser, "function1" );
+
+    const SimpleCParser::Type &pointee = function1.parameters[0].type->GetPointeeType();
+    CHECK_EQUAL( CXType_Elaborated, pointee.GetKind() );
+    CHECK_TRUE( pointee.IsConst() );
+    STRCMP_EQUAL( "const Anon_t", pointee.GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_Record, pointee.GetCanonicalType().GetKind() );
+    CHECK_TRUE( pointee.GetCanonicalType().IsConst() );
+    STRCMP_EQUAL( "const Anon_t", pointee.GetCanonicalType().GetSpelling().c_str() );
+
+    CHECK_EQUAL( CXType_Int, function1.parameters[1].type->GetCanonicalType().GetKind() );
+    CHECK_TRUE( function1.parameters[1].type->GetCanonicalType().IsConst() );
+
+    STRCMP_EQUAL( "struct Struct1", function1.parameters[2].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_Record, function1.parameters[2].type->GetNamedType().GetKind() );
+
+    STRCMP_EQUAL( "uint32_t", function1.parameters[3].type->GetSpelling().c_str() );
+    CHECK_EQUAL( CXType_UInt, function1.parameters[3].type->GetCanonicalType().GetKind() );
+    CHECK_EQUAL( 1, parser.GetIncludedHeaders().count( "stdint.h" ) );
+}
+
+/*
+ * Check that include guards and C++ linkage blocks are supported.
+ */
+TEST( SimpleCParser, Preprocessing )
+{
+    // Prepare
+    SimpleCParser parser;
+
+    // Exercise
+    CHECK_TRUE( parser.Parse( "#ifndef HEADER_H\n"
+                              "#define HEADER_H\n"
+                              "/* Comment */\n"
+                              "#ifdef __cplusplus\n"
+                              "extern \"C\" {\n"
+                              "#endif\n"
+                              "void function1(int a, // comment\n"
+                              "               int b);\n"
+                              "#if 0\n"
+                              "void function2(UNKNOWN a);\n"
+                              "#endif\n"
+                              "#ifdef __cplusplus\n"
+                              "}\n"
+                              "#endif\n"
+                              "#endif\n" ) );
+
+    // Verify
+    CHECK_EQUAL( 1, parser.GetFunctions().size() );
+    STRCMP_EQUAL( "function1", parser.GetFunctions()[0].name.c_str() );
+    CHECK_EQUAL( 2, parser.GetFunctions()[0].parameters.size() );
+}
+
+/*
+ * Check that parsing is abandoned when unsupported constructs are found.
+ */
+TEST( SimpleCParser, UnsupportedConstructs )
+{
+    // Exercise & Verify
+    CheckUnsupported( "#include \"header.h\"\nvoid function1(void);\n" );
+    CheckUnsupported( "#include <stdio.h>\nvoid function1(void);\n" );
+    CheckUnsupported( "#define SIZE 4\nvoid function1(int a[SIZE]);\n" );
+    CheckUnsupported( "#if defined(_WIN32) && _MSC_VER > 1000\nvoid function1(void);\n#endif\n" );
+    CheckUnsupported( "void function1(const char *format, ...);\n" );
+    CheckUnsupported( "void function1(UnknownType a);\n" );
+    CheckUnsupported( "void function1(struct Undeclared { int a; } *s);\n" );
+    CheckUnsupported( "void function1(int a) __attribute__((deprecated));\n" );
+    CheckUnsupported( "class Class1 { public: void method1(); };\n" );
+    CheckUnsupported( "extern int var1 = 0;\n" );
+}
+
+/*===========================================================================
+ *                    CONFORMANCE TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path();
+static const std::string inputFilename = "CppUMockGen_SimpleCParser.h";
+
+TEST_GROUP( SimpleCParser_Conformance )
+{
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove( tempDirPath / inputFilename );
+    }
+
+    void SetupTempFile( const std::string &contents )
+    {
+        std::ofstream tempFile( tempDirPath / inputFilename );
+        tempFile << contents;
+    }
+
+    std::string Generate( bool simpleCParse )
+    {
+        Config config( false, "", false, std::vector<std::string>(), std::vector<std::string>() );
+        Parser parser( false, false, false, simpleCParse );
+        std::ostringstream error;
+
+        CHECK_TRUE( parser.Parse( tempDirPath / inputFilename, config, false, std::vector<std::string>(),
+                                  std::vector<std::string>(), error ) );
+        STRCMP_EQUAL( "", error.str().c_str() );
+
+        std::ostringstream output;
+        parser.GenerateMock( "", "", "", output );
+        parser.GenerateExpectationHeader( "", "", output );
+        parser.GenerateExpectationImpl( "", "expect.h", output );
+        return output.str();
+    }
+
+    void CheckConformance( const std::string &contents )
+    {
+        // Prepare
+        SetupTempFile( contents );
+
+        // The header must be parseable without libclang, otherwise the conformance check would be pointless
+        SimpleCParser simpleCParser;
+        CHECK_TRUE( simpleCParser.Parse( contents ) );
+
+        // Exercise
+        std::string libclangOutput = Generate( false );
+        std::string simpleCOutput = Generate( true );
+
+        // Verify
+        STRCMP_EQUAL( libclangOutput.c_str(), simpleCOutput.c_str() );
+    }
+};
+
+/*===========================================================================
+ *                 CONFORMANCE TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that the same mocks and expectations are generated for functions with basic types.
+ */
+TEST( SimpleCParser_Conformance, BasicTypes )
+{
+    CheckConformance( "#include <stdint.h>\n"
+                      "void function1(float a, double b, unsigned short d, signed char e, char f);\n"
+                      "_Bool function2(unsigned a, signed b, long int c, unsigned long int d, short int e);\n"
+                      "int64_t function3(uint8_t *a, intptr_t b, uintmax_t c, const uint32_t d, int16_t e);\n"
+                      "const char *function4(const char *const s, char *buffer, unsigned long size);\n"
+                      "void function5(void);\n"
+                      "int function6();\n" );
+}
+
+/*
+ * Check that the same mocks and expectations are generated for functions with user-defined types.
+ */
+TEST( SimpleCParser_Conformance, UserTypes )
+{
+    CheckConformance( "#ifndef HEADER_H\n"
+                      "#define HEADER_H\n"
+                      "#ifdef __cplusplus\n"
+                      "extern \"C\" {\n"
+                      "#endif\n"
+                      "struct Struct1 { int x : 3; struct Struct2 { int y; } s2; union { int a; float b; }; int flex[]; };\n"
+                      "typedef struct { int a; } Anon_t;\n"
+                      "typedef enum { E0, E1 = 5, } Enum_t;\n"
+                      "enum Enum2 { X };\n"
+                      "union Union1 { int a; float b; };\n"
+                      "typedef int (*Callback_t)(int);\n"
+                      "typedef const int cint;\n"
+                      "typedef unsigned int u32;\n"
+                      "void function1(Anon_t a, Enum_t e, Callback_t cb, const Callback_t ccb, cint ci, const Anon_t *pa);\n"
+                      "void function2(struct Struct2 s2, struct Struct1 *s1, u32 *const pu);\n"
+                      "void function3(union Union1 u, const union Union1 *pu, enum Enum2 *pe, enum Enum2 ev);\n"
+                      "struct Struct1 function4(struct Struct1 *const p);\n"
+                      "const Anon_t *function5(const u32 *const *p);\n"
+                      "Enum_t function6(void);\n"
+                      "#ifdef __cplusplus\n"
+                      "}\n"
+                      "#endif\n"
+                      "#endif\n" );
+}
+
+/*
+ * Check that the same mocks and expectations are generated for functions with pointers, arrays and function pointers.
+ */
+TEST( SimpleCParser_Conformance, Declarators )
+{
+    CheckConformance( "void function1(int *const a, const int *const b, char *const *c, const int d[]);\n"
+                      "void function2(int (*const fp)(void), void (*h)(), int (*cmp)(const void *, const void *));\n"
+                      "void function3(const char * const s, int a[], const unsigned char b[]);\n"
+                      "void function4(int *a[], const char *const b[]);\n"
+                      "void function5(int (x), int (*)(int));\n"
+                      "int function6(int), function7(const char *);\n"
+                      "static inline int function8(int a) { return a + 1; }\n"
+                      "void function9(void);\n"
+                      "void function9(void) {}\n" );
+}
@@ -0,0 +1,407 @@
+/**
+ * @file
+ * @brief      Unit tests for the "StampCache" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <fstream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+#include "StampCache.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+static const std::filesystem::path tempDirPath = std::filesystem::temp_directory_path() / "CppUMockGen_StampCache_test";
+static const std::filesystem::path cacheDirPath = tempDirPath / "cache";
+static const std::filesystem::path inputFilePath = tempDirPath / "foo.h";
+static const std::filesystem::path includedFilePath = tempDirPath / "bar.h";
+static const std::filesystem::path mockFilePath = tempDirPath / "foo_mock.cpp";
+static const std::filesystem::path expectationFilePath = tempDirPath / "foo_expect.cpp";
+static const std::string signature = "CppUMockGen vX.Y\n-x\n";
+
+TEST_GROUP( StampCache )
+{
+    std::vector<std::filesystem::path> outputFilePaths;
+    std::vector<std::filesystem::path> dependencies;
+
+    TEST_SETUP()
+    {
+        std::filesystem::remove_all( tempDirPath );
+        std::filesystem::create_directories( tempDirPath );
+
+        WriteFile( inputFilePath, "#include \"bar.h\"\nvoid foo();\n" );
+        WriteFile( includedFilePath, "typedef int bar;\n" );
+        WriteFile( mockFilePath, "// Mock\n" );
+        WriteFile( expectationFilePath, "// Expectation\n" );
+
+        outputFilePaths = { mockFilePath, expectationFilePath };
+        dependencies = { inputFilePath, includedFilePath };
+    }
+
+    TEST_TEARDOWN()
+    {
+        std::filesystem::remove_all( tempDirPath );
+    }
+
+    void WriteFile( const std::filesystem::path &filePath, const std::string &contents )
+    {
+        std::ofstream file( filePath );
+        file << contents;
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that outputs that were never stamped are not up to date.
+ */
+TEST( StampCache, NotStamped )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+
+    // Exercise & Verify
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that stamped outputs are up to date, and that the cache directory is created if it does not exist.
+ */
+TEST( StampCache, Stamped )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+
+    // Exercise
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    // Verify
+    CHECK_TRUE( std::filesystem::is_directory( cacheDirPath ) );
+    CHECK_TRUE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+    CHECK_TRUE( StampCache( cacheDirPath ).IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that outputs are not up to date if the signature changes.
+ */
+TEST( StampCache, SignatureChanged )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    // Exercise & Verify
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature + "-u\n" ) );
+}
+
+/*
+ * Check that outputs are not up to date if the input file or an included file change.
+ */
+TEST( StampCache, DependencyChanged )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    // Exercise & Verify
+    WriteFile( includedFilePath, "typedef long bar;\n" );
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+
+    // Exercise & Verify
+    stampCache.Update( outputFilePaths, signature, dependencies );
+    WriteFile( inputFilePath, "void foo(int);\n" );
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that outputs are not up to date if a dependency changes keeping its size, once it was hashed by the same cache.
+ */
+TEST( StampCache, DependencyChanged_SameSize )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+    CHECK_TRUE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+
+    std::filesystem::file_time_type writeTime = std::filesystem::last_write_time( includedFilePath );
+
+    // Exercise
+    WriteFile( includedFilePath, "typedef int baz;\n" );
+    std::filesystem::last_write_time( includedFilePath, writeTime + std::chrono::seconds( 1 ) );
+
+    // Verify
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that outputs are not up to date if a dependency is deleted.
+ */
+TEST( StampCache, DependencyDeleted )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    // Exercise
+    std::filesystem::remove( includedFilePath );
+
+    // Verify
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that outputs are not up to date if an output file is modified or deleted.
+ */
+TEST( StampCache, OutputChanged )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    // Exercise & Verify
+    WriteFile( expectationFilePath, "// Modified\n" );
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+
+    // Exercise & Verify
+    stampCache.Update( outputFilePaths, signature, dependencies );
+    std::filesystem::remove( mockFilePath );
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that stamps are kept separately for each set of output files.
+ */
+TEST( StampCache, DifferentOutputs )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    std::vector<std::filesystem::path> otherOutputFilePaths = { mockFilePath };
+
+    // Exercise & Verify
+    CHECK_FALSE( stampCache.IsUpToDate( otherOutputFilePaths, signature ) );
+
+    // Exercise & Verify
+    stampCache.Update( otherOutputFilePaths, signature + "-u\n", dependencies );
+    CHECK_TRUE( stampCache.IsUpToDate( otherOutputFilePaths, signature + "-u\n" ) );
+    CHECK_TRUE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that outputs are not up to date if the stamp file is corrupted.
+ */
+TEST( StampCache, CorruptedStamp )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.Update( outputFilePaths, signature, dependencies );
+
+    // Exercise & Verify
+    for( const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator( cacheDirPath ) )
+    {
+        std::ifstream stampFile( entry.path() );
+        std::string header;
+        std::string signatureLine;
+        std::getline( stampFile, header );
+        std::getline( stampFile, signatureLine );
+        stampFile.close();
+
+        WriteFile( entry.path(), header + "\n" + signatureLine + "\nfoo\n" );
+    }
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+
+    // Exercise & Verify
+    for( const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator( cacheDirPath ) )
+    {
+        WriteFile( entry.path(), "Something else\n" );
+    }
+    CHECK_FALSE( stampCache.IsUpToDate( outputFilePaths, signature ) );
+}
+
+/*
+ * Check that an error is reported if an output file cannot be read when stamping.
+ */
+TEST( StampCache, OutputNotExisting )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    std::filesystem::remove( mockFilePath );
+
+    // Exercise & Verify
+    try
+    {
+        stampCache.Update( outputFilePaths, signature, dependencies );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_EQUAL( ( "Output file '" + mockFilePath.generic_string() + "' could not be read to be stamped." ).c_str(), e.what() );
+    }
+}
+
+/*
+ * Check that an error is reported if the stamp file cannot be written.
+ */
+TEST( StampCache, CannotWriteStamp )
+{
+    // Prepare
+    StampCache stampCache( mockFilePath );
+
+    // Exercise & Verify
+    try
+    {
+        stampCache.Update( outputFilePaths, signature, dependencies );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_CONTAINS( "could not be written.", e.what() );
+    }
+}
+
+/*
+ * Check that no model is got for an input file whose model was never stored.
+ */
+TEST( StampCache, Model_NotStored )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    std::string model;
+    std::vector<std::filesystem::path> modelDependencies;
+
+    // Exercise & Verify
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+}
+
+/*
+ * Check that a stored model is got back along with its dependencies.
+ */
+TEST( StampCache, Model_Stored )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    std::string storedModel = "CppUMockGen model\nmodel 3\n\n#####MODEL#####\n";
+    std::string model;
+    std::vector<std::filesystem::path> modelDependencies;
+
+    // Exercise
+    stampCache.StoreModel( inputFilePath, signature, dependencies, storedModel );
+
+    // Verify
+    CHECK_TRUE( StampCache( cacheDirPath ).GetModel( inputFilePath, signature, model, modelDependencies ) );
+    STRCMP_EQUAL( storedModel.c_str(), model.c_str() );
+    CHECK_EQUAL( 2, modelDependencies.size() );
+    STRCMP_EQUAL( inputFilePath.generic_string().c_str(), modelDependencies[0].generic_string().c_str() );
+    STRCMP_EQUAL( includedFilePath.generic_string().c_str(), modelDependencies[1].generic_string().c_str() );
+}
+
+/*
+ * Check that no model is got if the signature changes.
+ */
+TEST( StampCache, Model_SignatureChanged )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    stampCache.StoreModel( inputFilePath, signature, dependencies, "#####MODEL#####" );
+    std::string model;
+    std::vector<std::filesystem::path> modelDependencies;
+
+    // Exercise & Verify
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature + "-u\n", model, modelDependencies ) );
+}
+
+/*
+ * Check that no model is got if the input file or an included file change.
+ */
+TEST( StampCache, Model_DependencyChanged )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    std::string model;
+    std::vector<std::filesystem::path> modelDependencies;
+
+    // Exercise & Verify
+    stampCache.StoreModel( inputFilePath, signature, dependencies, "#####MODEL#####" );
+    WriteFile( includedFilePath, "typedef long bar;\n" );
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+
+    // Exercise & Verify
+    stampCache.StoreModel( inputFilePath, signature, { includedFilePath }, "#####MODEL#####" );
+    WriteFile( inputFilePath, "void foo(int);\n" );
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+}
+
+/*
+ * Check that no model is got if the model cache file is corrupted.
+ */
+TEST( StampCache, Model_Corrupted )
+{
+    // Prepare
+    StampCache stampCache( cacheDirPath );
+    std::string model;
+    std::vector<std::filesystem::path> modelDependencies;
+
+    stampCache.StoreModel( inputFilePath, signature, dependencies, "#####MODEL#####" );
+
+    std::filesystem::path modelFilePath = std::filesystem::directory_iterator( cacheDirPath )->path();
+    std::string contents;
+    {
+        std::ifstream modelFile( modelFilePath );
+        contents.assign( std::istreambuf_iterator<char>( modelFile ), std::istreambuf_iterator<char>() );
+    }
+
+    // Exercise & Verify
+    WriteFile( modelFilePath, contents.substr( 0, contents.size() - 5 ) );
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+
+    // Exercise & Verify
+    WriteFile( modelFilePath, contents.substr( 0, contents.find( "model " ) ) + "model foo\n#####MODEL#####" );
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+
+    // Exercise & Verify
+    WriteFile( modelFilePath, contents.substr( 0, contents.find( "model " ) ) );
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+
+    // Exercise & Verify
+    WriteFile( modelFilePath, "Something else\n" );
+    CHECK_FALSE( stampCache.GetModel( inputFilePath, signature, model, modelDependencies ) );
+}
+
+/*
+ * Check that an error is reported if the model cache file cannot be written.
+ */
+TEST( StampCache, Model_CannotWrite )
+{
+    // Prepare
+    StampCache stampCache( mockFilePath );
+
+    // Exercise & Verify
+    try
+    {
+        stampCache.StoreModel( inputFilePath, signature, dependencies, "#####MODEL#####" );
+        FAIL( "Exception should have been thrown" );
+    }
+    catch( std::runtime_error &e )
+    {
+        STRCMP_CONTAINS( "Model cache file '", e.what() );
+        STRCMP_CONTAINS( "could not be written.", e.what() );
+    }
+}
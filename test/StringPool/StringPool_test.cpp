@@ -0,0 +1,156 @@
+/**
+ * @file
+ * @brief      Unit tests for the "StringPool" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <memory>
+
+#include "StringPool.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( StringPool )
+{
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that equal strings are interned only once.
+ */
+TEST( StringPool, EqualStrings )
+{
+    // Prepare
+    StringPool pool;
+    std::string str1 = "const char *";
+    std::string str2 = "const char *";
+
+    // Exercise
+    std::shared_ptr<const std::string> interned1 = pool.Intern( str1 );
+    std::shared_ptr<const std::string> interned2 = pool.Intern( str2 );
+
+    // Verify
+    STRCMP_EQUAL( "const char *", interned1->c_str() );
+    POINTERS_EQUAL( interned1.get(), interned2.get() );
+    UNSIGNED_LONGS_EQUAL( 1, pool.GetSize() );
+}
+
+/*
+ * Check that different strings are interned separately.
+ */
+TEST( StringPool, DifferentStrings )
+{
+    // Prepare
+    StringPool pool;
+
+    // Exercise
+    std::shared_ptr<const std::string> interned1 = pool.Intern( "int" );
+    std::shared_ptr<const std::string> interned2 = pool.Intern( "unsigned int" );
+    std::shared_ptr<const std::string> interned3 = pool.Intern( "int" );
+
+    // Verify
+    STRCMP_EQUAL( "int", interned1->c_str() );
+    STRCMP_EQUAL( "unsigned int", interned2->c_str() );
+    CHECK( interned1.get() != interned2.get() );
+    POINTERS_EQUAL( interned1.get(), interned3.get() );
+    UNSIGNED_LONGS_EQUAL( 2, pool.GetSize() );
+}
+
+/*
+ * Check that many different strings are interned only once each.
+ */
+TEST( StringPool, ManyStrings )
+{
+    // Prepare
+    StringPool pool;
+    const unsigned int numStrings = 1000;
+    std::vector<std::shared_ptr<const std::string>> interned;
+
+    // Exercise
+    for( unsigned int i = 0; i < numStrings; i++ )
+    {
+        interned.push_back( pool.Intern( "type" + std::to_string( i ) ) );
+    }
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( numStrings, pool.GetSize() );
+    for( unsigned int i = 0; i < numStrings; i++ )
+    {
+        POINTERS_EQUAL( interned[i].get(), pool.Intern( "type" + std::to_string( i ) ).get() );
+    }
+    UNSIGNED_LONGS_EQUAL( numStrings, pool.GetSize() );
+}
+
+/*
+ * Check that interned strings remain valid after the pool is destroyed.
+ */
+TEST( StringPool, OutlivePool )
+{
+    // Prepare
+    std::shared_ptr<const std::string> interned;
+
+    // Exercise
+    {
+        StringPool pool;
+        interned = pool.Intern( "struct1" );
+    }
+
+    // Verify
+    STRCMP_EQUAL( "struct1", interned->c_str() );
+}
+
+/*
+ * Check that strings can be interned from several threads at the same time.
+ */
+TEST( StringPool, Threads )
+{
+    // Prepare
+    StringPool pool;
+    const unsigned int numThreads = 4;
+    const unsigned int numStrings = 100;
+    std::vector<std::vector<std::shared_ptr<const std::string>>> interned( numThreads );
+
+    // Exercise
+    std::vector<std::thread> threads;
+    for( unsigned int threadIndex = 0; threadIndex < numThreads; threadIndex++ )
+    {
+        threads.emplace_back( [&pool, &interned, threadIndex]()
+        {
+            for( unsigned int i = 0; i < numStrings; i++ )
+            {
+                interned[threadIndex].push_back( pool.Intern( "type" + std::to_string( i ) ) );
+            }
+        } );
+    }
+    for( std::thread &thread : threads )
+    {
+        thread.join();
+    }
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( numStrings, pool.GetSize() );
+    for( unsigned int threadIndex = 1; threadIndex < numThreads; threadIndex++ )
+    {
+        for( unsigned int i = 0; i < numStrings; i++ )
+        {
+            POINTERS_EQUAL( interned[0][i].get(), interned[threadIndex][i].get() );
+        }
+    }
+}
@@ -0,0 +1,287 @@
+/**
+ * @file
+ * @brief      Unit tests for the "TimeReport" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <string>
+
+#include "TimeReport.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( TimeReport )
+{
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that nothing is measured nor counted when there is no active report.
+ */
+TEST( TimeReport, NotActive )
+{
+    // Prepare
+    TimeReport report;
+
+    // Exercise
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::FUNCTION_PARSE );
+        TimeReport::Count( TimeReport::Counter::FUNCTIONS );
+    }
+
+    // Verify
+    POINTERS_EQUAL( nullptr, TimeReport::GetActive() );
+    UNSIGNED_LONGS_EQUAL( 0, report.GetCalls( TimeReport::Phase::FUNCTION_PARSE ) );
+    UNSIGNED_LONGS_EQUAL( 0, report.GetCount( TimeReport::Counter::FUNCTIONS ) );
+}
+
+/*
+ * Check that phases are measured and counters are incremented in the active report.
+ */
+TEST( TimeReport, Active )
+{
+    // Prepare
+    TimeReport report;
+    report.Activate();
+
+    // Exercise
+    for( int i = 0; i < 3; i++ )
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::GENERATION );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    TimeReport::Count( TimeReport::Counter::FUNCTIONS );
+    TimeReport::Count( TimeReport::Counter::ARGUMENTS, 5 );
+
+    // Verify
+    POINTERS_EQUAL( &report, TimeReport::GetActive() );
+    UNSIGNED_LONGS_EQUAL( 3, report.GetCalls( TimeReport::Phase::GENERATION ) );
+    CHECK_TRUE( report.GetWallTime( TimeReport::Phase::GENERATION ) >= 3000000 );
+    UNSIGNED_LONGS_EQUAL( 0, report.GetCalls( TimeReport::Phase::FILE_WRITE ) );
+    UNSIGNED_LONGS_EQUAL( 1, report.GetCount( TimeReport::Counter::FUNCTIONS ) );
+    UNSIGNED_LONGS_EQUAL( 5, report.GetCount( TimeReport::Counter::ARGUMENTS ) );
+    UNSIGNED_LONGS_EQUAL( 0, report.GetCount( TimeReport::Counter::OVERRIDES_HIT ) );
+
+    // Cleanup
+    report.Deactivate();
+    POINTERS_EQUAL( nullptr, TimeReport::GetActive() );
+}
+
+/*
+ * Check that phases can be measured in a report that is not active.
+ */
+TEST( TimeReport, ExplicitReport )
+{
+    // Prepare
+    TimeReport report;
+
+    // Exercise
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::OPTIONS, &report );
+    }
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 1, report.GetCalls( TimeReport::Phase::OPTIONS ) );
+}
+
+/*
+ * Check that deactivating or destroying a report that is not active does not deactivate the active report.
+ */
+TEST( TimeReport, DeactivateOther )
+{
+    // Prepare
+    TimeReport report;
+    report.Activate();
+
+    // Exercise
+    {
+        TimeReport otherReport;
+        otherReport.Deactivate();
+    }
+
+    // Verify
+    POINTERS_EQUAL( &report, TimeReport::GetActive() );
+
+    // Exercise
+    {
+        TimeReport otherReport;
+        otherReport.Activate();
+    }
+
+    // Verify
+    POINTERS_EQUAL( nullptr, TimeReport::GetActive() );
+}
+
+/*
+ * Check that phases measured and counters incremented in several threads are accumulated.
+ */
+TEST( TimeReport, MultipleThreads )
+{
+    // Prepare
+    TimeReport report;
+    report.Activate();
+
+    // Exercise
+    std::vector<std::thread> threads;
+    for( int i = 0; i < 4; i++ )
+    {
+        threads.emplace_back( []()
+        {
+            for( int j = 0; j < 1000; j++ )
+            {
+                TimeReport::Scope timeScope( TimeReport::Phase::FUNCTION_PARSE );
+                TimeReport::Count( TimeReport::Counter::OVERRIDE_LOOKUPS );
+            }
+        } );
+    }
+    for( std::thread &thread : threads )
+    {
+        thread.join();
+    }
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 4000, report.GetCalls( TimeReport::Phase::FUNCTION_PARSE ) );
+    UNSIGNED_LONGS_EQUAL( 4000, report.GetCount( TimeReport::Counter::OVERRIDE_LOOKUPS ) );
+
+    // Cleanup
+    report.Deactivate();
+}
+
+/*
+ * Check that the report is formatted as text.
+ */
+TEST( TimeReport, Format_Text )
+{
+    // Prepare
+    TimeReport report;
+    report.Add( TimeReport::Phase::TU_PARSE, 1500000, 1250000 );
+    report.Add( TimeReport::Phase::TU_PARSE, 500000, 250000 );
+    report.Activate();
+    TimeReport::Count( TimeReport::Counter::INPUT_FILES, 2 );
+    report.Deactivate();
+
+    // Exercise
+    std::string output = report.Format( TimeReport::OutputFormat::TEXT );
+
+    // Verify
+    STRCMP_CONTAINS( "Phase                                Calls     Wall (ms)      CPU (ms)\n", output.c_str() );
+    STRCMP_CONTAINS( "tu-parse                                 2         2.000         1.500\n", output.c_str() );
+    STRCMP_CONTAINS( "file-write                               0         0.000         0.000\n", output.c_str() );
+    STRCMP_CONTAINS( "\ntotal ", output.c_str() );
+    STRCMP_CONTAINS( "input-files                              2\n", output.c_str() );
+    STRCMP_CONTAINS( "overrides-hit                            0\n", output.c_str() );
+}
+
+/*
+ * Check that the report is formatted as JSON.
+ */
+TEST( TimeReport, Format_JSON )
+{
+    // Prepare
+    TimeReport report;
+    report.Add( TimeReport::Phase::TU_PARSE, 1500000, 1250000 );
+    report.Activate();
+    TimeReport::Count( TimeReport::Counter::FUNCTIONS, 7 );
+    report.Deactivate();
+
+    // Exercise
+    std::string output = report.Format( TimeReport::OutputFormat::JSON );
+
+    // Verify
+    STRCMP_CONTAINS( "{\n  \"wallTimeMs\": ", output.c_str() );
+    STRCMP_CONTAINS( "\n  \"cpuTimeMs\": ", output.c_str() );
+    STRCMP_CONTAINS( "  \"phases\": [\n    { \"name\": \"options\", \"calls\": 0, \"wallTimeMs\": 0.000, \"cpuTimeMs\": 0.000 },\n",
+                     output.c_str() );
+    STRCMP_CONTAINS( "    { \"name\": \"tu-parse\", \"calls\": 1, \"wallTimeMs\": 1.500, \"cpuTimeMs\": 1.250 },\n", output.c_str() );
+    STRCMP_CONTAINS( "    { \"name\": \"file-write\", \"calls\": 0, \"wallTimeMs\": 0.000, \"cpuTimeMs\": 0.000 }\n  ],\n",
+                     output.c_str() );
+    STRCMP_CONTAINS( "  \"counters\": {\n    \"input-files\": 0,\n    \"functions\": 7,\n", output.c_str() );
+    STRCMP_CONTAINS( "    \"overrides-hit\": 0\n  }\n}\n", output.c_str() );
+}
+
+/*
+ * Check that no trace events are recorded when tracing is not enabled.
+ */
+TEST( TimeReport, Trace_NotEnabled )
+{
+    // Prepare
+    TimeReport report;
+    report.Activate();
+
+    // Exercise
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::INPUT_FILE, "foo.h" );
+    }
+    std::string output = report.FormatTrace();
+
+    // Verify
+    UNSIGNED_LONGS_EQUAL( 1, report.GetCalls( TimeReport::Phase::INPUT_FILE ) );
+    STRCMP_EQUAL( "{\n"
+                  "  \"displayTimeUnit\": \"ms\",\n"
+                  "  \"traceEvents\": [\n"
+                  "    { \"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": { \"name\": \"CppUMockGen\" } }\n"
+                  "  ]\n"
+                  "}\n", output.c_str() );
+
+    // Cleanup
+    report.Deactivate();
+}
+
+/*
+ * Check that trace events are recorded for the phases measured in each thread when tracing is enabled.
+ */
+TEST( TimeReport, Trace_MultipleThreads )
+{
+    // Prepare
+    TimeReport report;
+    report.EnableTrace();
+    report.Activate();
+
+    // Exercise
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::TU_PARSE );
+    }
+    std::thread thread( []()
+    {
+        TimeReport::Scope timeScope( TimeReport::Phase::INPUT_FILE, "dir\\\"foo\".h" );
+        TimeReport::Scope innerTimeScope( TimeReport::Phase::GENERATION );
+    } );
+    thread.join();
+    std::string output = report.FormatTrace();
+
+    // Verify
+    CHECK_TRUE( report.IsTracing() );
+    STRCMP_CONTAINS( "{ \"name\": \"tu-parse\", \"cat\": \"tu-parse\", \"ph\": \"X\", \"ts\": ", output.c_str() );
+    STRCMP_CONTAINS( "{ \"name\": \"dir\\\\\\\"foo\\\".h\", \"cat\": \"input-file\", \"ph\": \"X\", \"ts\": ", output.c_str() );
+    STRCMP_CONTAINS( "{ \"name\": \"generation\", \"cat\": \"generation\", \"ph\": \"X\", \"ts\": ", output.c_str() );
+
+    // The phases of each thread are tagged with a different thread
+    size_t mainThreadPos = output.find( "\"name\": \"thread_name\"" );
+    size_t otherThreadPos = output.find( "\"name\": \"thread_name\"", mainThreadPos + 1 );
+    CHECK_TRUE( mainThreadPos != std::string::npos );
+    CHECK_TRUE( otherThreadPos != std::string::npos );
+    CHECK_TRUE( output.find( "\"name\": \"thread_name\"", otherThreadPos + 1 ) == std::string::npos );
+    std::string mainThreadId = output.substr( output.find( "\"tid\": ", mainThreadPos ), 10 );
+    std::string otherThreadId = output.substr( output.find( "\"tid\": ", otherThreadPos ), 10 );
+    CHECK_TRUE( mainThreadId != otherThreadId );
+
+    // Cleanup
+    report.Deactivate();
+}
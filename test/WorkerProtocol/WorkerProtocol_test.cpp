@@ -0,0 +1,141 @@
+/**
+ * @file
+ * @brief      Unit tests for the "WorkerProtocol" class
+ * @project    CppUMockGen
+ * @authors    Jesus Gonzalez <jgonzalez@gdr-sistemas.com>
+ * @copyright  Copyright (c) 2022 Jesus Gonzalez. All rights reserved.
+ * @license    See LICENSE.txt
+ */
+
+/*===========================================================================
+ *                              INCLUDES
+ *===========================================================================*/
+
+#include <CppUTest/TestHarness.h>
+#include <CppUTestExt/MockSupport.h>
+
+#include <vector>
+#include <string>
+#include <stdexcept>
+
+#include "WorkerProtocol.hpp"
+
+/*===========================================================================
+ *                          TEST GROUP DEFINITION
+ *===========================================================================*/
+
+TEST_GROUP( WorkerProtocol )
+{
+    void CheckMalformedRequest( const char *line, const char *expectedError )
+    {
+        try
+        {
+            WorkerProtocol::ParseRequest( line );
+            FAIL( "Exception should have been thrown" );
+        }
+        catch( std::runtime_error &e )
+        {
+            STRCMP_EQUAL( expectedError, e.what() );
+        }
+    }
+};
+
+/*===========================================================================
+ *                    TEST CASES IMPLEMENTATION
+ *===========================================================================*/
+
+/*
+ * Check that a request with arguments and request identifier is parsed properly.
+ */
+TEST( WorkerProtocol, ParseRequest_Basic )
+{
+    // Exercise
+    WorkerProtocol::Request request =
+            WorkerProtocol::ParseRequest( "{\"arguments\": [\"-m\", \"mocks/\", \"foo.h\"], \"requestId\": 12}" );
+
+    // Verify
+    std::vector<std::string> expectedArguments = { "-m", "mocks/", "foo.h" };
+    CHECK( expectedArguments == request.arguments );
+    LONGS_EQUAL( 12, request.requestId );
+}
+
+/*
+ * Check that an empty request is parsed properly.
+ */
+TEST( WorkerProtocol, ParseRequest_Empty )
+{
+    // Exercise
+    WorkerProtocol::Request request = WorkerProtocol::ParseRequest( " { } " );
+
+    // Verify
+    CHECK_TRUE( request.arguments.empty() );
+    LONGS_EQUAL( 0, request.requestId );
+}
+
+/*
+ * Check that escape sequences in strings are decoded properly.
+ */
+TEST( WorkerProtocol, ParseRequest_EscapeSequences )
+{
+    // Exercise
+    WorkerProtocol::Request request = WorkerProtocol::ParseRequest(
+            "{\"arguments\":[\"a\\\"b\\\\c\\/d\",\"\\b\\f\\n\\r\\t\",\"\\u0041\\u00e9\\u20AC\\ud83d\\ude00\"],\"requestId\":-3}" );
+
+    // Verify
+    std::vector<std::string> expectedArguments = { "a\"b\\c/d", "\b\f\n\r\t", "A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" };
+    CHECK( expectedArguments == request.arguments );
+    LONGS_EQUAL( -3, request.requestId );
+}
+
+/*
+ * Check that unknown fields are ignored.
+ */
+TEST( WorkerProtocol, ParseRequest_UnknownFields )
+{
+    // Exercise
+    WorkerProtocol::Request request = WorkerProtocol::ParseRequest(
+            "{\"inputs\": [{\"path\": \"foo.h\", \"digest\": \"abc\"}, {}], \"arguments\": [\"foo.h\"], "
+            "\"verbosity\": 10, \"cancel\": false, \"sandboxDir\": null, \"other\": {\"a\": [1, 2.5e3]}, \"requestId\": 5}" );
+
+    // Verify
+    std::vector<std::string> expectedArguments = { "foo.h" };
+    CHECK( expectedArguments == request.arguments );
+    LONGS_EQUAL( 5, request.requestId );
+}
+
+/*
+ * Check that malformed requests are reported.
+ */
+TEST( WorkerProtocol, ParseRequest_Malformed )
+{
+    CheckMalformedRequest( "", "Unexpected end of request." );
+    CheckMalformedRequest( "[]", "'{' expected at position 1 of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"foo.h\"]", "Unexpected end of request." );
+    CheckMalformedRequest( "{\"arguments\" [\"foo.h\"]}", "':' expected at position 14 of request." );
+    CheckMalformedRequest( "{\"arguments\": \"foo.h\"}", "'[' expected at position 15 of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"foo.h}", "Unexpected end of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"\\x\"]}", "Invalid escape sequence at position 19 of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"\\u00g0\"]}", "Invalid unicode escape sequence at position 22 of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"\\ud800\"]}", "Unpaired surrogate in unicode escape sequence at position 23 of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"\\ud800\\u0041\"]}", "Unpaired surrogate in unicode escape sequence at position 29 of request." );
+    CheckMalformedRequest( "{\"arguments\": [\"\\ude00\\ud83d\"]}", "Unpaired surrogate in unicode escape sequence at position 23 of request." );
+    CheckMalformedRequest( "{\"requestId\": \"1\"}", "Integer expected at position 15 of request." );
+    CheckMalformedRequest( "{\"other\": }", "Value expected at position 11 of request." );
+    CheckMalformedRequest( "{} {}", "Unexpected characters at position 4 of request." );
+}
+
+/*
+ * Check that responses are formatted properly.
+ */
+TEST( WorkerProtocol, FormatResponse )
+{
+    // Prepare
+    WorkerProtocol::Response response = { 1, "ERROR: \"foo.h\" C:\\dir\n\tmore\r\x01", 42 };
+
+    // Exercise
+    std::string line = WorkerProtocol::FormatResponse( response );
+
+    // Verify
+    STRCMP_EQUAL( "{\"exitCode\": 1, \"output\": \"ERROR: \\\"foo.h\\\" C:\\\\dir\\n\\tmore\\r\\u0001\", \"requestId\": 42}",
+                  line.c_str() );
+}